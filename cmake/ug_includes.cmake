@@ -193,6 +193,7 @@ option(USE_LUAJIT "Use LUA just in time compiler" OFF)
 option(USE_AUTODIFF "Use Autodiff" OFF)
 option(USE_PYBIND11 "Use PYBIND11" OFF)
 option(USE_JSON "Use JSON" OFF)
+option(USE_ZLIB "Use zlib for compressed output" OFF)
 option(USE_XEUS "Use XEUS" OFF)
 
 ################################################################################
@@ -279,6 +280,7 @@ message(STATUS "")
 message(STATUS "Info: External libraries (path which contains the library or ON if you used uginstall):")
 message(STATUS "Info: HLIBPRO:           ${HLIBPRO}")
 message(STATUS "Info: USE_JSON:          ${USE_JSON} (options are: ON, OFF)")
+message(STATUS "Info: USE_ZLIB:          ${USE_ZLIB} (options are: ON, OFF)")
 message(STATUS "Info: USE_XEUS:          ${USE_XEUS} (options are: ON, OFF)")
 message(STATUS "Info: USE_PYBIND11:      ${USE_PYBIND11} (options are: ON, OFF)")
 message(STATUS "Info: USE_AUTODIFF:      ${USE_AUTODIFF} (options are: ON, OFF)")
@@ -438,6 +440,8 @@ include(${UG_ROOT_CMAKE_PATH}/ug/lua2c.cmake)
 include(${UG_ROOT_CMAKE_PATH}/ug/luajit.cmake)
 # JSON
 include(${UG_ROOT_CMAKE_PATH}/ug/json.cmake)
+# ZLIB
+include(${UG_ROOT_CMAKE_PATH}/ug/zlib.cmake)
 # Pybind11
 include(${UG_ROOT_CMAKE_PATH}/ug/pybind11.cmake)
 # Autodiff
@@ -505,6 +509,9 @@ if(UNIX)
 	endif(NOT STATIC_BUILD)
 # for cekon pthread bug
 #    set(linkLibraries ${linkLibraries} pthread)
+# std::thread (e.g. used for asynchronous output)
+	find_package(Threads)
+	set(linkLibraries ${linkLibraries} ${CMAKE_THREAD_LIBS_INIT})
 elseif(WIN32)
 	set(linkLibraries ${linkLibraries} Kernel32)
 endif(UNIX)
@@ -0,0 +1,71 @@
+#include "common/util/trace.h"
+#include "lib_algebra/cpu_algebra_types.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/operator/convergence_check.h"
+#include "lib_algebra/operator/linear_solver/bicgstab.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+
+#include <iostream>
+
+// BiCGStab with fused reductions must need as many iterations as the
+// standard variant (the recurrences only change round-off)
+
+typedef ug::CPUAlgebra::matrix_type M;
+typedef ug::CPUAlgebra::vector_type V;
+
+// 5-point stencil on an n x n grid (dirichlet boundary eliminated)
+void laplace(M& A, int n)
+{
+	A.resize_and_clear(n*n, n*n);
+	for(int i=0; i<n; ++i)
+		for(int j=0; j<n; ++j){
+			const int k = i*n+j;
+			A(k,k) = 4.;
+			if(i>0) A(k,k-n) = -1.;
+			if(i<n-1) A(k,k+n) = -1.;
+			if(j>0) A(k,k-1) = -1.;
+			if(j<n-1) A(k,k+1) = -1.;
+		}
+	A.defragment();
+}
+
+int solve(SmartPtr<ug::MatrixOperator<M, V> > spA, bool bFused)
+{
+	const size_t N = spA->num_rows();
+	V x(N), b(N);
+	for(size_t i=0; i<N; ++i){
+		x[i] = 0.;
+		b[i] = 1.;
+	}
+
+	SmartPtr<ug::StdConvCheck<V> > spConv
+		= make_sp(new ug::StdConvCheck<V>(1000, 1e-30, 1e-10, false));
+
+	ug::BiCGStab<V> solver;
+	solver.set_convergence_check(spConv);
+	solver.set_fused_reductions(bFused);
+	solver.init(spA);
+	if(!solver.apply_return_defect(x, b)){ untested();
+		return -1;
+	}
+	return spConv->step();
+}
+
+int main()
+{
+	SmartPtr<ug::MatrixOperator<M, V> > spA
+		= make_sp(new ug::MatrixOperator<M, V>);
+	laplace(spA->get_matrix(), 40);
+
+	const int numStd = solve(spA, false);
+	const int numFused = solve(spA, true);
+
+	std::cout << "standard: " << numStd << " iterations\n";
+	std::cout << "fused: " << numFused << " iterations\n";
+}
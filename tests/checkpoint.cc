@@ -0,0 +1,324 @@
+#include "lib_grid/multi_grid.h"
+#include "lib_grid/subset_handler.h"
+#include "lib_algebra/cpu_algebra_types.h"
+#include "lib_disc/domain.h"
+#include "lib_disc/function_spaces/approximation_space.h"
+#include "lib_disc/function_spaces/grid_function.h"
+#include "lib_disc/io/checkpoint.h"
+
+#include "common/log.cpp" // ?
+#include "lib_disc/io/checkpoint.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/util/binary_buffer.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/message_hub.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/variant.cpp" // ?
+#include "lib_algebra/algebra_type.cpp" // ?
+#include "lib_disc/dof_manager/dof_distribution.cpp" // ?
+#include "lib_disc/function_spaces/adaption_surface_grid_function.cpp" // ?
+#include "lib_disc/function_spaces/approximation_space.cpp" // ?
+#include "lib_grid/algorithms/debug_util.cpp" // ?
+#include "lib_grid/algorithms/serialization.cpp" // ?
+#include "lib_grid/file_io/file_io_lgb.cpp" // ?
+#include "lib_grid/grid/grid.cpp" // ?
+#include "lib_grid/grid/grid_base_objects.cpp" // ?
+#include "lib_grid/grid/grid_connection_managment.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_2d.cpp" // ?
+#include "lib_grid/lib_grid_messages.cpp" // ?
+#include "lib_grid/multi_grid.cpp" // ?
+#include "lib_grid/refinement/projectors/projection_handler.cpp" // ?
+#include "lib_grid/tools/subset_handler_multi_grid.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "lib_disc/dof_manager/dof_count.cpp" // ?
+#include "lib_disc/dof_manager/dof_distribution_info.cpp" // ?
+#include "lib_disc/dof_manager/dof_index_storage.cpp" // ?
+#include "lib_disc/dof_manager/function_pattern.cpp" // ?
+#include "lib_disc/dof_manager/orientation.cpp" // ?
+#include "lib_disc/local_finite_element/local_finite_element_id.cpp" // ?
+#include "lib_disc/spatial_disc/disc_util/geom_cache.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/edge_util.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/face_util.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/vertex_util.cpp" // ?
+#include "lib_grid/algorithms/subset_dim_util.cpp" // ?
+#include "lib_grid/algorithms/subset_util.cpp" // ?
+#include "lib_grid/grid/grid_util.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_3d.cpp" // ?
+#include "lib_grid/refinement/projectors/elliptic_cylinder_projector.cpp" // ?
+#include "lib_grid/refinement/projectors/neurite_projector.cpp" // ?
+#include "lib_grid/tools/periodic_boundary_manager.cpp" // ?
+#include "lib_grid/tools/selector_grid.cpp" // ?
+#include "lib_grid/tools/selector_multi_grid.cpp" // ?
+#include "lib_grid/tools/subset_group.cpp" // ?
+#include "lib_grid/tools/subset_handler_grid.cpp" // ?
+#include "lib_grid/tools/subset_handler_interface.cpp" // ?
+#include "lib_grid/tools/surface_view.cpp" // ?
+#include "common/error.cpp" // ?
+#include "common/util/file_util.cpp" // ?
+#include "lib_disc/common/function_group.cpp" // ?
+#include "lib_grid/algorithms/field_util.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/misc_util.cpp" // ?
+#include "lib_grid/algorithms/orientation_util.cpp" // ?
+#include "lib_grid/algorithms/polychain_util.cpp" // ?
+#include "lib_grid/algorithms/subset_color_util.cpp" // ?
+#include "lib_grid/grid/neighborhood.cpp" // ?
+#include "lib_grid/grid_objects/rule_util.cpp" // ?
+#include "lib_grid/refinement/regular_refinement.cpp" // ?
+#include "lib_grid/tools/selector_interface.cpp" // ?
+#include "common/util/os_dependent_impl/file_util_posix.cpp" // ?
+#include "lib_grid/algorithms/element_side_util.cpp" // ?
+#include "lib_grid/grid_objects/pyramid_rules.cpp" // ?
+#include "lib_grid/grid_objects/tetrahedron_rules.cpp" // ?
+#include "lib_grid/grid/grid_adjacency_snapshot.cpp" // ?
+#include "lib_grid/grid/grid_object_collection.cpp" // ?
+#include "lib_disc/reference_element/reference_element.cpp" // ?
+#include "common/allocators/slab_allocator.cpp" // ?
+#include "lib_grid/common_attachments.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_1d.cpp" // ?
+#include "common/math/math_vector_matrix/math_vector.cpp" // ?
+#include "lib_grid/tools/grid_level.cpp" // ?
+#include "lib_disc/local_finite_element/local_finite_element_provider.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrange.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrange_local_dof.cpp" // ?
+#include "lib_disc/local_finite_element/local_dof_set.cpp" // ?
+#include "common/math/misc/math_util.cpp" // ?
+#include "common/math/misc/eigenvalues.cpp" // ?
+#include "common/math/misc/lineintersect_utils.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrangep1.cpp" // ?
+#include "lib_disc/local_finite_element/mini/mini.cpp" // ?
+#include "lib_disc/reference_element/reference_mapping_provider.cpp" // ?
+#include "lib_disc/function_spaces/local_transfer_interface.cpp" // ?
+#include "lib_grid/refinement/projectors/smooth_projector.cpp" // ?
+#include "lib_grid/refinement/projectors/subdivision_projector.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/volume_util.cpp" // ?
+#include "common/util/os_dependent_impl/os_info_linux.cpp" // ?
+#include "lib_grid/algorithms/heightfield_util.cpp" // ?
+#include "lib_grid/file_io/file_io_asc.cpp" // ?
+#include "lib_grid/algorithms/raster_layer_util.cpp" // ?
+#include "lib_grid/parallelization/parallel_grid_layout.cpp" // ?
+#include "lib_grid/grid_objects/hexahedron_rules.cpp" // ?
+#include "lib_grid/grid_objects/prism_rules.cpp" // ?
+#include "lib_grid/grid_objects/octahedron_rules.cpp" // ?
+#include "lib_disc/function_spaces/dof_position_util.cpp" // ?
+#include "lib_grid/algorithms/subdivision/subdivision_rules_piecewise_loop.cpp" // ?
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cstdio>
+
+// a checkpoint read into an empty domain must give the same multigrid, the
+// same ordering of the algebra indices and the same grid function values as
+// the domain it was written from.
+
+using namespace ug;
+
+typedef GridFunction<Domain2d, CPUAlgebra> TGridFunction;
+
+static unsigned rnd_state = 1;
+unsigned rnd(unsigned n)
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) % n;
+}
+
+// n x n cells, every second one split into two triangles. the faces are in
+// subsets "left" and "right", the boundary in "bnd". level 1 is a copy of
+// level 0, in which every element has one child of its own type.
+void create_grid(Domain2d& dom, int n)
+{
+	MultiGrid& mg = *dom.grid();
+	MGSubsetHandler& sh = *dom.subset_handler();
+	Domain2d::position_accessor_type& aaPos = dom.position_accessor();
+
+	std::vector<Vertex*> vVrt((n+1)*(n+1));
+	for(size_t i = 0; i < vVrt.size(); ++i){
+		vVrt[i] = *mg.create<RegularVertex>();
+		aaPos[vVrt[i]] = MathVector<2>((number)(i % (n+1)) / n, (number)(i / (n+1)) / n);
+	}
+
+	for(int j = 0; j < n; ++j)
+		for(int i = 0; i < n; ++i){
+			Vertex* v0 = vVrt[j*(n+1)+i];
+			Vertex* v1 = vVrt[j*(n+1)+i+1];
+			Vertex* v2 = vVrt[(j+1)*(n+1)+i+1];
+			Vertex* v3 = vVrt[(j+1)*(n+1)+i];
+			const int si = (i < n/2) ? 0 : 1;
+			if((i+j) % 2){
+				sh.assign_subset(*mg.create<Quadrilateral>(QuadrilateralDescriptor(v0, v1, v2, v3)), si);
+			}
+			else{
+				sh.assign_subset(*mg.create<Triangle>(TriangleDescriptor(v0, v1, v2)), si);
+				sh.assign_subset(*mg.create<Triangle>(TriangleDescriptor(v0, v2, v3)), si);
+			}
+		}
+
+//	sides get the subset of an adjacent face or the boundary subset
+	Grid::face_traits::secure_container faces;
+	for(EdgeIterator iter = mg.begin<Edge>(); iter != mg.end<Edge>(); ++iter){
+		mg.associated_elements(faces, *iter);
+		sh.assign_subset(*iter, (faces.size() == 1) ? 2 : sh.get_subset_index(faces[0]));
+	}
+	Grid::edge_traits::secure_container edges;
+	for(VertexIterator iter = mg.begin<Vertex>(); iter != mg.end<Vertex>(); ++iter){
+		mg.associated_elements(edges, *iter);
+		int si = sh.get_subset_index(edges[0]);
+		for(size_t i = 0; i < edges.size(); ++i)
+			if(sh.get_subset_index(edges[i]) == 2) si = 2;
+		sh.assign_subset(*iter, si);
+	}
+
+	sh.subset_info(0).name = "left";
+	sh.subset_info(1).name = "right";
+	sh.subset_info(2).name = "bnd";
+	sh.subset_info(0).set_property("dim", 2);
+	sh.subset_info(1).set_property("dim", 2);
+	sh.subset_info(2).set_property("dim", 1);
+
+	std::map<Vertex*, Vertex*> child;
+	for(size_t i = 0; i < vVrt.size(); ++i){
+		Vertex* c = child[vVrt[i]] = *mg.create<RegularVertex>(vVrt[i]);
+		aaPos[c] = aaPos[vVrt[i]];
+		sh.assign_subset(c, sh.get_subset_index(vVrt[i]));
+	}
+	std::vector<Edge*> vEdge(mg.begin<Edge>(0), mg.end<Edge>(0));
+	for(size_t i = 0; i < vEdge.size(); ++i){
+		Edge* e = vEdge[i];
+		sh.assign_subset(*mg.create<RegularEdge>(EdgeDescriptor(child[e->vertex(0)],
+							child[e->vertex(1)]), e), sh.get_subset_index(e));
+	}
+	std::vector<Face*> vFace(mg.begin<Face>(0), mg.end<Face>(0));
+	for(size_t i = 0; i < vFace.size(); ++i){
+		Face* f = vFace[i];
+		Face* c;
+		if(f->num_vertices() == 3)
+			c = *mg.create<Triangle>(TriangleDescriptor(child[f->vertex(0)],
+							child[f->vertex(1)], child[f->vertex(2)]), f);
+		else
+			c = *mg.create<Quadrilateral>(QuadrilateralDescriptor(child[f->vertex(0)],
+							child[f->vertex(1)], child[f->vertex(2)], child[f->vertex(3)]), f);
+		sh.assign_subset(c, sh.get_subset_index(f));
+	}
+}
+
+SmartPtr<ApproximationSpace<Domain2d> > create_space(SmartPtr<Domain2d> spDom)
+{
+	SmartPtr<ApproximationSpace<Domain2d> > spApprox =
+		make_sp(new ApproximationSpace<Domain2d>(spDom, AlgebraType(AlgebraType::CPU, 1)));
+	spApprox->add("u", "Lagrange", 1);
+	spApprox->add("p", "Lagrange", 2, "left, bnd");
+	spApprox->init_surfaces();
+	return spApprox;
+}
+
+// returns the number of elements of the given type that differ in level,
+// subset, corner positions or parent type
+template <typename TElem>
+size_t compare_grid(Domain2d& dom1, Domain2d& dom2)
+{
+	MultiGrid& mg1 = *dom1.grid(); MultiGrid& mg2 = *dom2.grid();
+	if(mg1.num<TElem>() != mg2.num<TElem>() || mg1.num_levels() != mg2.num_levels())
+		return 1 + mg1.num<TElem>();
+
+	size_t numWrong = 0;
+	for(size_t lev = 0; lev < mg1.num_levels(); ++lev){
+		if(mg1.num<TElem>(lev) != mg2.num<TElem>(lev)) {++numWrong; continue;}
+		typedef typename MultiGrid::traits<TElem>::iterator iterator;
+		iterator iter2 = mg2.begin<TElem>(lev);
+		for(iterator iter1 = mg1.begin<TElem>(lev); iter1 != mg1.end<TElem>(lev); ++iter1, ++iter2){
+			TElem* e1 = *iter1; TElem* e2 = *iter2;
+			bool bWrong = dom1.subset_handler()->get_subset_index(e1)
+						!= dom2.subset_handler()->get_subset_index(e2);
+
+			for(size_t i = 0; i < NumVertices(e1); ++i)
+				if(dom1.position_accessor()[GetVertex(e1, i)] != dom2.position_accessor()[GetVertex(e2, i)])
+					bWrong = true;
+
+			GridObject* p1 = mg1.get_parent(e1); GridObject* p2 = mg2.get_parent(e2);
+			if((p1 == NULL) != (p2 == NULL)
+				|| (p1 && p1->base_object_id() != p2->base_object_id()))
+				bWrong = true;
+
+			if(bWrong) ++numWrong;
+		}
+	}
+	return numWrong;
+}
+
+// returns the number of elements of the given type with other algebra indices
+template <typename TElem>
+size_t compare_indices(Domain2d& dom1, const DoFDistribution& dd1,
+                       Domain2d& dom2, const DoFDistribution& dd2)
+{
+	typedef typename DoFDistribution::traits<TElem>::const_iterator iterator;
+	size_t numWrong = 0;
+	std::vector<size_t> vInd1, vInd2;
+	iterator iter2 = dd2.begin<TElem>();
+	for(iterator iter1 = dd1.begin<TElem>(); iter1 != dd1.end<TElem>(); ++iter1, ++iter2){
+		if(iter2 == dd2.end<TElem>()) return numWrong + 1;
+		dd1.inner_algebra_indices(*iter1, vInd1);
+		dd2.inner_algebra_indices(*iter2, vInd2);
+		if(vInd1 != vInd2
+			|| dom1.position_accessor()[GetVertex(*iter1, 0)]
+				!= dom2.position_accessor()[GetVertex(*iter2, 0)])
+			++numWrong;
+	}
+	return numWrong;
+}
+
+int main()
+{
+	const char* filename = "checkpoint_test.ugcp";
+
+	SmartPtr<Domain2d> spDom1 = make_sp(new Domain2d());
+	create_grid(*spDom1, 6);
+	SmartPtr<ApproximationSpace<Domain2d> > spApprox1 = create_space(spDom1);
+	SmartPtr<TGridFunction> spU1 = make_sp(new TGridFunction(spApprox1));
+
+//	an index ordering, which the new approximation space won't have
+	SmartPtr<DoFDistribution> dd1 = spU1->dd();
+	std::vector<size_t> vNew(dd1->num_indices());
+	for(size_t i = 0; i < vNew.size(); ++i) vNew[i] = i;
+	for(size_t i = vNew.size() - 1; i > 0; --i) std::swap(vNew[i], vNew[rnd(i+1)]);
+	dd1->permute_indices(vNew);
+
+	for(size_t i = 0; i < spU1->size(); ++i) (*spU1)[i] = rnd(1000) / 1000.;
+
+	DomainCheckpoint<Domain2d, CPUAlgebra> cpWrite(spDom1);
+	cpWrite.add(spU1, "u");
+	cpWrite.set_time(1.5);
+	cpWrite.write(filename);
+
+	SmartPtr<Domain2d> spDom2 = make_sp(new Domain2d());
+	DomainCheckpoint<Domain2d, CPUAlgebra> cpRead(spDom2);
+	cpRead.read_domain(filename);
+
+	SmartPtr<ApproximationSpace<Domain2d> > spApprox2 = create_space(spDom2);
+	SmartPtr<TGridFunction> spU2 = make_sp(new TGridFunction(spApprox2));
+	SmartPtr<DoFDistribution> dd2 = spU2->dd();
+
+	std::cout << "levels: " << spDom2->grid()->num_levels() << "\n";
+	std::cout << "subsets: " << spDom2->subset_handler()->num_subsets() << " "
+			<< spDom2->subset_handler()->subset_info(2).name << "\n";
+
+	std::cout << "vertices: " << compare_grid<Vertex>(*spDom1, *spDom2) << " wrong\n";
+	std::cout << "edges: " << compare_grid<Edge>(*spDom1, *spDom2) << " wrong\n";
+	std::cout << "faces: " << compare_grid<Face>(*spDom1, *spDom2) << " wrong\n";
+	std::cout << "ordering differs before restart: "
+			<< (compare_indices<Vertex>(*spDom1, *dd1, *spDom2, *dd2) > 0 ? "yes" : "no") << "\n";
+
+	cpRead.add(spU2, "u");
+	cpRead.read_grid_functions();
+	std::cout << "time: " << cpRead.time() << "\n";
+
+	std::cout << "vertex indices: " << compare_indices<Vertex>(*spDom1, *dd1, *spDom2, *dd2) << " wrong\n";
+	std::cout << "edge indices: " << compare_indices<Edge>(*spDom1, *dd1, *spDom2, *dd2) << " wrong\n";
+
+	size_t numWrong = (spU2->size() == spU1->size()) ? 0 : 1;
+	for(size_t i = 0; i < spU1->size() && i < spU2->size(); ++i)
+		if((*spU1)[i] != (*spU2)[i]) ++numWrong;
+	std::cout << "values: " << numWrong << " wrong\n";
+
+	std::remove(filename);
+}
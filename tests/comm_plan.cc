@@ -0,0 +1,134 @@
+#define UG_PARALLEL
+
+#include "common/util/trace.h"
+#include "lib_algebra/cpu_algebra/vector.h"
+#include "lib_algebra/parallelization/parallelization_util.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "common/util/binary_buffer.cpp" // ?
+#include "common/util/file_util.cpp" // ?
+#include "common/util/os_dependent_impl/file_util_posix.cpp" // ?
+#include "common/util/os_dependent_impl/os_info_linux.cpp" // ?
+#include "pcl/pcl_base.cpp" // ?
+#include "pcl/pcl_util.cpp" // ?
+#include "pcl/pcl_comm_world.cpp" // ?
+#include "pcl/pcl_process_communicator.cpp" // ?
+
+#include <iostream>
+
+// the storage type conversions with communication plans must give the same
+// values as with the InterfaceCommunicator, also if the plan is reused
+// and after the layouts changed.
+// the interfaces form a ring, masters of rank p are slaves on rank p+1.
+// with one process, all messages are sent to the process itself.
+
+typedef ug::Vector<double> V;
+
+static unsigned rnd_state = 1;
+double rnd()
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) / 32768.;
+}
+
+// the first k indices are masters for the next process, the last k
+// indices are slaves of the previous one
+void make_layouts(ug::HorizontalAlgebraLayouts& layouts, size_t n, size_t k)
+{
+	int rank, size;
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+	layouts.clear();
+	ug::IndexLayout::Interface& master = layouts.master().interface((rank+1) % size);
+	ug::IndexLayout::Interface& slave = layouts.slave().interface((rank+size-1) % size);
+	for(size_t i=0; i<k; ++i){
+		master.push_back(i);
+		slave.push_back(n-k+i);
+	}
+}
+
+// returns the number of entries that differ
+size_t compare(size_t n, size_t k, int numRepeat)
+{
+	ug::HorizontalAlgebraLayouts plan, com;
+	make_layouts(plan, n, k);
+	make_layouts(com, n, k);
+	plan.enable_communication_plans(true);
+
+	size_t numWrong = 0;
+	for(int r=0; r<numRepeat; ++r){
+		V x(n), y(n);
+		for(size_t i=0; i<n; ++i) x[i] = y[i] = rnd();
+
+		switch(r % 3){
+			case 0:
+				ug::AdditiveToConsistent(&x, plan);
+				ug::AdditiveToConsistent(&y, com);
+				break;
+			case 1:
+				ug::UniqueToConsistent(&x, plan);
+				ug::UniqueToConsistent(&y, com);
+				break;
+			case 2:
+				ug::AdditiveToUnique(&x, plan);
+				ug::AdditiveToUnique(&y, com);
+				break;
+		}
+
+		for(size_t i=0; i<n; ++i)
+			if(x[i] != y[i]) ++numWrong;
+	}
+	return numWrong;
+}
+
+int main(int argc, char* argv[])
+{
+	MPI_Init(&argc, &argv);
+	{
+		std::cout << "reuse: " << compare(100, 10, 30) << " wrong\n";
+
+		ug::HorizontalAlgebraLayouts layouts;
+		make_layouts(layouts, 100, 10);
+		std::cout << "disabled by default: " << !layouts.communication_plans_enabled() << "\n";
+		layouts.enable_communication_plans(true);
+		V x(100);
+		for(size_t i=0; i<x.size(); ++i) x[i] = 1.;
+		ug::AdditiveToConsistent(&x, layouts);
+		std::cout << "set up: " << layouts.slave_to_master_plan().is_set_up() << "\n";
+
+	//	the plans have to be rebuilt if the interfaces change
+		make_layouts(layouts, 100, 20);
+		for(size_t i=0; i<x.size(); ++i) x[i] = 1.;
+		ug::AdditiveToConsistent(&x, layouts);
+		size_t numWrong = 0;
+		for(size_t i=0; i<x.size(); ++i){
+			const bool bInterface = i < 20 || i >= 80;
+			if(x[i] != (bInterface ? 2. : 1.)) ++numWrong;
+		}
+		std::cout << "resized: " << numWrong << " wrong\n";
+
+		layouts.enable_communication_plans(false);
+		std::cout << "released: " << !layouts.slave_to_master_plan().is_set_up() << "\n";
+
+		std::cout << "empty: " << compare(100, 0, 3) << " wrong\n";
+
+	//	a plan destroyed during an exchange must not throw, the following
+	//	exchanges are not disturbed
+		make_layouts(layouts, 100, 10);
+		try{
+			pcl::InterfaceCommunicationPlan<ug::IndexLayout> pending(4711);
+			ug::ComPol_VecAdd<V> cpAdd(&x);
+			pending.start(layouts.slave(), layouts.master(), cpAdd);
+			throw 1;
+		}
+		catch(int){}
+		std::cout << "destroyed while pending: " << compare(100, 10, 3) << " wrong\n";
+	}
+	MPI_Finalize();
+}
@@ -0,0 +1,205 @@
+#include "lib_grid/multi_grid.h"
+#include "lib_grid/subset_handler.h"
+#include "lib_disc/function_spaces/approximation_space.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "lib_disc/function_spaces/approximation_space.cpp" // ?
+#include "lib_disc/dof_manager/dof_distribution.cpp" // ?
+#include "common/util/message_hub.cpp" // ?
+#include "common/util/variant.cpp" // ?
+#include "lib_algebra/algebra_type.cpp" // ?
+#include "lib_disc/dof_manager/dof_count.cpp" // ?
+#include "lib_disc/dof_manager/dof_distribution_info.cpp" // ?
+#include "lib_disc/dof_manager/dof_index_storage.cpp" // ?
+#include "lib_disc/dof_manager/function_pattern.cpp" // ?
+#include "lib_disc/dof_manager/orientation.cpp" // ?
+#include "lib_disc/local_finite_element/local_finite_element_id.cpp" // ?
+#include "lib_disc/spatial_disc/disc_util/geom_cache.cpp" // ?
+#include "lib_grid/algorithms/debug_util.cpp" // ?
+#include "lib_grid/algorithms/subset_dim_util.cpp" // ?
+#include "lib_grid/grid/grid.cpp" // ?
+#include "lib_grid/grid/grid_base_objects.cpp" // ?
+#include "lib_grid/grid/grid_connection_managment.cpp" // ?
+#include "lib_grid/grid/grid_util.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_2d.cpp" // ?
+#include "lib_grid/lib_grid_messages.cpp" // ?
+#include "lib_grid/multi_grid.cpp" // ?
+#include "lib_grid/tools/subset_group.cpp" // ?
+#include "lib_grid/tools/subset_handler_multi_grid.cpp" // ?
+#include "lib_grid/tools/surface_view.cpp" // ?
+#include "common/error.cpp" // ?
+#include "lib_disc/common/function_group.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/vertex_util.cpp" // ?
+#include "lib_grid/tools/periodic_boundary_manager.cpp" // ?
+#include "lib_grid/tools/subset_handler_grid.cpp" // ?
+#include "lib_grid/tools/subset_handler_interface.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/edge_util.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/face_util.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/misc_util.cpp" // ?
+#include "lib_grid/grid_objects/pyramid_rules.cpp" // ?
+#include "lib_grid/grid/neighborhood.cpp" // ?
+#include "lib_grid/grid_objects/tetrahedron_rules.cpp" // ?
+#include "lib_grid/refinement/regular_refinement.cpp" // ?
+#include "lib_grid/grid/grid_adjacency_snapshot.cpp" // ?
+#include "lib_grid/grid/grid_object_collection.cpp" // ?
+#include "lib_disc/reference_element/reference_element.cpp" // ?
+#include "common/allocators/slab_allocator.cpp" // ?
+#include "lib_grid/common_attachments.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_1d.cpp" // ?
+#include "common/math/math_vector_matrix/math_vector.cpp" // ?
+#include "lib_grid/tools/grid_level.cpp" // ?
+#include "lib_disc/local_finite_element/local_finite_element_provider.cpp" // ?
+#include "lib_grid/grid_objects/rule_util.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrange.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrange_local_dof.cpp" // ?
+#include "lib_disc/local_finite_element/local_dof_set.cpp" // ?
+#include "common/math/misc/math_util.cpp" // ?
+#include "common/math/misc/eigenvalues.cpp" // ?
+#include "common/math/misc/lineintersect_utils.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrangep1.cpp" // ?
+#include "lib_disc/local_finite_element/mini/mini.cpp" // ?
+#include "lib_disc/reference_element/reference_mapping_provider.cpp" // ?
+
+#include <iostream>
+#include <vector>
+
+// the element index cache of a DoFDistribution has to return the same local
+// indices as the walk over the sub-elements, also after the indices have
+// been permuted and after the cache has been dropped.
+
+using namespace ug;
+
+static unsigned rnd_state = 1;
+unsigned rnd(unsigned n)
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) % n;
+}
+
+// writes the local indices of all elements of type TElem in a flat vector
+template <typename TElem>
+void collect(std::vector<size_t>& v, const DoFDistribution& dd, bool bHang)
+{
+	LocalIndices ind;
+	typedef typename DoFDistribution::traits<TElem>::const_iterator iter_type;
+	for(iter_type iter = dd.begin<TElem>(); iter != dd.end<TElem>(); ++iter){
+		dd.indices(*iter, ind, bHang);
+		v.push_back(ind.num_fct());
+		for(size_t fct = 0; fct < ind.num_fct(); ++fct){
+			v.push_back(ind.num_dof(fct));
+			for(size_t dof = 0; dof < ind.num_dof(fct); ++dof){
+				v.push_back(ind.index(fct, dof));
+				v.push_back(ind.comp(fct, dof));
+			}
+		}
+	}
+}
+
+std::vector<size_t> collect(const DoFDistribution& dd)
+{
+	std::vector<size_t> v;
+	for(int bHang = 0; bHang < 2; ++bHang){
+		collect<Vertex>(v, dd, bHang);
+		collect<Edge>(v, dd, bHang);
+		collect<Face>(v, dd, bHang);
+	}
+	return v;
+}
+
+// n x n cells, every second one split into two triangles. the faces are in
+// subsets "left" and "right", the boundary in "bnd".
+void create_grid(MultiGrid& mg, MGSubsetHandler& sh, int n)
+{
+	std::vector<Vertex*> vVrt((n+1)*(n+1));
+	for(size_t i = 0; i < vVrt.size(); ++i)
+		vVrt[i] = *mg.create<RegularVertex>();
+
+	for(int j = 0; j < n; ++j)
+		for(int i = 0; i < n; ++i){
+			Vertex* v0 = vVrt[j*(n+1)+i];
+			Vertex* v1 = vVrt[j*(n+1)+i+1];
+			Vertex* v2 = vVrt[(j+1)*(n+1)+i+1];
+			Vertex* v3 = vVrt[(j+1)*(n+1)+i];
+			const int si = (i < n/2) ? 0 : 1;
+			if((i+j) % 2){
+				sh.assign_subset(*mg.create<Quadrilateral>(QuadrilateralDescriptor(v0, v1, v2, v3)), si);
+			}
+			else{
+				sh.assign_subset(*mg.create<Triangle>(TriangleDescriptor(v0, v1, v2)), si);
+				sh.assign_subset(*mg.create<Triangle>(TriangleDescriptor(v0, v2, v3)), si);
+			}
+		}
+
+//	sides get the subset of an adjacent face or the boundary subset
+	Grid::face_traits::secure_container faces;
+	for(EdgeIterator iter = mg.begin<Edge>(); iter != mg.end<Edge>(); ++iter){
+		mg.associated_elements(faces, *iter);
+		sh.assign_subset(*iter, (faces.size() == 1) ? 2 : sh.get_subset_index(faces[0]));
+	}
+	Grid::edge_traits::secure_container edges;
+	for(VertexIterator iter = mg.begin<Vertex>(); iter != mg.end<Vertex>(); ++iter){
+		mg.associated_elements(edges, *iter);
+		int si = sh.get_subset_index(edges[0]);
+		for(size_t i = 0; i < edges.size(); ++i)
+			if(sh.get_subset_index(edges[i]) == 2) si = 2;
+		sh.assign_subset(*iter, si);
+	}
+
+	sh.subset_info(0).name = "left";
+	sh.subset_info(1).name = "right";
+	sh.subset_info(2).name = "bnd";
+	sh.subset_info(0).set_property("dim", 2);
+	sh.subset_info(1).set_property("dim", 2);
+	sh.subset_info(2).set_property("dim", 1);
+}
+
+int main()
+{
+	SmartPtr<MultiGrid> spMG = make_sp(new MultiGrid);
+	spMG->set_options(GRIDOPT_STANDARD_INTERCONNECTION);
+	SmartPtr<MGSubsetHandler> spSH = make_sp(new MGSubsetHandler(*spMG));
+	create_grid(*spMG, *spSH, 6);
+
+	IApproximationSpace approx(spSH, spMG);
+	approx.add("u", "Lagrange", 1);
+	approx.add("p", "Lagrange", 2, "left, bnd");
+	approx.add("v", "Lagrange", 3);
+	approx.init_levels();
+	approx.init_surfaces();
+
+	std::vector<SmartPtr<DoFDistribution> > vDD = approx.dof_distributions();
+	std::cout << "dof distributions: " << vDD.size() << "\n";
+	for(size_t d = 0; d < vDD.size(); ++d){
+		DoFDistribution& dd = *vDD[d];
+		const std::vector<size_t> vRef = collect(dd);
+
+		dd.enable_index_cache(true);
+		std::cout << "cached: " << (collect(dd) == vRef ? "ok" : "wrong") << "\n";
+
+	//	random permutation of the indices
+		std::vector<size_t> vNew(dd.num_indices());
+		for(size_t i = 0; i < vNew.size(); ++i) vNew[i] = i;
+		for(size_t i = vNew.size() - 1; i > 0; --i) std::swap(vNew[i], vNew[rnd(i+1)]);
+		dd.permute_indices(vNew);
+		const std::vector<size_t> vPermCached = collect(dd);
+
+		dd.enable_index_cache(false);
+		const std::vector<size_t> vPerm = collect(dd);
+		std::cout << "permuted: " << ((vPermCached == vPerm && vPerm != vRef) ? "ok" : "wrong") << "\n";
+
+	//	permute back
+		std::vector<size_t> vInv(vNew.size());
+		for(size_t i = 0; i < vNew.size(); ++i) vInv[vNew[i]] = i;
+		dd.enable_index_cache(true);
+		dd.permute_indices(vInv);
+		std::cout << "permuted back: " << (collect(dd) == vRef ? "ok" : "wrong") << "\n";
+
+		dd.clear_index_cache();
+		std::cout << "dropped: " << (collect(dd) == vRef ? "ok" : "wrong") << "\n";
+	}
+}
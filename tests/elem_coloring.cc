@@ -0,0 +1,88 @@
+#include "lib_disc/spatial_disc/elem_disc/elem_coloring.h"
+
+#include <iostream>
+#include <vector>
+#include <set>
+
+// the quadrilaterals of an n x n grid are colored by their vertex indices:
+// every element must get exactly one color, elements of one color must not
+// share an index and the element order within a color must be kept.
+
+struct Quad {size_t i, j;};
+
+struct QuadIndices
+{
+	size_t n;
+	size_t numCalls;
+	void operator()(Quad* q, std::vector<size_t>& vInd)
+	{
+		++numCalls;
+		vInd.clear();
+		vInd.push_back(q->j * (n+1) + q->i);
+		vInd.push_back(q->j * (n+1) + q->i + 1);
+		vInd.push_back((q->j+1) * (n+1) + q->i + 1);
+		vInd.push_back((q->j+1) * (n+1) + q->i);
+	}
+};
+
+// returns the number of violations
+size_t check(std::vector<Quad*>& vElem, const std::vector<Quad*>& vOrig,
+             const std::vector<size_t>& vColorStart, QuadIndices& getIndices)
+{
+	size_t numWrong = 0;
+	if(vElem.size() != vOrig.size()) ++numWrong;
+	if(vColorStart.back() != vElem.size()) ++numWrong;
+
+	std::set<Quad*> sElem(vElem.begin(), vElem.end());
+	if(sElem.size() != vOrig.size()) ++numWrong;
+
+	std::vector<size_t> vInd;
+	for(size_t c = 0; c + 1 < vColorStart.size(); ++c)
+	{
+		std::set<size_t> sUsed;
+		for(size_t e = vColorStart[c]; e < vColorStart[c+1]; ++e)
+		{
+			getIndices(vElem[e], vInd);
+			for(size_t k = 0; k < vInd.size(); ++k)
+				if(!sUsed.insert(vInd[k]).second) ++numWrong;
+
+		//	elements of the original list keep their order
+			if(e > vColorStart[c] && vElem[e-1] > vElem[e]) ++numWrong;
+		}
+	}
+	return numWrong;
+}
+
+int main()
+{
+	const size_t n = 20;
+	std::vector<Quad> vQuad(n*n);
+	std::vector<Quad*> vOrig;
+	for(size_t j = 0; j < n; ++j)
+		for(size_t i = 0; i < n; ++i)
+		{
+			vQuad[j*n+i].i = i; vQuad[j*n+i].j = j;
+			vOrig.push_back(&vQuad[j*n+i]);
+		}
+
+	QuadIndices getIndices; getIndices.n = n; getIndices.numCalls = 0;
+
+	std::vector<Quad*> vElem(vOrig);
+	std::vector<size_t> vColorStart;
+	const size_t numColors = ug::ColorElementsByIndices(vElem, vColorStart, (n+1)*(n+1), getIndices);
+	std::cout << "colors: " << numColors << "\n";
+	std::cout << "indices computed once: " << (getIndices.numCalls == n*n ? "yes" : "no") << "\n";
+	std::cout << "grid: " << check(vElem, vOrig, vColorStart, getIndices) << " wrong\n";
+
+//	every other element only
+	std::vector<Quad*> vHalf;
+	for(size_t e = 0; e < vOrig.size(); e += 2) vHalf.push_back(vOrig[e]);
+	vElem = vHalf;
+	ug::ColorElementsByIndices(vElem, vColorStart, (n+1)*(n+1), getIndices);
+	std::cout << "subset: " << check(vElem, vHalf, vColorStart, getIndices) << " wrong\n";
+
+//	no elements
+	vElem.clear();
+	std::cout << "empty: " << ug::ColorElementsByIndices(vElem, vColorStart, 0, getIndices)
+			  << " colors, " << vColorStart.size() << " start\n";
+}
@@ -0,0 +1,141 @@
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/grid_objects/grid_objects.h"
+#include "lib_grid/algorithms/unit_tests/check_frozen_adjacency.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "lib_grid/algorithms/unit_tests/check_frozen_adjacency.cpp" // ?
+#include "lib_grid/grid/grid.cpp" // ?
+#include "lib_grid/grid/grid_base_objects.cpp" // ?
+#include "lib_grid/grid/grid_connection_managment.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_2d.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_3d.cpp" // ?
+#include "common/util/message_hub.cpp" // ?
+#include "lib_grid/grid/grid_util.cpp" // ?
+#include "lib_grid/grid_objects/rule_util.cpp" // ?
+#include "lib_grid/tools/periodic_boundary_manager.cpp" // ?
+#include "common/util/variant.cpp" // ?
+#include "lib_grid/algorithms/debug_util.cpp" // ?
+#include "lib_grid/multi_grid.cpp" // ?
+#include "lib_grid/tools/subset_handler_grid.cpp" // ?
+#include "lib_grid/tools/subset_handler_multi_grid.cpp" // ?
+#include "lib_grid/tools/subset_handler_interface.cpp" // ?
+#include "common/allocators/slab_allocator.cpp" // ?
+#include "lib_grid/grid/grid_adjacency_snapshot.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_1d.cpp" // ?
+#include "lib_grid/common_attachments.cpp" // ?
+#include "common/math/math_vector_matrix/math_vector.cpp" // ?
+#include "lib_grid/grid/grid_object_collection.cpp" // ?
+#include "lib_grid/grid_objects/hexahedron_rules.cpp" // ?
+#include "lib_grid/grid_objects/octahedron_rules.cpp" // ?
+#include "lib_grid/grid_objects/prism_rules.cpp" // ?
+#include "lib_grid/grid_objects/pyramid_rules.cpp" // ?
+#include "lib_grid/grid_objects/tetrahedron_rules.cpp" // ?
+
+#include <iostream>
+#include <vector>
+
+// the associated elements of a frozen grid have to be the same as with the
+// containers of the grid, and option checks must not thaw the grid.
+
+using namespace ug;
+
+// n x n x n hexahedra, the middle layer is split into prisms
+void make_volumes(Grid& g, int n)
+{
+	std::vector<Vertex*> vrts((n+1)*(n+1)*(n+1));
+	for(size_t i = 0; i < vrts.size(); ++i)
+		vrts[i] = *g.create<RegularVertex>();
+
+#define V(i, j, k) vrts[((k)*(n+1) + (j))*(n+1) + (i)]
+	for(int k = 0; k < n; ++k)
+		for(int j = 0; j < n; ++j)
+			for(int i = 0; i < n; ++i){
+				if(k == n/2){
+					g.create<Prism>(PrismDescriptor(V(i,j,k), V(i+1,j,k), V(i+1,j+1,k),
+										V(i,j,k+1), V(i+1,j,k+1), V(i+1,j+1,k+1)));
+					g.create<Prism>(PrismDescriptor(V(i,j,k), V(i+1,j+1,k), V(i,j+1,k),
+										V(i,j,k+1), V(i+1,j+1,k+1), V(i,j+1,k+1)));
+				}
+				else
+					g.create<Hexahedron>(HexahedronDescriptor(
+							V(i,j,k), V(i+1,j,k), V(i+1,j+1,k), V(i,j+1,k),
+							V(i,j,k+1), V(i+1,j,k+1), V(i+1,j+1,k+1), V(i,j+1,k+1)));
+			}
+#undef V
+}
+
+// n x n quadrilaterals and triangles without volumes
+void make_faces(Grid& g, int n)
+{
+	std::vector<Vertex*> vrts((n+1)*(n+1));
+	for(size_t i = 0; i < vrts.size(); ++i)
+		vrts[i] = *g.create<RegularVertex>();
+
+#define V(i, j) vrts[(j)*(n+1) + (i)]
+	for(int j = 0; j < n; ++j)
+		for(int i = 0; i < n; ++i){
+			if((i + j) % 2){
+				g.create<Triangle>(TriangleDescriptor(V(i,j), V(i+1,j), V(i+1,j+1)));
+				g.create<Triangle>(TriangleDescriptor(V(i,j), V(i+1,j+1), V(i,j+1)));
+			}
+			else
+				g.create<Quadrilateral>(QuadrilateralDescriptor(V(i,j), V(i+1,j),
+															  V(i+1,j+1), V(i,j+1)));
+		}
+#undef V
+}
+
+bool run(Grid& g, const char* name)
+{
+	try{
+		grid_unit_tests::CheckFrozenAdjacency(g);
+	}
+	catch(UGError& e){
+		std::cout << name << ": " << e.get_msg() << "\n";
+		return false;
+	}
+
+// the auto-enable pattern of the algorithms must not thaw the grid
+	g.freeze_adjacency();
+	if(!g.option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+		g.enable_options(VRTOPT_STORE_ASSOCIATED_EDGES);
+	Grid::edge_traits::secure_container edges;
+	g.associated_elements(edges, *g.begin<Vertex>());
+	bool frozen = g.adjacency_is_frozen();
+
+// creating elements thaws the grid
+	g.create<RegularVertex>();
+	bool thawed = !g.adjacency_is_frozen();
+
+	std::cout << name << ": " << g.num_vertices() << " vertices, "
+			  << g.num_edges() << " edges, " << g.num_faces() << " faces, "
+			  << g.num_volumes() << " volumes, "
+			  << (frozen && thawed ? "ok" : "wrong") << "\n";
+	return frozen && thawed;
+}
+
+int main()
+{
+	bool ok = true;
+	{
+		Grid g(GRIDOPT_DEFAULT);
+		make_volumes(g, 4);
+		ok &= run(g, "volumes");
+	}
+	{
+		Grid g(GRIDOPT_DEFAULT);
+		make_faces(g, 6);
+		ok &= run(g, "faces");
+	}
+	{
+		Grid g(GRIDOPT_NONE);
+		make_faces(g, 3);
+		ok &= run(g, "faces, sides created later");
+	}
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/grid_objects/grid_objects.h"
+#include "lib_disc/spatial_disc/disc_util/fe_geom.h"
+#include "lib_disc/local_finite_element/lagrange/lagrange.h"
+#include "lib_disc/quadrature/gauss/gauss_quad.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "lib_disc/spatial_disc/disc_util/geom_cache.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrange.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrange_local_dof.cpp" // ?
+#include "lib_disc/local_finite_element/local_dof_set.cpp" // ?
+#include "lib_grid/grid/grid.cpp" // ?
+#include "lib_grid/grid/grid_base_objects.cpp" // ?
+#include "lib_grid/grid/grid_connection_managment.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_2d.cpp" // ?
+#include "common/math/misc/math_util.cpp" // ?
+#include "common/util/message_hub.cpp" // ?
+#include "common/util/variant.cpp" // ?
+#include "lib_disc/reference_element/reference_element.cpp" // ?
+#include "lib_grid/grid/grid_util.cpp" // ?
+#include "lib_grid/tools/periodic_boundary_manager.cpp" // ?
+#include "common/math/misc/eigenvalues.cpp" // ?
+#include "common/math/misc/lineintersect_utils.cpp" // ?
+#include "lib_grid/algorithms/debug_util.cpp" // ?
+#include "lib_grid/multi_grid.cpp" // ?
+#include "lib_grid/tools/subset_handler_grid.cpp" // ?
+#include "lib_grid/tools/subset_handler_multi_grid.cpp" // ?
+#include "lib_grid/tools/subset_handler_interface.cpp" // ?
+#include "common/allocators/slab_allocator.cpp" // ?
+#include "lib_grid/grid/grid_adjacency_snapshot.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_1d.cpp" // ?
+#include "lib_grid/common_attachments.cpp" // ?
+#include "common/math/math_vector_matrix/math_vector.cpp" // ?
+#include "lib_grid/grid/grid_object_collection.cpp" // ?
+#include "lib_disc/quadrature/gauss/gauss_quad_quadrilateral.cpp" // ?
+
+#include <ctime>
+#include <iostream>
+#include <vector>
+
+// the cached element geometries have to be the same as the computed ones,
+// also after moving a vertex and with an exhausted budget. disabling and
+// invalidating the caches has to free all memory.
+// the timings of the uncached and cached updates are written to stderr.
+
+using namespace ug;
+
+typedef FEGeometry<Quadrilateral, 2, LagrangeLSFS<ReferenceQuadrilateral, 2>,
+				   GaussQuadrature<ReferenceQuadrilateral, 5> > Geom;
+
+static unsigned rnd_state = 1;
+double rnd()
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) / 32768.;
+}
+
+struct Mesh{
+	Grid g;
+	std::vector<Vertex*> vrts;
+	Grid::VertexAttachmentAccessor<APosition2> aaPos;
+	std::vector<Quadrilateral*> quads;
+
+	// n x n perturbed quadrilaterals, i.e. not affine
+	explicit Mesh(int n) : vrts((n+1)*(n+1))
+	{
+		g.attach_to_vertices(aPosition2);
+		aaPos.access(g, aPosition2);
+		for(int j = 0; j <= n; ++j)
+			for(int i = 0; i <= n; ++i){
+				size_t k = j*(n+1) + i;
+				vrts[k] = *g.create<RegularVertex>();
+				aaPos[vrts[k]] = MathVector<2>(i + 0.3*(rnd() - 0.5), j + 0.3*(rnd() - 0.5));
+			}
+		for(int j = 0; j < n; ++j)
+			for(int i = 0; i < n; ++i){
+				size_t k = j*(n+1) + i;
+				quads.push_back(*g.create<Quadrilateral>(QuadrilateralDescriptor(
+						vrts[k], vrts[k+1], vrts[k+n+2], vrts[k+n+1])));
+			}
+	}
+
+	void corners(MathVector<2>* vCorner, size_t q)
+	{
+		for(size_t i = 0; i < 4; ++i)
+			vCorner[i] = aaPos[quads[q]->vertex(i)];
+	}
+};
+
+// all element dependent values of the geometry for all elements
+void eval(std::vector<number>& vals, Mesh& m, Geom& geo)
+{
+	vals.clear();
+	MathVector<2> vCorner[4];
+	for(size_t q = 0; q < m.quads.size(); ++q){
+		m.corners(vCorner, q);
+		geo.update(m.quads[q], vCorner);
+		for(size_t ip = 0; ip < geo.num_ip(); ++ip){
+			vals.push_back(geo.weight(ip));
+			vals.push_back(geo.global_ip(ip)[0]);
+			vals.push_back(geo.global_ip(ip)[1]);
+			for(size_t sh = 0; sh < geo.num_sh(); ++sh){
+				vals.push_back(geo.global_grad(ip, sh)[0]);
+				vals.push_back(geo.global_grad(ip, sh)[1]);
+			}
+		}
+	}
+}
+
+bool check(const char* name, const std::vector<number>& ref, const std::vector<number>& vals)
+{
+	bool ok = (ref == vals);
+	std::cout << name << ": " << (ok ? "ok" : "wrong") << "\n";
+	return ok;
+}
+
+double seconds(Mesh& m, Geom& geo, int numRuns)
+{
+	std::vector<number> vals;
+	clock_t start = clock();
+	for(int i = 0; i < numRuns; ++i)
+		eval(vals, m, geo);
+	return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main()
+{
+	Mesh m(64);
+	Geom geo;
+	bool ok = true;
+
+	std::vector<number> ref, vals;
+	eval(ref, m, geo);
+
+	GeomCacheControl::enable(true);
+	eval(vals, m, geo);
+	ok &= check("filling the cache", ref, vals);
+	std::cout << "memory used: " << (GeomCacheControl::memory_used() > 0 ? "yes" : "no") << "\n";
+	eval(vals, m, geo);
+	ok &= check("from the cache", ref, vals);
+
+// a moved vertex has to be recomputed
+	m.aaPos[m.vrts[100]][0] += 0.1;
+	GeomCacheControl::enable(false);
+	eval(ref, m, geo);
+	GeomCacheControl::enable(true);
+	eval(vals, m, geo);
+	m.aaPos[m.vrts[100]][0] -= 0.1;
+	eval(vals, m, geo);
+	m.aaPos[m.vrts[100]][0] += 0.1;
+	eval(vals, m, geo);
+	ok &= check("after moving a vertex", ref, vals);
+
+	GeomCacheControl::enable(false);
+	std::cout << "memory used after disabling: " << GeomCacheControl::memory_used() << "\n";
+	ok &= (GeomCacheControl::memory_used() == 0);
+
+	GeomCacheControl::enable(true);
+	eval(vals, m, geo);
+	GeomCacheControl::invalidate();
+	std::cout << "memory used after invalidating: " << GeomCacheControl::memory_used() << "\n";
+	ok &= (GeomCacheControl::memory_used() == 0);
+
+// with a small budget only a part of the elements is cached
+	GeomCacheControl::set_memory_budget(0.5);
+	eval(vals, m, geo);
+	eval(vals, m, geo);
+	ok &= check("with a small budget", ref, vals);
+	std::cout << "within budget: "
+			  << (GeomCacheControl::memory_used() <= GeomCacheControl::memory_budget() ? "yes" : "no")
+			  << "\n";
+	GeomCacheControl::set_memory_budget(256);
+
+	GeomCacheControl::enable(false);
+	double tUncached = seconds(m, geo, 20);
+	GeomCacheControl::enable(true);
+	eval(vals, m, geo);
+	double tCached = seconds(m, geo, 20);
+	GeomCacheControl::enable(false);
+	std::cerr << "uncached: " << tUncached << "s, cached: " << tCached << "s\n";
+
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,227 @@
+#include "common/util/trace.h"
+#include "lib_disc/local_finite_element/lagrange/lagrange.h"
+#include "lib_disc/local_finite_element/lagrange/lagrange_tensor_prod.h"
+#include "lib_disc/quadrature/gauss_legendre/gauss_legendre.h"
+#include "lib_disc/spatial_disc/disc_util/tensor_prod_fe_geom.h"
+#include "lib_disc/spatial_disc/disc_util/geom_provider.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "lib_disc/quadrature/gauss_legendre/gauss_legendre.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrange.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrange_local_dof.cpp" // ?
+#include "lib_disc/local_finite_element/local_dof_set.cpp" // ?
+#include "lib_disc/reference_element/reference_element.cpp" // ?
+#include "common/math/misc/math_util.cpp" // ?
+#include "common/math/misc/lineintersect_utils.cpp" // ?
+#include "common/math/misc/eigenvalues.cpp" // ?
+#include "common/math/math_vector_matrix/math_vector.cpp" // ?
+#include "common/error.cpp" // ?
+#include "lib_disc/quadrature/gauss/gauss_quad_edge.cpp" // ?
+#include "lib_disc/quadrature/gauss/gauss_quad_hexahedron.cpp" // ?
+#include "lib_disc/quadrature/gauss/gauss_quad_octahedron.cpp" // ?
+#include "lib_disc/quadrature/gauss/gauss_quad_prism.cpp" // ?
+#include "lib_disc/quadrature/gauss/gauss_quad_pyramid.cpp" // ?
+#include "lib_disc/quadrature/gauss/gauss_quad_quadrilateral.cpp" // ?
+#include "lib_disc/quadrature/gauss/gauss_quad_tetrahedron.cpp" // ?
+#include "lib_disc/quadrature/gauss/gauss_quad_triangle.cpp" // ?
+#include "lib_disc/quadrature/gauss/gauss_quad_vertex.cpp" // ?
+#include "lib_disc/quadrature/quadrature_provider.cpp" // ?
+#include "lib_disc/quadrature/gauss_tensor_prod/gauss_tensor_prod.cpp" // ?
+#include "lib_disc/local_finite_element/local_finite_element_provider.cpp" // ?
+#include "lib_disc/local_finite_element/local_finite_element_id.cpp" // ?
+#include "lib_disc/quadrature/newton_cotes/newton_cotes.cpp" // ?
+#include "lib_disc/reference_element/reference_mapping_provider.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrangep1.cpp" // ?
+#include "lib_disc/local_finite_element/mini/mini.cpp" // ?
+#include "lib_disc/quadrature/gauss_jacobi/gauss_jacobi10.cpp" // ?
+#include "lib_disc/quadrature/gauss_jacobi/gauss_jacobi20.cpp" // ?
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+// sum-factorized evaluation of tensor-product lagrange elements
+// interpolation, local gradients and testing must coincide with the
+// evaluation using the full shape function tables. The same is checked for
+// the fe geometry obtained from the GeomProvider on a distorted element.
+
+// deterministic random numbers, independent of the libc
+static unsigned long s_seed = 1;
+static number next_rand()
+{
+	s_seed = s_seed * 1103515245 + 12345;
+	return (number)((s_seed / 65536) % 32768) / 32768. - .5;
+}
+
+// tensor-product integration points, first coordinate running slowest
+template <int dim>
+void tensor_points(std::vector<ug::MathVector<dim> >& vIP, const ug::QuadratureRule<1>& q1)
+{
+	size_t n = 1;
+	for(int d=0; d<dim; ++d) n *= q1.size();
+	vIP.resize(n);
+	for(size_t ip=0; ip<n; ++ip){
+		size_t rest = ip;
+		for(int d=dim-1; d>=0; --d){
+			vIP[ip][d] = q1.point(rest % q1.size())[0];
+			rest /= q1.size();
+		}
+	}
+}
+
+// returns the max deviation between sum factorization and full tables
+template <typename TRefElem, int p>
+number compare()
+{
+	static const int dim = TRefElem::dim;
+	typedef ug::LagrangeLSFS<TRefElem, p> LSFS;
+	LSFS lsfs;
+
+	ug::GaussLegendre q1(2*p);
+	ug::LagrangeTensorProduct<dim> tp;
+	tp.init(lsfs, p, q1);
+
+	std::vector<ug::MathVector<dim> > vIP;
+	tensor_points<dim>(vIP, q1);
+	const size_t nsh = lsfs.num_sh(), nip = vIP.size();
+	if(tp.num_ip() != nip || tp.num_sh() != nsh){ untested();
+		return 1.;
+	}
+
+	std::vector<number> vDoF(nsh), vVal(nip), vTestVal(nip);
+	std::vector<ug::MathVector<dim> > vGrad(nip), vTestGrad(nip);
+	for(size_t sh=0; sh<nsh; ++sh) vDoF[sh] = next_rand();
+	for(size_t ip=0; ip<nip; ++ip){
+		vTestVal[ip] = next_rand();
+		for(int d=0; d<dim; ++d) vTestGrad[ip][d] = next_rand();
+	}
+
+	tp.interpolate(&vVal[0], &vDoF[0]);
+	tp.local_grad(&vGrad[0], &vDoF[0]);
+	std::vector<number> vTested(nsh, 0.);
+	tp.integrate(&vTested[0], &vTestVal[0], &vTestGrad[0]);
+
+	number maxErr = 0.;
+	std::vector<number> vTestedFull(nsh, 0.);
+	for(size_t ip=0; ip<nip; ++ip){
+		number val = 0.;
+		ug::MathVector<dim> grad(0.);
+		for(size_t sh=0; sh<nsh; ++sh){
+			ug::MathVector<dim> g;
+			lsfs.grad(g, sh, vIP[ip]);
+			const number phi = lsfs.shape(sh, vIP[ip]);
+			val += vDoF[sh] * phi;
+			for(int d=0; d<dim; ++d) grad[d] += vDoF[sh] * g[d];
+			vTestedFull[sh] += vTestVal[ip] * phi + VecDot(vTestGrad[ip], g);
+		}
+		maxErr = std::max(maxErr, std::fabs(val - vVal[ip]));
+		for(int d=0; d<dim; ++d)
+			maxErr = std::max(maxErr, std::fabs(grad[d] - vGrad[ip][d]));
+	}
+	for(size_t sh=0; sh<nsh; ++sh)
+		maxErr = std::max(maxErr, std::fabs(vTestedFull[sh] - vTested[sh]));
+
+	return maxErr;
+}
+
+template <typename TRefElem, int p>
+void check(const char* name)
+{
+	const number err = compare<TRefElem, p>();
+	std::cout << name << " p=" << p << ": " << (err < 1e-11 ? "ok" : "wrong") << "\n";
+}
+
+// returns the max deviation between the geometry and the full tables
+template <typename TElem, int worldDim>
+number compare_geom(int p, const ug::MathVector<worldDim>* vCorner)
+{
+	typedef ug::TensorProductFEGeometry<TElem, worldDim> TGeom;
+	static const int dim = TGeom::dim;
+	const ug::LFEID lfeID(ug::LFEID::LAGRANGE, dim, p);
+	const int quadOrder = 2*p;
+
+	TGeom& geo = ug::GeomProvider<TGeom>::get(lfeID, quadOrder);
+	if(&geo != &ug::GeomProvider<TGeom>::get(lfeID, quadOrder)
+		|| &geo == &ug::GeomProvider<TGeom>::get(lfeID, quadOrder+1)){ untested();
+		return 1.;
+	}
+	geo.update(NULL, vCorner, lfeID, quadOrder);
+
+	const ug::LocalShapeFunctionSet<dim>& lsfs
+		= ug::LocalFiniteElementProvider::get<dim>(TGeom::ref_elem_type::REFERENCE_OBJECT_ID, lfeID);
+	const size_t nsh = geo.num_sh(), nip = geo.num_ip();
+
+	std::vector<number> vDoF(nsh), vVal(nip), vTestVal(nip);
+	std::vector<ug::MathVector<worldDim> > vGrad(nip), vTestGrad(nip);
+	for(size_t sh=0; sh<nsh; ++sh) vDoF[sh] = next_rand();
+	for(size_t ip=0; ip<nip; ++ip){
+		vTestVal[ip] = next_rand();
+		for(int d=0; d<worldDim; ++d) vTestGrad[ip][d] = next_rand();
+	}
+
+	geo.interpolate(&vVal[0], &vDoF[0]);
+	geo.global_grad(&vGrad[0], &vDoF[0]);
+	std::vector<number> vTested(nsh, 0.);
+	geo.integrate(&vTested[0], &vTestVal[0], &vTestGrad[0]);
+
+	number maxErr = 0.;
+	std::vector<number> vTestedFull(nsh, 0.);
+	for(size_t ip=0; ip<nip; ++ip){
+		number val = 0.;
+		ug::MathVector<worldDim> grad(0.);
+		for(size_t sh=0; sh<nsh; ++sh){
+			ug::MathVector<dim> lg;
+			ug::MathVector<worldDim> g;
+			lsfs.grad(lg, sh, geo.local_ip(ip));
+			MatVecMult(g, geo.JTInv(ip), lg);
+			const number phi = lsfs.shape(sh, geo.local_ip(ip));
+			val += vDoF[sh] * phi;
+			for(int d=0; d<worldDim; ++d) grad[d] += vDoF[sh] * g[d];
+			vTestedFull[sh] += geo.weight(ip) * (vTestVal[ip] * phi + VecDot(vTestGrad[ip], g));
+		}
+		maxErr = std::max(maxErr, std::fabs(val - vVal[ip]));
+		for(int d=0; d<worldDim; ++d)
+			maxErr = std::max(maxErr, std::fabs(grad[d] - vGrad[ip][d]));
+	}
+	for(size_t sh=0; sh<nsh; ++sh)
+		maxErr = std::max(maxErr, std::fabs(vTestedFull[sh] - vTested[sh]));
+
+	return maxErr;
+}
+
+template <typename TElem, int worldDim>
+void check_geom(const char* name, int p, const ug::MathVector<worldDim>* vCorner)
+{
+	const number err = compare_geom<TElem, worldDim>(p, vCorner);
+	std::cout << name << " geometry p=" << p << ": " << (err < 1e-11 ? "ok" : "wrong") << "\n";
+}
+
+int main()
+{
+	check<ug::ReferenceEdge, 1>("edge");
+	check<ug::ReferenceEdge, 4>("edge");
+	check<ug::ReferenceQuadrilateral, 1>("quadrilateral");
+	check<ug::ReferenceQuadrilateral, 2>("quadrilateral");
+	check<ug::ReferenceQuadrilateral, 3>("quadrilateral");
+	check<ug::ReferenceHexahedron, 1>("hexahedron");
+	check<ug::ReferenceHexahedron, 2>("hexahedron");
+	check<ug::ReferenceHexahedron, 3>("hexahedron");
+
+	ug::MathVector<2> vQuad[4];
+	vQuad[0] = ug::MathVector<2>(0., 0.); vQuad[1] = ug::MathVector<2>(2., 0.1);
+	vQuad[2] = ug::MathVector<2>(1.7, 1.5); vQuad[3] = ug::MathVector<2>(-0.2, 1.);
+	check_geom<ug::Quadrilateral, 2>("quadrilateral", 1, vQuad);
+	check_geom<ug::Quadrilateral, 2>("quadrilateral", 3, vQuad);
+
+	ug::MathVector<3> vHex[8];
+	for(int i=0; i<8; ++i){
+		vHex[i] = ug::MathVector<3>(((i+1)/2)%2, (i/2)%2, i/4);
+		for(int d=0; d<3; ++d) vHex[i][d] += 0.2 * next_rand();
+	}
+	check_geom<ug::Hexahedron, 3>("hexahedron", 2, vHex);
+}
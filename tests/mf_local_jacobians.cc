@@ -0,0 +1,114 @@
+#include "common/util/trace.h"
+#include "lib_algebra/cpu_algebra/sparsematrix_impl.h"
+#include "lib_algebra/cpu_algebra/vector.h"
+#include "lib_disc/common/local_jacobian_cache.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+
+// matrix-free jacobian test
+// the stored local jacobians applied to a vector must give the same result
+// as the assembled matrix (SpMV), the same holds for the diagonal
+
+// deterministic random numbers, independent of the libc
+static unsigned long s_seed = 1;
+static unsigned next_rand(unsigned n)
+{
+	s_seed = s_seed * 1103515245 + 12345;
+	return (unsigned)((s_seed / 65536) % 32768) % n;
+}
+
+typedef ug::SparseMatrix<double> M;
+typedef ug::Vector<double> V;
+
+// random "element": numCorner distinct nodes, two functions per node
+void random_element(ug::LocalIndices& ind, int numNode, int numCorner)
+{
+	std::vector<int> vNode;
+	while((int)vNode.size() < numCorner){
+		int n = next_rand(numNode);
+		bool found = false;
+		for(size_t i=0; i<vNode.size(); ++i) found |= (vNode[i] == n);
+		if(!found) vNode.push_back(n);
+	}
+
+	ind.clear();
+	ind.resize_fct(2);
+	for(size_t fct=0; fct<2; ++fct)
+		for(size_t i=0; i<vNode.size(); ++i)
+			ind.push_back_index(fct, 2*vNode[i] + fct);
+}
+
+// assembles numElem random elements into A and the cache
+void assemble(M& A, ug::LocalJacobianCache& cache, int numNode, int numElem)
+{
+	A.resize_and_clear(2*numNode, 2*numNode);
+	cache.clear();
+
+	ug::LocalIndices ind;
+	ug::LocalMatrix locJ;
+	for(int e=0; e<numElem; ++e){
+		random_element(ind, numNode, 2 + next_rand(3));
+		locJ.resize(ind);
+		locJ = 0.0;
+		for(size_t fct1=0; fct1<locJ.num_all_row_fct(); ++fct1)
+			for(size_t dof1=0; dof1<locJ.num_all_row_dof(fct1); ++dof1)
+				for(size_t fct2=0; fct2<locJ.num_all_col_fct(); ++fct2)
+					for(size_t dof2=0; dof2<locJ.num_all_col_dof(fct2); ++dof2)
+						locJ.value(fct1,dof1,fct2,dof2) = (int)next_rand(21) - 10;
+
+		ug::AddLocalMatrixToGlobal(A, locJ);
+		cache.add(locJ);
+	}
+	A.defragment();
+}
+
+int main()
+{
+	const int numNode = 50, numElem = 120;
+
+	M A;
+	ug::LocalJacobianCache cache;
+	assemble(A, cache, numNode, numElem);
+	std::cout << "== " << cache.num_elems() << " element jacobians\n";
+
+	const size_t N = A.num_rows();
+	V c(N), d(N), b(N), diag(N);
+	int wrong = 0;
+	for(int k=0; k<10; ++k){
+		for(size_t i=0; i<N; ++i) c[i] = (int)next_rand(11) - 5;
+		A.apply(b, c);
+		d.set(0.0);
+		cache.apply(d, c);
+		for(size_t i=0; i<N; ++i)
+			if(std::fabs(d[i] - b[i]) > 1e-12) ++wrong;
+	}
+	std::cout << "apply: " << wrong << " wrong\n";
+
+	wrong = 0;
+	diag.set(0.0);
+	cache.add_diagonal(diag);
+	for(size_t i=0; i<N; ++i)
+		if(std::fabs(diag[i] - A(i,i)) > 1e-12) ++wrong;
+	std::cout << "diagonal: " << wrong << " wrong\n";
+
+	// a second application must not change the result (nothing recomputed)
+	wrong = 0;
+	A.apply(b, c);
+	d.set(0.0);
+	cache.apply(d, c);
+	for(size_t i=0; i<N; ++i)
+		if(std::fabs(d[i] - b[i]) > 1e-12) ++wrong;
+	std::cout << "reapply: " << wrong << " wrong\n";
+
+	ug::LocalJacobianCache().swap(cache);
+	std::cout << "released " << cache.empty() << "\n";
+}
@@ -0,0 +1,168 @@
+#include "common/util/trace.h"
+#include "lib_algebra/cpu_algebra_types.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/operator/convergence_check.h"
+#include "lib_algebra/operator/linear_solver/cg.h"
+#include "lib_algebra/operator/preconditioner/ilu.h"
+#include "lib_algebra/operator/preconditioner/ilut.h"
+#include "lib_algebra/operator/preconditioner/gauss_seidel.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "common/progress.cpp" // ?
+#include "lib_algebra/algebra_common/permutation_util.cpp" // ?
+#include "lib_algebra/ordering_strategies/algorithms/native_cuthill_mckee.cpp" // ?
+
+#include <iostream>
+#include <cmath>
+
+// preconditioners with single precision storage must give the same
+// solution as with double precision storage, with at most 10% more cg
+// steps
+// after a change of the pattern, the data computed at init must not be
+// used anymore
+
+typedef ug::CPUAlgebra A;
+typedef A::matrix_type M;
+typedef A::vector_type V;
+
+static unsigned rnd_state = 1;
+double rnd()
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) / 32768.;
+}
+
+// 5-point stencil on an n x n grid with random edge coefficients.
+// rows are inserted in random order and the matrix is not defragmented
+void diffusion(M& mat, int n)
+{
+	std::vector<double> cx(n*n), cy(n*n);
+	for(int k=0; k<n*n; ++k){
+		cx[k] = 1. + 9.*rnd();
+		cy[k] = 1. + 9.*rnd();
+	}
+
+	std::vector<int> vRow(n*n);
+	for(int k=0; k<n*n; ++k) vRow[k] = k;
+	for(int k=n*n-1; k>0; --k) std::swap(vRow[k], vRow[int(rnd()*(k+1))]);
+
+	mat.resize_and_clear(n*n, n*n);
+	for(int r=0; r<n*n; ++r){
+		const int k = vRow[r], i = k/n, j = k%n;
+		double d = 0.;
+		const double w = (j>0) ? cx[k-1] : 1.;
+		const double e = cx[k];
+		const double s = (i>0) ? cy[k-n] : 1.;
+		const double nn = cy[k];
+		if(j>0) mat(k,k-1) = -w;
+		if(j<n-1) mat(k,k+1) = -e;
+		if(i>0) mat(k,k-n) = -s;
+		if(i<n-1) mat(k,k+n) = -nn;
+		d = w + e + s + nn;
+		mat(k,k) = d;
+	}
+}
+
+int solve(SmartPtr<ug::MatrixOperator<M, V> > spA,
+          SmartPtr<ug::IPreconditioner<A> > spPre, V& x)
+{
+	const size_t N = spA->num_rows();
+	V b(N);
+	x.resize(N);
+	for(size_t i=0; i<N; ++i){
+		x[i] = 0.;
+		b[i] = 1.;
+	}
+
+	SmartPtr<ug::StdConvCheck<V> > spConv
+		= make_sp(new ug::StdConvCheck<V>(1000, 1e-30, 1e-12, false));
+
+	ug::CG<V> solver;
+	solver.set_preconditioner(spPre);
+	solver.set_convergence_check(spConv);
+	solver.init(spA);
+	if(!solver.apply_return_defect(x, b)){ untested();
+		return -1;
+	}
+	return spConv->step();
+}
+
+template <typename TPre>
+void compare(const char* name, SmartPtr<ug::MatrixOperator<M, V> > spA)
+{
+	V xd, xs;
+
+	SmartPtr<TPre> spD = make_sp(new TPre);
+	const int numD = solve(spA, spD, xd);
+
+	SmartPtr<TPre> spS = make_sp(new TPre);
+	spS->enable_single_precision(true);
+	const int numS = solve(spA, spS, xs);
+
+	const bool bSteps = numD > 0 && numS > 0 && numS <= numD + numD/10 + 1;
+	double diff = 0., norm = 0.;
+	for(size_t i=0; i<xd.size(); ++i){
+		diff = std::max(diff, std::fabs(xd[i] - xs[i]));
+		norm = std::max(norm, std::fabs(xd[i]));
+	}
+
+	std::cout << name << ": steps "
+	          << (bSteps ? "ok" : "wrong")
+	          << ", solution "
+	          << ((diff <= 1e-8 * norm) ? "ok" : "wrong") << "\n";
+	if(!bSteps || diff > 1e-8 * norm){ untested();
+		std::cout << "  double " << numD << ", single " << numS
+		          << ", max diff " << diff << "\n";
+	}
+}
+
+// changes the pattern after the init of the single precision sgs. a step
+// must then give the same as a double precision sgs initialized afterwards
+void check_pattern_changed(int n)
+{
+	SmartPtr<ug::MatrixOperator<M, V> > spA
+		= make_sp(new ug::MatrixOperator<M, V>);
+	diffusion(spA->get_matrix(), n);
+
+	SmartPtr<ug::SymmetricGaussSeidel<A> > spS
+		= make_sp(new ug::SymmetricGaussSeidel<A>);
+	spS->enable_single_precision(true);
+	spS->init(spA);
+
+	M& mat = spA->get_matrix();
+	mat(0, n*n-1) = -1.;
+	mat(n*n-1, 0) = -1.;
+	mat(0, 0) += 1.;
+	mat(n*n-1, n*n-1) += 1.;
+
+	SmartPtr<ug::SymmetricGaussSeidel<A> > spD
+		= make_sp(new ug::SymmetricGaussSeidel<A>);
+	spD->init(spA);
+
+	V cS(n*n), cD(n*n), d(n*n);
+	size_t numWrong = 0;
+	for(int i=0; i<n*n; ++i) d[i] = rnd();
+	spS->apply(cS, d);
+	spD->apply(cD, d);
+	for(int i=0; i<n*n; ++i)
+		if(cS[i] != cD[i]) ++numWrong;
+	std::cout << "sgs pattern changed: " << numWrong << " wrong\n";
+}
+
+int main()
+{
+	SmartPtr<ug::MatrixOperator<M, V> > spA
+		= make_sp(new ug::MatrixOperator<M, V>);
+	diffusion(spA->get_matrix(), 40);
+
+	compare<ug::ILU<A> >("ilu", spA);
+	compare<ug::ILUTPreconditioner<A> >("ilut", spA);
+	compare<ug::SymmetricGaussSeidel<A> >("sgs", spA);
+
+	check_pattern_changed(20);
+}
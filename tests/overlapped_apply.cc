@@ -0,0 +1,256 @@
+#define UG_PARALLEL
+#include "common/util/smart_pointer.h"
+#include "lib_algebra/cpu_algebra/vector.h"
+#include "lib_algebra/cpu_algebra/sparsematrix.h"
+#include "lib_algebra/parallelization/parallel_vector.h"
+#include "lib_algebra/parallelization/parallel_matrix.h"
+#include "lib_algebra/cpu_algebra_types.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/operator/convergence_check.h"
+#include "lib_algebra/operator/linear_solver/bicgstab.h"
+#include "lib_algebra/operator/linear_solver/gmres.h"
+#include "lib_algebra/operator/preconditioner/jacobi.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "common/util/binary_buffer.cpp" // ?
+#include "common/util/file_util.cpp" // ?
+#include "common/util/os_dependent_impl/file_util_posix.cpp" // ?
+#include "common/util/os_dependent_impl/os_info_linux.cpp" // ?
+#include "pcl/pcl_base.cpp" // ?
+#include "pcl/pcl_util.cpp" // ?
+#include "pcl/pcl_comm_world.cpp" // ?
+#include "pcl/pcl_process_communicator.cpp" // ?
+
+#include <iostream>
+#include <cmath>
+
+// applying an additive matrix to an additive vector (which makes the vector
+// consistent while the rows away from the interface are computed) must give
+// the same result as making the vector consistent first. The const apply and
+// matmul_minus must leave the vector unchanged. The row split is cached, so
+// this is also checked after the pattern and the layouts changed.
+// the solvers pass additive vectors to such an operator and must give the
+// same iterates as with an operator that needs consistent input.
+// the interfaces form a ring, masters of rank p are slaves on rank p+1.
+
+typedef ug::CPUAlgebra::vector_type V;
+typedef ug::CPUAlgebra::matrix_type M;
+typedef ug::MatrixOperator<M, V> Op;
+
+// operator for which the solvers make the input consistent beforehand
+class BlockingOp : public Op
+{
+	public:
+		virtual bool accepts_additive_input() const {return false;}
+};
+
+static unsigned rnd_state = 1;
+double rnd()
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) / 32768.;
+}
+
+// the first k indices (after shift) are masters for the next process, the
+// last k indices (before shift) are slaves of the previous one
+void make_layouts(ug::AlgebraLayouts& layouts, size_t n, size_t k, size_t shift = 0)
+{
+	int rank, size;
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+	layouts.clear();
+	ug::IndexLayout::Interface& master = layouts.master().interface((rank+1) % size);
+	ug::IndexLayout::Interface& slave = layouts.slave().interface((rank+size-1) % size);
+	for(size_t i=0; i<k; ++i){
+		master.push_back(shift+i);
+		slave.push_back(n-shift-k+i);
+	}
+}
+
+// tridiagonal matrix with random entries
+void make_matrix(M& A, size_t n)
+{
+	A.resize_and_clear(n, n);
+	for(size_t i=0; i<n; ++i){
+		A(i, i) = 2. + rnd();
+		if(i > 0) A(i, i-1) = -rnd();
+		if(i+1 < n) A(i, i+1) = -rnd();
+	}
+	A.set_storage_type(ug::PST_ADDITIVE);
+}
+
+void fill(V& x, V& y, SmartPtr<ug::AlgebraLayouts> spLayouts, ug::ParallelStorageType type)
+{
+	for(size_t i=0; i<x.size(); ++i) x[i] = y[i] = rnd();
+	x.set_layouts(spLayouts); y.set_layouts(spLayouts);
+	x.set_storage_type(ug::PST_ADDITIVE);
+	if(type == ug::PST_UNIQUE){
+		x.change_storage_type(ug::PST_UNIQUE);
+		for(size_t i=0; i<x.size(); ++i) y[i] = x[i];
+	}
+	y.set_storage_type(x.get_storage_mask());
+}
+
+// returns the number of entries of A*x and b - A*x that differ
+size_t compare(M& A, SmartPtr<ug::AlgebraLayouts> spLayouts, ug::ParallelStorageType type)
+{
+	const size_t n = A.num_rows();
+	size_t numWrong = 0;
+	V x(n), y(n), bx(n), by(n);
+
+	fill(x, y, spLayouts, type);
+	A.apply_making_consistent(bx, x);
+	y.change_storage_type(ug::PST_CONSISTENT);
+	A.apply(by, y);
+	for(size_t i=0; i<n; ++i)
+		if(std::fabs(bx[i] - by[i]) > 1e-12 || x[i] != y[i]) ++numWrong;
+	if(!x.has_storage_type(ug::PST_CONSISTENT) || !bx.has_storage_type(ug::PST_ADDITIVE))
+		++numWrong;
+
+	fill(x, y, spLayouts, type);
+	A.apply(bx, x);
+	for(size_t i=0; i<n; ++i)
+		if(x[i] != y[i]) ++numWrong;
+	if(x.get_storage_mask() != y.get_storage_mask()) ++numWrong;
+	y.change_storage_type(ug::PST_CONSISTENT);
+	A.apply(by, y);
+	for(size_t i=0; i<n; ++i)
+		if(std::fabs(bx[i] - by[i]) > 1e-12) ++numWrong;
+
+	fill(x, y, spLayouts, type);
+	for(size_t i=0; i<n; ++i) bx[i] = by[i] = rnd();
+	bx.set_storage_type(ug::PST_ADDITIVE); by.set_storage_type(ug::PST_ADDITIVE);
+	A.matmul_minus(bx, x);
+	for(size_t i=0; i<n; ++i)
+		if(x[i] != y[i]) ++numWrong;
+	if(x.get_storage_mask() != y.get_storage_mask()) ++numWrong;
+	y.change_storage_type(ug::PST_CONSISTENT);
+	A.matmul_minus(by, y);
+	for(size_t i=0; i<n; ++i)
+		if(std::fabs(bx[i] - by[i]) > 1e-12) ++numWrong;
+
+	return numWrong;
+}
+
+// the jacobi correction of an additive defect is D^{-1} applied to the
+// consistent defect (D consistent as well)
+size_t check_jacobi(SmartPtr<Op> spA, SmartPtr<ug::AlgebraLayouts> spLayouts)
+{
+	const size_t n = spA->num_rows();
+	SmartPtr<ug::ILinearIterator<V> > spJacobi(new ug::Jacobi<ug::CPUAlgebra>);
+	spJacobi->init(spA);
+
+	V c(n), d(n), y(n), diag(n);
+	for(size_t i=0; i<n; ++i){y[i] = d[i] = rnd(); diag[i] = spA->diag(i);}
+	c.set_layouts(spLayouts); d.set_layouts(spLayouts);
+	y.set_layouts(spLayouts); diag.set_layouts(spLayouts);
+	d.set_storage_type(ug::PST_ADDITIVE); y.set_storage_type(ug::PST_ADDITIVE);
+	diag.set_storage_type(ug::PST_ADDITIVE);
+	spJacobi->apply(c, d);
+	y.change_storage_type(ug::PST_CONSISTENT);
+	diag.change_storage_type(ug::PST_CONSISTENT);
+
+	size_t numWrong = c.has_storage_type(ug::PST_CONSISTENT) ? 0 : 1;
+	for(size_t i=0; i<n; ++i)
+		if(std::fabs(c[i] - y[i] / diag[i]) > 1e-12) ++numWrong;
+	return numWrong;
+}
+
+template <typename TSolver>
+void solve(TSolver& solver, SmartPtr<Op> spA, SmartPtr<ug::AlgebraLayouts> spLayouts,
+           V& x, int& numIter)
+{
+	const size_t n = spA->num_rows();
+	rnd_state = 3;
+	V b(n);
+	x.resize(n);
+	for(size_t i=0; i<n; ++i){b[i] = rnd(); x[i] = 0.0;}
+	b.set_layouts(spLayouts); x.set_layouts(spLayouts);
+	b.set_storage_type(ug::PST_ADDITIVE); x.set_storage_type(ug::PST_CONSISTENT);
+
+	SmartPtr<ug::StdConvCheck<V> > spConv(new ug::StdConvCheck<V>(100, 1e-30, 1e-10, false));
+	solver.set_convergence_check(spConv);
+	solver.init(spA);
+	solver.apply(x, b);
+	numIter = spConv->step();
+}
+
+// returns the number of differing iterations and solution entries
+template <typename TSolver>
+size_t compare_solver(TSolver& solver, SmartPtr<Op> spA, SmartPtr<Op> spBlocking,
+                      SmartPtr<ug::AlgebraLayouts> spLayouts)
+{
+	V x, y;
+	int numIter, numIterBlocking;
+	solve(solver, spA, spLayouts, x, numIter);
+	solve(solver, spBlocking, spLayouts, y, numIterBlocking);
+
+	size_t numWrong = (numIter == numIterBlocking && numIter < 100) ? 0 : 1;
+	for(size_t i=0; i<x.size(); ++i)
+		if(std::fabs(x[i] - y[i]) > 1e-8) ++numWrong;
+	return numWrong;
+}
+
+int main(int argc, char* argv[])
+{
+	MPI_Init(&argc, &argv);
+	{
+		SmartPtr<ug::AlgebraLayouts> spLayouts(new ug::AlgebraLayouts);
+		make_layouts(*spLayouts, 100, 10);
+
+		M A;
+		A.set_layouts(spLayouts);
+		make_matrix(A, 100);
+
+		size_t numWrong = 0;
+		for(int r=0; r<5; ++r) numWrong += compare(A, spLayouts, ug::PST_ADDITIVE);
+		std::cout << "additive: " << numWrong << " wrong\n";
+
+		numWrong = 0;
+		for(int r=0; r<5; ++r) numWrong += compare(A, spLayouts, ug::PST_UNIQUE);
+		std::cout << "unique: " << numWrong << " wrong\n";
+
+	//	a new connection from an inner row to the interface
+		A(50, 95) = -1.;
+		std::cout << "pattern changed: " << compare(A, spLayouts, ug::PST_ADDITIVE) << " wrong\n";
+
+	//	larger interfaces in the same layouts object
+		make_layouts(*spLayouts, 100, 30);
+		std::cout << "layouts changed: " << compare(A, spLayouts, ug::PST_ADDITIVE) << " wrong\n";
+
+	//	other interface entries, but as many as before
+		make_layouts(*spLayouts, 100, 30, 10);
+		std::cout << "interface moved: " << compare(A, spLayouts, ug::PST_ADDITIVE) << " wrong\n";
+
+	//	a matrix of another size
+		make_layouts(*spLayouts, 60, 5);
+		make_matrix(A, 60);
+		std::cout << "resized: " << compare(A, spLayouts, ug::PST_ADDITIVE) << " wrong\n";
+
+	//	solvers
+		SmartPtr<Op> spA(new Op), spBlocking(new BlockingOp);
+		spA->set_layouts(spLayouts); spBlocking->set_layouts(spLayouts);
+		rnd_state = 5; make_matrix(*spA, 60);
+		rnd_state = 5; make_matrix(*spBlocking, 60);
+		std::cout << "accepts additive: " << spA->accepts_additive_input() << "\n";
+
+		std::cout << "jacobi: " << check_jacobi(spA, spLayouts) << " wrong\n";
+
+		ug::BiCGStab<V> bicgstab;
+		std::cout << "bicgstab: " << compare_solver(bicgstab, spA, spBlocking, spLayouts) << " wrong\n";
+		bicgstab.set_fused_reductions(true);
+		std::cout << "bicgstab fused: " << compare_solver(bicgstab, spA, spBlocking, spLayouts) << " wrong\n";
+		bicgstab.set_preconditioner(make_sp(new ug::Jacobi<ug::CPUAlgebra>(0.8)));
+		std::cout << "bicgstab jacobi: " << compare_solver(bicgstab, spA, spBlocking, spLayouts) << " wrong\n";
+
+		ug::GMRES<V> gmres(20);
+		std::cout << "gmres: " << compare_solver(gmres, spA, spBlocking, spLayouts) << " wrong\n";
+	}
+	MPI_Finalize();
+}
@@ -0,0 +1,87 @@
+#include "common/util/trace.h"
+#include "lib_algebra/cpu_algebra_types.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/operator/convergence_check.h"
+#include "lib_algebra/operator/linear_solver/cg.h"
+#include "lib_algebra/operator/preconditioner/smoothed_aggregation_amg.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+
+#include <iostream>
+
+// smoothed aggregation amg as preconditioner for cg on a poisson problem
+// the number of steps has to stay (almost) constant under refinement and
+// must be the same for scalar and 2x2 block matrices
+
+typedef ug::CPUAlgebra A1;
+typedef ug::CPUBlockAlgebra<2> A2;
+
+// 5-point stencil on an n x n grid (dirichlet boundary eliminated),
+// the diagonal value is scaled by s
+template <typename TValue>
+void laplace(ug::SparseMatrix<TValue>& A, int n, const TValue& s)
+{
+	A.resize_and_clear(n*n, n*n);
+	for(int i=0; i<n; ++i)
+		for(int j=0; j<n; ++j){
+			const int k = i*n+j;
+			A(k,k) = s; A(k,k) *= 4.;
+			if(i>0){ A(k,k-n) = s; A(k,k-n) *= -1.;}
+			if(i<n-1){ A(k,k+n) = s; A(k,k+n) *= -1.;}
+			if(j>0){ A(k,k-1) = s; A(k,k-1) *= -1.;}
+			if(j<n-1){ A(k,k+1) = s; A(k,k+1) *= -1.;}
+		}
+	A.defragment();
+}
+
+template <typename TAlgebra>
+void solve(int n, const typename TAlgebra::matrix_type::value_type& s)
+{
+	typedef typename TAlgebra::matrix_type M;
+	typedef typename TAlgebra::vector_type V;
+
+	SmartPtr<ug::MatrixOperator<M, V> > spA = make_sp(new ug::MatrixOperator<M, V>);
+	laplace(spA->get_matrix(), n, s);
+
+	const size_t N = spA->num_rows();
+	V x(N), b(N);
+	x.set(0.0);
+	b.set(1.0);
+
+	SmartPtr<ug::SmoothedAggregationAMG<TAlgebra> > spAMG
+		= make_sp(new ug::SmoothedAggregationAMG<TAlgebra>);
+	spAMG->set_max_coarse_size(50);
+
+	SmartPtr<ug::StdConvCheck<V> > spConv
+		= make_sp(new ug::StdConvCheck<V>(100, 1e-30, 1e-10, false));
+
+	ug::CG<V> solver;
+	solver.set_preconditioner(spAMG);
+	solver.set_convergence_check(spConv);
+	solver.init(spA);
+	if(!solver.apply_return_defect(x, b)){ untested();
+		std::cout << "n=" << n << ": not converged\n";
+		return;
+	}
+
+	std::cout << "n=" << n << ": " << spAMG->num_levels() << " levels, "
+	          << spConv->step() << " steps\n";
+}
+
+int main()
+{
+	std::cout << "== scalar\n";
+	for(int n=16; n<=128; n*=2)
+		solve<A1>(n, 1.);
+
+	std::cout << "== 2x2 blocks\n";
+	ug::DenseMatrix<ug::FixedArray2<double, 2, 2> > s;
+	s = 0.0; s(0,0) = 1.; s(1,1) = 1.;
+	for(int n=16; n<=128; n*=2)
+		solve<A2>(n, s);
+}
@@ -0,0 +1,161 @@
+#define UG_PARALLEL
+
+#include "common/util/trace.h"
+#include "lib_algebra/cpu_algebra_types.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/operator/convergence_check.h"
+#include "lib_algebra/operator/linear_solver/cg.h"
+#include "lib_algebra/operator/preconditioner/smoothed_aggregation_amg.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "common/util/binary_buffer.cpp" // ?
+#include "common/util/file_util.cpp" // ?
+#include "common/util/os_dependent_impl/file_util_posix.cpp" // ?
+#include "common/util/os_dependent_impl/os_info_linux.cpp" // ?
+#include "pcl/pcl_base.cpp" // ?
+#include "pcl/pcl_util.cpp" // ?
+#include "pcl/pcl_comm_world.cpp" // ?
+#include "pcl/pcl_process_communicator.cpp" // ?
+#include "common/error.cpp" // ?
+#include "common/util/variant.cpp" // ?
+#include "lib_algebra/parallelization/parallel_nodes.cpp" // ?
+#include "lib_algebra/parallelization/parallelization_util.cpp" // ?
+#include "lib_grid/parallelization/parallel_grid_layout.cpp" // ?
+
+#include <iostream>
+#include <cmath>
+
+// smoothed aggregation amg on a distributed poisson problem. the fine
+// levels are aggregated on each process and the coarse levels are gathered
+// on one process. the solution must match the one of a hierarchy built on
+// the whole matrix on one process, and the number of cg steps must stay
+// close to it.
+// the n x n grid is cut into strips of grid lines, neighboring strips share
+// a line, which is master on the lower and slave on the upper process.
+
+typedef ug::CPUAlgebra::matrix_type M;
+typedef ug::CPUAlgebra::vector_type V;
+typedef ug::MatrixOperator<M, V> Op;
+
+// first and last grid line of a strip
+void strip(int n, int rank, int size, int& first, int& last)
+{
+	first = rank * (n-1) / size;
+	last = (rank+1) * (n-1) / size;
+	if(rank == 0) first = 0;
+	if(rank == size-1) last = n-1;
+}
+
+// additive 5-point stencil on the lines of a strip (dirichlet boundary
+// eliminated), the shared lines get half of the couplings along the line
+void laplace(Op& A, V& b, int n, int rank, int size)
+{
+	int first, last;
+	strip(n, rank, size, first, last);
+	const int numLines = last - first + 1;
+
+	A.resize_and_clear(numLines*n, numLines*n);
+	b.resize(numLines*n);
+	for(int i=first; i<=last; ++i)
+		for(int j=0; j<n; ++j){
+			const int k = (i-first)*n+j;
+			const bool bShared = (i == first && rank > 0) || (i == last && rank < size-1);
+			const double w = bShared ? 0.5 : 1.;
+			A(k,k) = 4.*w;
+			if(j>0) A(k,k-1) = -w;
+			if(j<n-1) A(k,k+1) = -w;
+			if(i>first) A(k,k-n) = -1.;
+			if(i<last) A(k,k+n) = -1.;
+			b[k] = w;
+		}
+	A.defragment();
+}
+
+void make_layouts(ug::AlgebraLayouts& layouts, int n, int rank, int size)
+{
+	int first, last;
+	strip(n, rank, size, first, last);
+
+	layouts.clear();
+	if(rank < size-1){
+		ug::IndexLayout::Interface& master = layouts.master().interface(rank+1);
+		for(int j=0; j<n; ++j) master.push_back((last-first)*n+j);
+	}
+	if(rank > 0){
+		ug::IndexLayout::Interface& slave = layouts.slave().interface(rank-1);
+		for(int j=0; j<n; ++j) slave.push_back(j);
+	}
+}
+
+// solves with cg and amg, returns the number of steps
+int solve(int n, int rank, int size, SmartPtr<ug::AlgebraLayouts> spLayouts, V& x)
+{
+	SmartPtr<Op> spA = make_sp(new Op);
+	V b;
+	spA->set_layouts(spLayouts);
+	laplace(*spA, b, n, rank, size);
+	spA->set_storage_type(ug::PST_ADDITIVE);
+
+	x.resize(b.size());
+	x.set(0.0);
+	x.set_layouts(spLayouts); b.set_layouts(spLayouts);
+	x.set_storage_type(ug::PST_CONSISTENT); b.set_storage_type(ug::PST_ADDITIVE);
+
+	SmartPtr<ug::SmoothedAggregationAMG<ug::CPUAlgebra> > spAMG
+		= make_sp(new ug::SmoothedAggregationAMG<ug::CPUAlgebra>);
+	spAMG->set_max_coarse_size(50);
+	spAMG->set_agglomeration_size(200);
+
+	SmartPtr<ug::StdConvCheck<V> > spConv
+		= make_sp(new ug::StdConvCheck<V>(100, 1e-30, 1e-12, false));
+
+	ug::CG<V> solver;
+	solver.set_preconditioner(spAMG);
+	solver.set_convergence_check(spConv);
+	solver.init(spA);
+	if(!solver.apply_return_defect(x, b)) return -1;
+	return spConv->step();
+}
+
+int main(int argc, char* argv[])
+{
+	MPI_Init(&argc, &argv);
+	{
+		int rank, size;
+		MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+		MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+		for(int n=32; n<=96; n+=32){
+		//	whole problem on each process
+			SmartPtr<ug::AlgebraLayouts> spSerial(new ug::AlgebraLayouts);
+			spSerial->proc_comm() = pcl::ProcessCommunicator(pcl::PCD_LOCAL);
+			V xSerial;
+			const int stepsSerial = solve(n, 0, 1, spSerial, xSerial);
+
+		//	distributed problem
+			SmartPtr<ug::AlgebraLayouts> spLayouts(new ug::AlgebraLayouts);
+			make_layouts(*spLayouts, n, rank, size);
+			V x;
+			const int steps = solve(n, rank, size, spLayouts, x);
+
+			int first, last;
+			strip(n, rank, size, first, last);
+			int numWrong = 0;
+			for(size_t k=0; k<x.size(); ++k)
+				if(std::fabs(x[k] - xSerial[first*n+k]) > 1e-8) ++numWrong;
+			numWrong = spLayouts->proc_comm().allreduce(numWrong, PCL_RO_SUM);
+			const int maxSteps = spLayouts->proc_comm().allreduce(steps, PCL_RO_MAX);
+
+			if(rank == 0)
+				std::cout << "n=" << n << ": " << numWrong << " wrong, steps "
+				          << ((stepsSerial > 0 && maxSteps > 0 && maxSteps <= 2 * stepsSerial)
+				              ? "ok" : "too many") << "\n";
+		}
+	}
+	MPI_Finalize();
+}
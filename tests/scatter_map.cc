@@ -0,0 +1,217 @@
+#include "lib_grid/multi_grid.h"
+#include "lib_grid/subset_handler.h"
+#include "lib_disc/function_spaces/approximation_space.h"
+#include "lib_algebra/cpu_algebra/sparsematrix.h"
+#include "lib_disc/spatial_disc/local_to_global/local_to_global_scatter_map.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "lib_disc/function_spaces/approximation_space.cpp" // ?
+#include "lib_disc/dof_manager/dof_distribution.cpp" // ?
+#include "common/util/message_hub.cpp" // ?
+#include "common/util/variant.cpp" // ?
+#include "lib_algebra/algebra_type.cpp" // ?
+#include "lib_disc/dof_manager/dof_count.cpp" // ?
+#include "lib_disc/dof_manager/dof_distribution_info.cpp" // ?
+#include "lib_disc/dof_manager/dof_index_storage.cpp" // ?
+#include "lib_disc/dof_manager/function_pattern.cpp" // ?
+#include "lib_disc/dof_manager/orientation.cpp" // ?
+#include "lib_disc/local_finite_element/local_finite_element_id.cpp" // ?
+#include "lib_disc/spatial_disc/disc_util/geom_cache.cpp" // ?
+#include "lib_grid/algorithms/debug_util.cpp" // ?
+#include "lib_grid/algorithms/subset_dim_util.cpp" // ?
+#include "lib_grid/grid/grid.cpp" // ?
+#include "lib_grid/grid/grid_base_objects.cpp" // ?
+#include "lib_grid/grid/grid_connection_managment.cpp" // ?
+#include "lib_grid/grid/grid_util.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_2d.cpp" // ?
+#include "lib_grid/lib_grid_messages.cpp" // ?
+#include "lib_grid/multi_grid.cpp" // ?
+#include "lib_grid/tools/subset_group.cpp" // ?
+#include "lib_grid/tools/subset_handler_multi_grid.cpp" // ?
+#include "lib_grid/tools/surface_view.cpp" // ?
+#include "common/error.cpp" // ?
+#include "lib_disc/common/function_group.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/vertex_util.cpp" // ?
+#include "lib_grid/tools/periodic_boundary_manager.cpp" // ?
+#include "lib_grid/tools/subset_handler_grid.cpp" // ?
+#include "lib_grid/tools/subset_handler_interface.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/edge_util.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/face_util.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/misc_util.cpp" // ?
+#include "lib_grid/grid_objects/pyramid_rules.cpp" // ?
+#include "lib_grid/grid/neighborhood.cpp" // ?
+#include "lib_grid/grid_objects/tetrahedron_rules.cpp" // ?
+#include "lib_grid/refinement/regular_refinement.cpp" // ?
+#include "lib_grid/grid/grid_adjacency_snapshot.cpp" // ?
+#include "lib_grid/grid/grid_object_collection.cpp" // ?
+#include "lib_disc/reference_element/reference_element.cpp" // ?
+#include "common/allocators/slab_allocator.cpp" // ?
+#include "lib_grid/common_attachments.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_1d.cpp" // ?
+#include "common/math/math_vector_matrix/math_vector.cpp" // ?
+#include "lib_grid/tools/grid_level.cpp" // ?
+#include "lib_disc/local_finite_element/local_finite_element_provider.cpp" // ?
+#include "lib_grid/grid_objects/rule_util.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrange.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrange_local_dof.cpp" // ?
+#include "lib_disc/local_finite_element/local_dof_set.cpp" // ?
+#include "common/math/misc/math_util.cpp" // ?
+#include "common/math/misc/eigenvalues.cpp" // ?
+#include "common/math/misc/lineintersect_utils.cpp" // ?
+#include "lib_disc/local_finite_element/lagrange/lagrangep1.cpp" // ?
+#include "lib_disc/local_finite_element/mini/mini.cpp" // ?
+#include "lib_disc/reference_element/reference_mapping_provider.cpp" // ?
+
+#include <iostream>
+#include <vector>
+
+// adding the element matrices with the positions replayed by the scatter map
+// must give exactly the same matrix as the search for the connections, also
+// if the elements come in another order or the indices changed in between.
+
+using namespace ug;
+
+typedef SparseMatrix<double> M;
+
+static unsigned rnd_state = 1;
+unsigned rnd(unsigned n)
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) % n;
+}
+
+// n x n cells, every second one split into two triangles
+void create_grid(MultiGrid& mg, MGSubsetHandler& sh, int n)
+{
+	std::vector<Vertex*> vVrt((n+1)*(n+1));
+	for(size_t i = 0; i < vVrt.size(); ++i)
+		vVrt[i] = *mg.create<RegularVertex>();
+
+	for(int j = 0; j < n; ++j)
+		for(int i = 0; i < n; ++i){
+			Vertex* v0 = vVrt[j*(n+1)+i];
+			Vertex* v1 = vVrt[j*(n+1)+i+1];
+			Vertex* v2 = vVrt[(j+1)*(n+1)+i+1];
+			Vertex* v3 = vVrt[(j+1)*(n+1)+i];
+			if((i+j) % 2){
+				mg.create<Quadrilateral>(QuadrilateralDescriptor(v0, v1, v2, v3));
+			}
+			else{
+				mg.create<Triangle>(TriangleDescriptor(v0, v1, v2));
+				mg.create<Triangle>(TriangleDescriptor(v0, v2, v3));
+			}
+		}
+
+	sh.assign_subset(mg.begin<Face>(), mg.end<Face>(), 0);
+	sh.assign_subset(mg.begin<Edge>(), mg.end<Edge>(), 0);
+	sh.assign_subset(mg.begin<Vertex>(), mg.end<Vertex>(), 0);
+	sh.subset_info(0).name = "inner";
+	sh.subset_info(0).set_property("dim", 2);
+}
+
+// element matrices with random values, the same for both matrices
+void assemble(M& A, M& B, LocalToGlobalScatterMap<M>& map,
+              const DoFDistribution& dd, const std::vector<Face*>& vElem)
+{
+	A.clear_retain_structure();
+	B.clear_retain_structure();
+	map.begin_pass(B, dd);
+
+	LocalIndices ind;
+	LocalMatrix lmat;
+	for(size_t e = 0; e < vElem.size(); ++e){
+		dd.indices(vElem[e], ind, false);
+		lmat.resize(ind);
+		for(size_t f1 = 0; f1 < ind.num_fct(); ++f1)
+			for(size_t d1 = 0; d1 < ind.num_dof(f1); ++d1)
+				for(size_t f2 = 0; f2 < ind.num_fct(); ++f2)
+					for(size_t d2 = 0; d2 < ind.num_dof(f2); ++d2)
+						lmat.value(f1, d1, f2, d2) = rnd(1000) / 7.;
+		AddLocalMatrixToGlobal(A, lmat);
+		map.add(B, lmat);
+	}
+}
+
+// the pattern of all elements
+void create_pattern(M& A, const DoFDistribution& dd, const std::vector<Face*>& vElem)
+{
+	A.resize_and_clear(dd.num_indices(), dd.num_indices());
+	LocalIndices ind;
+	for(size_t e = 0; e < vElem.size(); ++e){
+		dd.indices(vElem[e], ind, false);
+		for(size_t f1 = 0; f1 < ind.num_fct(); ++f1)
+			for(size_t d1 = 0; d1 < ind.num_dof(f1); ++d1)
+				for(size_t f2 = 0; f2 < ind.num_fct(); ++f2)
+					for(size_t d2 = 0; d2 < ind.num_dof(f2); ++d2)
+						A(ind.index(f1, d1), ind.index(f2, d2)) = 0.0;
+	}
+}
+
+// returns the number of entries that differ
+size_t compare(const M& A, const M& B)
+{
+	size_t numWrong = (A.total_num_connections() == B.total_num_connections()) ? 0 : 1;
+	for(size_t r = 0; r < B.num_rows(); ++r)
+		for(M::const_row_iterator it = B.begin_row(r); it != B.end_row(r); ++it)
+			if(A(r, it.index()) != it.value()) ++numWrong;
+	return numWrong;
+}
+
+void pass(const char* name, M& A, M& B, LocalToGlobalScatterMap<M>& map,
+          const DoFDistribution& dd, const std::vector<Face*>& vElem)
+{
+	assemble(A, B, map, dd, vElem);
+	std::cout << name << ": " << compare(A, B) << " wrong, "
+	          << (map.replayed() ? "replayed" : "searched") << "\n";
+}
+
+int main()
+{
+	SmartPtr<MultiGrid> spMG = make_sp(new MultiGrid);
+	spMG->set_options(GRIDOPT_STANDARD_INTERCONNECTION);
+	SmartPtr<MGSubsetHandler> spSH = make_sp(new MGSubsetHandler(*spMG));
+	create_grid(*spMG, *spSH, 6);
+
+	IApproximationSpace approx(spSH, spMG);
+	approx.add("u", "Lagrange", 2);
+	approx.init_levels();
+
+	DoFDistribution& dd = *approx.dof_distributions()[0];
+	std::vector<Face*> vElem(spMG->begin<Face>(), spMG->end<Face>());
+
+	M A, B;
+	create_pattern(A, dd, vElem);
+	create_pattern(B, dd, vElem);
+	LocalToGlobalScatterMap<M> map;
+
+	pass("record", A, B, map, dd, vElem);
+	pass("replay", A, B, map, dd, vElem);
+	pass("replay again", A, B, map, dd, vElem);
+
+//	two elements swapped: same number of entries, other indices
+	std::swap(vElem[3], vElem[vElem.size()-4]);
+	pass("swapped", A, B, map, dd, vElem);
+	pass("swapped, record", A, B, map, dd, vElem);
+	pass("swapped, replay", A, B, map, dd, vElem);
+
+//	a subset of the elements
+	std::vector<Face*> vSub(vElem.begin(), vElem.begin() + vElem.size() / 2);
+	pass("subset", A, B, map, dd, vSub);
+	pass("all", A, B, map, dd, vElem);
+	pass("all again", A, B, map, dd, vElem);
+
+//	permuted indices change the revision of the DoFDistribution
+	std::vector<size_t> vNew(dd.num_indices());
+	for(size_t i = 0; i < vNew.size(); ++i) vNew[i] = i;
+	for(size_t i = vNew.size() - 1; i > 0; --i) std::swap(vNew[i], vNew[rnd(i+1)]);
+	dd.permute_indices(vNew);
+	create_pattern(A, dd, vElem);
+	create_pattern(B, dd, vElem);
+	pass("permuted", A, B, map, dd, vElem);
+	pass("permuted, replay", A, B, map, dd, vElem);
+}
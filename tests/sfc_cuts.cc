@@ -0,0 +1,135 @@
+#define UG_PARALLEL
+
+#include "lib_grid/parallelization/space_filling_curve_cuts.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "common/util/binary_buffer.cpp" // ?
+#include "common/util/file_util.cpp" // ?
+#include "common/util/os_dependent_impl/file_util_posix.cpp" // ?
+#include "common/util/os_dependent_impl/os_info_linux.cpp" // ?
+#include "pcl/pcl_base.cpp" // ?
+#include "pcl/pcl_util.cpp" // ?
+#include "pcl/pcl_comm_world.cpp" // ?
+#include "pcl/pcl_process_communicator.cpp" // ?
+#include "lib_grid/parallelization/space_filling_curve_cuts.cpp" // ?
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// the cuts of a space filling curve have to be ascending for all tolerances,
+// since the segment of a key is found by a binary search in the cuts.
+// the weight in front of each cut has to be within the tolerance window, up to
+// the weight of the entries which share one curve index.
+
+static unsigned rnd_state = 1;
+double rnd()
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) / 32768.;
+}
+
+// returns the number of failed checks
+int check(const std::vector<uint64>& keys, const std::vector<double>& weights,
+          int numSegments, double tol, uint64 keyEnd)
+{
+	pcl::ProcessCommunicator com;
+	std::vector<uint64> cuts;
+	ug::FindSpaceFillingCurveCuts(cuts, keys, weights, numSegments, tol, keyEnd, com);
+
+	int failed = 0;
+	if(cuts.size() != (size_t)numSegments - 1){
+		std::cout << "wrong number of cuts\n";
+		return 1;
+	}
+
+	for(size_t i = 1; i < cuts.size(); ++i){
+		if(cuts[i] < cuts[i-1]){
+			std::cout << "cut " << i << " in front of cut " << i-1 << "\n";
+			++failed;
+		}
+	}
+
+	std::vector<double> segWeights(numSegments, 0);
+	for(size_t i = 0; i < keys.size(); ++i){
+		size_t s = std::upper_bound(cuts.begin(), cuts.end(), keys[i]) - cuts.begin();
+		segWeights[s] += weights[i];
+	}
+	std::vector<double> globalSegWeights(numSegments);
+	com.allreduce(&segWeights.front(), &globalSegWeights.front(), numSegments, PCL_RO_SUM);
+
+	double total = 0;
+	for(int s = 0; s < numSegments; ++s)
+		total += globalSegWeights[s];
+	double avg = total / numSegments;
+	double maxDev = std::min(std::max(0., 1. - tol), 0.5) * avg;
+
+	double localStep = 0, step = 0;
+	for(size_t i = 0; i < keys.size();){
+		double w = 0;
+		size_t j = i;
+		for(; j < keys.size() && keys[j] == keys[i]; ++j)
+			w += weights[j];
+		localStep = std::max(localStep, w);
+		i = j;
+	}
+	com.allreduce(&localStep, &step, 1, PCL_RO_SUM);
+
+	double front = 0;
+	for(int s = 0; s + 1 < numSegments; ++s){
+		front += globalSegWeights[s];
+		if(std::fabs(front - avg * (s+1)) > maxDev + step + 1e-10 * total){
+			std::cout << "cut " << s << " off by " << front - avg * (s+1)
+			          << ", allowed " << maxDev + step << "\n";
+			++failed;
+		}
+	}
+	return failed;
+}
+
+int main(int argc, char* argv[])
+{
+	MPI_Init(&argc, &argv);
+	int rank;
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	rnd_state += rank;
+
+	const uint64 keyEnd = (uint64)1 << 20;
+	double tols[] = {0., 0.3, 0.5, 0.9, 0.99};
+	int numSegs[] = {2, 7, 32};
+	int failed = 0;
+
+	for(int clustered = 0; clustered < 2; ++clustered){
+		// clustered keys share few curve positions, so that many cuts
+		// see the same weights in front of them.
+		std::vector<uint64> keys(2000);
+		std::vector<double> weights(keys.size());
+		for(size_t i = 0; i < keys.size(); ++i){
+			if(clustered)
+				keys[i] = (uint64)(rnd() * 64) * (keyEnd / 64);
+			else
+				keys[i] = (uint64)(rnd() * keyEnd);
+			weights[i] = 0.5 + rnd();
+		}
+		std::sort(keys.begin(), keys.end());
+
+		for(int t = 0; t < 5; ++t){
+			for(int n = 0; n < 3; ++n){
+				int f = check(keys, weights, numSegs[n], tols[t], keyEnd);
+				if(rank == 0)
+					std::cout << (clustered ? "clustered" : "uniform")
+					          << " tol " << tols[t] << " segments " << numSegs[n]
+					          << ": " << (f ? "wrong" : "ok") << "\n";
+				failed += f;
+			}
+		}
+	}
+
+	MPI_Finalize();
+	return failed ? 1 : 0;
+}
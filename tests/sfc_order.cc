@@ -0,0 +1,165 @@
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/subset_handler.h"
+#include "lib_grid/common_attachments.h"
+#include "lib_grid/algorithms/space_filling_curve_util.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "common/allocators/slab_allocator.cpp" // ?
+#include "lib_grid/grid/grid.cpp" // ?
+#include "lib_grid/grid/grid_base_objects.cpp" // ?
+#include "lib_grid/grid/grid_connection_managment.cpp" // ?
+#include "lib_grid/grid/grid_adjacency_snapshot.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_1d.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_2d.cpp" // ?
+#include "lib_grid/multi_grid.cpp" // ?
+#include "lib_grid/common_attachments.cpp" // ?
+#include "lib_grid/tools/subset_handler_interface.cpp" // ?
+#include "lib_grid/tools/subset_handler_grid.cpp" // ?
+#include "lib_grid/algorithms/debug_util.cpp" // ?
+#include "common/math/math_vector_matrix/math_vector.cpp" // ?
+#include "common/util/message_hub.cpp" // ?
+#include "common/util/variant.cpp" // ?
+#include "lib_grid/tools/periodic_boundary_manager.cpp" // ?
+#include "lib_grid/grid/grid_util.cpp" // ?
+#include "lib_grid/grid/grid_object_collection.cpp" // ?
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <cmath>
+
+// orders the elements of a grid along a space filling curve. the result
+// has to be a permutation of the elements, the attachments have to move with
+// their elements and the subsets have to contain the same elements in the
+// order of the grid.
+
+using namespace ug;
+
+static unsigned rnd_state = 1;
+unsigned rnd(unsigned n)
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) % n;
+}
+
+void test(SpaceFillingCurve sfc)
+{
+	const int n = 32;
+
+	Grid g;
+	g.attach_to_vertices(aPosition2);
+	Grid::VertexAttachmentAccessor<APosition2> aaPos(g, aPosition2);
+
+	AInt aID;
+	g.attach_to_vertices(aID);
+	g.attach_to_faces(aID);
+	Grid::AttachmentAccessor<Vertex, AInt> aaVrtID(g, aID);
+	Grid::AttachmentAccessor<Face, AInt> aaFaceID(g, aID);
+
+	SubsetHandler sh(g);
+
+//	create the vertices and quadrilaterals in random order
+	std::vector<int> vOrder(n*n);
+	for(int k=0; k<n*n; ++k) vOrder[k] = k;
+	for(int k=n*n-1; k>0; --k) std::swap(vOrder[k], vOrder[rnd(k+1)]);
+
+	std::vector<Vertex*> vVrt(n*n);
+	for(int k=0; k<n*n; ++k){
+		const int id = vOrder[k];
+		Vertex* v = *g.create<RegularVertex>();
+		aaPos[v] = vector2(id % n, id / n);
+		aaVrtID[v] = id;
+		sh.assign_subset(v, (id % n < n/2) ? 0 : 1);
+		vVrt[id] = v;
+	}
+
+	for(int k=0; k<n*n; ++k){
+		const int id = vOrder[k];
+		const int i = id % n, j = id / n;
+		if(i == n-1 || j == n-1) continue;
+		Face* f = *g.create<Quadrilateral>(QuadrilateralDescriptor(
+						vVrt[id], vVrt[id+1], vVrt[id+n+1], vVrt[id+n]));
+		aaFaceID[f] = id;
+		sh.assign_subset(f, (j < n/2) ? 0 : 1);
+	}
+
+	const size_t numVrt = g.num_vertices(), numFace = g.num_faces();
+
+	OrderAlongSpaceFillingCurve(sh, aaPos, sfc);
+
+//	each element is still there exactly once
+	std::set<int> sVrt, sFace;
+	for(VertexIterator iter = g.vertices_begin(); iter != g.vertices_end(); ++iter)
+		sVrt.insert(aaVrtID[*iter]);
+	for(FaceIterator iter = g.faces_begin(); iter != g.faces_end(); ++iter)
+		sFace.insert(aaFaceID[*iter]);
+	std::cout << "vertices: " << ((g.num_vertices() == numVrt && sVrt.size() == numVrt) ? "ok" : "wrong") << "\n";
+	std::cout << "faces: " << ((g.num_faces() == numFace && sFace.size() == numFace) ? "ok" : "wrong") << "\n";
+
+//	the attachment data moved with the elements
+	size_t numWrongData = 0;
+	for(VertexIterator iter = g.vertices_begin(); iter != g.vertices_end(); ++iter){
+		const vector2& p = aaPos[*iter];
+		if(aaVrtID[*iter] != (int)p.x() + n * (int)p.y()) ++numWrongData;
+	}
+	for(FaceIterator iter = g.faces_begin(); iter != g.faces_end(); ++iter){
+		if(aaVrtID[(*iter)->vertex(0)] != aaFaceID[*iter]) ++numWrongData;
+	}
+	std::cout << "attachments: " << numWrongData << " wrong\n";
+
+//	the grid is ordered along the curve
+	vector2 boxMin(0, 0), boxMax(n-1, n-1);
+	size_t numUnordered = 0;
+	uint64 last = 0;
+	number dist = 0;
+	Vertex* prev = NULL;
+	for(VertexIterator iter = g.vertices_begin(); iter != g.vertices_end(); ++iter){
+		const uint64 key = SpaceFillingCurveIndex<2>(sfc, aaPos[*iter], boxMin, boxMax);
+		if(prev){
+			if(key < last) ++numUnordered;
+			dist += VecDistance(aaPos[prev], aaPos[*iter]);
+		}
+		last = key;
+		prev = *iter;
+	}
+	std::cout << "unordered vertices: " << numUnordered << "\n";
+//	consecutive vertices along the hilbert curve are neighbors
+	if(sfc == SFC_HILBERT)
+		std::cout << "mean distance of consecutive vertices < 1.5: "
+		          << (dist / (numVrt - 1) < 1.5) << "\n";
+
+	last = 0;
+	numUnordered = 0;
+	for(FaceIterator iter = g.faces_begin(); iter != g.faces_end(); ++iter){
+		const uint64 key = SpaceFillingCurveIndex<2>(sfc, CalculateCenter(*iter, aaPos), boxMin, boxMax);
+		if(iter != g.faces_begin() && key < last) ++numUnordered;
+		last = key;
+	}
+	std::cout << "unordered faces: " << numUnordered << "\n";
+
+//	the subsets contain the same elements in the order of the grid
+	size_t numWrongSubset = 0, numInSubsets = 0;
+	for(int si = 0; si < sh.num_subsets(); ++si){
+		VertexIterator gIter = g.vertices_begin();
+		for(VertexIterator iter = sh.begin<Vertex>(si); iter != sh.end<Vertex>(si); ++iter){
+			++numInSubsets;
+			if(sh.get_subset_index(*iter) != si) ++numWrongSubset;
+			while(gIter != g.vertices_end() && *gIter != *iter) ++gIter;
+			if(gIter == g.vertices_end()) ++numWrongSubset;
+		}
+	}
+	std::cout << "subsets: " << ((numWrongSubset == 0 && numInSubsets == numVrt) ? "ok" : "wrong") << "\n";
+}
+
+int main()
+{
+	std::cout << "== hilbert\n";
+	test(SFC_HILBERT);
+	std::cout << "== morton\n";
+	test(SFC_MORTON);
+}
@@ -0,0 +1,142 @@
+#include "common/util/trace.h"
+#include "lib_algebra/cpu_algebra_types.h"
+#include "lib_algebra/cpu_algebra/single_precision_matrix.h"
+#include "lib_algebra/algebra_common/core_smoothers.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+
+#include <iostream>
+
+// SinglePrecisionMatrix has to hold the pattern of the original matrix with
+// all values rounded to float. a gauss-seidel step on it must give exactly
+// the same result as on a double precision matrix with rounded values.
+
+static unsigned rnd_state = 1;
+double rnd()
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) / 32768.;
+}
+
+void set_random(double& v, double diag){ v = diag + rnd() - 0.5; }
+template <typename TBlock>
+void set_random(TBlock& v, double diag)
+{
+	for(size_t r=0; r<GetRows(v); ++r)
+		for(size_t c=0; c<GetCols(v); ++c)
+			BlockRef(v, r, c) = ((r == c) ? diag : 0.) + rnd() - 0.5;
+}
+
+template <typename T>
+void set_random(ug::DenseVector<T>& v, double diag)
+{
+	for(size_t i=0; i<v.size(); ++i) v[i] = diag + rnd() - 0.5;
+}
+
+void round_to_float(double& v){ v = (float)v; }
+template <typename TBlock>
+void round_to_float(TBlock& v)
+{
+	for(size_t r=0; r<GetRows(v); ++r)
+		for(size_t c=0; c<GetCols(v); ++c)
+			BlockRef(v, r, c) = (float)BlockRef(v, r, c);
+}
+
+bool equal(const double& a, const double& b){ return a == b; }
+template <typename TBlock>
+bool equal(const TBlock& a, const TBlock& b)
+{
+	for(size_t r=0; r<GetRows(a); ++r)
+		for(size_t c=0; c<GetCols(a); ++c)
+			if(BlockRef(a, r, c) != BlockRef(b, r, c)) return false;
+	return true;
+}
+
+template <typename T>
+bool equal(const ug::DenseVector<T>& a, const ug::DenseVector<T>& b)
+{
+	for(size_t i=0; i<a.size(); ++i)
+		if(a[i] != b[i]) return false;
+	return true;
+}
+
+template <typename TAlgebra>
+void test(const char* name)
+{
+	typedef typename TAlgebra::matrix_type M;
+	typedef typename TAlgebra::vector_type V;
+	typedef typename M::value_type block;
+	typedef typename M::const_row_iterator row_it;
+	typedef typename ug::SinglePrecisionMatrix<M>::const_row_iterator float_row_it;
+
+//	random pattern, inserted in random order, not defragmented. row 7
+//	has no diagonal entry.
+	const size_t n = 200;
+	M A;
+	A.resize_and_clear(n, n);
+	for(size_t k=0; k<6*n; ++k){
+		const size_t r = rnd() * n, c = rnd() * n;
+		if(r != 7 || c != 7) set_random(A(r, c), 0.);
+	}
+	for(size_t r=0; r<n; ++r)
+		if(r != 7) set_random(A(r, r), 20.);
+
+	ug::SinglePrecisionMatrix<M> Af;
+	Af.init(A);
+
+	const M& cA = A;
+	M Ar;
+	Ar.set_as_copy_of(A);
+	size_t nnz = 0, numWrong = 0;
+	for(size_t r=0; r<n; ++r){
+		float_row_it itf = Af.begin_row(r);
+		for(row_it it = cA.begin_row(r); it != cA.end_row(r); ++it, ++itf){
+			++nnz;
+			block v = it.value();
+			round_to_float(v);
+			if(itf == Af.end_row(r) || itf.index() != it.index() || !equal(itf.value(), v))
+				++numWrong;
+		}
+		if(itf != Af.end_row(r)) ++numWrong;
+		for(typename M::row_iterator it = Ar.begin_row(r); it != Ar.end_row(r); ++it)
+			round_to_float(it.value());
+	}
+	std::cout << name << ": rows " << (Af.num_rows() == n ? "ok" : "wrong")
+	          << ", connections " << (Af.total_num_connections() == nnz ? "ok" : "wrong")
+	          << ", values " << numWrong << " wrong\n";
+
+	size_t numWrongDiag = 0;
+	for(size_t r=0; r<n; ++r){
+		const bool bHasDiag = Af.get_diag_connection(r) != Af.end_row(r);
+		if(bHasDiag != (r != 7)) ++numWrongDiag;
+		if(bHasDiag && (Af.get_diag_connection(r).index() != r
+		                || !equal(Af.diag(r), Ar(r, r)))) ++numWrongDiag;
+	}
+	std::cout << name << ": diagonal " << numWrongDiag << " wrong\n";
+
+//	the missing diagonal entry would make the smoother fail
+	Ar(7, 7) = 20.;
+	A(7, 7) = 20.;
+	Af.init(A);
+
+	V d(n), c(n), cf(n);
+	for(size_t i=0; i<n; ++i) set_random(d[i], 0.);
+	ug::gs_step_LL(Ar, c, d, 1.0);
+	ug::gs_step_LL(Af, cf, d, 1.0);
+	size_t numWrongGS = 0;
+	for(size_t i=0; i<n; ++i)
+		if(!equal(c[i], cf[i])) ++numWrongGS;
+	std::cout << name << ": gauss-seidel " << numWrongGS << " wrong\n";
+}
+
+int main()
+{
+	test<ug::CPUAlgebra>("scalar");
+	test<ug::CPUBlockAlgebra<2> >("2x2 blocks");
+	test<ug::CPUBlockAlgebra<3> >("3x3 blocks");
+}
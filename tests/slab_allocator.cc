@@ -0,0 +1,96 @@
+#include "common/util/trace.h"
+#include "common/allocators/slab_allocator.h"
+
+#include "common/allocators/slab_allocator.cpp" // ?
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cstring>
+#include <stdint.h>
+
+// random allocations and releases from a SlabAllocator. the blocks must be
+// aligned, must not overlap and must keep their contents. all slabs have to
+// be released once all blocks are released.
+
+struct Block{
+	unsigned char* p;
+	size_t size;
+	unsigned char fill;
+};
+
+static unsigned rnd_state = 1;
+unsigned rnd(unsigned n)
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) % n;
+}
+
+int main()
+{
+	ug::SlabAllocator alloc;
+	std::vector<Block> vBlocks;
+	size_t numMisaligned = 0, numOverlap = 0, numCorrupt = 0;
+
+	for(int step=0; step<200000; ++step){
+		if(vBlocks.empty() || rnd(100) < 55){
+			Block b;
+			b.size = 1 + rnd(600);
+			b.fill = (unsigned char)rnd(256);
+			b.p = (unsigned char*)alloc.allocate(b.size);
+			if(((uintptr_t)b.p) % ug::SlabAllocator::s_granularity) ++numMisaligned;
+			std::memset(b.p, b.fill, b.size);
+			vBlocks.push_back(b);
+		}
+		else{
+			const size_t i = rnd(vBlocks.size());
+			Block& b = vBlocks[i];
+			for(size_t k=0; k<b.size; ++k)
+				if(b.p[k] != b.fill){ untested(); ++numCorrupt; break;}
+			alloc.deallocate(b.p, b.size);
+			vBlocks[i] = vBlocks.back();
+			vBlocks.pop_back();
+		}
+	}
+
+	std::cout << "live blocks: " << vBlocks.size() << "\n";
+
+//	live blocks must not overlap
+	std::map<unsigned char*, size_t> mBlocks;
+	for(size_t i=0; i<vBlocks.size(); ++i)
+		mBlocks[vBlocks[i].p] = vBlocks[i].size;
+	unsigned char* end = NULL;
+	for(std::map<unsigned char*, size_t>::iterator it = mBlocks.begin();
+		it != mBlocks.end(); ++it){
+		if(it->first < end) ++numOverlap;
+		end = it->first + it->second;
+	}
+
+	for(size_t i=0; i<vBlocks.size(); ++i){
+		Block& b = vBlocks[i];
+		for(size_t k=0; k<b.size; ++k)
+			if(b.p[k] != b.fill){ untested(); ++numCorrupt; break;}
+		alloc.deallocate(b.p, b.size);
+	}
+	vBlocks.clear();
+
+	std::cout << "misaligned: " << numMisaligned << "\n";
+	std::cout << "overlapping: " << numOverlap << "\n";
+	std::cout << "corrupted: " << numCorrupt << "\n";
+
+	alloc.release_spare_slabs();
+	std::cout << "slabs after release: " << alloc.num_slabs() << "\n";
+
+//	blocks allocated one after another are contiguous
+	unsigned char* p[4];
+	for(int i=0; i<4; ++i) p[i] = (unsigned char*)alloc.allocate(48);
+	bool bContiguous = true;
+	for(int i=1; i<4; ++i)
+		if(p[i] != p[i-1] + 48) bContiguous = false;
+	std::cout << "contiguous: " << bContiguous << "\n";
+
+//	released blocks are reused
+	alloc.deallocate(p[1], 48);
+	std::cout << "reused: " << (alloc.allocate(48) == p[1]) << "\n";
+	std::cout << "slabs: " << alloc.num_slabs() << "\n";
+}
@@ -0,0 +1,109 @@
+#include "common/util/trace.h"
+#include "lib_algebra/cpu_algebra/sparsematrix_impl.h"
+#include "lib_algebra/cpu_algebra/vector.h"
+
+#include "common/log.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+
+#include <vector>
+#include <cmath>
+
+// sparse_matrix finalized state test
+// random insertion into a defragmented (finalized) matrix, then SpMV
+
+// deterministic random numbers, independent of the libc
+static unsigned long s_seed = 1;
+static unsigned next_rand(unsigned n)
+{
+	s_seed = s_seed * 1103515245 + 12345;
+	return (unsigned)((s_seed / 65536) % 32768) % n;
+}
+
+typedef ug::SparseMatrix<double> M;
+typedef ug::Vector<double> V;
+
+// compares A*x and A^T*x with a dense reference
+bool check_spmv(const M& A, const std::vector<double>& dense, int N)
+{
+	V x(N), b(N), bt(N);
+	for(int i=0; i<N; ++i){
+		x[i] = 1. + i%7;
+	}
+	A.apply(b, x);
+	A.apply_transposed(bt, x);
+
+	for(int r=0; r<N; ++r){
+		double s = 0., st = 0.;
+		for(int c=0; c<N; ++c){
+			s += dense[r*N+c] * x[c];
+			st += dense[c*N+r] * x[c];
+		}
+		if(std::fabs(s - b[r]) > 1e-12 || std::fabs(st - bt[r]) > 1e-12){
+			return false;
+		}
+	}
+	return true;
+}
+
+// assembles a random matrix in two phases: some entries, defragment(),
+// then more entries at random positions (new rows and new connections)
+bool test_random_assembly(int N)
+{
+	M A;
+	A.resize_and_clear(N, N);
+	std::vector<double> dense(N*N, 0.);
+
+	const int n0 = N + next_rand(2*N);
+	for(int k=0; k<n0; ++k){
+		int r = next_rand(N/2), c = next_rand(N);
+		double v = 1. + next_rand(10);
+		A(r, c) += v;
+		dense[r*N+c] += v;
+	}
+
+	A.defragment();
+	assert(A.is_finalized());
+	if(!check_spmv(A, dense, N)){ untested();
+		return false;
+	}
+
+	const int n1 = 4*N + next_rand(4*N);
+	for(int k=0; k<n1; ++k){
+		int r = next_rand(N), c = next_rand(N);
+		double v = 1. + next_rand(10);
+		A(r, c) += v;
+		dense[r*N+c] += v;
+	}
+
+	return check_spmv(A, dense, N);
+}
+
+int main()
+{
+	const int numTests = 200;
+	int numWrong = 0;
+	for(int i=0; i<numTests; ++i){
+		if(!test_random_assembly(5 + next_rand(40))){ untested();
+			++numWrong;
+		}
+	}
+	std::cout << "== random assembly after defragment\n";
+	std::cout << numTests << " assemblies, " << numWrong << " wrong\n";
+
+	// explicit finalize, value changes keep the state, new connections leave it
+	M A;
+	A.resize_and_clear(3, 3);
+	A(0, 0) = 1.; A(1, 1) = 2.; A(2, 2) = 3.;
+	A.finalize();
+	std::cout << "finalized " << A.is_finalized() << "\n";
+	A(1, 1) = 4.;
+	std::cout << "finalized after value change " << A.is_finalized() << "\n";
+	A(0, 2) = 1.;
+	std::cout << "finalized after insertion " << A.is_finalized() << "\n";
+
+	return numWrong != 0;
+}
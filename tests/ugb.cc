@@ -0,0 +1,228 @@
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/subset_handler.h"
+#include "lib_grid/selector.h"
+#include "lib_grid/common_attachments.h"
+#include "lib_grid/file_io/file_io_ugb.h"
+
+#include "common/log.cpp" // ?
+#include "lib_grid/file_io/file_io_ugb.cpp" // ?
+#include "common/assert.cpp" // ?
+#include "common/debug_id.cpp" // ?
+#include "common/util/binary_buffer.cpp" // ?
+#include "common/util/crc32.cpp" // ?
+#include "common/util/message_hub.cpp" // ?
+#include "common/util/ostream_buffer_splitter.cpp" // ?
+#include "common/util/variant.cpp" // ?
+#include "lib_grid/algorithms/debug_util.cpp" // ?
+#include "lib_grid/algorithms/serialization.cpp" // ?
+#include "lib_grid/file_io/file_io_lgb.cpp" // ?
+#include "lib_grid/grid/grid.cpp" // ?
+#include "lib_grid/grid/grid_base_objects.cpp" // ?
+#include "lib_grid/grid/grid_connection_managment.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_2d.cpp" // ?
+#include "lib_grid/lib_grid_messages.cpp" // ?
+#include "lib_grid/multi_grid.cpp" // ?
+#include "lib_grid/refinement/projectors/projection_handler.cpp" // ?
+#include "lib_grid/tools/subset_handler_multi_grid.cpp" // ?
+#include "common/util/string_util.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/edge_util.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/face_util.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/vertex_util.cpp" // ?
+#include "lib_grid/algorithms/subset_dim_util.cpp" // ?
+#include "lib_grid/algorithms/subset_util.cpp" // ?
+#include "lib_grid/grid/grid_util.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_3d.cpp" // ?
+#include "lib_grid/refinement/projectors/elliptic_cylinder_projector.cpp" // ?
+#include "lib_grid/refinement/projectors/neurite_projector.cpp" // ?
+#include "lib_grid/tools/periodic_boundary_manager.cpp" // ?
+#include "lib_grid/tools/selector_grid.cpp" // ?
+#include "lib_grid/tools/selector_multi_grid.cpp" // ?
+#include "lib_grid/tools/subset_group.cpp" // ?
+#include "lib_grid/tools/subset_handler_grid.cpp" // ?
+#include "lib_grid/tools/subset_handler_interface.cpp" // ?
+#include "lib_grid/tools/surface_view.cpp" // ?
+#include "common/error.cpp" // ?
+#include "common/util/file_util.cpp" // ?
+#include "lib_grid/algorithms/field_util.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/misc_util.cpp" // ?
+#include "lib_grid/algorithms/orientation_util.cpp" // ?
+#include "lib_grid/algorithms/polychain_util.cpp" // ?
+#include "lib_grid/algorithms/subset_color_util.cpp" // ?
+#include "lib_grid/grid/neighborhood.cpp" // ?
+#include "lib_grid/grid_objects/rule_util.cpp" // ?
+#include "lib_grid/refinement/regular_refinement.cpp" // ?
+#include "lib_grid/tools/selector_interface.cpp" // ?
+#include "common/util/os_dependent_impl/file_util_posix.cpp" // ?
+#include "lib_grid/algorithms/element_side_util.cpp" // ?
+#include "lib_grid/grid_objects/pyramid_rules.cpp" // ?
+#include "lib_grid/grid_objects/tetrahedron_rules.cpp" // ?
+#include "lib_grid/grid/grid_adjacency_snapshot.cpp" // ?
+#include "lib_grid/grid/grid_object_collection.cpp" // ?
+#include "common/allocators/slab_allocator.cpp" // ?
+#include "lib_grid/common_attachments.cpp" // ?
+#include "lib_grid/grid_objects/grid_objects_1d.cpp" // ?
+#include "common/math/math_vector_matrix/math_vector.cpp" // ?
+#include "lib_grid/tools/grid_level.cpp" // ?
+#include "common/math/misc/math_util.cpp" // ?
+#include "common/math/misc/eigenvalues.cpp" // ?
+#include "common/math/misc/lineintersect_utils.cpp" // ?
+#include "lib_grid/refinement/projectors/smooth_projector.cpp" // ?
+#include "lib_grid/refinement/projectors/subdivision_projector.cpp" // ?
+#include "lib_grid/algorithms/geom_obj_util/volume_util.cpp" // ?
+#include "common/util/os_dependent_impl/os_info_linux.cpp" // ?
+#include "lib_grid/algorithms/heightfield_util.cpp" // ?
+#include "lib_grid/file_io/file_io_asc.cpp" // ?
+#include "lib_grid/algorithms/raster_layer_util.cpp" // ?
+#include "lib_grid/parallelization/parallel_grid_layout.cpp" // ?
+#include "lib_grid/grid_objects/hexahedron_rules.cpp" // ?
+#include "lib_grid/grid_objects/prism_rules.cpp" // ?
+#include "lib_grid/grid_objects/octahedron_rules.cpp" // ?
+#include "lib_grid/algorithms/subdivision/subdivision_rules_piecewise_loop.cpp" // ?
+#include "common/util/demangle.cpp" // ?
+
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <cstdio>
+
+// a grid written to an ugb file and read back must have the same elements,
+// positions, subsets, selection and vertex attachment values. this is
+// checked for uncompressed and for zlib compressed sections.
+
+using namespace ug;
+
+static unsigned rnd_state = 1;
+double rnd()
+{
+	rnd_state = rnd_state * 1103515245u + 12345u;
+	return ((rnd_state >> 16) & 0x7fff) / 32768.;
+}
+
+// n x n cells, every second one split into two triangles. the left half of
+// the faces is in subset 0, the right half in subset 1. the diagonal
+// vertices are selected.
+void create_grid(Grid& grid, SubsetHandler& sh, Selector& sel, APosition2& aPos,
+                 ANumber& aVal, int n)
+{
+	grid.attach_to_vertices(aPos);
+	grid.attach_to_vertices(aVal);
+	Grid::VertexAttachmentAccessor<APosition2> aaPos(grid, aPos);
+	Grid::VertexAttachmentAccessor<ANumber> aaVal(grid, aVal);
+
+	std::vector<Vertex*> vVrt((n+1)*(n+1));
+	for(size_t i = 0; i < vVrt.size(); ++i){
+		vVrt[i] = *grid.create<RegularVertex>();
+		aaPos[vVrt[i]] = vector2((number)(i % (n+1)) / n, (number)(i / (n+1)) / n);
+		aaVal[vVrt[i]] = rnd();
+		if(i % (n+1) == i / (n+1)) sel.select(vVrt[i]);
+	}
+
+	for(int j = 0; j < n; ++j)
+		for(int i = 0; i < n; ++i){
+			Vertex* v0 = vVrt[j*(n+1)+i];
+			Vertex* v1 = vVrt[j*(n+1)+i+1];
+			Vertex* v2 = vVrt[(j+1)*(n+1)+i+1];
+			Vertex* v3 = vVrt[(j+1)*(n+1)+i];
+			const int si = (i < n/2) ? 0 : 1;
+			if((i+j) % 2){
+				sh.assign_subset(*grid.create<Quadrilateral>(QuadrilateralDescriptor(v0, v1, v2, v3)), si);
+			}
+			else{
+				sh.assign_subset(*grid.create<Triangle>(TriangleDescriptor(v0, v1, v2)), si);
+				sh.assign_subset(*grid.create<Triangle>(TriangleDescriptor(v0, v2, v3)), si);
+			}
+		}
+	sh.subset_info(0).name = "left";
+	sh.subset_info(1).name = "right";
+}
+
+// returns the number of elements of the given type, which differ in corner
+// positions or subset
+template <typename TElem>
+size_t compare(Grid& g1, SubsetHandler& sh1, APosition2& aPos1,
+               Grid& g2, SubsetHandler& sh2, APosition2& aPos2)
+{
+	if(g1.num<TElem>() != g2.num<TElem>())
+		return 1 + g1.num<TElem>();
+
+	Grid::VertexAttachmentAccessor<APosition2> aaPos1(g1, aPos1), aaPos2(g2, aPos2);
+	size_t numWrong = 0;
+	typedef typename Grid::traits<TElem>::iterator iterator;
+	iterator iter2 = g2.begin<TElem>();
+	for(iterator iter1 = g1.begin<TElem>(); iter1 != g1.end<TElem>(); ++iter1, ++iter2){
+		bool bWrong = sh1.get_subset_index(*iter1) != sh2.get_subset_index(*iter2);
+		for(size_t i = 0; i < NumVertices(*iter1); ++i)
+			if(aaPos1[GetVertex(*iter1, i)] != aaPos2[GetVertex(*iter2, i)])
+				bWrong = true;
+		if(bWrong) ++numWrong;
+	}
+	return numWrong;
+}
+
+size_t file_size(const char* filename)
+{
+	std::ifstream in(filename, std::ios::binary | std::ios::ate);
+	return in.tellg();
+}
+
+void check(int compressionLevel, size_t& sizeOut)
+{
+	const char* filename = "ugb_test.ugb";
+	rnd_state = 1;
+
+	Grid g1;
+	SubsetHandler sh1(g1);
+	Selector sel1(g1);
+	APosition2 aPos1;
+	ANumber aVal1;
+	create_grid(g1, sh1, sel1, aPos1, aVal1, 40);
+
+	GridWriterUGB writer;
+	writer.set_compression_level(compressionLevel);
+	writer.add_grid(g1, aPos1);
+	writer.add_subset_handler(sh1, "defSH");
+	writer.add_selector(sel1, "diagonal");
+	writer.add_vertex_attachment(aVal1, "value");
+	writer.write_to_file(filename);
+	sizeOut = file_size(filename);
+
+	Grid g2;
+	SubsetHandler sh2(g2);
+	Selector sel2(g2);
+	APosition2 aPos2;
+	ANumber aVal2;
+	AInt aWrongType;
+	GridReaderUGB reader;
+	bool bOk = reader.parse_file(filename)
+				&& reader.grid(g2, aPos2)
+				&& reader.subset_handler(sh2, 0)
+				&& reader.selector(sel2, 0)
+				&& reader.num_vertex_attachments() == 1
+				&& reader.vertex_attachment(aVal2, "value");
+	std::cout << "level " << compressionLevel << ": read " << (bOk ? "ok" : "failed") << "\n";
+
+	std::cout << "  vertices: " << compare<Vertex>(g1, sh1, aPos1, g2, sh2, aPos2) << " wrong\n";
+	std::cout << "  faces: " << compare<Face>(g1, sh1, aPos1, g2, sh2, aPos2) << " wrong\n";
+
+	size_t numWrong = (sel1.num<Vertex>() == sel2.num<Vertex>()) ? 0 : 1;
+	Grid::VertexAttachmentAccessor<ANumber> aaVal1(g1, aVal1), aaVal2(g2, aVal2);
+	VertexIterator iter2 = g2.begin<Vertex>();
+	for(VertexIterator iter1 = g1.begin<Vertex>(); iter1 != g1.end<Vertex>(); ++iter1, ++iter2){
+		if(sel1.is_selected(*iter1) != sel2.is_selected(*iter2)) ++numWrong;
+		if(aaVal1[*iter1] != aaVal2[*iter2]) ++numWrong;
+	}
+	std::cout << "  selection and values: " << numWrong << " wrong\n";
+
+	const bool bRejected = !reader.vertex_attachment(aWrongType, "value");
+	std::cout << "  wrong type rejected: " << (bRejected ? "yes" : "no") << "\n";
+
+	std::remove(filename);
+}
+
+int main()
+{
+	size_t sizeRaw, sizeCompressed;
+	check(0, sizeRaw);
+	check(6, sizeCompressed);
+	std::cout << "compressed smaller: " << (sizeCompressed < sizeRaw ? "yes" : "no") << "\n";
+}
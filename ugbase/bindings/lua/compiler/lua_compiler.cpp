@@ -37,9 +37,14 @@
 #include "bindings/lua/info_commands.h"
 #include "common/util/file_util.h"
 #include <fstream>
+#include <iomanip>
+#include <algorithm>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <sys/stat.h>
+#include <utime.h>
+#include <time.h>
 #include "lua_compiler.h"
 #include "lua_compiler_debug.h"
 #include "common/profiler/profiler.h"
@@ -54,7 +59,104 @@ extern bool useLuaCompiler;
 DebugID DID_LUACOMPILER("LUACompiler");
 
 namespace bridge {
-    
+
+///	maximal number of libraries kept in the LUA2C cache
+static size_t s_lua2cCacheSize = 256;
+
+void SetLUA2CCacheSize(size_t maxNumLibraries)
+{
+	s_lua2cCacheSize = maxNumLibraries;
+}
+
+#ifdef USE_LUA2C
+static const char* LUA2C_COMPILE_FLAGS = "gcc -fpic -O3 -c";
+static const char* LUA2C_LINK_FLAGS = "gcc -dynamiclib";
+
+///	returns the output of a shell command or an empty string on failure
+static string ShellOutput(const char* cmd)
+{
+	string res;
+	FILE* f = popen(cmd, "r");
+	if(f == nullptr) return res;
+	char buf[256];
+	while(fgets(buf, sizeof(buf), f) != nullptr)
+		res += buf;
+	pclose(f);
+	return res;
+}
+
+///	identifies the compiler and the flags used to build the LUA2C libraries
+/**	Libraries built by a different compiler or with different flags must not be
+ * reused from the cache. The identity is computed once per process.*/
+static const string& LUA2CCompilerIdentity()
+{
+	static string identity;
+	if(identity.empty()){
+		identity = ShellOutput("gcc --version 2>&1")
+					+ ShellOutput("gcc -dumpmachine 2>&1")
+					+ LUA2C_COMPILE_FLAGS + "\n" + LUA2C_LINK_FLAGS + "\n";
+	}
+	return identity;
+}
+
+///	64 bit FNV-1a hash of the whole string
+static uint64_t LUA2CHash(const string& s)
+{
+	uint64_t h = 14695981039346656037ULL;
+	for(size_t i = 0; i < s.size(); ++i){
+		h ^= (unsigned char)s[i];
+		h *= 1099511628211ULL;
+	}
+	return h;
+}
+
+///	returns true if the key stored in keyFile equals key
+static bool LUA2CKeyMatches(const string& keyFile, const string& key)
+{
+	vector<char> stored;
+	if(!FileExists(keyFile) || !ReadFile(keyFile.c_str(), stored, false))
+		return false;
+	return (stored.size() == key.size())
+			&& std::equal(stored.begin(), stored.end(), key.begin());
+}
+
+///	removes the least recently used libraries if the cache is full
+/**	Cache hits update the modification time of a library, so the oldest
+ * modification time marks the least recently used one. Temporary files older
+ * than a day are left from aborted processes and are removed, too.*/
+static void EvictLUA2CCache(const string& cacheDir)
+{
+	vector<string> files;
+	if(!GetFilesInDirectory(files, cacheDir.c_str()))
+		return;
+
+	const time_t now = time(nullptr);
+	vector<pair<time_t, string> > libs;
+	for(size_t i = 0; i < files.size(); ++i){
+		string file = cacheDir + files[i];
+		struct stat st;
+		if(stat(file.c_str(), &st) != 0)
+			continue;
+		if(FileTypeIs(files[i].c_str(), ".dylib"))
+			libs.push_back(make_pair(st.st_mtime, file));
+		else if(FileTypeIs(files[i].c_str(), ".tmp") && (now - st.st_mtime > 86400))
+			remove(file.c_str());
+	}
+
+	if(libs.size() <= s_lua2cCacheSize)
+		return;
+
+	sort(libs.begin(), libs.end());
+	const size_t numRemove = libs.size() - s_lua2cCacheSize;
+	for(size_t i = 0; i < numRemove; ++i){
+		const string& lib = libs[i].second;
+		UG_DLOG(DID_LUACOMPILER, 2, "LUA2C: evicting " << lib << " from cache\n");
+		remove(lib.c_str());
+		remove((lib.substr(0, lib.size() - 6) + ".key").c_str());
+	}
+}
+#endif
+
 
 bool LUACompiler::create(const char *functionName, LuaFunctionHandle* pHandle)
 {
@@ -114,8 +216,49 @@ bool LUACompiler::createC(const char *functionName, LuaFunctionHandle* pHandle)
 
 		UG_DLOG(DID_LUACOMPILER, 5, GetFileLines((p+"LUACompiler_output.c").c_str(), 1, -1, true) << "\n");
 
+	//	compiled functions are cached on disk. The key consists of the compiler
+	//	identity and the whole generated source. It is stored next to the
+	//	library and compared on lookup, so that hash collisions are detected.
+		string cacheDir = PathProvider::get_path(ROOT_PATH) + "/bin/LUACompiler_cache/";
+		if(!DirectoryExists(cacheDir))
+			CreateDirectory(cacheDir);
+
+		string key = LUA2CCompilerIdentity()
+					+ GetFileLines((p+"LUACompiler_output.c").c_str(), 1, -1, false);
+		stringstream ssCache;
+		ssCache << cacheDir << functionName << "_" << hex << setw(16) << setfill('0')
+				<< LUA2CHash(key) << dec;
+		string cacheFile = ssCache.str() + ".dylib";
+		string keyFile = ssCache.str() + ".key";
+		m_name = functionName;
+
+		if(FileExists(cacheFile) && LUA2CKeyMatches(keyFile, key))
+		{
+			UG_DLOG(DID_LUACOMPILER, 2, "using cached library " << cacheFile << "\n");
+			try{
+				m_libHandle = OpenLibrary(cacheFile.c_str());
+				m_f = (LUA2C_Function) GetLibraryProcedure(m_libHandle, functionName);
+			}
+			catch(std::string error)
+			{
+				UG_DLOG(DID_LUACOMPILER, 1, "LUA2C: could not open cached library "
+						<< cacheFile << ": " << error << ", recompiling.\n");
+				if(m_libHandle) CloseLibrary(m_libHandle);
+				m_libHandle = nullptr;
+				m_f = nullptr;
+			}
+			if(m_f != nullptr)
+			{
+			//	mark as recently used
+				utime(cacheFile.c_str(), nullptr);
+				UG_DLOG(DID_LUACOMPILER, 1, "OK (cached)\n");
+				bInitialized = true;
+				return true;
+			}
+		}
+
 
-		string c1s=string("gcc -fpic -O3 -c ") + p + "LUACompiler_output.c -o " + p + "LUACompiler_output.o";
+		string c1s=string(LUA2C_COMPILE_FLAGS) + " " + p + "LUACompiler_output.c -o " + p + "LUACompiler_output.o";
 		UG_DLOG(DID_LUACOMPILER, 2, "compiling line: " << c1s << "\n");
 		if(system(c1s.c_str()) != 0)
 		{
@@ -133,11 +276,14 @@ bool LUACompiler::createC(const char *functionName, LuaFunctionHandle* pHandle)
 		}
 	
 		bool bTmpFileSuccess=false;
-		m_name = functionName;
 
-		m_pDyn = MakeTmpFile(p+string(functionName), ".dylib", bTmpFileSuccess);
+	//	link to a temporary file and move it to the cache afterwards, so that
+	//	concurrent processes never open a partially written library
+		stringstream ssTmp;
+		ssTmp << cacheFile << "." << getpid();
+		string tmpDyn = MakeTmpFile(ssTmp.str(), ".tmp", bTmpFileSuccess);
 
-		string c2s=string("gcc -dynamiclib ") + p+"LUACompiler_output.o -o " + m_pDyn.c_str();
+		string c2s=string(LUA2C_LINK_FLAGS) + " " + p+"LUACompiler_output.o -o " + tmpDyn.c_str();
 
 		if(GetLogAssistant().is_output_process())
 		{	UG_DLOG(DID_LUACOMPILER, 2, "linking line: " << c2s << "\n"); }
@@ -156,8 +302,32 @@ bool LUACompiler::createC(const char *functionName, LuaFunctionHandle* pHandle)
 			}
 			return false;
 		}
+	//	the key is written before the library is moved to the cache. Both are
+	//	written to temporary files first, so that concurrent processes never
+	//	read a partially written file.
+		bool bCached = false;
+		{
+			stringstream ssTmpKey;
+			ssTmpKey << keyFile << "." << getpid() << ".tmp";
+			fstream keyOut(ssTmpKey.str().c_str(), fstream::out | fstream::binary);
+			keyOut << key;
+			keyOut.close();
+			bCached = keyOut.good()
+						&& (rename(ssTmpKey.str().c_str(), keyFile.c_str()) == 0)
+						&& (rename(tmpDyn.c_str(), cacheFile.c_str()) == 0);
+			remove(ssTmpKey.str().c_str());
+		}
+		if(bCached)
+			EvictLUA2CCache(cacheDir);
+		else
+		{
+		//	no cache available, use the temporary library and remove it when done
+			UG_DLOG(DID_LUACOMPILER, 1, "LUA2C: could not store " << cacheFile << " in cache.\n");
+			cacheFile = tmpDyn;
+			m_pDyn = tmpDyn;
+		}
 		try{
-		m_libHandle = OpenLibrary(m_pDyn.c_str());
+		m_libHandle = OpenLibrary(cacheFile.c_str());
 		}
 		catch(std::string error)
 		{
@@ -275,6 +445,23 @@ bool LUACompiler::call(double *ret, const double *in) const
 	}
 }
 
+bool LUACompiler::call(double *ret, size_t retStride, const double *in,
+                       size_t inStride, size_t n) const
+{
+	if(bVM)
+	{
+		vm->execute(ret, retStride, in, inStride, n);
+		return true;
+	}
+	else
+	{
+		UG_ASSERT(m_f != nullptr, "function " << m_name << " not valid");
+		for(size_t k = 0; k < n; ++k)
+			m_f(ret + k*retStride, in + k*inStride);
+		return true;
+	}
+}
+
 
 }
 }
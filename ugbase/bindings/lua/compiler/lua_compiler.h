@@ -98,9 +98,21 @@ public:
 	bool createC(const char *functionName, LuaFunctionHandle* pHandle = nullptr);
 	
 	bool call(double *ret, const double *in) const;
+
+	/// evaluates the function for n inputs
+	/**
+	 * The inputs of the k-th evaluation are read from in[k*inStride], ..., the
+	 * results are written to ret[k*retStride], ...
+	 */
+	bool call(double *ret, size_t retStride, const double *in, size_t inStride,
+	          size_t n) const;
 	virtual ~LUACompiler();
 };
 
+///	sets the maximal number of compiled LUA2C libraries kept in bin/LUACompiler_cache
+/**	If more libraries are cached, the least recently used ones are removed.*/
+void SetLUA2CCacheSize(size_t maxNumLibraries);
+
 
 }
 }
@@ -64,9 +64,26 @@ private:
 		OP_BINARY,
 		ASSIGN,
 		OP_RETURN,
-		OP_CALL
+		OP_CALL,
+	//	specialized binary operations, only used in the decoded program
+		OP_ADD,
+		OP_SUB,
+		OP_MUL,
+		OP_DIV
 	};
 
+	/// instruction of the decoded program
+	struct VMDecodedInstr
+	{
+		int instr;	///< VMInstruction
+		int arg;	///< 0-based variable, instruction index, operator or subfunction
+		double val;	///< constant of PUSH_CONSTANT
+	};
+
+	/// decoded program, built from vmBuf on first call
+	std::vector<VMDecodedInstr> m_code;
+	bool m_bDecoded;
+
 
 
 	void serializeVMInstr(VMInstruction inst)
@@ -86,6 +103,7 @@ private:
 	inline void serializeChar(char c)
 	{
 		vmBuf.push_back(c);
+		m_bDecoded = false;
 	}
 
 	inline void serializeInt(int d)
@@ -165,6 +183,7 @@ public:
 	VMAdd()
 	{
 			m_name = "unknown";
+			m_bDecoded = false;
 	}
 	void set_name(std::string name)
 	{
@@ -245,6 +264,7 @@ public:
 //		UG_LOG("adjusting jmp pos in " << iPos << " to " << jmpPos << "\n");
 		int *p = (int *)&vmBuf[iPos];
 		*p = jmpPos;
+		m_bDecoded = false;
 	}
 
 	void ret()
@@ -354,11 +374,8 @@ public:
 		variables.resize(nr);
 	}
 
-	inline void execute_unary(size_t &i, double &v)
+	inline void execute_unary(int op, double &v)
 	{
-		int op;
-//		UG_LOG("unary op " << v << "\n");
-		deserializeInt(i, op);
 		switch(op)
 		{
 			case LUAPARSER_MATH_COS: v = cos(v);	break;
@@ -373,14 +390,8 @@ public:
 		}
 	}
 
-	inline void execute_binary(size_t &i, double *stack, int SP)
+	inline void execute_binary(int op, double &a, const double b)
 	{
-		double &a = stack[SP-2];
-		double &b = stack[SP-1];
-//		UG_LOG("binary op " << a << " op " << b << "\n");
-
-		int op;
-		deserializeInt(i, op);
 		switch(op)
 		{
 			case '+': 	a = b+a;	break;
@@ -401,87 +412,147 @@ public:
 		}
 	}
 
+	/// decodes the serialized program into m_code
+	/**	Operands are read once, jump targets are translated to instruction
+	 * indices and the arithmetic binary operations get own instructions, so
+	 * that call() does not need to deserialize anything.*/
+	void decode()
+	{
+		m_code.clear();
+		std::vector<int> vInstrIndex(vmBuf.size()+1, -1);
+		for(size_t i=0; i<vmBuf.size(); )
+		{
+			vInstrIndex[i] = m_code.size();
+			VMDecodedInstr d;
+			d.arg = 0;
+			d.val = 0.0;
+			VMInstruction instr;
+			deserializeVMInstr(i, instr);
+			d.instr = instr;
+			switch(instr)
+			{
+				case PUSH_CONSTANT:
+					deserializeDouble(i, d.val);
+					break;
+				case PUSH_VAR:
+				case ASSIGN:
+					deserializeInt(i, d.arg);
+					d.arg -= 1;
+					break;
+				case JMP_IF_FALSE:
+				case JMP:
+				case OP_UNARY:
+				case OP_CALL:
+					deserializeInt(i, d.arg);
+					break;
+				case OP_BINARY:
+					deserializeInt(i, d.arg);
+					switch(d.arg)
+					{
+						case '+': d.instr = OP_ADD; break;
+						case '-': d.instr = OP_SUB; break;
+						case '*': d.instr = OP_MUL; break;
+						case '/': d.instr = OP_DIV; break;
+					}
+					break;
+				case OP_RETURN:
+					break;
+				default:
+					UG_THROW("VMAdd " << m_name << ": unknown instruction " << ((int)instr) << " at " << i);
+			}
+			m_code.push_back(d);
+		}
+		vInstrIndex[vmBuf.size()] = m_code.size();
+
+		for(size_t k=0; k<m_code.size(); k++)
+			if(m_code[k].instr == JMP || m_code[k].instr == JMP_IF_FALSE)
+			{
+				UG_COND_THROW(m_code[k].arg < 0 || m_code[k].arg > (int)vmBuf.size()
+				              || vInstrIndex[m_code[k].arg] < 0,
+				              "VMAdd " << m_name << ": invalid jump target " << m_code[k].arg);
+				m_code[k].arg = vInstrIndex[m_code[k].arg];
+			}
+		m_bDecoded = true;
+	}
+
 	double call(double *stack, int &SP)
 	{
-//		for(int j=0; j<variables.size(); j++)
-//		{UG_LOG("var[[" << j << "] = " << variables[j] << "\n");}
+		if(!m_bDecoded) decode();
+		UG_COND_THROW(m_code.empty(), "VMAdd " << m_name << ": empty program");
 
-		double varD;
-		int varI;
+		const VMDecodedInstr *code = &m_code[0];
+		double *var = variables.empty() ? NULL : &variables[0];
 		size_t i=0;
-		VMInstruction instr;
 		while(1)
 		{
-//			UG_LOG("IP =  " << i << ", SP = " << SP);
-			deserializeVMInstr(i, instr);
-//			UG_LOG("OP =  " << (int)instr << "\n");
-//			for(int j=0; j<SP; j++)
-//				{UG_LOG("SP[" << j << "] = " << stack[j] << ", ");}
-//			UG_LOG("\n");
-
-			switch(instr)
+			const VMDecodedInstr &c = code[i++];
+			switch(c.instr)
 			{
 				case PUSH_CONSTANT:
-
-					deserializeDouble(i, varD);
-//					UG_LOG("PUSH CONSTANT " << varD << "\n");
-					stack[SP++] = varD;
+					stack[SP++] = c.val;
 					break;
 
 				case PUSH_VAR:
-					deserializeInt(i, varI);
-					stack[SP++] = variables[varI-1];
-//					UG_LOG("PUSH VAR " << varI << "\n");
+					stack[SP++] = var[c.arg];
 					break;
 
 				case JMP_IF_FALSE:
-					deserializeInt(i, varI);
-//					UG_LOG("JMP IF FALSE " << varI << "\n");
 					SP--;
 					if(stack[SP] == 0.0)
-						i = varI;
+						i = c.arg;
 					break;
 				case JMP:
-					deserializeInt(i, varI);
-//					UG_LOG("JMP " << varI << "\n");
-					i = varI;
+					i = c.arg;
 					break;
 
 				case OP_UNARY:
 					UG_ASSERT(SP>0, SP);
-					execute_unary(i, stack[SP-1]);
+					execute_unary(c.arg, stack[SP-1]);
 					break;
 
+				case OP_ADD:
+					UG_ASSERT(SP>1, SP);
+					stack[SP-2] = stack[SP-1] + stack[SP-2];
+					SP--;
+					break;
+				case OP_SUB:
+					UG_ASSERT(SP>1, SP);
+					stack[SP-2] = stack[SP-1] - stack[SP-2];
+					SP--;
+					break;
+				case OP_MUL:
+					UG_ASSERT(SP>1, SP);
+					stack[SP-2] = stack[SP-1] * stack[SP-2];
+					SP--;
+					break;
+				case OP_DIV:
+					UG_ASSERT(SP>1, SP);
+					stack[SP-2] = stack[SP-1] / stack[SP-2];
+					SP--;
+					break;
 				case OP_BINARY:
 					UG_ASSERT(SP>1, SP);
-					execute_binary(i, stack, SP);
+					execute_binary(c.arg, stack[SP-2], stack[SP-1]);
 					SP--;
 					break;
 
 				case ASSIGN:
-					deserializeInt(i, varI);
 					SP--;
-//					UG_LOG("ASSIGN " << varI << " = " << stack[SP] << "\n");
-					variables[varI-1] = stack[SP];
+					var[c.arg] = stack[SP];
 					break;
 
 				case OP_RETURN:
-//					UG_LOG("RETURN\n");
 					UG_ASSERT(SP == (int)m_nrOut, "stack pointer is not nrOut =" << m_nrOut << ", instead " << SP << " ?")
 					return stack[0];
-					break;
 
 				case OP_CALL:
 				{
-					deserializeInt(i, varI);
-//					UG_LOG("call IP =  " << i << ", SP = " << SP << "\n");
-					SmartPtr<VMAdd> sub = subfunctions[varI];
+					SmartPtr<VMAdd> sub = subfunctions[c.arg];
 					sub->call_sub(stack, SP);
-//					UG_LOG("call IP =  " << i << ", SP = " << SP << "\n");
 					break;
 				}
 				default:
-					UG_ASSERT(0, "IP: " << i << " op " << ((int)instr) << " ?\n");
+					UG_ASSERT(0, "IP: " << i-1 << " op " << c.instr << " ?\n");
 			}
 		}
 	}
@@ -509,6 +580,28 @@ public:
 		return 1;
 	}
 
+	/// executes the function for n inputs
+	/**	The inputs of the k-th evaluation are in[k*inStride], ...,
+	 * in[k*inStride+num_in()-1], the results are written to ret[k*retStride],
+	 * ..., ret[k*retStride+num_out()-1].*/
+	int execute(double *ret, size_t retStride, const double *in, size_t inStride, size_t n)
+	{
+		double stack[255];
+		for(size_t k=0; k<n; k++)
+		{
+			int SP=0;
+			const double *pIn = in + k*inStride;
+			for(size_t i=0;i<m_nrIn; i++)
+				variables[i] = pIn[i];
+			call(stack, SP);
+			UG_ASSERT(SP == (int)m_nrOut, SP << " != " << m_nrOut);
+			double *pRet = ret + k*retStride;
+			for(size_t i=0; i<m_nrOut; i++)
+				pRet[i] = stack[i];
+		}
+		return 1;
+	}
+
 	double call()
 	{
 		double stack[255];
@@ -78,6 +78,9 @@ extern "C" // default lua
 
 
 #include "info_commands.h"
+#ifdef USE_LUA2C
+	#include "compiler/lua_compiler.h"
+#endif
 
 
 using namespace std;
@@ -1289,6 +1292,10 @@ bool RegisterInfoCommands(Registry &reg, const char* parentGroup)
 		                 "", "bEnable", "");
 		reg.add_function("EnableLUA2VM", &EnableLUA2VM, grp.c_str(),
 				"", "bEnable", "");
+#ifdef USE_LUA2C
+		reg.add_function("SetLUA2CCacheSize", &SetLUA2CCacheSize, grp.c_str(),
+				"", "maxNumLibraries", "sets the maximal number of compiled LUA2C functions kept on disk");
+#endif
 		reg.add_function("InitSignals", &InitSignals, grp.c_str());
 	}
 	UG_REGISTRY_CATCH_THROW(grp);
@@ -73,6 +73,21 @@ private:
 #endif
 
 
+/// restores the lua stack to its size at construction on every exit path
+/**
+ * Use this in functions that push values on the lua stack and may be left by
+ * an exception, e.g. when the results of a lua_pcall are checked.
+ */
+class LuaStackGuard
+{
+public:
+	LuaStackGuard(lua_State *L) : m_L(L), m_top(lua_gettop(L)) {}
+	~LuaStackGuard()	{lua_settop(m_L, m_top);}
+private:
+	lua_State *m_L;
+	int m_top;
+};
+
 }
 }
 #endif /* LUA_STACK_CHECK_H_ */
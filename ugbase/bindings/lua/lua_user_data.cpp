@@ -134,6 +134,8 @@ void RegisterLuaUserDataType(Registry& reg, string type, string grp)
 		reg.add_class_<T, TBase>(name, grp)
 			.template add_constructor<void (*)(const char*)>("Callback")
 			.template add_constructor<void (*)(LuaFunctionHandle)>("handle")
+			.add_method("set_batch_callback", static_cast<void (T::*)(const char*)>(&T::set_batch_callback), "", "BatchCallback", "sets a callback evaluating all points of an element in one call")
+			.add_method("set_batch_callback", static_cast<void (T::*)(LuaFunctionHandle)>(&T::set_batch_callback), "", "handle", "sets a callback evaluating all points of an element in one call")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, string("LuaUser").append(type), tag);
 	}
@@ -146,6 +148,8 @@ void RegisterLuaUserDataType(Registry& reg, string type, string grp)
 		reg.add_class_<T, TBase>(name, grp)
 			.template add_constructor<void (*)(const char*)>("Callback")
 			.template add_constructor<void (*)(LuaFunctionHandle)>("handle")
+			.add_method("set_batch_callback", static_cast<void (T::*)(const char*)>(&T::set_batch_callback), "", "BatchCallback", "sets a callback evaluating all points of an element in one call")
+			.add_method("set_batch_callback", static_cast<void (T::*)(LuaFunctionHandle)>(&T::set_batch_callback), "", "handle", "sets a callback evaluating all points of an element in one call")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, string("LuaCondUser").append(type), tag);
 	}
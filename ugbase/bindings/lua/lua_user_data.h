@@ -135,20 +135,65 @@ class LuaUserData
 	///	evaluates the data at a given point and time
 		inline TRet evaluate(TData& D, const MathVector<dim>& x, number time, int si) const;
 
+	/**
+	 * \brief sets a callback evaluating all integration points of an element at once
+	 *
+	 * The batch callback is invoked once per element (and series) instead of
+	 * once per integration point. It is called as f(X, t, si, n), where X is a
+	 * table holding the n points coordinate-wise, i.e. X[dim*(ip-1)+d] is the
+	 * d-th coordinate of the ip-th point (1-based). The table X is reused
+	 * between the calls and must not be stored. The callback returns a table
+	 * with the n values, stored in the same way (for conditional data a
+	 * table of flags precedes it). See batch_signature().
+	 *
+	 * If the callback has been compiled by LUA2C, the compiled pointwise
+	 * callback is preferred.
+	 *
+	 * \param luaCallback		name of Lua batch callback
+	 * \{
+	 */
+		void set_batch_callback(const char* luaCallback);
+		void set_batch_callback(LuaFunctionHandle handle);
+	/// \}
+
+	///	evaluates the data at nip points using as few Lua calls as possible
+		void evaluate_batch(TData vValue[], const MathVector<dim> vGlobIP[],
+		                    number time, int si, const size_t nip) const;
+
+	///	returns string of required batch callback signature
+		static std::string batch_signature();
+
 	protected:
 	///	sets that LuaUserData is created by LuaUserDataFactory
 		void set_created_from_factory(bool bFromFactory) {m_bFromFactory = bFromFactory;}
 
+	///	evaluates the batch callback for nip points
+		void eval_batch_callback(TData vValue[], const MathVector<dim> vGlobIP[],
+		                         number time, int si, const size_t nip) const;
+
+	///	frees the references of the batch callback
+		void free_batch_callback_ref();
+
 	protected:
 	///	callback name as string
 		std::string m_callbackName;
 
 	///	reference to lua function
 		int m_callbackRef;
+
+	///	name of and reference to lua batch function
+		std::string m_batchCallbackName;
+		int m_batchCallbackRef;
+
+	///	reference to the reused coordinate table passed to the batch function
+		int m_batchPosRef;
 		
 		#ifdef USE_LUA2C
     	/// LUACompiler type for compiled LUA code
 			bridge::LUACompiler m_luaComp;
+
+		///	in- and output buffers for batched calls of the compiled code
+			mutable std::vector<double> m_vCompIn, m_vCompRet;
 		#endif
 	///	flag, indicating if created from factory
 		bool m_bFromFactory;
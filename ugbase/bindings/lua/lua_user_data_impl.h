@@ -40,6 +40,7 @@
 #include "lib_disc/spatial_disc/user_data/const_user_data.h"
 
 #include "info_commands.h"
+#include "lua_stack_check.h"
 #include "common/util/number_util.h"
 
 #if 0
@@ -92,7 +93,9 @@ std::string LuaUserData<TData,dim,TRet>::name()
 
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::LuaUserData(const char* luaCallback)
-	: m_callbackName(luaCallback), m_bFromFactory(false)
+	: m_callbackName(luaCallback),
+	  m_batchCallbackRef(LUA_NOREF), m_batchPosRef(LUA_NOREF),
+	  m_bFromFactory(false)
 {
 //	get lua state
 	m_L = ug::script::GetDefaultLuaState();
@@ -119,7 +122,9 @@ LuaUserData<TData,dim,TRet>::LuaUserData(const char* luaCallback)
 
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::LuaUserData(LuaFunctionHandle handle)
-	: m_callbackName("__anonymous__lua__function__"), m_bFromFactory(false)
+	: m_callbackName("__anonymous__lua__function__"),
+	  m_batchCallbackRef(LUA_NOREF), m_batchPosRef(LUA_NOREF),
+	  m_bFromFactory(false)
 {
 //	get lua state
 	m_L = ug::script::GetDefaultLuaState();
@@ -351,11 +356,187 @@ evaluate(TData& D, const MathVector<dim>& x, number time, int si) const
 	}
 }
 
+template <typename TData, int dim, typename TRet>
+std::string LuaUserData<TData,dim,TRet>::batch_signature()
+{
+	std::stringstream ss;
+	ss << "function name(X, t, si, n)\n";
+	ss << "   -- X[" << dim << "*(ip-1)+d]: d-th coordinate of point ip = 1, ..., n\n";
+	ss << "   ... \n   return ";
+	if(lua_traits<TRet>::size != 0)
+		ss << "F, ";
+	ss << "V\n";
+	if(lua_traits<TRet>::size != 0)
+		ss << "   -- F[ip]: " << lua_traits<TRet>::signature() << " for point ip\n";
+	ss << "   -- V[" << lua_traits<TData>::size << "*(ip-1)+k]: k-th component of ("
+	   << lua_traits<TData>::signature() << ") for point ip\n";
+	ss << "end";
+	return ss.str();
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::free_batch_callback_ref()
+{
+	if(m_batchCallbackRef != LUA_NOREF){
+		luaL_unref(m_L, LUA_REGISTRYINDEX, m_batchCallbackRef);
+		m_batchCallbackRef = LUA_NOREF;
+	}
+	if(m_batchPosRef != LUA_NOREF){
+		luaL_unref(m_L, LUA_REGISTRYINDEX, m_batchPosRef);
+		m_batchPosRef = LUA_NOREF;
+	}
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::set_batch_callback(const char* luaCallback)
+{
+//	obtain a reference
+	lua_getglobal(m_L, luaCallback);
+
+//	make sure that the reference is valid
+	if(lua_isnil(m_L, -1)){
+		lua_pop(m_L, 1);
+		UG_THROW(name() << ": Specified lua batch callback "
+						"does not exist: " << luaCallback);
+	}
+
+//	store reference to lua function
+	free_batch_callback_ref();
+	m_batchCallbackName = luaCallback;
+	m_batchCallbackRef = luaL_ref(m_L, LUA_REGISTRYINDEX);
+
+//	table for the coordinates, reused for all calls
+	lua_newtable(m_L);
+	m_batchPosRef = luaL_ref(m_L, LUA_REGISTRYINDEX);
+
+//	make a test run
+	MathVector<dim> x; x = 0.0;
+	TData D;
+	eval_batch_callback(&D, &x, 0.0, 0, 1);
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::set_batch_callback(LuaFunctionHandle handle)
+{
+//	store reference to lua function
+	free_batch_callback_ref();
+	m_batchCallbackName = "__anonymous__lua__batch__function__";
+	lua_rawgeti(m_L, LUA_REGISTRYINDEX, handle.ref);
+	m_batchCallbackRef = luaL_ref(m_L, LUA_REGISTRYINDEX);
+
+//	table for the coordinates, reused for all calls
+	lua_newtable(m_L);
+	m_batchPosRef = luaL_ref(m_L, LUA_REGISTRYINDEX);
+
+//	make a test run
+	MathVector<dim> x; x = 0.0;
+	TData D;
+	eval_batch_callback(&D, &x, 0.0, 0, 1);
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::
+eval_batch_callback(TData vValue[], const MathVector<dim> vGlobIP[],
+                    number time, int si, const size_t nip) const
+{
+	PROFILE_CALLBACK()
+	const int valSize = lua_traits<TData>::size;
+	const int retSize = (lua_traits<TRet>::size > 0) ? 2 : 1;
+
+//	all values pushed below are popped on return and if an error is thrown
+	bridge::LuaStackGuard stackGuard(m_L);
+
+//	push the callback function on the stack
+	lua_rawgeti(m_L, LUA_REGISTRYINDEX, m_batchCallbackRef);
+
+//	fill the coordinate table and push it on the stack
+	lua_rawgeti(m_L, LUA_REGISTRYINDEX, m_batchPosRef);
+	for(size_t ip = 0; ip < nip; ++ip)
+		for(int d = 0; d < dim; ++d){
+			lua_pushnumber(m_L, vGlobIP[ip][d]);
+			lua_rawseti(m_L, -2, ip*dim + d + 1);
+		}
+
+//	push time, subset index and number of points on stack
+	lua_traits<number>::push(m_L, time);
+	lua_traits<int>::push(m_L, si);
+	lua_pushinteger(m_L, nip);
+
+//	call lua function
+	if(lua_pcall(m_L, 4, retSize, 0) != 0)
+		UG_THROW(name() << "::evaluate_batch(...): Error while "
+						"running batch callback '" << m_batchCallbackName << "',"
+						" lua message: "<< lua_tostring(m_L, -1)<<".\n"
+						"Use signature as follows:\n"
+						<< batch_signature());
+
+	try{
+		if(!lua_istable(m_L, -1))
+			UG_THROW("Values must be returned as table.");
+
+	//	read return values (flags of conditional data are not needed here)
+		double ret[valSize];
+		for(size_t ip = 0; ip < nip; ++ip){
+			for(int k = 0; k < valSize; ++k){
+				lua_rawgeti(m_L, -1, ip*valSize + k + 1);
+				ret[k] = ReturnValueToNumber(m_L, -1);
+				lua_pop(m_L, 1);
+			}
+			lua_traits<TData>::read(vValue[ip], ret, (void*)NULL);
+		}
+	}
+	UG_CATCH_THROW(name() << "::evaluate_batch(...): Error while running "
+					"batch callback '" << m_batchCallbackName << "'.\n"
+					"Use signature as follows:\n"
+					<< batch_signature());
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::
+evaluate_batch(TData vValue[], const MathVector<dim> vGlobIP[],
+               number time, int si, const size_t nip) const
+{
+    PROFILE_CALLBACK()
+//	the compiled callback does not enter the interpreter at all
+	#ifdef USE_LUA2C
+	if(useLuaCompiler && m_luaComp.is_valid())
+	{
+		if(nip == 0) return;
+		const size_t inSize = dim+2;
+		const size_t retSize = lua_traits<TData>::size+1;
+		m_vCompIn.resize(nip*inSize);
+		m_vCompRet.resize(nip*retSize);
+		for(size_t ip = 0; ip < nip; ++ip){
+			double* d = &m_vCompIn[ip*inSize];
+			for(int i=0; i<dim; i++)
+				d[i] = vGlobIP[ip][i];
+			d[dim] = time;
+			d[dim+1] = si;
+		}
+		m_luaComp.call(&m_vCompRet[0], retSize, &m_vCompIn[0], inSize, nip);
+		TRet *t=NULL;
+		for(size_t ip = 0; ip < nip; ++ip)
+			lua_traits<TData>::read(vValue[ip], &m_vCompRet[ip*retSize], t);
+		return;
+	}
+	#endif
+
+	if(m_batchCallbackRef != LUA_NOREF && nip > 0)
+	{
+		eval_batch_callback(vValue, vGlobIP, time, si, nip);
+		return;
+	}
+
+	for(size_t ip = 0; ip < nip; ++ip)
+		evaluate(vValue[ip], vGlobIP[ip], time, si);
+}
+
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::~LuaUserData()
 {
 //	free reference to callback
 	luaL_unref(m_L, LUA_REGISTRYINDEX, m_callbackRef);
+	free_batch_callback_ref();
 
 	if(m_bFromFactory)
 		LuaUserDataFactory<TData,dim,TRet>::remove(m_callbackName);
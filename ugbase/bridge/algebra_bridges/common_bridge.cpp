@@ -58,6 +58,7 @@
 #include "lib_algebra/operator/operator_util.h"
 #include "lib_algebra/operator/vector_writer.h"
 #include "../util_overloaded.h"
+#include "lib_algebra/cpu_algebra/algebra_threading.h"
 
 #include "bridge_mat_vec_operations.h"
 #include "matrix_diagonal.h"
@@ -502,6 +503,14 @@ static void Common(Registry& reg, string grp)
 			.add_method("compose_file_path", &T::leave_section)
 			.set_construct_as_smart_pointer(true);
 	}
+
+// Threading of the cpu algebra
+	{
+		reg.add_function("SetAlgebraNumThreads", &SetAlgebraNumThreads, grp,
+				"", "numThreads", "sets the number of threads used for SpMV and vector operations (0 = OpenMP default)");
+		reg.add_function("AlgebraNumThreads", &AlgebraNumThreads, grp,
+				"numThreads", "", "number of threads used for SpMV and vector operations");
+	}
 }
 
 }; // end Functionality
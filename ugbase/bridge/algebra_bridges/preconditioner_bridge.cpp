@@ -163,7 +163,9 @@ static void Algebra(Registry& reg, string grp)
 			//.add_method("set_ordering_algorithm", &T::set_ordering_algorithm, "", "",
 			//			"sets an ordering algorithm")
 			.add_method("set_sor_relax", &T::set_sor_relax,
-					"", "sor relaxation", "sets sor relaxation parameter");
+					"", "sor relaxation", "sets sor relaxation parameter")
+			.add_method("enable_level_scheduling", &T::enable_level_scheduling, "", "enable", "processes independent rows of the sweeps in parallel threads (level sets)")
+			.add_method("enable_single_precision", &T::enable_single_precision, "", "enable", "stores the matrix for the sweeps in single precision");
 		reg.add_class_to_group(name, "GaussSeidelBase", tag);
 	}
 
@@ -233,6 +235,8 @@ static void Algebra(Registry& reg, string grp)
 						"set whether preprocessing (notably, LU factorization) is to be disabled - usable when the operator has not changed; use with care")
 			.add_method("enable_consistent_interfaces", &T::enable_consistent_interfaces, "", "enable", "Make Matrix consistent for connections in interfaces.")
 			.add_method("enable_overlap", &T::enable_overlap, "", "enable", "Enables matrix overlap. This also means that interfaces are consistent.")
+			.add_method("enable_level_scheduling", &T::enable_level_scheduling, "", "enable", "processes independent rows of the triangular solves in parallel threads (level sets)")
+			.add_method("enable_single_precision", &T::enable_single_precision, "", "enable", "stores the factors in single precision for the triangular solves")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "ILU", tag);
 	}
@@ -252,10 +256,34 @@ static void Algebra(Registry& reg, string grp)
 			.add_method("set_ordering_algorithm", &T::set_ordering_algorithm, "", "",
 						"sets an ordering algorithm")
 			.add_method("set_sort", &T::set_sort, "", "bSort", "if bSort=true, use a cuthill-mckey sorting to reduce fill-in. default true")
+			.add_method("enable_single_precision", &T::enable_single_precision, "", "enable", "stores the factors in single precision for the triangular solves")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "ILUT", tag);
 	}
 
+//	Smoothed Aggregation AMG
+	{
+		typedef SmoothedAggregationAMG<TAlgebra> T;
+		typedef IPreconditioner<TAlgebra> TBase;
+		string name = string("SmoothedAggregationAMG").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Smoothed Aggregation Algebraic Multigrid")
+			.add_constructor()
+			.add_method("set_strength_threshold", &T::set_strength_threshold, "", "theta", "threshold for strong couplings used in the aggregation. default 0.08")
+			.add_method("set_max_levels", &T::set_max_levels, "", "maxLevels")
+			.add_method("set_max_coarse_size", &T::set_max_coarse_size, "", "maxCoarseSize", "size below which the coarsest level is solved directly")
+			.add_method("set_agglomeration_size", &T::set_agglomeration_size, "", "size", "global size below which a distributed level is gathered on one process. default 2000")
+			.add_method("set_num_presmooth", &T::set_num_presmooth, "", "num")
+			.add_method("set_num_postsmooth", &T::set_num_postsmooth, "", "num")
+			.add_method("set_smoother_damp", &T::set_smoother_damp, "", "damp", "damping of the jacobi smoother")
+			.add_method("set_cycle_type", &T::set_cycle_type, "", "type", "1 = V-cycle, 2 = W-cycle")
+			.add_method("set_info", &T::set_info, "", "info", "print hierarchy after setup")
+			.add_method("num_levels", &T::num_levels, "number of levels")
+			.add_method("operator_complexity", &T::operator_complexity, "operator complexity")
+			.add_method("grid_complexity", &T::grid_complexity, "grid complexity")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "SmoothedAggregationAMG", tag);
+	}
+
 //	ILU Threshold Scalar
 	{
 		typedef ILUTScalarPreconditioner<TAlgebra> T;
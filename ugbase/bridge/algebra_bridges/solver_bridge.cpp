@@ -47,6 +47,7 @@
 #include "lib_algebra/operator/linear_solver/auto_linear_solver.h"
 #include "lib_algebra/operator/linear_solver/analyzing_solver.h"
 #include "lib_algebra/operator/linear_solver/cg.h"
+#include "lib_algebra/operator/linear_solver/pipelined_cg.h"
 #include "lib_algebra/operator/linear_solver/bicgstab.h"
 #include "lib_algebra/operator/linear_solver/gmres.h"
 #include "lib_algebra/operator/linear_solver/lu.h"
@@ -213,10 +214,25 @@ static void Algebra(Registry& reg, string grp)
 			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> >, SmartPtr<IConvergenceCheck<vector_type> >) )("precond#convCheck")
 			.add_method("add_postprocess_corr", &T::add_postprocess_corr, "adds a postprocess of the corrections", "op")
 			.add_method("remove_postprocess_corr", &T::remove_postprocess_corr, "removes a postprocess of the corrections", "op")
+			.add_method("set_single_reduction", &T::set_single_reduction, "", "bSingleReduction", "computes all scalar products of an iteration in one reduction (Chronopoulos/Gear)")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "CG", tag);
 	}
 
+	// 	Pipelined CG Solver
+	{
+		typedef PipelinedCG<vector_type> T;
+		typedef IPreconditionedLinearOperatorInverse<vector_type> TBase;
+		string name = string("PipelinedCG").append(suffix);
+		reg.add_class_<T,TBase>(name, grp, "Pipelined Conjugate Gradient Solver (Ghysels/Vanroose)")
+			.add_constructor()
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> > ) )("precond")
+			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> >, SmartPtr<IConvergenceCheck<vector_type> >) )("precond#convCheck")
+			.add_method("set_replace_residual", &T::set_replace_residual, "", "freq", "recomputes the residual every freq iterations (0 = never)")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "PipelinedCG", tag);
+	}
+
 // 	BiCGStab Solver
 	{
 		typedef BiCGStab<vector_type> T;
@@ -228,6 +244,7 @@ static void Algebra(Registry& reg, string grp)
 			. ADD_CONSTRUCTOR( (SmartPtr<ILinearIterator<vector_type,vector_type> >, SmartPtr<IConvergenceCheck<vector_type> >) )("precond#convCheck")
 			.add_method("set_restart", &T::set_restart)
 			.add_method("set_min_orthogonality", &T::set_min_orthogonality)
+			.add_method("set_fused_reductions", &T::set_fused_reductions, "", "bFused", "computes the scalar products in three reductions per iteration")
 			.add_method("add_postprocess_corr", &T::add_postprocess_corr, "adds a postprocess of the corrections", "op")
 			.add_method("remove_postprocess_corr", &T::remove_postprocess_corr, "removes a postprocess of the corrections", "op")
 			.set_construct_as_smart_pointer(true);
@@ -241,6 +258,7 @@ static void Algebra(Registry& reg, string grp)
 		string name = string("GMRES").append(suffix);
 		reg.add_class_<T,TBase>(name, grp, "GMRES Solver")
 			.ADD_CONSTRUCTOR( (size_t restar) )("restart")
+			.add_method("set_classical_gram_schmidt", &T::set_classical_gram_schmidt, "", "bCGS", "classical Gram-Schmidt with reorthogonalization (two reductions per step)")
 			.add_method("add_postprocess_corr", &T::add_postprocess_corr, "adds a postprocess of the corrections", "op")
 			.add_method("remove_postprocess_corr", &T::remove_postprocess_corr, "removes a postprocess of the corrections", "op")
 			.set_construct_as_smart_pointer(true);
@@ -57,6 +57,9 @@
 #include "lib_disc/time_disc/time_integrator_observers/lua_callback_observer.hpp"
 #include "lib_disc/time_disc/time_integrator_subject.hpp"
 #include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
+#include "lib_disc/operator/linear_operator/matrix_free_operator.h"
+#include "lib_disc/operator/linear_operator/matrix_free_jacobi.h"
+#include "lib_disc/operator/linear_operator/matrix_free_chebyshev.h"
 #include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
 #include "lib_disc/operator/non_linear_operator/line_search.h"
 #include "lib_disc/operator/linear_operator/nested_iteration/nested_iteration.h"
@@ -274,6 +277,57 @@ static void Algebra(Registry& reg, string parentGroup)
 		reg.add_class_to_group(name, "AssembledLinearOperator", tag);
 	}
 
+//	MatrixFreeOperator
+	{
+		std::string grp = parentGroup; grp.append("/Discretization");
+		typedef MatrixFreeOperator<TAlgebra> T;
+		typedef ILinearOperator<vector_type> TBase;
+		string name = string("MatrixFreeOperator").append(suffix);
+		reg.add_class_<T, TBase>(name, grp)
+			.add_constructor()
+			.template add_constructor<void (*)(SmartPtr<IAssemble<TAlgebra> >)>("Assembling Routine")
+			.template add_constructor<void (*)(SmartPtr<IAssemble<TAlgebra> >, const GridLevel&)>("AssemblingRoutine#GridLevel")
+			.add_method("set_discretization", &T::set_discretization)
+			.add_method("set_level", &T::set_level)
+			.add_method("set_dirichlet_values", &T::set_dirichlet_values)
+			.add_method("set_cache_local_jacobians", &T::set_cache_local_jacobians, "", "bCache",
+					"store the local jacobians for repeated application (default: false)")
+			.add_method("init", static_cast<void (T::*)(const vector_type&)>(&T::init), "", "u",
+					"sets the linearization point")
+			.add_method("level", &T::level)
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MatrixFreeOperator", tag);
+	}
+
+//	MatrixFreeJacobi
+	{
+		std::string grp = parentGroup; grp.append("/Discretization");
+		typedef MatrixFreeJacobi<TAlgebra> T;
+		typedef ILinearIterator<vector_type> TBase;
+		string name = string("MatrixFreeJacobi").append(suffix);
+		reg.add_class_<T, TBase>(name, grp, "Jacobi smoother for matrix-free operators")
+			.add_constructor()
+			.template add_constructor<void (*)(number)>("DampingFactor")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MatrixFreeJacobi", tag);
+	}
+
+//	MatrixFreeChebyshev
+	{
+		std::string grp = parentGroup; grp.append("/Discretization");
+		typedef MatrixFreeChebyshev<TAlgebra> T;
+		typedef ILinearIterator<vector_type> TBase;
+		string name = string("MatrixFreeChebyshev").append(suffix);
+		reg.add_class_<T, TBase>(name, grp, "Chebyshev smoother for matrix-free operators")
+			.add_constructor()
+			.add_method("set_degree", &T::set_degree, "", "degree")
+			.add_method("set_eigenvalue_ratio", &T::set_eigenvalue_ratio, "", "ratio")
+			.add_method("set_num_power_iterations", &T::set_num_power_iterations, "", "num")
+			.add_method("set_max_eigenvalue", &T::set_max_eigenvalue, "", "lambdaMax")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "MatrixFreeChebyshev", tag);
+	}
+
 
 #if ENABLE_NESTED_NEWTON_RESOLFUNC_UPDATE
 	//	generic Newton updater
@@ -309,6 +363,7 @@ static void Algebra(Registry& reg, string parentGroup)
 			.add_method("disable_line_search", &T::disable_line_search)
 			.add_method("line_search", &T::line_search, "lineSeach", "")
 			.add_method("set_reassemble_J_freq", &T::set_reassemble_J_freq, "reassemble freq. for Jacobian")
+			.add_method("set_matrix_free", &T::set_matrix_free, "", "bMatrixFree")
 			.add_method("init", &T::init, "success", "op")
 			.add_method("prepare", &T::prepare, "success", "u")
 			.add_method("apply", &T::apply, "success", "u")
@@ -251,6 +251,12 @@ static void Algebra(Registry& reg, string grp)
 				"whether matrix is constant in time", "")
 			.add_method("set_matrix_structure_is_const", &T::set_matrix_structure_is_const, "",
 				"whether matrix has constant in time structure", "")
+			.add_method("set_use_scatter_map", &T::set_use_scatter_map, "",
+				"bUse", "reuses the positions of the element matrix entries in the global matrix if the structure is constant. default true")
+			.add_method("set_num_threads", &T::set_num_threads, "",
+				"numThreads", "sets the number of threads used in the colored element loops (requires OPENMP)")
+			.add_method("num_threads", &T::num_threads, "number of threads", "",
+				"returns the number of threads used in the element loops")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name+suffix, name, tag);
 	}
@@ -45,6 +45,7 @@
 #include "lib_disc/function_spaces/approximation_space.h"
 
 #include "lib_disc/spatial_disc/disc_util/fv_output.h"
+#include "lib_disc/spatial_disc/disc_util/geom_cache.h"
 
 using namespace std;
 
@@ -164,6 +165,15 @@ static void Algebra(Registry& reg, string grp)
  */
 static void Common(Registry& reg, string grp)
 {
+//	geometry cache
+	{
+		reg.add_function("EnableGeometryCache", &GeomCacheControl::enable, grp,
+				"", "bEnable", "caches element geometries (FV1, FE) for static meshes");
+		reg.add_function("SetGeometryCacheMemoryBudget", &GeomCacheControl::set_memory_budget, grp,
+				"", "MB", "sets the memory shared by all geometry caches");
+		reg.add_function("InvalidateGeometryCache", &GeomCacheControl::invalidate, grp,
+				"", "", "drops all cached element geometries");
+	}
 }
 
 }; // end Functionality
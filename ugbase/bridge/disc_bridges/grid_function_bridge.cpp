@@ -603,6 +603,9 @@ static void Common(Registry& reg, string grp)
 		.add_method("init_levels", &T::init_levels)
 		.add_method("init_surfaces", &T::init_surfaces)
 		.add_method("init_top_surface", &T::init_top_surface)
+		.add_method("set_index_cache", &T::set_index_cache, "", "bEnable")
+		.add_method("set_communication_plans", &T::set_communication_plans, "", "bEnable",
+					"reuses persistent requests for the master/slave exchanges of vectors")
 
 		.add_method("clear", &T::clear)
 		.add_method("add_fct", static_cast<void (T::*)(const char*, const char*, int, const char*)>(&T::add),
@@ -212,6 +212,7 @@ static void DomainAlgebra(Registry& reg, string grp)
 			.add_method("set_debug", &T::set_debug)
 			.add_method("set_emulate_full_refined_grid", &T::set_emulate_full_refined_grid)
 			.add_method("set_rap", &T::set_rap)
+			.add_method("set_matrix_free", &T::set_matrix_free, "", "bMatrixFree")
 			.add_method("set_smooth_on_surface_rim", &T::set_smooth_on_surface_rim)
 			.add_method("set_comm_comp_overlap", &T::set_comm_comp_overlap)
 			.add_method("ignore_init_for_base_solver", static_cast<void (T::*)(bool)>(&T::ignore_init_for_base_solver), "", "ignore")
@@ -198,6 +198,11 @@ static void Domain(Registry& reg, string grp)
 	{
 		reg.add_function("OrderLex", static_cast<void (*)(approximation_space_type&, const char*)>(&OrderLex<TDomain>), grp);
 	}
+//	Order along a space filling curve
+	{
+		reg.add_function("OrderSpaceFillingCurve", static_cast<void (*)(approximation_space_type&)>(&OrderSpaceFillingCurve<TDomain>), grp);
+		reg.add_function("OrderSpaceFillingCurve", static_cast<void (*)(approximation_space_type&, const char*)>(&OrderSpaceFillingCurve<TDomain>), grp);
+	}
 //	Order in downwind direction
 	{
 		reg.add_function("OrderDownwind", static_cast<void (*)(approximation_space_type&, SmartPtr<UserData<MathVector<TDomain::dim>, TDomain::dim> >)> (&ug::OrderDownwind<TDomain>), grp);
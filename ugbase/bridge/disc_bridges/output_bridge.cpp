@@ -47,6 +47,7 @@
 
 #include "lib_disc/io/vtkoutput.h"
 #include "lib_disc/io/vtk_export_ho.h"
+#include "lib_disc/io/checkpoint.h"
 #include "common/profiler/profiler.h"
 
 #include "../util_overloaded.h"
@@ -161,6 +162,25 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "GridFunctionDebugWriter", tag);
 	}
 
+//	DomainCheckpoint
+	{
+		typedef DomainCheckpoint<TDomain, TAlgebra> T;
+		typedef typename T::time_series_type time_series_type;
+		string name = string("DomainCheckpoint").append(suffix);
+		reg.add_class_<T>(name, grp)
+			.template add_constructor<void (*)(SmartPtr<TDomain>)>("domain")
+			.add_method("add", static_cast<void (T::*)(SmartPtr<function_type>, const char*)>(&T::add), "", "gridFunction#name")
+			.add_method("add", static_cast<void (T::*)(SmartPtr<time_series_type>, SmartPtr<function_type>, const char*)>(&T::add), "", "timeSeries#gridFunction#name")
+			.add_method("clear", &T::clear)
+			.add_method("set_time", &T::set_time, "", "time")
+			.add_method("time", &T::time, "time")
+			.add_method("write", &T::write, "", "filename|save-dialog")
+			.add_method("read_domain", &T::read_domain, "", "filename|load-dialog", "restores the (empty) domain from a checkpoint")
+			.add_method("read_grid_functions", &T::read_grid_functions, "", "", "restores DoF ordering and values of all added grid functions")
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "DomainCheckpoint", tag);
+	}
+
 //	GridFunctionPositionProvider
 	{
 		typedef GridFunctionPositionProvider<function_type> T;
@@ -286,6 +306,10 @@ static void Dimension(Registry& reg, string grp)
 			.add_method("select_element", static_cast<void (T::*)(SmartPtr<UserData<MathVector<dim>, dim> >, const char*)>(&T::select_element))
 			.add_method("select_element", static_cast<void (T::*)(SmartPtr<UserData<MathMatrix<dim,dim>, dim> >, const char*)>(&T::select_element))
 			.add_method("set_binary", &T::set_binary, "", "bBinary", "should values be printed in binary (base64 encoded way ) or plain ascii")
+			.add_method("set_appended", &T::set_appended, "", "bAppended", "should binary values be written raw in an appended block (instead of base64 inline)")
+			.add_method("set_compression", &T::set_compression, "", "level", "zlib compression level (0 = none, 1-9) of appended binary data")
+			.add_method("set_async", &T::set_async, "", "bAsync", "should vtu files be written by a background thread")
+			.add_method("wait_for_output", &T::wait_for_output, "", "", "waits until all files written in the background are finished")
 			.add_method("set_user_defined_comment", static_cast<void (T::*)(const char*)>(&T::set_user_defined_comment))
 			.add_method("set_write_grid", static_cast<void (T::*)(bool)>(&T::set_write_grid))
 			.add_method("set_write_subset_indices", static_cast<void (T::*)(bool)>(&T::set_write_subset_indices))
@@ -53,6 +53,7 @@
 #include "lib_grid/algorithms/grid_statistics.h"
 
 #include "lib_grid/algorithms/subset_util.h"
+#include "lib_grid/algorithms/space_filling_curve_util.h"
 
 #ifdef UG_PARALLEL
 	#include "lib_disc/parallelization/domain_load_balancer.h"
@@ -81,6 +82,13 @@ static void MinimizeMemoryFootprint(TDomain& dom)
 							 | GRIDOPT_AUTOGENERATE_SIDES);
 }
 
+template <typename TDomain>
+static void OrderDomainAlongSpaceFillingCurve(TDomain& dom, const char* curve)
+{
+	OrderAlongSpaceFillingCurve(*dom.subset_handler(), dom.position_accessor(),
+								SpaceFillingCurveFromString(curve));
+}
+
 template <typename TDomain>
 static void LoadAndRefineDomain(TDomain& domain, const char* filename,
 								int numRefs)
@@ -515,6 +523,8 @@ static void Domain(Registry& reg, string grp)
 	reg.add_function("TestDomainInterfaces", static_cast<bool (*)(TDomain*, bool)>(&TestDomainInterfaces<TDomain>), grp);
 
 	reg.add_function("MinimizeMemoryFootprint", &MinimizeMemoryFootprint<TDomain>, grp);
+	reg.add_function("OrderDomainAlongSpaceFillingCurve", &OrderDomainAlongSpaceFillingCurve<TDomain>, grp,
+					"", "dom#curve", "Reorders the grid elements and their data along a space filling curve ('hilbert' or 'morton')");
 }
 
 /**
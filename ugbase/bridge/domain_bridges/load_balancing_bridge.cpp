@@ -47,6 +47,7 @@
 	#include "lib_grid/parallelization/load_balancer.h"
 	#include "lib_grid/parallelization/load_balancer_util.h"
 	#include "lib_grid/parallelization/partitioner_dynamic_bisection.h"
+	#include "lib_grid/parallelization/partitioner_sfc.h"
 	#include "lib_grid/parallelization/balance_weights_ref_marks.h"
 	#include "lib_grid/parallelization/partition_pre_processors/replace_coordinate.h"
 	#include "lib_grid/parallelization/partition_post_processors/smooth_partition_bounds.h"
@@ -197,6 +198,30 @@ static void RegisterDynamicBisectionPartitioner(
 	reg.add_class_to_group(name, clsGrpName, GetDomainTag<TDomain>());
 }
 
+template <class TDomain, class TPartitioner>
+static void RegisterSFCPartitioner(
+	Registry& reg,
+	string name,
+	string grpName,
+	string clsGrpName)
+{
+	reg.add_class_<TPartitioner, IPartitioner>(name, grpName)
+		.template add_constructor<void (*)(TDomain&)>()
+		.add_method("set_subset_handler",
+			&TPartitioner::set_subset_handler)
+		.add_method("set_curve",
+			&TPartitioner::set_curve)
+		.add_method("set_tolerance",
+			&TPartitioner::set_tolerance)
+		.add_method("enable_fixed_bounding_box",
+			&TPartitioner::enable_fixed_bounding_box)
+		.add_method("fixed_bounding_box_enabled",
+			&TPartitioner::fixed_bounding_box_enabled)
+		.set_construct_as_smart_pointer(true);
+
+	reg.add_class_to_group(name, clsGrpName, GetDomainTag<TDomain>());
+}
+
 template <class TDomain, class elem_t>
 static void RegisterSmoothPartitionBounds(
 	Registry& reg,
@@ -312,6 +337,9 @@ static void Common(Registry& reg, string grp) {
 				.add_method("rebalance", &T::rebalance)
 				.add_method("set_balance_threshold", &T::set_balance_threshold)
 				.add_method("set_element_threshold", &T::set_element_threshold)
+				.add_method("enable_incremental_rebalancing", &T::enable_incremental_rebalancing)
+				.add_method("incremental_rebalancing_enabled", &T::incremental_rebalancing_enabled)
+				.add_method("set_max_diffusion_steps", &T::set_max_diffusion_steps)
 				.add_method("set_partitioner", &T::set_partitioner)
 				.add_method("create_quality_record", &T::create_quality_record)
 				.add_method("print_quality_records", &T::print_quality_records)
@@ -332,6 +360,14 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"Partitioner_DynamicBisection");
 
+		RegisterSFCPartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_SFC<Edge, 1> > >(
+			reg,
+			"EdgePartitioner_SFC1d",
+			grp,
+			"Partitioner_SFC");
+
 
 		RegisterSmoothPartitionBounds<TDomain, Edge>(
 			reg,
@@ -366,6 +402,14 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"Partitioner_DynamicBisection");
 
+		RegisterSFCPartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_SFC<Face, 2> > >(
+			reg,
+			"FacePartitioner_SFC2d",
+			grp,
+			"Partitioner_SFC");
+
 		RegisterSmoothPartitionBounds<TDomain, Face>(
 			reg,
 			"SmoothPartitionBounds2d",
@@ -407,6 +451,14 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"Partitioner_DynamicBisection");
 
+		RegisterSFCPartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_SFC<Volume, 3> > >(
+			reg,
+			"VolumePartitioner_SFC3d",
+			grp,
+			"Partitioner_SFC");
+
 		RegisterSmoothPartitionBounds<TDomain, Volume>(
 			reg,
 			"SmoothPartitionBounds3d",
@@ -99,6 +99,10 @@ void RegisterGridBridge_Grid(Registry& reg, string parentGroup)
 		.add_method("reserve_edges", &Grid::reserve<Edge>, "", "num")
 		.add_method("reserve_faces", &Grid::reserve<Face>, "", "num")
 		.add_method("reserve_volumes", &Grid::reserve<Volume>, "", "num")
+		.add_method("freeze_adjacency", &Grid::freeze_adjacency, "", "",
+					"replaces the containers of associated elements by a compact snapshot until the topology changes")
+		.add_method("thaw_adjacency", &Grid::thaw_adjacency)
+		.add_method("adjacency_is_frozen", &Grid::adjacency_is_frozen)
 		.set_construct_as_smart_pointer(true);
 
 //	MultiGrid
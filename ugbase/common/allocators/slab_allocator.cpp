@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <cstdlib>
+#include <new>
+#include "slab_allocator.h"
+
+#ifdef _WIN32
+	#include <malloc.h>
+#endif
+
+namespace ug
+{
+
+static void* AllocAligned(std::size_t size, std::size_t alignment)
+{
+#ifdef _WIN32
+	return _aligned_malloc(size, alignment);
+#else
+	void* p = NULL;
+	if(posix_memalign(&p, alignment, size) != 0)
+		return NULL;
+	return p;
+#endif
+}
+
+static void FreeAligned(void* p)
+{
+#ifdef _WIN32
+	_aligned_free(p);
+#else
+	free(p);
+#endif
+}
+
+
+SlabAllocator& SlabAllocator::
+inst()
+{
+//	intentionally leaked. Grid objects may be destroyed by other static objects.
+	static SlabAllocator* allocator = new SlabAllocator;
+	return *allocator;
+}
+
+SlabAllocator::
+SlabAllocator() :
+	m_pools(s_maxBlockSize / s_granularity),
+	m_numSlabs(0)
+{
+	for(std::size_t i = 0; i < m_pools.size(); ++i){
+		m_pools[i].blockSize = (i + 1) * s_granularity;
+		m_pools[i].avail = NULL;
+		m_pools[i].spare = NULL;
+	}
+}
+
+SlabAllocator::
+~SlabAllocator()
+{
+//	only slabs without live blocks can safely be released here.
+	release_spare_slabs();
+}
+
+std::size_t SlabAllocator::
+header_size()
+{
+	return ((sizeof(Slab) + s_granularity - 1) / s_granularity) * s_granularity;
+}
+
+SlabAllocator::Slab* SlabAllocator::
+slab_of(void* p)
+{
+	return reinterpret_cast<Slab*>(
+				reinterpret_cast<std::size_t>(p) & ~(s_slabSize - 1));
+}
+
+void SlabAllocator::
+link(Pool& pool, Slab* slab)
+{
+	slab->prev = NULL;
+	slab->next = pool.avail;
+	if(pool.avail)
+		pool.avail->prev = slab;
+	pool.avail = slab;
+	slab->inAvailList = true;
+}
+
+void SlabAllocator::
+unlink(Pool& pool, Slab* slab)
+{
+	if(slab->prev)
+		slab->prev->next = slab->next;
+	else
+		pool.avail = slab->next;
+	if(slab->next)
+		slab->next->prev = slab->prev;
+	slab->prev = slab->next = NULL;
+	slab->inAvailList = false;
+}
+
+SlabAllocator::Slab* SlabAllocator::
+new_slab(Pool& pool)
+{
+	void* raw = AllocAligned(s_slabSize, s_slabSize);
+	if(!raw)
+		throw std::bad_alloc();
+
+	Slab* slab = reinterpret_cast<Slab*>(raw);
+	slab->raw = raw;
+	slab->pool = &pool;
+	slab->prev = slab->next = NULL;
+	slab->bump = reinterpret_cast<char*>(raw) + header_size();
+	slab->end = reinterpret_cast<char*>(raw) + s_slabSize;
+	slab->freeList = NULL;
+	slab->numLive = 0;
+	slab->inAvailList = false;
+	++m_numSlabs;
+	return slab;
+}
+
+void SlabAllocator::
+free_slab(Slab* slab)
+{
+	--m_numSlabs;
+	FreeAligned(slab->raw);
+}
+
+void* SlabAllocator::
+allocate(std::size_t size)
+{
+	if(size == 0)
+		size = 1;
+	if(size > s_maxBlockSize)
+		return ::operator new(size);
+
+	Pool& pool = m_pools[(size - 1) / s_granularity];
+
+	Slab* slab = pool.avail;
+	if(!slab){
+		if(pool.spare){
+			slab = pool.spare;
+			pool.spare = NULL;
+		}
+		else
+			slab = new_slab(pool);
+		link(pool, slab);
+	}
+
+	void* p;
+	if(slab->freeList){
+		p = slab->freeList;
+		slab->freeList = *reinterpret_cast<void**>(p);
+	}
+	else{
+		p = slab->bump;
+		slab->bump += pool.blockSize;
+	}
+	++slab->numLive;
+
+//	a slab without free blocks leaves the list of available slabs
+	if(!slab->freeList && (slab->bump + pool.blockSize > slab->end))
+		unlink(pool, slab);
+
+	return p;
+}
+
+void SlabAllocator::
+deallocate(void* p, std::size_t size)
+{
+	if(!p)
+		return;
+	if(size == 0)
+		size = 1;
+	if(size > s_maxBlockSize){
+		::operator delete(p);
+		return;
+	}
+
+	Slab* slab = slab_of(p);
+	Pool& pool = *slab->pool;
+
+	*reinterpret_cast<void**>(p) = slab->freeList;
+	slab->freeList = p;
+	--slab->numLive;
+
+	if(slab->numLive == 0){
+	//	the slab is empty. Reset it and either keep it as spare or release it.
+		if(slab->inAvailList)
+			unlink(pool, slab);
+		slab->bump = reinterpret_cast<char*>(slab->raw) + header_size();
+		slab->freeList = NULL;
+		if(!pool.spare)
+			pool.spare = slab;
+		else
+			free_slab(slab);
+	}
+	else if(!slab->inAvailList){
+	//	insert the slab behind the head, so that the current slab is filled up first
+		Slab* head = pool.avail;
+		if(head){
+			slab->prev = head;
+			slab->next = head->next;
+			if(head->next)
+				head->next->prev = slab;
+			head->next = slab;
+			slab->inAvailList = true;
+		}
+		else
+			link(pool, slab);
+	}
+}
+
+void SlabAllocator::
+release_spare_slabs()
+{
+	for(std::size_t i = 0; i < m_pools.size(); ++i){
+		if(m_pools[i].spare){
+			free_slab(m_pools[i].spare);
+			m_pools[i].spare = NULL;
+		}
+	}
+}
+
+}//	end of namespace
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__COMMON__ALLOCATORS__SLAB_ALLOCATOR__
+#define __H__UG__COMMON__ALLOCATORS__SLAB_ALLOCATOR__
+
+#include <cstddef>
+#include <vector>
+
+namespace ug
+{
+
+///	Allocates small objects from size-segregated slabs of contiguous memory.
+/**	Requests are rounded up to a multiple of s_granularity and served from the
+ * pool of the matching size class. Each pool carves its blocks from aligned
+ * slabs of s_slabSize bytes. Fresh blocks are handed out by bumping a pointer
+ * through the current slab, so that objects created one after another (e.g.
+ * the children of a refined element) end up next to each other in memory.
+ * Released blocks are kept in a per-slab free list and are reused before new
+ * memory is touched.
+ *
+ * A slab is returned to the system as soon as its last block is released
+ * (one empty slab per size class is retained to avoid thrashing). Releasing
+ * all objects of a size class, as e.g. Grid::clear does, thus releases the
+ * memory in bulk.
+ *
+ * Requests larger than s_maxBlockSize are forwarded to ::operator new.
+ * Since the owning slab is found through the address of a block, deallocate
+ * has to be called with the same size that was passed to allocate. Class
+ * specific operator delete(void*, std::size_t) guarantees this for
+ * polymorphic types with virtual destructors.
+ *
+ * \note	The allocator performs no locking. Allocation and deallocation
+ * 			must not happen concurrently from different threads.
+ */
+class SlabAllocator
+{
+	public:
+	///	granularity of size classes in bytes. Also the alignment of all blocks.
+		static const std::size_t s_granularity = 16;
+	///	blocks larger than this are allocated through ::operator new
+		static const std::size_t s_maxBlockSize = 512;
+	///	size and alignment of a slab in bytes. Has to be a power of 2.
+		static const std::size_t s_slabSize = 64 * 1024;
+
+	///	returns the global instance used for grid objects.
+	/**	The instance is never destroyed, so that objects may still be released
+	 * during static deinitialization.*/
+		static SlabAllocator& inst();
+
+		SlabAllocator();
+		~SlabAllocator();
+
+	///	returns memory for an object of the given size
+	/**	throws std::bad_alloc if no memory could be obtained.*/
+		void* allocate(std::size_t size);
+
+	///	releases memory obtained through allocate(size).
+		void deallocate(void* p, std::size_t size);
+
+	///	releases the empty slabs which are retained for reuse
+		void release_spare_slabs();
+
+	///	number of slabs currently held (including retained empty slabs)
+		std::size_t num_slabs() const	{return m_numSlabs;}
+
+	///	number of bytes currently held in slabs
+		std::size_t num_slab_bytes() const	{return m_numSlabs * s_slabSize;}
+
+	private:
+		struct Pool;
+
+	///	header placed at the beginning of each slab
+		struct Slab
+		{
+			void*		raw;
+			Pool*		pool;
+			Slab*		prev;
+			Slab*		next;
+			char*		bump;
+			char*		end;
+			void*		freeList;
+			std::size_t	numLive;
+			bool		inAvailList;
+		};
+
+	///	all slabs of a size class which still contain free blocks
+		struct Pool
+		{
+			std::size_t	blockSize;
+			Slab*		avail;
+			Slab*		spare;
+		};
+
+		static std::size_t header_size();
+		static Slab* slab_of(void* p);
+
+		Slab* new_slab(Pool& pool);
+		void free_slab(Slab* slab);
+
+		static void link(Pool& pool, Slab* slab);
+		static void unlink(Pool& pool, Slab* slab);
+
+	private:
+	//	no copies
+		SlabAllocator(const SlabAllocator&);
+		SlabAllocator& operator=(const SlabAllocator&);
+
+		std::vector<Pool>	m_pools;
+		std::size_t			m_numSlabs;
+};
+
+}//	end of namespace
+
+#endif
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "common/util/async_file_writer.h"
+
+#include <fstream>
+
+#include "common/profiler/profiler.h"
+#include "common/error.h"
+
+namespace ug {
+
+AsyncFileWriter::AsyncFileWriter()
+{}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+	if(m_thread.joinable())
+		m_thread.join();
+}
+
+void AsyncFileWriter::submit(const std::string& filename, std::string& buffer)
+{
+	PROFILE_FUNC();
+
+	wait();
+
+	m_filename = filename;
+	m_buffer.swap(buffer);
+	buffer.clear();
+	m_error.clear();
+
+	try{
+		m_thread = std::thread(&AsyncFileWriter::run, this);
+	}
+	catch(std::exception& e){
+	//	no thread available: write synchronously
+		run();
+		UG_COND_THROW(!m_error.empty(), m_error);
+	}
+}
+
+void AsyncFileWriter::wait()
+{
+	if(!m_thread.joinable()) return;
+
+	{
+		PROFILE_BEGIN(AsyncFileWriter_wait);
+		m_thread.join();
+		PROFILE_END();
+	}
+
+	m_buffer.clear();
+	UG_COND_THROW(!m_error.empty(), m_error);
+}
+
+void AsyncFileWriter::run()
+{
+//	no exceptions must escape the thread, they are reported in wait()
+	std::ofstream out(m_filename.c_str(), std::ios::out | std::ios::binary
+										| std::ios::trunc);
+	if(!out.is_open()){
+		m_error = std::string("AsyncFileWriter: Could not open output file: ")
+					+ m_filename;
+		return;
+	}
+
+	out.write(m_buffer.data(), m_buffer.size());
+	out.close();
+	if(!out.good())
+		m_error = std::string("AsyncFileWriter: Could not write to file: ")
+					+ m_filename;
+}
+
+}	// namespace ug
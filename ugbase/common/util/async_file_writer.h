@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__COMMON__UTIL__ASYNC_FILE_WRITER__
+#define __H__UG__COMMON__UTIL__ASYNC_FILE_WRITER__
+
+#include <string>
+#include <thread>
+
+namespace ug {
+
+/// \addtogroup ugbase_common_io
+/// \{
+
+/**
+ * \brief Writes memory buffers to files in a background thread
+ * \details A buffer passed to submit() is written by a separate thread, so
+ *   that the caller may continue with computation while the file system is
+ *   busy. At most one write is in flight: submit() first waits for the
+ *   previous job (double buffering). Errors of a job are reported by the next
+ *   call to wait() or submit(). The destructor waits for a pending job.
+ */
+class AsyncFileWriter {
+public:
+	AsyncFileWriter();
+	~AsyncFileWriter();
+
+	/**
+	 * \brief Writes the buffer to the file in the background
+	 * \param[in] filename name of the output file
+	 * \param[in,out] buffer content of the file. Swapped into the writer,
+	 *                i.e. empty on return.
+	 * \throws UGError if the previous job failed
+	 */
+	void submit(const std::string& filename, std::string& buffer);
+
+	/**
+	 * \brief Waits until the pending job is finished
+	 * \throws UGError if the job failed
+	 */
+	void wait();
+
+	/// returns if a job has been submitted and not been waited for
+	bool pending() const {return m_thread.joinable();}
+
+private:
+	void run();
+
+private:
+	std::thread m_thread;
+	std::string m_filename;
+	std::string m_buffer;
+	std::string m_error;
+};
+
+// end group ugbase_common_io
+/// \}
+
+} // namespace: ug
+
+#endif // __H__UG__COMMON__UTIL__ASYNC_FILE_WRITER__
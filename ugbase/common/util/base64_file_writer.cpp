@@ -37,12 +37,17 @@
 #include <boost/archive/iterators/base64_from_binary.hpp>
 #include <boost/archive/iterators/ostream_iterator.hpp>
 //#include <boost/filesystem.hpp>
+#include <algorithm>
 
 // debug includes!!
 #include "common/profiler/profiler.h"
 #include "common/error.h"
 #include "common/assert.h"
 
+#ifdef UG_ZLIB
+	#include <zlib.h>
+#endif
+
 using namespace std;
 
 /**
@@ -76,6 +81,14 @@ Base64FileWriter& Base64FileWriter::operator<<(const fmtflag format)
 	if (format != m_currFormat && m_numBytesWritten > 0) {
 		flushInputBuffer(true);
 	}
+
+	// in appended mode, each binary section forms one array
+	if (m_bAppended && format != m_currFormat) {
+		if (m_currFormat == base64_binary)
+			finish_appended_array();
+		else if (format == base64_binary)
+			m_arrayBegin = m_appended.size();
+	}
 	m_currFormat = format;
 	return *this;
 }
@@ -128,6 +141,10 @@ Base64FileWriter& Base64FileWriter::operator<<(size_t value)
 }
 
 Base64FileWriter::Base64FileWriter() :
+	m_pOut(&m_fStream),
+	m_arrayBegin(0),
+	m_bAppended(false),
+	m_compressionLevel(0),
 	m_currFormat(base64_ascii),
 	m_inBuffer(ios_base::binary | ios_base::out | ios_base::in),
 	m_lastInputByteSize(0),
@@ -136,6 +153,10 @@ Base64FileWriter::Base64FileWriter() :
 
 Base64FileWriter::Base64FileWriter(const char* filename,
 		const ios_base::openmode mode) :
+	m_pOut(&m_fStream),
+	m_arrayBegin(0),
+	m_bAppended(false),
+	m_compressionLevel(0),
 	m_currFormat(base64_ascii),
 	m_inBuffer(ios_base::binary | ios_base::out | ios_base::in),
 	m_lastInputByteSize(0),
@@ -165,6 +186,7 @@ void Base64FileWriter::open(const char *filename,
 	}
 	*/
 
+	m_pOut = &m_fStream;
 	m_fStream.open(filename, mode);
 	if (!m_fStream.is_open()) {
 		UG_THROW( "Could not open output file: " << filename);
@@ -173,9 +195,114 @@ void Base64FileWriter::open(const char *filename,
 	}
 }
 
+void Base64FileWriter::open_memory()
+{
+	m_memStream.str("");
+	m_memStream.clear();
+	m_pOut = &m_memStream;
+}
+
+void Base64FileWriter::take_buffer(std::string& buffer)
+{
+	flushInputBuffer(true);
+	UG_COND_THROW(m_pOut != &m_memStream,
+				  "Base64FileWriter::take_buffer: writer is not in memory mode.");
+	buffer = m_memStream.str();
+	m_memStream.str("");
+}
+
+void Base64FileWriter::set_appended(bool bAppended)
+{
+	UG_COND_THROW(m_currFormat == base64_binary && bAppended != m_bAppended,
+				  "Base64FileWriter::set_appended: can not switch while "
+				  "writing binary data.");
+	m_bAppended = bAppended;
+}
+
+void Base64FileWriter::set_compression_level(int level)
+{
+#ifdef UG_ZLIB
+	UG_COND_THROW(level < 0 || level > 9,
+				  "Base64FileWriter: Invalid compression level " << level);
+#else
+	UG_COND_THROW(level != 0,
+				  "Base64FileWriter: Compression requested, but ug was compiled "
+				  "without zlib support (use cmake -DUSE_ZLIB=ON).");
+#endif
+	m_compressionLevel = level;
+}
+
+std::string Base64FileWriter::appended_data(size_t begin) const
+{
+	UG_ASSERT(begin <= m_appended.size(), "offset out of range");
+	return m_appended.substr(begin);
+}
+
+void Base64FileWriter::append_encoded_array(const std::string& array)
+{
+	UG_COND_THROW(m_currFormat == base64_binary,
+				  "Base64FileWriter: can not append array while writing binary data.");
+	m_appended.append(array);
+}
+
+void Base64FileWriter::write_appended_data()
+{
+	PROFILE_FUNC();
+	assertFileOpen();
+
+	(*this) << normal;
+	*m_pOut << "  <AppendedData encoding=\"raw\">\n   _";
+	m_pOut->write(m_appended.data(), m_appended.size());
+	*m_pOut << "\n  </AppendedData>\n";
+
+	m_appended.clear();
+	m_arrayBegin = 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 
+// replaces the raw array (size header + data) starting at m_arrayBegin by the
+// block layout of vtkZLibDataCompressor:
+// [#blocks][block size][last block size][#blocks x compressed size][data]
+void Base64FileWriter::finish_appended_array()
+{
+	if (m_compressionLevel == 0) return;
+#ifdef UG_ZLIB
+	typedef unsigned int header_type;
+	const size_t headerSize = sizeof(header_type);
+	const size_t blockSize = 32768;
+
+	UG_COND_THROW(m_appended.size() < m_arrayBegin + headerSize,
+				  "Base64FileWriter: appended array without size header.");
+
+	const char* raw = m_appended.data() + m_arrayBegin + headerSize;
+	const size_t rawSize = m_appended.size() - m_arrayBegin - headerSize;
+	const size_t numBlocks = (rawSize + blockSize - 1) / blockSize;
+
+	std::vector<header_type> vHeader(3 + numBlocks);
+	vHeader[0] = (header_type)numBlocks;
+	vHeader[1] = (header_type)blockSize;
+	vHeader[2] = (header_type)(rawSize % blockSize);
+
+	std::string compressed;
+	std::vector<Bytef> buff(compressBound(blockSize));
+	for(size_t b = 0; b < numBlocks; ++b){
+		const size_t len = std::min(blockSize, rawSize - b * blockSize);
+		uLongf cLen = buff.size();
+		if(compress2(&buff[0], &cLen, (const Bytef*)(raw + b * blockSize),
+					 len, m_compressionLevel) != Z_OK)
+			UG_THROW("Base64FileWriter: zlib compression failed.");
+		vHeader[3 + b] = (header_type)cLen;
+		compressed.append((const char*)&buff[0], cLen);
+	}
+
+	m_appended.resize(m_arrayBegin);
+	m_appended.append((const char*)&vHeader[0], vHeader.size() * headerSize);
+	m_appended.append(compressed);
+#endif
+}
+
 // this function performs conversion to plain const char* and stores it in
 // m_inBuffer, either raw for binary mode or as string conversion in base64_ascii.
 template <typename T>
@@ -195,6 +322,11 @@ void Base64FileWriter::dispatch(const T& value)
 			flushInputBuffer();
 			break;
 		case base64_binary: {
+			if (m_bAppended) {
+				// raw bytes are collected in the appended block
+				m_appended.append(reinterpret_cast<const char*>(&value), sizeof(T));
+				break;
+			}
 			// write the value in binary mode to the input buffer
 			UG_ASSERT(m_inBuffer.good(), "can not write to buffer")
 			m_inBuffer.write(reinterpret_cast<const char*>(&value), sizeof(T));
@@ -208,13 +340,18 @@ void Base64FileWriter::dispatch(const T& value)
 		}
 		case normal:
 			// nothing to do here, almost
-			m_fStream << value;
+			*m_pOut << value;
 			break;
 	}
 }
 
 inline void Base64FileWriter::assertFileOpen()
 {
+	if (m_pOut == &m_memStream) {
+		if (m_memStream.bad())
+			UG_THROW( "Memory stream is not writeable." );
+		return;
+	}
 	if (m_fStream.bad() || !m_fStream.is_open()) {
 		UG_THROW( "File stream is not open." );
 	}
@@ -263,7 +400,7 @@ void Base64FileWriter::flushInputBuffer(bool force)
 
 		// encode buff in base64
 		copy(base64_text(buff), base64_text(buff + buff_len),
-				boost::archive::iterators::ostream_iterator<char>(m_fStream));
+				boost::archive::iterators::ostream_iterator<char>(*m_pOut));
 	}
 
 	size_t rest_len = m_numBytesWritten - buff_len;
@@ -299,7 +436,7 @@ void Base64FileWriter::flushInputBuffer(bool force)
 
 	if (force) {
 		for(uint i = 0; i < paddChars; ++i)
-			m_fStream << '=';
+			*m_pOut << '=';
 
 		// resetting num bytes written and bytes in block
 		m_numBytesWritten = 0;
@@ -315,6 +452,7 @@ void Base64FileWriter::close()
 
 	// make sure all remaining content of the input buffer is encoded and flushed
 	flushInputBuffer(true);
+	if (m_pOut == &m_memStream) return;
 
 	// only when this is done, close the file stream
 	m_fStream.close();
@@ -71,6 +71,19 @@ namespace ug {
  *   \code{.cpp}
  *   writer.close();
  *   \endcode
+ *
+ *   If appended mode is enabled (set_appended), data written in
+ *   <tt>base64_binary</tt> format is not encoded inline but collected as raw
+ *   bytes in an appended block. Each switch into <tt>base64_binary</tt> starts
+ *   a new array at appended_offset(), each switch away from it finishes the
+ *   array. The first four bytes of every array are expected to hold its byte
+ *   size (as written by VTKOutput). If a compression level is set, finished
+ *   arrays are zlib compressed and this size header is replaced by the block
+ *   header of the VTK zlib data compressor. The block is written by
+ *   write_appended_data().
+ *
+ *   Instead of a file, the writer may also write to memory (open_memory),
+ *   the result is retrieved via take_buffer.
  */
 class Base64FileWriter {
 public:
@@ -112,6 +125,50 @@ public:
 	void open(const char *filename,
 			const std::ios_base::openmode mode = std::ios_base::out );
 
+	/**
+	 * \brief Writes to an internal memory buffer instead of a file
+	 */
+	void open_memory();
+
+	/**
+	 * \brief Moves the content written in memory mode to the given string
+	 */
+	void take_buffer(std::string& buffer);
+
+	/**
+	 * \brief Enables collection of binary data in an appended block
+	 */
+	void set_appended(bool bAppended);
+
+	/// returns if binary data is collected in an appended block
+	bool appended() const {return m_bAppended;}
+
+	/**
+	 * \brief Sets the zlib compression level for appended arrays
+	 * \param level 0 disables compression, 1 (fast) to 9 (best)
+	 * \throws UGError if level > 0 and ug was compiled without zlib
+	 */
+	void set_compression_level(int level);
+
+	/// returns the zlib compression level for appended arrays
+	int compression_level() const {return m_compressionLevel;}
+
+	/// returns the offset of the next array in the appended block
+	size_t appended_offset() const {return m_appended.size();}
+
+	/// returns the appended block starting at the given offset
+	std::string appended_data(size_t begin) const;
+
+	/// appends an already finished (and possibly compressed) array
+	void append_encoded_array(const std::string& array);
+
+	/**
+	 * \brief Writes the appended block as raw VTK AppendedData section
+	 * \details The block is cleared afterwards. Must be called at the place
+	 *          where the section is expected, i.e. before the closing tag.
+	 */
+	void write_appended_data();
+
 	/**
 	 * \brief gets the current set format
 	 */
@@ -150,10 +207,33 @@ private:
 	template <typename T>
 	void dispatch(const T& value);
 
+	/**
+	 * \brief Finishes the current array of the appended block (compression)
+	 */
+	void finish_appended_array();
+
 	/**
 	 * \brief File stream to write everything to
 	 */
 	std::fstream m_fStream;
+
+	/**
+	 * \brief Memory stream used instead of the file stream (open_memory)
+	 */
+	std::stringstream m_memStream;
+
+	/**
+	 * \brief Stream all output goes to (either m_fStream or m_memStream)
+	 */
+	std::ostream* m_pOut;
+
+	/**
+	 * \brief Appended block, array start and settings of appended mode
+	 */
+	std::string m_appended;
+	size_t m_arrayBegin;
+	bool m_bAppended;
+	int m_compressionLevel;
 	/**
 	 * \brief Current write format (\c base64 or \c normal)
 	 */
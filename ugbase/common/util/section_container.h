@@ -125,6 +125,14 @@ class SectionContainer
 	///	takes all elements from the given section container and transfers them to this one.
 		void transfer_elements(SectionContainer& c);
 
+	///	replaces the order of the elements in the given section
+	/**	The sequence [newOrderBegin, newOrderEnd) has to contain each element of
+	 * the specified section exactly once and no other elements. Elements of
+	 * other sections are not affected.*/
+		template <class TIterator>
+		void reorder_section(int sectionIndex, TIterator newOrderBegin,
+							 TIterator newOrderEnd);
+
 	protected:
 		void add_sections(int num);
 
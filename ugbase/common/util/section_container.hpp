@@ -371,6 +371,26 @@ transfer_elements(SectionContainer& c)
 	}
 }
 
+template <class TValue, class TContainer>
+template <class TIterator>
+void
+SectionContainer<TValue, TContainer>::
+reorder_section(int sectionIndex, TIterator newOrderBegin, TIterator newOrderEnd)
+{
+	assert((sectionIndex >= 0) && (sectionIndex < num_sections()) &&
+			"ERROR in SectionContainer::reorder_section(): bad sectionIndex");
+
+//	values have to be copied before the section is cleared, since the given
+//	sequence may reference the section itself.
+	std::vector<TValue> vals(newOrderBegin, newOrderEnd);
+	assert((vals.size() == num_elements(sectionIndex)) &&
+			"ERROR in SectionContainer::reorder_section(): size mismatch");
+
+	clear_section(sectionIndex);
+	for(size_t i = 0; i < vals.size(); ++i)
+		insert(vals[i], sectionIndex);
+}
+
 }
 
 #endif
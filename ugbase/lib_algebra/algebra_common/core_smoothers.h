@@ -34,6 +34,9 @@
 #define __H__UG__CPU_ALGEBRA__CORE_SMOOTHERS__
 ////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+#include "level_schedule.h"
+
 namespace ug
 {
 
@@ -86,8 +89,30 @@ namespace ug
  * </ul>
  *
  * \sa gs_step_LL, gs_step_UR, sgs_step
+ *
+ *	The diagonal entries are accessed using the cached diagonal positions of the
+ *	matrix (diag_index), so that no row has to be searched for its diagonal. In
+ *	addition, the smoothers accept an optional array of pre-inverted diagonal
+ *	blocks (e.g. computed in the preprocess of a preconditioner), which saves
+ *	the factorization of the diagonal block in every sweep for block algebras.
  */
 
+/// type of the optional array of pre-inverted diagonal blocks
+template<typename Matrix_type>
+struct InvDiagArray
+{
+	typedef std::vector<typename block_traits<typename Matrix_type::value_type>::inverse_type> type;
+};
+
+/// computes c = relaxFactor * A_ii^{-1} s, using the pre-inverted diagonal block if given
+template<typename vector_block, typename matrix_block, typename TInvDiag>
+inline void DiagInverseMult(vector_block &c, const number relaxFactor, const matrix_block &A_ii,
+                            const TInvDiag *pvInvDiag, size_t i, const vector_block &s)
+{
+	if(pvInvDiag) MatMult(c, relaxFactor, (*pvInvDiag)[i], s);
+	else InverseMatMult(c, relaxFactor, A_ii, s);
+}
+
 
 /////////////////////////////////////////////////////////////////////////////////////////////
 //	gs_step_LL
@@ -100,10 +125,12 @@ namespace ug
 * \param A Matrix \f$A = D - L - U\f$
 * \param c Vector. \f$ c = N * d = (D-L)^{-1} * d \f$
 * \param d Vector d.
+* \param pvInvDiag (optional) pre-inverted diagonal blocks
 * \sa gs_step_UR, sgs_step
 */
 template<typename Matrix_type, typename Vector_type>
-void gs_step_LL(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor)
+void gs_step_LL(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor,
+                const typename InvDiagArray<Matrix_type>::type *pvInvDiag = NULL)
 {
 	// gs LL has preconditioning matrix N = (D-L)^{-1}
 
@@ -111,6 +138,7 @@ void gs_step_LL(const Matrix_type &A, Vector_type &c, const Vector_type &d, cons
 	typedef typename Matrix_type::const_row_iterator const_row_it;
 	typename Vector_type::value_type s;
 
+	UG_ASSERT(pvInvDiag == NULL || pvInvDiag->size() == c.size(), "inverse diagonal has wrong size.");
 	const size_t sz = c.size();
 	for (size_t i = 0; i < sz; ++i)
 	{
@@ -127,8 +155,8 @@ void gs_step_LL(const Matrix_type &A, Vector_type &c, const Vector_type &d, cons
 			MatMultAdd(s, 1.0, s, -1.0, it.value(), c[it.index()]);
 
 		// c[i] = relaxFactor * s/A(i,i)
-		const matrix_block& A_ii = it.index() == i ? it.value() : matrix_block(0);
-		InverseMatMult(c[i], relaxFactor, A_ii, s);
+		const matrix_block& A_ii = (it != rowEnd && it.index() == i) ? it.value() : matrix_block(0);
+		DiagInverseMult(c[i], relaxFactor, A_ii, pvInvDiag, i, s);
 	}
 }
 
@@ -144,29 +172,35 @@ void gs_step_LL(const Matrix_type &A, Vector_type &c, const Vector_type &d, cons
  * \param A Matrix \f$A = D - L - U\f$
  * \param c will be \f$c = N * d = (D-U)^{-1} * d \f$
  * \param d the vector d.
+ * \param pvInvDiag (optional) pre-inverted diagonal blocks
  * \sa gs_step_LL, sgs_step
  */
 template<typename Matrix_type, typename Vector_type>
-void gs_step_UR(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor)
+void gs_step_UR(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor,
+                const typename InvDiagArray<Matrix_type>::type *pvInvDiag = NULL)
 {
 	// gs UR has preconditioning matrix N = (D-U)^{-1}
 
+	typedef typename Matrix_type::const_row_iterator const_row_it;
 	typename Vector_type::value_type s;
 
 	if(c.size() == 0) return;
+	UG_ASSERT(pvInvDiag == NULL || pvInvDiag->size() == c.size(), "inverse diagonal has wrong size.");
+	A.update_diag_index();
 	size_t i = c.size()-1;
 	do
 	{
 		s = d[i];
-		typename Matrix_type::const_row_iterator diag = A.get_connection(i, i);
+		const const_row_it diag = A.get_diag_connection(i);
 		
-		typename Matrix_type::const_row_iterator it = diag; ++it;
-		for(; it != A.end_row(i); ++it)
+		const const_row_it rowEnd = A.end_row(i);
+		const_row_it it = diag; ++it;
+		for(; it != rowEnd; ++it)
 			// s -= it.value() * x[it.index()];
 			MatMultAdd(s, 1.0, s, -1.0, it.value(), c[it.index()]);
 
 		// c[i] = relaxFactor * s/A(i,i)
-		InverseMatMult(c[i], relaxFactor, diag.value(), s);
+		DiagInverseMult(c[i], relaxFactor, diag.value(), pvInvDiag, i, s);
 	} while(i-- != 0);
 
 }
@@ -183,26 +217,152 @@ void gs_step_UR(const Matrix_type &A, Vector_type &c, const Vector_type &d, cons
  * \param A Matrix \f$A = D - L - R\f$
  * \param c will be \f$c = N * d = (D-U)^{-1} D (D-L)^{-1} d \f$
  * \param d the vector d.
+ * \param pvInvDiag (optional) pre-inverted diagonal blocks
  * \sa gs_step_LL, gs_step_LL
  */
 template<typename Matrix_type, typename Vector_type>
-void sgs_step(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor)
+void sgs_step(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor,
+              const typename InvDiagArray<Matrix_type>::type *pvInvDiag = NULL)
 {
 	// sgs has preconditioning matrix N = (D-U)^{-1} D (D-L)^{-1}
 
 	// c1 = (D-L)^{-1} d
-	gs_step_LL(A, c, d, relaxFactor);
+	gs_step_LL(A, c, d, relaxFactor, pvInvDiag);
 
 	// c2 = D c1
 	typename Vector_type::value_type s;
+	A.update_diag_index();
 	for(size_t i = 0; i<c.size(); i++)
 	{
 		s=c[i];
-		MatMult(c[i], 1.0, A(i, i), s);
+		MatMult(c[i], 1.0, A.diag(i), s);
+	}
+
+	// c3 = (D-U)^{-1} c2
+	gs_step_UR(A, c, c, relaxFactor, pvInvDiag);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////
+//	level-scheduled Gauss-Seidel steps
+/**
+ * The following variants of gs_step_LL, gs_step_UR and sgs_step process the
+ * rows level by level (\sa LevelSchedule) and the rows of each level in
+ * parallel. The result is identical to the one of the sequential steps.
+ * The schedules have to be computed for the sparsity pattern of A
+ * (lower levels for the forward, upper levels for the backward sweep).
+ */
+
+/// computes row i of the forward Gauss-Seidel step
+template<typename Matrix_type, typename Vector_type>
+struct GSRowLL
+{
+	typedef typename Matrix_type::value_type matrix_block;
+	typedef typename InvDiagArray<Matrix_type>::type inv_diag_type;
+
+	GSRowLL(const Matrix_type &A_, Vector_type &c_, const Vector_type &d_,
+	        number relaxFactor_, const inv_diag_type *pvInvDiag_)
+		: A(A_), c(c_), d(d_), relaxFactor(relaxFactor_), pvInvDiag(pvInvDiag_) {}
+
+	void operator()(size_t i) const
+	{
+		typename Vector_type::value_type s = d[i];
+
+		int k, end;
+		A.get_row_range(i, k, end);
+		for(; k < end && A.col_index_at(k) < (int)i; ++k)
+			// s -= A(i,j) * c[j];
+			MatMultAdd(s, 1.0, s, -1.0, A.value_at(k), c[A.col_index_at(k)]);
+
+		const matrix_block& A_ii = (k < end && A.col_index_at(k) == (int)i) ? A.value_at(k) : matrix_block(0);
+		DiagInverseMult(c[i], relaxFactor, A_ii, pvInvDiag, i, s);
+	}
+
+	const Matrix_type &A;
+	Vector_type &c;
+	const Vector_type &d;
+	number relaxFactor;
+	const inv_diag_type *pvInvDiag;
+};
+
+/// computes row i of the backward Gauss-Seidel step
+template<typename Matrix_type, typename Vector_type>
+struct GSRowUR
+{
+	typedef typename Matrix_type::value_type matrix_block;
+	typedef typename InvDiagArray<Matrix_type>::type inv_diag_type;
+
+	GSRowUR(const Matrix_type &A_, Vector_type &c_, const Vector_type &d_,
+	        number relaxFactor_, const inv_diag_type *pvInvDiag_)
+		: A(A_), c(c_), d(d_), relaxFactor(relaxFactor_), pvInvDiag(pvInvDiag_) {}
+
+	void operator()(size_t i) const
+	{
+		typename Vector_type::value_type s = d[i];
+
+		int begin, end;
+		A.get_row_range(i, begin, end);
+		const int diag = A.diag_index(i);
+		for(int k = (diag != -1) ? diag+1 : begin; k < end; ++k)
+			if(A.col_index_at(k) > (int)i)
+				// s -= A(i,j) * c[j];
+				MatMultAdd(s, 1.0, s, -1.0, A.value_at(k), c[A.col_index_at(k)]);
+
+		const matrix_block& A_ii = (diag != -1) ? A.value_at(diag) : matrix_block(0);
+		DiagInverseMult(c[i], relaxFactor, A_ii, pvInvDiag, i, s);
+	}
+
+	const Matrix_type &A;
+	Vector_type &c;
+	const Vector_type &d;
+	number relaxFactor;
+	const inv_diag_type *pvInvDiag;
+};
+
+/// forward Gauss-Seidel step using the level schedule of the lower triangle
+template<typename Matrix_type, typename Vector_type>
+void gs_step_LL_levels(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor,
+                       const LevelSchedule &lowerLevels,
+                       const typename InvDiagArray<Matrix_type>::type *pvInvDiag = NULL)
+{
+	UG_ASSERT(lowerLevels.num_rows() == c.size(), "level schedule does not match vector size.");
+	A.update_diag_index();
+	ForEachRowInLevels(lowerLevels, GSRowLL<Matrix_type, Vector_type>(A, c, d, relaxFactor, pvInvDiag));
+}
+
+/// backward Gauss-Seidel step using the level schedule of the upper triangle
+template<typename Matrix_type, typename Vector_type>
+void gs_step_UR_levels(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor,
+                       const LevelSchedule &upperLevels,
+                       const typename InvDiagArray<Matrix_type>::type *pvInvDiag = NULL)
+{
+	UG_ASSERT(upperLevels.num_rows() == c.size(), "level schedule does not match vector size.");
+	A.update_diag_index();
+	ForEachRowInLevels(upperLevels, GSRowUR<Matrix_type, Vector_type>(A, c, d, relaxFactor, pvInvDiag));
+}
+
+/// symmetric Gauss-Seidel step using the level schedules of the lower and upper triangle
+template<typename Matrix_type, typename Vector_type>
+void sgs_step_levels(const Matrix_type &A, Vector_type &c, const Vector_type &d, const number relaxFactor,
+                     const LevelSchedule &lowerLevels, const LevelSchedule &upperLevels,
+                     const typename InvDiagArray<Matrix_type>::type *pvInvDiag = NULL)
+{
+	// c1 = (D-L)^{-1} d
+	gs_step_LL_levels(A, c, d, relaxFactor, lowerLevels, pvInvDiag);
+
+	// c2 = D c1
+	const size_t sz = c.size();
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(sz);
+	#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+	for(size_t i = 0; i < sz; i++)
+	{
+		typename Vector_type::value_type s = c[i];
+		MatMult(c[i], 1.0, A.diag(i), s);
 	}
 
 	// c3 = (D-U)^{-1} c2
-	gs_step_UR(A, c, c, relaxFactor);
+	gs_step_UR_levels(A, c, c, relaxFactor, upperLevels, pvInvDiag);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////
@@ -221,9 +381,10 @@ void diag_step(const Matrix_type& A, Vector_type& c, const Vector_type& d, numbe
 	UG_ASSERT(c.size() == d.size() && c.size() == A.num_rows(), c << ", " << d <<
 			" and " << A << " need to have same size.");
 
+	A.update_diag_index();
 	for(size_t i=0; i < c.size(); i++)
 		// c[i] = damp * d[i]/A(i,i)
-		InverseMatMult(c[i], damp, A(i,i), d[i]);
+		InverseMatMult(c[i], damp, A.diag(i), d[i]);
 }
 
 
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULE__
+#define __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULE__
+
+#include <vector>
+#include <algorithm>
+#include <exception>
+#include "lib_algebra/cpu_algebra/algebra_threading.h"
+
+namespace ug{
+
+/// \addtogroup lib_algebra
+///	@{
+
+///	level sets of the dependency graph of a triangular sweep
+/**
+ * In a forward sweep (e.g. Gauss-Seidel, ILU forward substitution) row i
+ * depends on all rows j < i with A(i,j) in the sparsity pattern, in a backward
+ * sweep on all rows j > i. The level of a row is one more than the maximal
+ * level of the rows it depends on. Rows of the same level are independent and
+ * can be processed concurrently, while processing the levels one after another
+ * yields exactly the result of the sequential sweep.
+ *
+ * The schedule only depends on the sparsity pattern and is computed once, e.g.
+ * in the preprocess of a preconditioner.
+ */
+class LevelSchedule
+{
+	public:
+	///	computes the levels of the forward (bLower = true) or backward sweep of A
+		template<typename TMatrix>
+		void init(const TMatrix &A, bool bLower)
+		{
+			const size_t n = A.num_rows();
+			std::vector<size_t> vLevel(n, 0);
+			size_t numLevels = 0;
+
+		//	level of each row, visited in sweep order
+			for(size_t ii = 0; ii < n; ++ii)
+			{
+				const size_t i = bLower ? ii : n-1-ii;
+				size_t level = 0;
+				int begin, end;
+				A.get_row_range(i, begin, end);
+				for(int k = begin; k < end; ++k)
+				{
+					const size_t j = A.col_index_at(k);
+					if(j >= n || (bLower ? j >= i : j <= i)) continue;
+					level = std::max(level, vLevel[j]+1);
+				}
+				vLevel[i] = level;
+				numLevels = std::max(numLevels, level+1);
+			}
+
+		//	sort rows by level, keeping the sweep order within a level
+			m_vLevelStart.assign(numLevels+1, 0);
+			for(size_t i = 0; i < n; ++i)
+				m_vLevelStart[vLevel[i]+1]++;
+			for(size_t l = 0; l < numLevels; ++l)
+				m_vLevelStart[l+1] += m_vLevelStart[l];
+
+			std::vector<size_t> vPos(m_vLevelStart.begin(), m_vLevelStart.end()-1);
+			m_vRow.resize(n);
+			for(size_t ii = 0; ii < n; ++ii)
+			{
+				const size_t i = bLower ? ii : n-1-ii;
+				m_vRow[vPos[vLevel[i]]++] = i;
+			}
+		}
+
+	///	removes the schedule
+		void clear()
+		{
+			m_vRow.clear();
+			m_vLevelStart.clear();
+		}
+
+	///	number of scheduled rows
+		size_t num_rows() const {return m_vRow.size();}
+
+	///	number of levels
+		size_t num_levels() const {return m_vLevelStart.empty() ? 0 : m_vLevelStart.size()-1;}
+
+	///	rows of level l are row(k) for k in [level_begin(l), level_end(l))
+	/// \{
+		size_t level_begin(size_t l) const {return m_vLevelStart[l];}
+		size_t level_end(size_t l) const {return m_vLevelStart[l+1];}
+		size_t row(size_t k) const {return m_vRow[k];}
+	/// \}
+
+	protected:
+		std::vector<size_t> m_vRow;			///< rows sorted by level
+		std::vector<size_t> m_vLevelStart;	///< start of each level in m_vRow
+};
+
+///	calls rowOp(i) for all rows of the schedule, level by level
+/**
+ * With UG_OPENMP, the rows of each level are distributed to the algebra
+ * threads (\sa SetAlgebraNumThreads). rowOp must only write to entries of
+ * row i and only read entries of rows of previous levels.
+ */
+template<typename TRowOp>
+void ForEachRowInLevels(const LevelSchedule &schedule, const TRowOp &rowOp)
+{
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(schedule.num_rows());
+	if(numThreads > 1)
+	{
+	//	exceptions must not leave the parallel region, rethrow the first afterwards
+		std::exception_ptr pError;
+		const long numLevels = schedule.num_levels();
+
+		#pragma omp parallel num_threads(numThreads)
+		for(long l = 0; l < numLevels; ++l)
+		{
+			const long begin = schedule.level_begin(l);
+			const long end = schedule.level_end(l);
+
+			#pragma omp for schedule(static)
+			for(long k = begin; k < end; ++k)
+			{
+				try{
+					rowOp(schedule.row(k));
+				}
+				catch(...){
+					#pragma omp critical (LevelScheduleError)
+					if(!pError) pError = std::current_exception();
+				}
+			}
+		}
+
+		if(pError) std::rethrow_exception(pError);
+		return;
+	}
+#endif
+
+	for(size_t k = 0; k < schedule.num_rows(); ++k)
+		rowOp(schedule.row(k));
+}
+
+/// @}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__ALGEBRA_COMMON__LEVEL_SCHEDULE__ */
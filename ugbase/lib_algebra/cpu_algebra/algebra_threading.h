@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__CPU_ALGEBRA__ALGEBRA_THREADING__
+#define __H__UG__CPU_ALGEBRA__ALGEBRA_THREADING__
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+#ifdef UG_OPENMP
+#include <omp.h>
+#endif
+
+namespace ug{
+
+/// \addtogroup cpu_algebra
+/// \{
+
+///	vectors and matrices with less entries (rows) are always processed serially
+const size_t ALGEBRA_THREADING_MIN_SIZE = 8192;
+
+///	number of entries summed up into one partial sum of a reduction
+/**
+ * Reductions (dot products, norms) are computed as partial sums over blocks
+ * of fixed size that are added up in block order. Thus, the result does not
+ * depend on the number of threads used.
+ */
+const size_t ALGEBRA_REDUCTION_BLOCK_SIZE = 1024;
+
+inline int& AlgebraNumThreadsStorage()
+{
+	static int numThreads = 0;
+	return numThreads;
+}
+
+///	sets the number of threads used by the cpu algebra (SpMV, BLAS-1)
+/**
+ * A value of 0 uses the OpenMP default (omp_get_max_threads). Without
+ * OpenMP support (UG_OPENMP) the algebra always runs serially.
+ */
+inline void SetAlgebraNumThreads(int numThreads)
+{
+	AlgebraNumThreadsStorage() = std::max(numThreads, 0);
+}
+
+///	returns the number of threads used by the cpu algebra
+inline int AlgebraNumThreads()
+{
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraNumThreadsStorage();
+	if(numThreads > 0) return numThreads;
+	return omp_get_max_threads();
+#else
+	return 1;
+#endif
+}
+
+///	returns the number of threads to be used for a loop over n entries
+inline int AlgebraLoopThreads(size_t n)
+{
+	if(n < ALGEBRA_THREADING_MIN_SIZE) return 1;
+	return AlgebraNumThreads();
+}
+
+///	computes partial results of op for the blocks of [0, n)
+/**
+ * op(from, to) has to return the partial result for the range [from, to).
+ * The blocks are distributed statically to the threads, i.e. in the same
+ * way as the entries of the element-wise vector loops.
+ */
+template<typename TBlockOp>
+void AlgebraBlockPartials(std::vector<double>& vPartial, size_t n, const TBlockOp& op)
+{
+	const size_t numBlocks = (n + ALGEBRA_REDUCTION_BLOCK_SIZE - 1) / ALGEBRA_REDUCTION_BLOCK_SIZE;
+	vPartial.resize(numBlocks);
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(n);
+	#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+	for(size_t b = 0; b < numBlocks; ++b)
+		vPartial[b] = op(b * ALGEBRA_REDUCTION_BLOCK_SIZE,
+						 std::min(n, (b+1) * ALGEBRA_REDUCTION_BLOCK_SIZE));
+}
+
+///	returns the sum of op over [0, n), computed deterministically in blocks
+template<typename TBlockOp>
+double AlgebraBlockSum(size_t n, const TBlockOp& op)
+{
+#ifdef UG_OPENMP
+	if(n < ALGEBRA_THREADING_MIN_SIZE) return op(0, n);
+#else
+	return op(0, n);
+#endif
+
+	std::vector<double> vPartial;
+	AlgebraBlockPartials(vPartial, n, op);
+	double sum = 0.0;
+	for(size_t b = 0; b < vPartial.size(); ++b)
+		sum += vPartial[b];
+	return sum;
+}
+
+///	returns the maximum of op over [0, n) (op has to return values >= 0)
+template<typename TBlockOp>
+double AlgebraBlockMax(size_t n, const TBlockOp& op)
+{
+#ifdef UG_OPENMP
+	if(n < ALGEBRA_THREADING_MIN_SIZE) return op(0, n);
+#else
+	return op(0, n);
+#endif
+
+	std::vector<double> vPartial;
+	AlgebraBlockPartials(vPartial, n, op);
+	double max = 0.0;
+	for(size_t b = 0; b < vPartial.size(); ++b)
+		max = std::max(max, vPartial[b]);
+	return max;
+}
+
+// end group cpu_algebra
+/// \}
+
+} // namespace ug
+
+#endif /* __H__UG__CPU_ALGEBRA__ALGEBRA_THREADING__ */
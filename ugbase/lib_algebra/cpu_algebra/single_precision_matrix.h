@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__CPU_ALGEBRA__SINGLE_PRECISION_MATRIX__
+#define __H__UG__CPU_ALGEBRA__SINGLE_PRECISION_MATRIX__
+
+#include <vector>
+#include "common/common.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+
+namespace ug{
+
+/// \addtogroup lib_algebra
+/// \{
+
+/// conversion of matrix blocks to and from single precision storage
+/**
+ * Only blocks of static size can be stored. For all other block types the
+ * conversion throws, such that the single precision mode can be requested
+ * for every algebra, but fails at runtime for variable block sizes.
+ */
+template<typename TBlock, bool bStatic = block_traits<TBlock>::is_static>
+struct SinglePrecisionBlock
+{
+	enum { size = 1 };
+	static void store(float* p, const TBlock& b)
+	{
+		UG_THROW("Single precision storage is only available for blocks of static size.");
+	}
+	static void load(TBlock& b, const float* p)
+	{
+		UG_THROW("Single precision storage is only available for blocks of static size.");
+	}
+};
+
+template<typename TBlock>
+struct SinglePrecisionBlock<TBlock, true>
+{
+	enum { rows = block_traits<TBlock>::static_num_rows };
+	enum { cols = block_traits<TBlock>::static_num_cols };
+	enum { size = rows * cols };
+	static void store(float* p, const TBlock& b)
+	{
+		for(size_t r = 0; r < (size_t)rows; ++r)
+			for(size_t c = 0; c < (size_t)cols; ++c)
+				*p++ = (float) BlockRef(b, r, c);
+	}
+	static void load(TBlock& b, const float* p)
+	{
+		for(size_t r = 0; r < (size_t)rows; ++r)
+			for(size_t c = 0; c < (size_t)cols; ++c)
+				BlockRef(b, r, c) = *p++;
+	}
+};
+
+template<>
+struct SinglePrecisionBlock<number, true>
+{
+	enum { size = 1 };
+	static void store(float* p, const number& b) {*p = (float) b;}
+	static void load(number& b, const float* p) {b = *p;}
+};
+
+
+/**
+ * \brief Read-only copy of a sparse matrix with single precision values
+ *
+ * The matrix stores the sparsity pattern of a SparseMatrix in a compact form
+ * (without reserved space in the rows) and its entries as floats. Entries
+ * are converted back to the double precision block type on access, so that
+ * the smoothers and triangular solves written for SparseMatrix
+ * (e.g. gs_step_LL, invert_L) can be used unchanged with double precision
+ * vectors, while only half of the bytes for the matrix values have to be
+ * loaded from memory.
+ *
+ * This is meant for preconditioners, whose matrices (e.g. ILU factors) do
+ * not need the full accuracy. The defect and the Krylov vectors remain in
+ * double precision.
+ *
+ * \tparam TMatrix	matrix type the copy is created from (e.g. SparseMatrix
+ * 					or ParallelMatrix). value_type is the one of TMatrix.
+ */
+template<typename TMatrix>
+class SinglePrecisionMatrix
+{
+	public:
+		typedef typename TMatrix::value_type value_type;
+		typedef SinglePrecisionBlock<value_type> block_conversion;
+		enum { block_size = block_conversion::size };
+
+	public:
+		SinglePrecisionMatrix() : m_numCols(0) {}
+
+	///	creates the single precision copy of A
+		void init(const TMatrix& A)
+		{
+			PROFILE_FUNC_GROUP("algebra");
+			const size_t numRows = A.num_rows();
+			m_numCols = A.num_cols();
+			m_vRowStart.resize(numRows + 1);
+			m_vDiagIndex.resize(numRows);
+			m_vCol.clear();
+			m_vValue.clear();
+
+			int begin, end;
+			size_t nnz = 0;
+			for(size_t r = 0; r < numRows; ++r){
+				A.get_row_range(r, begin, end);
+				nnz += end - begin;
+			}
+			m_vCol.reserve(nnz);
+			m_vValue.resize(nnz * block_size);
+
+			int pos = 0;
+			for(size_t r = 0; r < numRows; ++r)
+			{
+				m_vRowStart[r] = pos;
+				m_vDiagIndex[r] = -1;
+				A.get_row_range(r, begin, end);
+				for(int k = begin; k < end; ++k, ++pos)
+				{
+					const int c = A.col_index_at(k);
+					if(c == (int)r) m_vDiagIndex[r] = pos;
+					m_vCol.push_back(c);
+					block_conversion::store(&m_vValue[pos * block_size], A.value_at(k));
+				}
+			}
+			m_vRowStart[numRows] = pos;
+		}
+
+	///	frees the memory
+		void clear()
+		{
+			m_vRowStart.clear(); m_vDiagIndex.clear();
+			m_vCol.clear(); m_vValue.clear();
+			m_numCols = 0;
+		}
+
+		size_t num_rows() const {return m_vDiagIndex.size();}
+		size_t num_cols() const {return m_numCols;}
+		size_t total_num_connections() const {return m_vCol.size();}
+
+	///	the diagonal positions are computed in init()
+		void update_diag_index() const {}
+
+	//	raw access, same as in SparseMatrix
+		void get_row_range(size_t r, int &begin, int &end) const
+		{
+			begin = m_vRowStart[r];
+			end = m_vRowStart[r+1];
+		}
+		int col_index_at(int k) const {return m_vCol[k];}
+		value_type value_at(int k) const
+		{
+			value_type v;
+			block_conversion::load(v, &m_vValue[k * block_size]);
+			return v;
+		}
+		int diag_index(size_t r) const {return m_vDiagIndex[r];}
+
+	///	returns A(r,r), or 0.0 if there is no diagonal entry
+		value_type diag(size_t r) const
+		{
+			const int k = m_vDiagIndex[r];
+			if(k == -1) return value_type(0.0);
+			return value_at(k);
+		}
+
+	///	row iterator with the interface of SparseMatrix::const_row_iterator
+		class const_row_iterator
+		{
+			public:
+				const_row_iterator(const SinglePrecisionMatrix& A, int k) : m_A(&A), m_k(k) {}
+				size_t index() const {return m_A->col_index_at(m_k);}
+				value_type value() const {return m_A->value_at(m_k);}
+				const_row_iterator& operator++() {++m_k; return *this;}
+				bool operator==(const const_row_iterator& o) const {return m_k == o.m_k;}
+				bool operator!=(const const_row_iterator& o) const {return m_k != o.m_k;}
+			private:
+				const SinglePrecisionMatrix* m_A;
+				int m_k;
+		};
+
+		const_row_iterator begin_row(size_t r) const {return const_row_iterator(*this, m_vRowStart[r]);}
+		const_row_iterator end_row(size_t r) const {return const_row_iterator(*this, m_vRowStart[r+1]);}
+
+	///	returns an iterator to A(r,r), or end_row(r) if there is no diagonal entry
+		const_row_iterator get_diag_connection(size_t r) const
+		{
+			const int k = m_vDiagIndex[r];
+			if(k == -1) return end_row(r);
+			return const_row_iterator(*this, k);
+		}
+
+	protected:
+		std::vector<int> m_vRowStart;	///< row r is stored at [m_vRowStart[r], m_vRowStart[r+1])
+		std::vector<int> m_vDiagIndex;	///< positions of the diagonal entries, -1 if missing
+		std::vector<int> m_vCol;		///< column indices
+		std::vector<float> m_vValue;	///< block_size floats per connection
+		size_t m_numCols;
+};
+
+/// \}
+
+} // end namespace ug
+
+#endif // __H__UG__CPU_ALGEBRA__SINGLE_PRECISION_MATRIX__
@@ -244,7 +244,28 @@ public:
 	// finalizing functions
 	//----------------------
 
+	/**
+	 * \brief compacts the matrix to the pure CRS layout and marks it as finalized
+	 *
+	 * In the finalized state, row r is stored contiguously from rowStart[r] to
+	 * rowStart[r+1] and axpy, axpy_transposed and apply use branch-free CRS
+	 * kernels. Values may still be changed, but adding a new connection leaves
+	 * the finalized state. Note that defragmenting the matrix also finalizes it.
+	 */
+	void finalize()
+	{
+		if(!m_bFinalized) defragment();
+	}
+
+	//! returns true if the matrix is stored in the compact CRS layout (\sa finalize)
+	bool is_finalized() const { return m_bFinalized; }
 
+	//! returns a counter that changes whenever the sparsity pattern may have changed
+	/**
+	 * Can be used to cache data derived from the pattern, e.g. which rows
+	 * couple to the interface of a parallel vector (\sa ParallelMatrix::apply).
+	 */
+	size_t pattern_revision() const { return m_patternRevision; }
 
 	inline void check_rc(size_t r, size_t c) const
 	{
@@ -327,6 +348,17 @@ public:
 	//! calculates dest += alpha * A[row, .] v;
 	template<typename vector_t>
 	inline void mat_mult_add_row(size_t row, typename vector_t::value_type &dest, double alpha, const vector_t &v) const;
+
+protected:
+	//! axpy for the finalized (compact CRS) layout
+	template<typename vector_t>
+	void axpy_finalized(vector_t &dest,
+			const number &alpha1, const vector_t &v1,
+			const number &beta1, const vector_t &w1) const;
+
+	//! axpy_transposed for the finalized (compact CRS) layout
+	template<typename vector_t>
+	void axpy_transposed_finalized(vector_t &dest, const number &beta1, const vector_t &w1) const;
 public:
 	// accessor functions
 	//----------------------
@@ -584,6 +616,87 @@ public:
 		return row_iterator(*this, r, j);
 	}
 
+	// diagonal access
+	//----------------------
+
+	/**
+	 * \brief computes the positions of the diagonal entries, if the sparsity
+	 * pattern has changed since the last call
+	 *
+	 * The positions are cached and used by diag_index, diag and
+	 * get_diag_connection, so that smoothers do not have to search the rows
+	 * for the diagonal in every sweep. The cache is updated lazily by these
+	 * functions; call this before accessing the diagonal from several threads.
+	 */
+	void update_diag_index() const;
+
+	//! returns the position of A(r,r) in the value array, or -1 if there is no diagonal entry
+	int diag_index(size_t r) const
+	{
+		update_diag_index();
+		UG_ASSERT(r < m_diagIndex.size(), "row " << r << " out of bounds.");
+		return m_diagIndex[r];
+	}
+
+	//! returns A(r,r), or 0.0 if there is no diagonal entry
+	const value_type &diag(size_t r) const
+	{
+		int j = diag_index(r);
+		if(j == -1)
+		{
+			static value_type v(0.0);
+			return v;
+		}
+		return values[j];
+	}
+
+	//! returns a const_row_iterator to A(r,r), or end_row(r) if there is no diagonal entry
+	const_row_iterator get_diag_connection(size_t r) const
+	{
+		int j = diag_index(r);
+		if(j == -1) return end_row(r);
+		return const_row_iterator(*this, r, j);
+	}
+
+	// raw row access
+	//----------------------
+
+	/**
+	 * \brief returns the positions [begin, end) of row r in the column and value arrays
+	 *
+	 * In contrast to the row iterators, the raw access does not register at
+	 * the matrix and can therefore be used by several threads at the same time.
+	 * \sa col_index_at, value_at
+	 */
+	void get_row_range(size_t r, int &begin, int &end) const
+	{
+		begin = rowStart[r];
+		end = rowEnd[r];
+	}
+
+	//! returns the column index at position k (\sa get_row_range)
+	int col_index_at(int k) const { return cols[k]; }
+
+	//! returns the value at position k (\sa get_row_range)
+	const value_type &value_at(int k) const { return values[k]; }
+
+	//! returns the value at position k (\sa get_row_range, connection_index)
+	value_type &value_at(int k) { return values[k]; }
+
+	/**
+	 * \brief returns the position of the connection (r, c) in the value array
+	 *
+	 * The position stays valid as long as no connection is added and the
+	 * matrix is not defragmented. For a finalized matrix, the positions only
+	 * depend on the sparsity pattern.
+	 * \return position usable with value_at, or -1 if (r, c) does not exist
+	 */
+	int connection_index(size_t r, size_t c) const
+	{
+		check_rc(r, c);
+		return get_index_const(r, c);
+	}
+
 
 	void defragment()
     {
@@ -719,6 +832,8 @@ protected:
     }
     void copyToNewSize(size_t newSize, size_t maxCols);
 	void check_fragmentation() const;
+	//! invalidates all data cached for the current sparsity pattern
+	void pattern_changed() { m_bDiagIndexValid = false; ++m_patternRevision; }
 	int get_nnz_max_cols(size_t maxCols);
 
 public: // bug
@@ -741,6 +856,10 @@ protected:
     size_t fragmented;
     size_t nnz;
     bool bNeedsValues;
+    bool m_bFinalized; ///< true if rows are stored contiguously (rowStart[r+1] == rowEnd[r])
+    mutable std::vector<int> m_diagIndex; ///< cached positions of the diagonal entries (\sa update_diag_index)
+    mutable bool m_bDiagIndexValid; ///< true if m_diagIndex matches the current sparsity pattern
+    size_t m_patternRevision; ///< incremented on every change of the sparsity pattern (\sa pattern_revision)
 
     std::vector<value_type> values;
     int maxValues;
@@ -41,6 +41,7 @@
 #include "lib_algebra/common/operations_vec.h"
 #include "common/profiler/profiler.h"
 #include "sparsematrix.h"
+#include "algebra_threading.h"
 #include <vector>
 #include <algorithm>
 
@@ -60,6 +61,9 @@ SparseMatrix<T>::SparseMatrix()
 {
 	PROFILE_SPMATRIX(SparseMatrix_constructor);
 	bNeedsValues = true;
+	m_bFinalized = false;
+	m_bDiagIndexValid = false;
+	m_patternRevision = 0;
 	iIterators=0;
 	nnz = 0;
 	m_numCols = 0;
@@ -80,6 +84,8 @@ void SparseMatrix<T>::clear_and_free()
 	std::vector<int>().swap(cols);
 	std::vector<value_type>().swap(values);
 	maxValues = 0;
+	m_bFinalized = false;
+	pattern_changed();
 
 #ifdef CHECK_ROW_ITERATORS
 	std::vector<int>().swap(nrOfRowIterators);
@@ -101,6 +107,8 @@ void SparseMatrix<T>::resize_and_clear(size_t newRows, size_t newCols)
 	values.clear();
 	if(bNeedsValues) values.resize(newRows);
 	maxValues = 0;
+	m_bFinalized = false;
+	pattern_changed();
 
 #ifdef CHECK_ROW_ITERATORS
 	nrOfRowIterators.clear();
@@ -118,6 +126,8 @@ void SparseMatrix<T>::resize_and_keep_values(size_t newRows, size_t newCols)
 
 	if(newRows != num_rows())
 	{
+		m_bFinalized = false;
+		pattern_changed();
 		size_t oldrows = num_rows();
 		rowStart.resize(newRows+1, -1);
 		rowMax.resize(newRows);
@@ -201,6 +211,8 @@ void SparseMatrix<T>::set_as_transpose_of2(const SparseMatrix<value_type> &B, do
 
 	maxValues = B.maxValues;
 	fragmented = 0;
+	m_bFinalized = false;
+	pattern_changed();
 
 	for(r=0; r<num_cols(); r++){
 		for(const_row_iterator it = B.begin_row(r); it != B.end_row(r); ++it){
@@ -268,6 +280,140 @@ inline void SparseMatrix<T>::mat_mult_add_row(size_t row, typename vector_t::val
 }
 
 
+/// CRS row kernels used for finalized matrices
+/**
+ * The generic version uses the block operations of the value type, the
+ * specialization for double uses independent partial sums, so that the row
+ * loop can be pipelined and vectorized by the compiler.
+ */
+template<typename value_t>
+struct CRSKernels
+{
+	//! dest += beta * A[row, .] w, where the row is stored in [begin, end)
+	template<typename vector_t>
+	static inline void row_mult_add(typename vector_t::value_type &dest, const number &beta,
+			const value_t *pVal, const int *pCol, int begin, int end, const vector_t &w)
+	{
+		for(int k = begin; k < end; ++k)
+			MatMultAdd(dest, 1.0, dest, beta, pVal[k], w[pCol[k]]);
+	}
+
+	//! dest[col] += beta * A[row, col]^T wRow for all cols of the row stored in [begin, end)
+	template<typename vector_t>
+	static inline void row_mult_transposed_add(vector_t &dest, const number &beta,
+			const value_t *pVal, const int *pCol, int begin, int end,
+			const typename vector_t::value_type &wRow)
+	{
+		for(int k = begin; k < end; ++k)
+			MatMultTransposedAdd(dest[pCol[k]], 1.0, dest[pCol[k]], beta, pVal[k], wRow);
+	}
+};
+
+template<>
+struct CRSKernels<double>
+{
+	template<typename vector_t>
+	static inline void row_mult_add(double &dest, const number &beta,
+			const double *pVal, const int *pCol, int begin, int end, const vector_t &w)
+	{
+		double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+		int k = begin;
+		for(; k + 3 < end; k += 4)
+		{
+			s0 += pVal[k]   * w[pCol[k]];
+			s1 += pVal[k+1] * w[pCol[k+1]];
+			s2 += pVal[k+2] * w[pCol[k+2]];
+			s3 += pVal[k+3] * w[pCol[k+3]];
+		}
+		for(; k < end; ++k)
+			s0 += pVal[k] * w[pCol[k]];
+		dest += beta * ((s0 + s1) + (s2 + s3));
+	}
+
+	template<typename vector_t>
+	static inline void row_mult_transposed_add(vector_t &dest, const number &beta,
+			const double *pVal, const int *pCol, int begin, int end, const double &wRow)
+	{
+		const double bw = beta * wRow;
+		for(int k = begin; k < end; ++k)
+			dest[pCol[k]] += pVal[k] * bw;
+	}
+};
+
+
+template<typename T>
+template<typename vector_t>
+void SparseMatrix<T>::axpy_finalized(vector_t &dest,
+		const number &alpha1, const vector_t &v1,
+		const number &beta1, const vector_t &w1) const
+{
+	UG_ASSERT(m_bFinalized, "matrix is not finalized.");
+	const size_t numRows = num_rows();
+	if(numRows == 0) return;
+
+	const int *pRow = &rowStart[0];
+	const int *pCol = cols.empty() ? NULL : &cols[0];
+	const value_type *pVal = values.empty() ? NULL : &values[0];
+
+	// rows are independent, the static distribution matches the one of the
+	// threaded vector operations (first touch)
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(numRows);
+#endif
+
+	if(alpha1 == 0.0)
+	{
+#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+		for(size_t i=0; i < numRows; i++)
+		{
+			dest[i] = 0.0;
+			CRSKernels<value_type>::row_mult_add(dest[i], beta1, pVal, pCol, pRow[i], pRow[i+1], w1);
+		}
+	}
+	else if(&dest == &v1)
+	{
+#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+		for(size_t i=0; i < numRows; i++)
+		{
+			if(alpha1 != 1.0) dest[i] *= alpha1;
+			CRSKernels<value_type>::row_mult_add(dest[i], beta1, pVal, pCol, pRow[i], pRow[i+1], w1);
+		}
+	}
+	else
+	{
+#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+		for(size_t i=0; i < numRows; i++)
+		{
+			VecScaleAssign(dest[i], alpha1, v1[i]);
+			CRSKernels<value_type>::row_mult_add(dest[i], beta1, pVal, pCol, pRow[i], pRow[i+1], w1);
+		}
+	}
+}
+
+template<typename T>
+template<typename vector_t>
+void SparseMatrix<T>::axpy_transposed_finalized(vector_t &dest,
+		const number &beta1, const vector_t &w1) const
+{
+	UG_ASSERT(m_bFinalized, "matrix is not finalized.");
+	const size_t numRows = num_rows();
+	if(numRows == 0) return;
+
+	const int *pRow = &rowStart[0];
+	const int *pCol = cols.empty() ? NULL : &cols[0];
+	const value_type *pVal = values.empty() ? NULL : &values[0];
+
+	for(size_t i=0; i < numRows; i++)
+		CRSKernels<value_type>::row_mult_transposed_add(dest, beta1, pVal, pCol, pRow[i], pRow[i+1], w1[i]);
+}
+
+
 template<typename T>
 template<typename vector_t>
 void SparseMatrix<T>::apply_ignore_zero_rows(vector_t &dest,
@@ -297,9 +443,23 @@ void SparseMatrix<T>::axpy(vector_t &dest,
 {
 	PROFILE_SPMATRIX(SparseMatrix_axpy);
 	check_fragmentation();
+	if(m_bFinalized)
+	{
+		axpy_finalized(dest, alpha1, v1, beta1, w1);
+		return;
+	}
+
+	const size_t numRows = num_rows();
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(numRows);
+#endif
+
 	if(alpha1 == 0.0)
 	{
-		for(size_t i=0; i < num_rows(); i++)
+#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+		for(size_t i=0; i < numRows; i++)
 		{
 			size_t rowIt=rowStart[i];
 			size_t itEnd=rowEnd[i];
@@ -317,20 +477,30 @@ void SparseMatrix<T>::axpy(vector_t &dest,
 	else if(&dest == &v1)
 	{
 		if(alpha1 != 1.0) {
-			for(size_t i=0; i < num_rows(); i++)
+#ifdef UG_OPENMP
+			#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+			for(size_t i=0; i < numRows; i++)
 			{
 				dest[i] *= alpha1;
 				mat_mult_add_row(i, dest[i], beta1, w1);
 			}
 		}
 		else
-			for(size_t i=0; i < num_rows(); i++)
+		{
+#ifdef UG_OPENMP
+			#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+			for(size_t i=0; i < numRows; i++)
 				mat_mult_add_row(i, dest[i], beta1, w1);
-
+		}
 	}
 	else
 	{
-		for(size_t i=0; i < num_rows(); i++)
+#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+		for(size_t i=0; i < numRows; i++)
 		{
 			VecScaleAssign(dest[i], alpha1, v1[i]);
 			mat_mult_add_row(i, dest[i], beta1, w1);
@@ -358,6 +528,12 @@ void SparseMatrix<T>::axpy_transposed(vector_t &dest,
 	else
 		VecScaleAssign(dest, alpha1, v1);
 
+	if(m_bFinalized)
+	{
+		axpy_transposed_finalized(dest, beta1, w1);
+		return;
+	}
+
 	for(size_t i=0; i<num_rows(); i++)
 	{
 
@@ -602,6 +778,10 @@ int SparseMatrix<T>::get_index(int r, int c)
 //		UG_LOG("new row\n");
 		// row did not start, start new row at the end of cols array
 		assureValuesSize(maxValues+1);
+		// note: assureValuesSize may defragment and finalize the matrix,
+		// so the flags are reset after it
+		m_bFinalized = false;
+		pattern_changed();
 		rowStart[r] = maxValues;
 		rowEnd[r] = maxValues+1;
 		rowMax[r] = maxValues+1;
@@ -689,6 +869,11 @@ int SparseMatrix<T>::get_index(int r, int c)
 	if(bNeedsValues) values[index] = 0.0;
 	cols[index] = c;
 
+	// the row has been extended or moved (which may have defragmented and
+	// finalized the matrix in assureValuesSize), so the compact layout is lost
+	m_bFinalized = false;
+	pattern_changed();
+
 	nnz++;
 #ifndef NDEBUG
 	assert(index >= rowStart[r] && index < rowEnd[r]);
@@ -716,6 +901,8 @@ void SparseMatrix<T>::copyToNewSize(size_t newSize, size_t maxCol)
 		cols.resize(newSize);
 		cols.resize(cols.capacity());
 		if(bNeedsValues) { values.resize(newSize); values.resize(cols.size()); }
+		m_bFinalized = false;
+		pattern_changed();
 		return;
 	}
 
@@ -747,6 +934,22 @@ void SparseMatrix<T>::copyToNewSize(size_t newSize, size_t maxCol)
 	maxValues = j;
 	if(bNeedsValues) values.swap(v);
 	cols.swap(c);
+
+	// rows are now stored contiguously
+	m_bFinalized = true;
+	pattern_changed();
+}
+
+template<typename T>
+void SparseMatrix<T>::update_diag_index() const
+{
+	if(m_bDiagIndexValid) return;
+	PROFILE_SPMATRIX(SparseMatrix_update_diag_index);
+	const size_t numRows = num_rows();
+	m_diagIndex.resize(numRows);
+	for(size_t r=0; r<numRows; r++)
+		m_diagIndex[r] = (r < num_cols()) ? get_index_const(r, r) : -1;
+	m_bDiagIndexValid = true;
 }
 
 template<typename T>
@@ -34,6 +34,7 @@
 #define __H__UG__CPU_ALGEBRA__VECTOR__
 
 #include "sparsematrix.h"
+#include "algebra_threading.h"
 
 #include "../common/template_expressions.h"
 #include "../common/operations.h"
@@ -169,6 +170,10 @@ public:
 
 	inline void operator *= (const number &a)
 	{
+#ifdef UG_OPENMP
+		const int numThreads = AlgebraLoopThreads(m_size);
+		#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
 		for(size_t i=0; i<size(); i++) values[i] *= a;
 	}
 
@@ -222,6 +227,9 @@ protected:
 private:
 	void destroy();
 
+	//! initializes freshly allocated values in the distribution of the threaded loops
+	void first_touch(value_type *v, size_t n);
+
 	size_t m_size;			///< size of the vector (vector is from 0..size-1)
 	size_t m_capacity;		///< size of the vector (vector is from 0..size-1)
 	value_type *values;		///< array where the values are stored, size m_size
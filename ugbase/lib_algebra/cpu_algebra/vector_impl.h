@@ -39,6 +39,7 @@
 #include "algebra_misc.h"
 #include "common/math/ugmath.h"
 #include "vector.h" // for urand
+#include "algebra_threading.h"
 
 #define prefetchReadWrite(a)
 
@@ -67,21 +68,68 @@ inline const value_type &Vector<value_type>::operator [] (size_t i) const
 	return sum;
 }*/
 
+/// block operations for the (threaded) reductions of Vector
+template<typename value_type>
+struct VectorBlockOps
+{
+	//! sum_i a_i^T b_i over [from, to)
+	struct DotProd
+	{
+		DotProd(const value_type* a_, const value_type* b_) : a(a_), b(b_) {}
+		double operator()(size_t from, size_t to) const
+		{
+			double sum=0;
+			for(size_t i=from; i<to; i++) sum += VecProd(a[i], b[i]);
+			return sum;
+		}
+		const value_type *a, *b;
+	};
+
+	//! sum_i |a_i|^2 over [from, to)
+	struct Norm2
+	{
+		Norm2(const value_type* a_) : a(a_) {}
+		double operator()(size_t from, size_t to) const
+		{
+			double sum=0;
+			for(size_t i=from; i<to; i++) sum += BlockNorm2(a[i]);
+			return sum;
+		}
+		const value_type *a;
+	};
+
+	//! max_i |a_i|_max over [from, to)
+	struct MaxNorm
+	{
+		MaxNorm(const value_type* a_) : a(a_) {}
+		double operator()(size_t from, size_t to) const
+		{
+			double d=0;
+			for(size_t i=from; i<to; i++) d = std::max(d, BlockMaxNorm(a[i]));
+			return d;
+		}
+		const value_type *a;
+	};
+};
+
 // dotprod
 template<typename value_type>
 inline double Vector<value_type>::dotprod(const Vector &w) //const
 {
 	UG_ASSERT(m_size == w.m_size,  *this << " has not same size as " << w);
 
-	double sum=0;
-	for(size_t i=0; i<m_size; i++)	sum += VecProd(values[i], w[i]);
-	return sum;
+	return AlgebraBlockSum(m_size,
+			typename VectorBlockOps<value_type>::DotProd(values, w.values));
 }
 
 // assign double to whole Vector
 template<typename value_type>
 inline double Vector<value_type>::operator = (double d)
 {
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(m_size);
+	#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
 	for(size_t i=0; i<m_size; i++)
 		values[i] = d;
 	return d;
@@ -100,6 +148,10 @@ template<typename value_type>
 inline void Vector<value_type>::operator = (const vector_type &v)
 {
 	resize(v.size());
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(m_size);
+	#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
 	for(size_t i=0; i<m_size; i++)
 		values[i] = v[i];
 }
@@ -108,6 +160,10 @@ template<typename value_type>
 inline void Vector<value_type>::operator += (const vector_type &v)
 {
 	UG_ASSERT(v.size() == size(), "vector sizes must match! (" << v.size() << " != " << size() << ")");
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(m_size);
+	#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
 	for(size_t i=0; i<m_size; i++)
 		values[i] += v[i];
 }
@@ -116,6 +172,10 @@ template<typename value_type>
 inline void Vector<value_type>::operator -= (const vector_type &v)
 {
 	UG_ASSERT(v.size() == size(), "vector sizes must match! (" << v.size() << " != " << size() << ")");
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(m_size);
+	#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
 	for(size_t i=0; i<m_size; i++)
 		values[i] -= v[i];
 }
@@ -162,6 +222,7 @@ void Vector<value_type>::create(size_t size)
 	m_size = size;
 	values = new value_type[size];
 	m_capacity = size;
+	first_touch(values, size);
 }
 
 
@@ -197,11 +258,17 @@ void Vector<value_type>::reserve_exactly(size_t newCapacity, bool bCopyValues)
 	// we cannot use memcpy here bcs of variable blocks.
 	if(values != NULL && bCopyValues)
 	{
+#ifdef UG_OPENMP
+		const int numThreads = AlgebraLoopThreads(m_size);
+		#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
 		for(size_t i=0; i<m_size; i++)
 			std::swap(new_values[i], values[i]);
 		for(size_t i=m_size; i<newCapacity; i++)
 			new_values[i] = 0.0;
 	}
+	else
+		first_touch(new_values, newCapacity);
 	if(values) delete [] values;
 	values = new_values;
 	m_capacity = newCapacity;
@@ -245,10 +312,29 @@ void Vector<value_type>::create(const Vector &v)
 	m_capacity = m_size;
 
 	// we cannot use memcpy here bcs of variable blocks.
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(m_size);
+	#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
 	for(size_t i=0; i<m_size; i++)
 		values[i] = v.values[i];
 }
 
+template<typename value_type>
+void Vector<value_type>::first_touch(value_type *v, size_t n)
+{
+#ifdef UG_OPENMP
+	// the pages of freshly allocated memory are placed at the NUMA node of
+	// the thread touching them first. Using the same static distribution as
+	// in the threaded vector loops keeps the entries local to those threads.
+	const int numThreads = AlgebraLoopThreads(n);
+	if(numThreads == 1) return;
+	#pragma omp parallel for schedule(static) num_threads(numThreads)
+	for(size_t i=0; i<n; i++)
+		v[i] = 0.0;
+#endif
+}
+
 
 // print
 template<typename value_type>
@@ -322,19 +408,93 @@ double operator *(const TRANSPOSED<Vector<value_type> > &x, const Vector<value_t
 template<typename value_type>
 inline double Vector<value_type>::norm() const
 {
-	double d=0;
-	for(size_t i=0; i<size(); ++i)
-		d+=BlockNorm2(values[i]);
-	return sqrt(d);
+	return sqrt(AlgebraBlockSum(m_size,
+			typename VectorBlockOps<value_type>::Norm2(values)));
 }
 
 template<typename value_type>
 inline double Vector<value_type>::maxnorm() const
 {
-	double d=0;
-	for(size_t i=0; i<size(); ++i)
-		d = std::max(d, BlockMaxNorm(values[i]));
-	return d;
+	return AlgebraBlockMax(m_size,
+			typename VectorBlockOps<value_type>::MaxNorm(values));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// threaded BLAS-1 operations
+// (more specialized than the generic versions in operations_vec.h, which are
+// also used for small blocks and therefore stay serial)
+
+// dest = alpha1*v1
+template<typename value_type>
+inline void VecScaleAssign(Vector<value_type> &dest, double alpha1, const Vector<value_type> &v1)
+{
+	const size_t n = dest.size();
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(n);
+	#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+	for(size_t i=0; i<n; i++)
+		VecScaleAssign(dest[i], alpha1, v1[i]);
+}
+
+// dest = v1
+template<typename value_type>
+inline void VecAssign(Vector<value_type> &dest, const Vector<value_type> &v1)
+{
+	const size_t n = dest.size();
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(n);
+	#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+	for(size_t i=0; i<n; i++)
+		dest[i] = v1[i];
+}
+
+// dest = alpha1*v1 + alpha2*v2
+template<typename value_type>
+inline void VecScaleAdd(Vector<value_type> &dest, double alpha1, const Vector<value_type> &v1,
+		double alpha2, const Vector<value_type> &v2)
+{
+	const size_t n = dest.size();
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(n);
+	#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+	for(size_t i=0; i<n; i++)
+		VecScaleAdd(dest[i], alpha1, v1[i], alpha2, v2[i]);
+}
+
+// dest = alpha1*v1 + alpha2*v2 + alpha3*v3
+template<typename value_type>
+inline void VecScaleAdd(Vector<value_type> &dest, double alpha1, const Vector<value_type> &v1,
+		double alpha2, const Vector<value_type> &v2, double alpha3, const Vector<value_type> &v3)
+{
+	const size_t n = dest.size();
+#ifdef UG_OPENMP
+	const int numThreads = AlgebraLoopThreads(n);
+	#pragma omp parallel for schedule(static) num_threads(numThreads) if(numThreads > 1)
+#endif
+	for(size_t i=0; i<n; i++)
+		VecScaleAdd(dest[i], alpha1, v1[i], alpha2, v2[i], alpha3, v3[i]);
+}
+
+// returns a^T b
+template<typename value_type>
+inline double VecProd(const Vector<value_type> &a, const Vector<value_type> &b)
+{
+	UG_ASSERT(a.size() == b.size(), a << " has not same size as " << b);
+	if(a.size() == 0) return 0.0;
+	return AlgebraBlockSum(a.size(),
+			typename VectorBlockOps<value_type>::DotProd(&a[0], &b[0]));
+}
+
+// returns |a|^2
+template<typename value_type>
+inline double VecNormSquared(const Vector<value_type> &a)
+{
+	if(a.size() == 0) return 0.0;
+	return AlgebraBlockSum(a.size(),
+			typename VectorBlockOps<value_type>::Norm2(&a[0]));
 }
 
 template<typename TValueType>
@@ -520,6 +520,17 @@ public:
 		return row_iterator(*this, r, j);
 	}
 
+	// diagonal access (same interface as SparseMatrix, without caching)
+	void update_diag_index() const {}
+	int diag_index(size_t r) const { return get_index_const(r, r); }
+	const value_type &diag(size_t r) const { return operator()(r, r); }
+	const_row_iterator get_diag_connection(size_t r) const { return get_connection(r, r); }
+
+	// raw row access (same interface as SparseMatrix)
+	void get_row_range(size_t r, int &begin, int &end) const { begin = rowStart[r]; end = rowEnd[r]; }
+	int col_index_at(int k) const { return cols[k]; }
+	const value_type &value_at(int k) const { return values[k]; }
+
 
 	void defragment()
     {
@@ -95,6 +95,8 @@ public:
 	// finalizing functions
 	//----------------------
 	void defragment();
+	void finalize();
+	bool is_finalized() const;
 
 }
 
@@ -138,6 +138,27 @@ class ILinearOperator : public IOperator<X,Y>
 	 */
 		virtual void apply_sub(Y& f, const X& u) = 0;
 
+	///	applies the operator, making u consistent if needed
+	/**
+	 * As apply(), but u is passed non-const: if accepts_additive_input()
+	 * returns true, u may be additive in parallel and is changed to
+	 * consistent in place. Otherwise, u must be consistent as for apply().
+	 *
+	 * \param[in,out]	u		domain function, consistent after the call
+	 * \param[out]		f		codomain function
+	 */
+		virtual void apply_making_consistent(Y& f, X& u) {apply(f, u);}
+
+	///	returns if apply_making_consistent accepts a non-consistent u in parallel
+	/**
+	 * By default, u must be consistent. Operators that make an additive u
+	 * consistent themselves, overlapping the communication with the
+	 * computation, return true. Callers may then skip the conversion of u
+	 * and find u consistent after apply_making_consistent
+	 * (\sa ParallelMatrix::apply_making_consistent).
+	 */
+		virtual bool accepts_additive_input() const {return false;}
+
 	/// virtual	destructor
 		virtual ~ILinearOperator() {};
 };
@@ -70,6 +70,23 @@ class MatrixOperator :	public virtual ILinearOperator<X,Y>,
 	// 	Apply Operator, i.e. f = f - L*u;
 		virtual void apply_sub(Y& f, const X& u) {matrix_type::matmul_minus(f,u);}
 
+#ifdef UG_PARALLEL
+	// 	Apply Operator f = L*u, making an additive u consistent
+		virtual void apply_making_consistent(Y& f, X& u)
+			{matrix_type::apply_making_consistent(f,u);}
+#endif
+
+	//	An additive matrix makes an additive u consistent while applied
+		virtual bool accepts_additive_input() const
+		{
+#ifdef UG_PARALLEL
+			return matrix_type::has_storage_type(PST_ADDITIVE)
+				&& !matrix_type::has_storage_type(PST_CONSISTENT);
+#else
+			return false;
+#endif
+		}
+
 	// 	Access to matrix
 		virtual M& get_matrix() {return *this;};
 };
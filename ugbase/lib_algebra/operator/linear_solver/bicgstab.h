@@ -41,6 +41,7 @@
 #include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
 #include "lib_algebra/operator/interface/linear_solver_profiling.h"
 #include "lib_algebra/operator/interface/pprocess.h"
+#include "fused_reductions.h"
 #ifdef UG_PARALLEL
 	#include "lib_algebra/parallelization/parallelization.h"
 #endif
@@ -61,6 +62,12 @@ namespace ug{
  *
  * - Saad, "Iterative Methods For Sparse Linear Systems", p246, Alg. 7.7
  *
+ * If fused reductions are enabled, the scalar products of an iteration are
+ * computed in three global reductions (instead of six): (v,r0), then
+ * (t,s), (t,t), (s,s) for omega and the defect of the half step, and finally
+ * (r0,r), (r,r) for the next rho and the defect. The iterates and the number
+ * of steps are the same as for the standard variant.
+ *
  * \tparam 	TVector		vector type
  */
 template <typename TVector>
@@ -83,18 +90,18 @@ class BiCGStab
 	public:
 	///	constructors
 		BiCGStab() :
-			m_numRestarts(0), m_minOrtho(0.0)
+			m_numRestarts(0), m_minOrtho(0.0), m_bFusedReductions(false)
 		{};
 
 		BiCGStab(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond)
 			: base_type ( spPrecond ),
-			  m_numRestarts(0), m_minOrtho(0.0)
+			  m_numRestarts(0), m_minOrtho(0.0), m_bFusedReductions(false)
 		{}
 
 		BiCGStab( SmartPtr<ILinearIterator<vector_type> > spPrecond,
 		          SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
 			: base_type(spPrecond, spConvCheck),
-			  m_numRestarts(0), m_minOrtho(0.0)
+			  m_numRestarts(0), m_minOrtho(0.0), m_bFusedReductions(false)
 		{};
 
 	///	name of solver
@@ -122,6 +129,9 @@ class BiCGStab
 			}
 			#endif
 
+			if(m_bFusedReductions)
+				return apply_fused_reductions(x, b);
+
 		// 	build defect:  r := b - A*x
 			linear_operator()->apply_sub(b, x);
 			vector_type& r = b;
@@ -246,9 +256,9 @@ class BiCGStab
 				{
 					q = p;
 
-				// 	make q consistent
+				// 	make q consistent (or let the operator do so while applied)
 					#ifdef UG_PARALLEL
-					if(!q.change_storage_type(PST_CONSISTENT))
+					if(!operator_makes_consistent() && !q.change_storage_type(PST_CONSISTENT))
 						UG_THROW("BiCGStab: Cannot convert q to consistent vector.");
 					#endif
 				}
@@ -257,7 +267,7 @@ class BiCGStab
 				m_corr_post_process.apply (q);
 
 			// 	compute v := A*q
-				linear_operator()->apply(v, q);
+				linear_operator()->apply_making_consistent(v, q);
 
 			// 	make v unique
 				#ifdef UG_PARALLEL
@@ -315,9 +325,9 @@ class BiCGStab
 				{
 					q = s;
 
-				// 	make q consistent
+				// 	make q consistent (or let the operator do so while applied)
 					#ifdef UG_PARALLEL
-					if(!q.change_storage_type(PST_CONSISTENT))
+					if(!operator_makes_consistent() && !q.change_storage_type(PST_CONSISTENT))
 						UG_THROW("BiCGStab: Cannot convert q to consistent vector.");
 					#endif
 				}
@@ -326,7 +336,7 @@ class BiCGStab
 				m_corr_post_process.apply (q);
 
 			// 	compute t := A*q
-				linear_operator()->apply(t, q);
+				linear_operator()->apply_making_consistent(t, q);
 
 			// 	make t unique
 				#ifdef UG_PARALLEL
@@ -388,6 +398,9 @@ class BiCGStab
 
 	///	sets to restart if given orthogonality missed
 		void set_min_orthogonality(number minOrtho) {m_minOrtho = minOrtho;}
+
+	///	sets if the scalar products are computed in three fused reductions per step
+		void set_fused_reductions(bool bFused) {m_bFusedReductions = bFused;}
 		
 	///	adds a post-process for the iterates
 		void add_postprocess_corr (SmartPtr<IPProcessVector<vector_type> > p)
@@ -402,6 +415,231 @@ class BiCGStab
 		}
 
 	protected:
+	///	BiCGStab with three global reductions per iteration
+		bool apply_fused_reductions(vector_type& x, vector_type& b)
+		{
+			LS_PROFILE_BEGIN(LS_ApplyFusedReductions);
+
+		// 	build defect:  r := b - A*x
+			linear_operator()->apply_sub(b, x);
+			vector_type& r = b;
+
+		// 	create vectors
+			SmartPtr<vector_type> spR = r.clone_without_values(); vector_type& r0 = *spR;
+			SmartPtr<vector_type> spP = r.clone_without_values(); vector_type& p = *spP;
+			SmartPtr<vector_type> spV = r.clone_without_values(); vector_type& v = *spV;
+			SmartPtr<vector_type> spT = r.clone_without_values(); vector_type& t = *spT;
+			SmartPtr<vector_type> spS = r.clone_without_values(); vector_type& s = *spS;
+			SmartPtr<vector_type> spQ = x.clone_without_values(); vector_type& q = *spQ;
+
+			prepare_conv_check();
+
+		//	convert r to unique
+			#ifdef UG_PARALLEL
+			if(!r.change_storage_type(PST_UNIQUE))
+				UG_THROW("BiCGStab: Cannot convert b to a vector with the 'unique' parallel storage type.");
+			#endif
+
+		//	start defect
+			FusedDotProducts<vector_type> dots;
+			dots.add(r, r);
+			dots.reduce(r);
+			number rr = dots[0];
+			convergence_check()->start_defect(std::sqrt(std::max(rr, 0.0)));
+
+			write_debugXR(x, r, convergence_check()->step(), 'i');
+
+		//	needed variables
+			number rho = 1, rhoNew = 1, alpha = 1, omega = 1, norm_r0 = 0.0;
+			bool bRestart = true;
+
+		// 	Iteration loop
+			while(!convergence_check()->iteration_ended())
+			{
+			//	check for restart based on fixed step number restart
+				if(m_numRestarts > 0 && convergence_check()->step() > 0 &&
+					(convergence_check()->step() % m_numRestarts == 0))
+				{
+					std::stringstream ss; ss <<
+					"Restarting: at every "<<m_numRestarts<<" Iterations";
+					convergence_check()->print_line(ss.str());
+					bRestart = true;
+				}
+
+			//	check if start values have to be set (rho = (r0,r) = (r,r))
+				const number rhoOld = bRestart ? 1.0 : rho;
+				if(bRestart)
+				{
+					r0 = r;
+					p = 0.0; alpha = 0.0;
+					v = 0.0; omega = 1.0;
+					rhoNew = rr;
+					norm_r0 = std::sqrt(std::max(rr, 0.0));
+					bRestart = false;
+				}
+
+			// 	remember current rho (rhoNew has been computed by recurrence)
+				rho = rhoNew;
+
+			//	check that rhoOld valid
+				if(rhoOld == 0.0)
+				{
+					UG_LOG("BiCGStab: Method breakdown with rhoOld = "<<rhoOld<<
+						   ". Aborting iteration.\n");
+					return false;
+				}
+
+			// 	update p = r + beta * p - beta * omega * v
+				const number beta = (rho/rhoOld) * (alpha/omega);
+				VecScaleAdd(p, 1.0, r, beta, p, -beta*omega, v);
+
+			// 	q = M^-1 * p, v := A*q
+				if(!precondition(q, p, 'a')) return false;
+				linear_operator()->apply_making_consistent(v, q);
+
+				#ifdef UG_PARALLEL
+				if(!v.change_storage_type(PST_UNIQUE))
+					UG_THROW("BiCGStab: Cannot convert v to unique vector.");
+				#endif
+
+			//	alpha = rho/(v,r0)
+				dots.clear();
+				dots.add(v, r0);
+				dots.reduce(v);
+				alpha = dots[0];
+				if(alpha == 0.0){
+					if(v.size()){
+						UG_LOG("BiCGStab: Method breakdown: alpha = "<<alpha<<
+						       " is an invalid value. Aborting iteration.\n");
+						return false;
+					}
+					alpha = 1.0;
+				}
+				alpha = rho/alpha;
+
+			// 	x := x + alpha * q, s = r - alpha*v
+				VecScaleAdd(x, 1.0, x, alpha, q);
+				VecScaleAdd(s, 1.0, r, -alpha, v);
+
+			// 	q = M^-1 * s, t := A*q
+				if(!precondition(q, s, 'b')) return false;
+				linear_operator()->apply_making_consistent(t, q);
+
+				#ifdef UG_PARALLEL
+				if(!t.change_storage_type(PST_UNIQUE))
+					UG_THROW("BiCGStab: Cannot convert t to unique vector.");
+				#endif
+
+			//	scalar products of the second half step in one reduction
+				dots.clear();
+				const size_t iTS = dots.add(t, s);
+				const size_t iTT = dots.add(t, t);
+				const size_t iSS = dots.add(s, s);
+				dots.reduce(t);
+
+				const number ts = dots[iTS], tt = dots[iTT], ss = dots[iSS];
+
+			// 	check convergence of the half step (as in the standard variant)
+				convergence_check()->update_defect(std::sqrt(std::max(ss, 0.0)));
+
+				write_debugXR(x, s, convergence_check()->step(), 'a');
+
+			//	if finished: set output to last defect and exist loop
+				if(convergence_check()->iteration_ended())
+				{
+					r = s; break;
+				}
+
+			//	check tt
+				if(tt == 0.0)
+				{
+					UG_LOG("BiCGStab: Method breakdown tt = "<<tt<<" is an "
+							"invalid value. Aborting iteration.\n");
+					return false;
+				}
+
+			// 	omega = (s,t)/(t,t), x := x + omega * q, r = s - omega*t
+				omega = ts/tt;
+				VecScaleAdd(x, 1.0, x, omega, q);
+				VecScaleAdd(r, 1.0, s, -omega, t);
+
+			//	rho of next step (r0,r) and defect (r,r) in one reduction
+			//	note: the recurrence (r0,r) = (r0,s) - omega (r0,t) would save
+			//	this reduction, but its round-off is amplified by BiCGStab and
+			//	leads to different iterates than the standard variant
+				dots.clear();
+				const size_t iR0R = dots.add(r0, r);
+				const size_t iRR = dots.add(r, r);
+				dots.reduce(r);
+				rhoNew = dots[iR0R];
+				rr = dots[iRR];
+
+			// 	check convergence
+				convergence_check()->update_defect(std::sqrt(std::max(rr, 0.0)));
+
+				write_debugXR(x, r, convergence_check()->step(), 'b');
+
+			//	check values
+				if(omega == 0.0)
+				{
+					UG_LOG("BiCGStab: Method breakdown with omega = "<<omega<<
+					       ". Aborting iteration.\n");
+					return false;
+				}
+
+			//	check for restart compare (r, r0) > m_minOrtho * ||r|| ||r0||
+				const number norm_r = convergence_check()->defect();
+				if(fabs(rhoNew)/(norm_r * norm_r0) <= m_minOrtho)
+				{
+					std::stringstream ss; ss <<
+					"Restarting: Min Orthogonality "<<m_minOrtho<<" missed: "
+					<<"(r,r0)="<<fabs(rhoNew)<<", ||r||="<<norm_r<<", ||r0||= "
+					<<norm_r0;
+					convergence_check()->print_line(ss.str());
+					bRestart = true;
+				}
+			}
+
+		//	print ending output
+			return convergence_check()->post();
+		}
+
+	///	applies the preconditioner (or copies) and post-processes the correction
+		bool precondition(vector_type& q, vector_type& d, char phase)
+		{
+			if(preconditioner().valid())
+			{
+				enter_precond_debug_section(convergence_check()->step(), phase);
+				if(!preconditioner()->apply(q, d))
+				{
+					UG_LOG("BiCGStab: Cannot apply preconditioner. Aborting.\n");
+					this->leave_vector_debug_writer_section();
+					return false;
+				}
+				this->leave_vector_debug_writer_section();
+			}
+			else
+			{
+				q = d;
+				#ifdef UG_PARALLEL
+				if(!operator_makes_consistent() && !q.change_storage_type(PST_CONSISTENT))
+					UG_THROW("BiCGStab: Cannot convert q to consistent vector.");
+				#endif
+			}
+
+			m_corr_post_process.apply (q);
+			return true;
+		}
+
+	///	returns if an unpreconditioned q may be passed to A without making it consistent
+	/**	q is then made consistent by the operator, overlapping the
+	 * 	communication with the computation of the rows away from the interface.*/
+		bool operator_makes_consistent()
+		{
+			return m_corr_post_process.size() == 0
+				&& linear_operator()->accepts_additive_input();
+		}
+
 	///	prepares the output of the convergence check
 		void prepare_conv_check()
 		{
@@ -439,7 +677,9 @@ class BiCGStab
 		virtual std::string config_string() const
 		{
 			std::stringstream ss;
-			ss << "BiCGStab( restart = " << m_numRestarts << ", min_orthogonality = " << m_minOrtho << ")\n";
+			ss << "BiCGStab( restart = " << m_numRestarts << ", min_orthogonality = " << m_minOrtho;
+			if(m_bFusedReductions) ss << ", fused reductions";
+			ss << ")\n";
 			ss << base_type::config_string_preconditioner_convergence_check();
 			return ss.str();
 		}
@@ -450,6 +690,9 @@ class BiCGStab
 	///	minimal value in (0,1) accepted for Orthoginality before restart
 		number m_minOrtho;
 
+	///	flag if scalar products are computed in fused reductions
+		bool m_bFusedReductions;
+
 	///	postprocessor for the correction in the iterations
 		/**
 		 * These postprocess operations are applied to the preconditioned
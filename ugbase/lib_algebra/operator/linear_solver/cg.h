@@ -35,11 +35,14 @@
 
 #include <iostream>
 #include <string>
+#include <sstream>
+#include <algorithm>
 
 #include "lib_algebra/operator/interface/operator.h"
 #include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
 #include "common/profiler/profiler.h"
 #include "lib_algebra/operator/interface/pprocess.h"
+#include "fused_reductions.h"
 #ifdef UG_PARALLEL
 	#include "lib_algebra/parallelization/parallelization.h"
 #endif
@@ -59,6 +62,13 @@ namespace ug{
  *
  * - Saad, "Iterative Methods For Sparse Linear Systems", p277, Alg. 9.1
  *
+ * If single reduction is enabled, the variant of Chronopoulos and Gear is
+ * used, where the scalar products (r,z), (Az,z) and the defect norm of one
+ * iteration are computed in a single global reduction:
+ *
+ * - Chronopoulos, Gear, "s-step iterative methods for symmetric linear
+ *   systems", J. Comput. Appl. Math. 25 (1989)
+ *
  * \tparam 	TVector		vector type
  */
 template <typename TVector>
@@ -80,13 +90,13 @@ class CG
 
 	public:
 	///	constructors
-		CG() : base_type() {}
+		CG() : base_type(), m_bSingleReduction(false) {}
 
 		CG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond)
-			: base_type ( spPrecond )  {}
+			: base_type ( spPrecond ), m_bSingleReduction(false)  {}
 
 		CG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond, SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
-			: base_type ( spPrecond, spConvCheck)  {}
+			: base_type ( spPrecond, spConvCheck), m_bSingleReduction(false)  {}
 
 	///	name of solver
 		virtual const char* name() const {return "CG";}
@@ -110,6 +120,9 @@ class CG
 								"Inadequate storage format of Vectors.");
 			#endif
 
+			if(m_bSingleReduction)
+				return apply_single_reduction(x, b);
+
 		// 	rename r as b (for convenience)
 			vector_type& r = b;
 
@@ -241,6 +254,18 @@ class CG
 			return convergence_check()->post();
 		}
 		
+	///	sets if the single reduction variant (Chronopoulos/Gear) is used
+		void set_single_reduction(bool bSingleReduction) {m_bSingleReduction = bSingleReduction;}
+
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << "CG";
+			if(m_bSingleReduction) ss << " (single reduction)";
+			ss << "\n" << base_type::config_string_preconditioner_convergence_check();
+			return ss.str();
+		}
+
 	///	adds a post-process for the iterates
 		void add_postprocess_corr (SmartPtr<IPProcessVector<vector_type> > p)
 		{
@@ -254,6 +279,138 @@ class CG
 		}
 
 	protected:
+	///	CG with one global reduction per iteration (Chronopoulos/Gear)
+	/**
+	 * In addition to the vectors of the standard method, s = A*p is updated
+	 * by the recurrence s := w + beta * s, where w = A*z. Thus,
+	 * (q,p) = (s,p) can be computed from rho = (r,z) and delta = (w,z) as
+	 * (s,p) = delta - beta * rho / alpha and all scalar products of
+	 * an iteration are summed up together.
+	 */
+		bool apply_single_reduction(vector_type& x, vector_type& b)
+		{
+			PROFILE_BEGIN_GROUP(CG_apply_single_reduction, "CG algebra");
+
+		// 	rename r as b (for convenience)
+			vector_type& r = b;
+
+		// 	Build defect:  r := b - J(u)*x
+			linear_operator()->apply_sub(r, x);
+
+		// 	create help vectors
+			SmartPtr<vector_type> spZ = x.clone_without_values(); vector_type& z = *spZ;
+			SmartPtr<vector_type> spP = x.clone_without_values(); vector_type& p = *spP;
+			SmartPtr<vector_type> spW = r.clone_without_values(); vector_type& w = *spW;
+			SmartPtr<vector_type> spS = r.clone_without_values(); vector_type& s = *spS;
+
+			write_debugXR(x, r, convergence_check()->step());
+			prepare_conv_check();
+
+			FusedDotProducts<vector_type> dots;
+			number rho = 0.0, rhoOld = 0.0, alpha = 0.0;
+			bool bFirst = true;
+
+			for(;;)
+			{
+			// 	Preconditioning z = M^-1 * r
+				if(!precondition(z, r)) return false;
+
+			// 	w = A*z (additive)
+				linear_operator()->apply(w, z);
+
+			// 	make r unique for the norm
+				#ifdef UG_PARALLEL
+				if(!r.change_storage_type(PST_UNIQUE))
+					UG_THROW("CG::apply_single_reduction: "
+									"Cannot convert r to unique vector.");
+				#endif
+
+			//	rho = (r,z), delta = (w,z), ||r||^2 in one reduction
+				dots.clear();
+				const size_t iRho = dots.add(r, z);
+				const size_t iDelta = dots.add(w, z);
+				const size_t iNorm = dots.add(r, r);
+				dots.reduce(r);
+
+				const number defect = std::sqrt(std::max(dots[iNorm], 0.0));
+				if(bFirst) convergence_check()->start_defect(defect);
+				else convergence_check()->update_defect(defect);
+
+				write_debugXR(x, r, convergence_check()->step());
+				if(convergence_check()->iteration_ended()) break;
+
+				rho = dots[iRho];
+				const number delta = dots[iDelta];
+
+			// 	beta and (s,p) = delta - beta * rho / alpha
+				number beta = 0.0, lambda = delta;
+				if(!bFirst){
+					beta = rho / rhoOld;
+					lambda = delta - beta * rho / alpha;
+				}
+
+			//	check lambda
+				if(lambda == 0.0)
+				{
+				    if (p.size())
+				    {
+				        UG_LOG("ERROR in 'CG::apply_single_reduction': lambda=" <<
+				            lambda<< " is not admitted. Aborting solver.\n");
+				        return false;
+				    }
+				    else
+				        lambda = 1.0;
+				}
+
+				alpha = rho / lambda;
+
+			// 	new directions p := z + beta * p, s := w + beta * s
+				if(bFirst){p = z; s = w;}
+				else{
+					VecScaleAdd(p, beta, p, 1.0, z);
+					VecScaleAdd(s, beta, s, 1.0, w);
+				}
+
+			// 	Update x := x + alpha*p, r := r - alpha*s
+				VecScaleAdd(x, 1.0, x, alpha, p);
+				VecScaleAdd(r, 1.0, r, -alpha, s);
+
+				rhoOld = rho;
+				bFirst = false;
+			}
+
+		//	post output
+			return convergence_check()->post();
+		}
+
+	///	applies the preconditioner (if present) and makes the result consistent
+		bool precondition(vector_type& z, vector_type& r)
+		{
+			if(preconditioner().valid())
+			{
+				enter_precond_debug_section(convergence_check()->step());
+				if(!preconditioner()->apply(z, r))
+				{
+					UG_LOG("ERROR in 'CG::apply_return_defect': "
+							"Cannot apply preconditioner. Aborting.\n");
+					this->leave_vector_debug_writer_section();
+					return false;
+				}
+				this->leave_vector_debug_writer_section();
+			}
+			else z = r;
+
+			#ifdef UG_PARALLEL
+			if(!z.change_storage_type(PST_CONSISTENT))
+				UG_THROW("CG::apply_return_defect: "
+								"Cannot convert z to consistent vector.");
+			#endif
+
+		//	post-process the correction
+			m_corr_post_process.apply (z);
+			return true;
+		}
+
 	///	adjust output of convergence check
 		void prepare_conv_check()
 		{
@@ -301,6 +458,9 @@ class CG
 		 * useless kernel parts to prevail in the (floating point) arithmetics.
 		 */
 		PProcessChain<vector_type> m_corr_post_process;
+
+	///	flag if single reduction variant is used
+		bool m_bSingleReduction;
 };
 
 } // end namespace ug
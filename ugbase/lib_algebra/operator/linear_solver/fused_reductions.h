@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__FUSED_REDUCTIONS__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__FUSED_REDUCTIONS__
+
+#include <vector>
+#include <cmath>
+
+#include "common/common.h"
+#include "common/profiler/profiler.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+	#include "pcl/pcl_process_communicator.h"
+#endif
+
+namespace ug{
+
+///	process-local part of a dot product
+template <typename TVector>
+inline number LocalVecProd(const TVector& a, const TVector& b)
+{
+	return VecProd(a, b);
+}
+
+#ifdef UG_PARALLEL
+template <typename T>
+inline number LocalVecProd(const ParallelVector<T>& a, const ParallelVector<T>& b)
+{
+//	the local parts only sum up to the global value for these combinations
+	if(!(a.has_storage_type(PST_ADDITIVE) && b.has_storage_type(PST_CONSISTENT))
+		&& !(a.has_storage_type(PST_CONSISTENT) && b.has_storage_type(PST_ADDITIVE))
+		&& !(a.has_storage_type(PST_UNIQUE) && b.has_storage_type(PST_UNIQUE)))
+		UG_THROW("LocalVecProd: Storage types "<<a.get_storage_mask()<<" and "
+				 <<b.get_storage_mask()<<" do not allow a local dot product.");
+
+	return VecProd((const T&)a, (const T&)b);
+}
+#endif
+
+///	several dot products that are summed up in one global reduction
+/**
+ * Krylov methods in parallel are dominated by the global synchronization of
+ * the scalar products. This class collects the process-local contributions
+ * of several dot products and sums them in a single (non-blocking, if
+ * supported by MPI) allreduce. Between start() and finish() further local
+ * work, e.g. a matrix-vector product or a preconditioner application, can be
+ * performed while the reduction is in progress.
+ *
+ * Usage:
+ * \code
+ * 	FusedDotProducts<vector_type> dots;
+ * 	const size_t iRU = dots.add(r, u);
+ * 	const size_t iRR = dots.add(r, r);
+ * 	dots.start(r);
+ * 	... // local work
+ * 	dots.finish();
+ * 	number ru = dots[iRU];
+ * \endcode
+ *
+ * In parallel the storage types of each pair must be additive/consistent
+ * or unique/unique, such that no communication is needed for the local part.
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class FusedDotProducts
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	public:
+		FusedDotProducts() : m_bActive(false)
+		#ifdef UG_PARALLEL
+			, m_request(MPI_REQUEST_NULL)
+		#endif
+		{}
+
+		~FusedDotProducts()
+		{
+			if(m_bActive) finish();
+		}
+
+	///	removes all dot products
+		void clear()
+		{
+			if(m_bActive) finish();
+			m_vLocal.clear();
+			m_vGlobal.clear();
+		}
+
+	///	adds the local part of (a,b) and returns the index of the dot product
+		size_t add(const vector_type& a, const vector_type& b)
+		{
+			UG_ASSERT(!m_bActive, "Reduction already started.");
+			m_vLocal.push_back(LocalVecProd(a, b));
+			return m_vLocal.size() - 1;
+		}
+
+	///	adds a value (computed locally on each process) to be summed up
+		size_t add_local_value(number val)
+		{
+			UG_ASSERT(!m_bActive, "Reduction already started.");
+			m_vLocal.push_back(val);
+			return m_vLocal.size() - 1;
+		}
+
+	///	number of dot products
+		size_t size() const {return m_vLocal.size();}
+
+	///	starts the global summation of all local contributions
+	/**	The vector v is only used to determine the process communicator.*/
+		void start(const vector_type& v)
+		{
+			PROFILE_BEGIN_GROUP(FusedDotProducts_start, "algebra");
+			UG_ASSERT(!m_bActive, "Reduction already started.");
+			m_vGlobal.resize(m_vLocal.size());
+			if(m_vLocal.empty()) return;
+
+			#ifdef UG_PARALLEL
+			const pcl::ProcessCommunicator& pc = v.layouts()->proc_comm();
+			if(!pc.empty()){
+				pc.iallreduce(&m_vLocal[0], &m_vGlobal[0], m_vLocal.size(),
+							  PCL_RO_SUM, m_request);
+				m_bActive = true;
+				return;
+			}
+			#endif
+
+			m_vGlobal = m_vLocal;
+		}
+
+	///	waits for the global summation to complete
+		void finish()
+		{
+			if(!m_bActive) return;
+			PROFILE_BEGIN_GROUP(FusedDotProducts_finish, "algebra");
+			#ifdef UG_PARALLEL
+			if(m_request != MPI_REQUEST_NULL)
+				pcl::MPI_Wait(&m_request);
+			#endif
+			m_bActive = false;
+		}
+
+	///	starts and completes the summation
+		void reduce(const vector_type& v) {start(v); finish();}
+
+	///	returns the global value of the i'th dot product (after finish)
+		number operator[](size_t i) const
+		{
+			UG_ASSERT(!m_bActive, "Reduction not yet finished.");
+			UG_ASSERT(i < m_vGlobal.size(), "Index "<<i<<" out of range.");
+			return m_vGlobal[i];
+		}
+
+	protected:
+	///	local and global values
+		std::vector<number> m_vLocal, m_vGlobal;
+
+	///	flag if a reduction is in progress
+		bool m_bActive;
+
+		#ifdef UG_PARALLEL
+	///	request of the non-blocking reduction
+		MPI_Request m_request;
+		#endif
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__FUSED_REDUCTIONS__ */
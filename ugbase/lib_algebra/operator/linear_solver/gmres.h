@@ -35,10 +35,12 @@
 
 #include <iostream>
 #include <string>
+#include <algorithm>
 
 #include "lib_algebra/operator/interface/operator.h"
 #include "common/profiler/profiler.h"
 #include "lib_algebra/operator/interface/pprocess.h"
+#include "fused_reductions.h"
 #ifdef UG_PARALLEL
 	#include "lib_algebra/parallelization/parallelization.h"
 #endif
@@ -58,6 +60,12 @@ namespace ug{
  *
  * - Saad, "Iterative Methods For Sparse Linear Systems"
  *
+ * By default, the Arnoldi basis is orthogonalized by modified Gram-Schmidt,
+ * requiring j+2 global reductions in the j'th step. Optionally, classical
+ * Gram-Schmidt with one reorthogonalization (CGS2) is used, where all
+ * scalar products of a pass are fused in one reduction and the norm is
+ * obtained from the second pass, i.e. two reductions per step.
+ *
  * \tparam 	TVector		vector type
  */
 template <typename TVector>
@@ -79,13 +87,14 @@ class GMRES
 
 	public:
 	///	default constructor
-		GMRES(size_t restart) : m_restart(restart) {};
+		GMRES(size_t restart) : m_restart(restart), m_bClassicalGS(false) {};
 
 	///	constructor setting the preconditioner and the convergence check
 		GMRES( size_t restart,
 		       SmartPtr<ILinearIterator<vector_type> > spPrecond,
 		       SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
-			: base_type(spPrecond, spConvCheck), m_restart(restart)
+			: base_type(spPrecond, spConvCheck), m_restart(restart),
+			  m_bClassicalGS(false)
 		{};
 
 	///	name of solver
@@ -174,12 +183,14 @@ class GMRES
 					if(v[j+1].invalid()) v[j+1] = x.clone_without_values();
 
 #ifdef UG_PARALLEL
-					if(!v[j]->change_storage_type(PST_CONSISTENT))
+				//	an additive matrix makes v[j] consistent itself while applied
+					if(!linear_operator()->accepts_additive_input()
+						&& !v[j]->change_storage_type(PST_CONSISTENT))
 						UG_THROW("GMRES: Cannot convert v["<<j+1<<"] to consistent vector.");
 #endif
 
 				//	compute r = A*v[j]
-					linear_operator()->apply(*spR, *v[j]);
+					linear_operator()->apply_making_consistent(*spR, *v[j]);
 
 				// 	apply v[j+1] = M^-1 * A * v[j]
 					if(preconditioner().valid()){
@@ -204,19 +215,25 @@ class GMRES
 				//	post-process the correction
 					m_corr_post_process.apply (*v[j+1]);
 
-				//	loop previous steps
-					for(size_t i = 0; i <= j; ++i)
+				//	orthogonalize v[j+1] against v[0],...,v[j] and compute h_{i,j}
+					if(m_bClassicalGS)
+						orthogonalize_cgs2(v, h, j);
+					else
 					{
-					//	h_ij := (r, v[j])
-						h[i][j] = VecProd(*v[j+1], *v[i]);
+					//	loop previous steps
+						for(size_t i = 0; i <= j; ++i)
+						{
+						//	h_ij := (r, v[j])
+							h[i][j] = VecProd(*v[j+1], *v[i]);
+
+						//	v[j+1] -= h_ij * v[i]
+							VecScaleAppend(*v[j+1], *v[i], (-1)*h[i][j]);
+						}
 
-					//	v[j+1] -= h_ij * v[i]
-						VecScaleAppend(*v[j+1], *v[i], (-1)*h[i][j]);
+					//	compute h_{j+1,j}
+						h[j+1][j] = v[j+1]->norm();
 					}
 
-				//	compute h_{j+1,j}
-					h[j+1][j] = v[j+1]->norm();
-
 				//	update h
 					for(size_t i = 0; i < j; ++i)
 					{
@@ -283,11 +300,16 @@ class GMRES
 		virtual std::string config_string() const
 		{
 			std::stringstream ss;
-			ss << "GMRes ( restart = " << m_restart << ")\n";
+			ss << "GMRes ( restart = " << m_restart;
+			if(m_bClassicalGS) ss << ", classical Gram-Schmidt";
+			ss << ")\n";
 			ss << base_type::config_string_preconditioner_convergence_check();
 			return ss.str();
 		}
 		
+	///	sets if classical Gram-Schmidt with reorthogonalization is used
+		void set_classical_gram_schmidt(bool bCGS) {m_bClassicalGS = bCGS;}
+
 	///	adds a post-process for the iterates
 		void add_postprocess_corr (SmartPtr<IPProcessVector<vector_type> > p)
 		{
@@ -317,10 +339,55 @@ class GMRES
 			convergence_check()->set_info(s);
 		}
 
+	///	classical Gram-Schmidt with reorthogonalization
+	/**
+	 * Both passes compute the scalar products with all previous basis
+	 * vectors in one fused reduction. The squared norm of v[j+1] is
+	 * reduced in the second pass as well, the norm after the second
+	 * correction c follows from ||v - sum c_i v_i||^2 = ||v||^2 - sum c_i^2.
+	 */
+		void orthogonalize_cgs2(std::vector<SmartPtr<vector_type> >& v,
+		                        std::vector<std::vector<number> >& h, size_t j)
+		{
+			vector_type& w = *v[j+1];
+			FusedDotProducts<vector_type> dots;
+
+		//	first pass
+			for(size_t i = 0; i <= j; ++i)
+				dots.add(w, *v[i]);
+			dots.reduce(w);
+
+			for(size_t i = 0; i <= j; ++i){
+				h[i][j] = dots[i];
+				VecScaleAppend(w, *v[i], (-1)*h[i][j]);
+			}
+
+		//	second pass
+			dots.clear();
+			for(size_t i = 0; i <= j; ++i)
+				dots.add(w, *v[i]);
+			const size_t iNorm = dots.add(w, w);
+			dots.reduce(w);
+
+			number corr2 = 0.0;
+			for(size_t i = 0; i <= j; ++i){
+				const number c = dots[i];
+				h[i][j] += c;
+				VecScaleAppend(w, *v[i], (-1)*c);
+				corr2 += c*c;
+			}
+
+		//	compute h_{j+1,j}
+			h[j+1][j] = sqrt(std::max(dots[iNorm] - corr2, 0.0));
+		}
+
 	protected:
 	///	restart parameter
 		size_t m_restart;
 
+	///	flag if classical Gram-Schmidt with reorthogonalization is used
+		bool m_bClassicalGS;
+
 	///	postprocessor for the correction in the iterations
 		/**
 		 * These postprocess operations are applied to the preconditioned
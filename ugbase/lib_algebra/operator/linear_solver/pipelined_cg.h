@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__
+#define __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__
+
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <algorithm>
+
+#include "lib_algebra/operator/interface/operator.h"
+#include "lib_algebra/operator/interface/preconditioned_linear_operator_inverse.h"
+#include "common/profiler/profiler.h"
+#include "fused_reductions.h"
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+#endif
+
+namespace ug{
+
+///	the pipelined CG method as a solver for linear operators
+/**
+ * This class implements the pipelined preconditioned CG - method of
+ * Ghysels and Vanroose. The three scalar products of an iteration,
+ * (r,u), (w,u) and the defect norm, are summed up in one non-blocking
+ * global reduction, that is overlapped with the application of the
+ * preconditioner m = M^-1 * w and the matrix-vector product n = A*m.
+ *
+ * The method needs four additional vectors compared to the standard CG
+ * and the recursively updated residual may deviate from the true
+ * residual for very small tolerances. Therefore, the residual can be
+ * recomputed every few iterations (set_replace_residual).
+ *
+ * For detailed description of the algorithm, please refer to:
+ *
+ * - Ghysels, Vanroose, "Hiding global synchronization latency in the
+ *   preconditioned Conjugate Gradient algorithm", Parallel Computing 40 (2014)
+ *
+ * \tparam 	TVector		vector type
+ */
+template <typename TVector>
+class PipelinedCG
+	: public IPreconditionedLinearOperatorInverse<TVector>
+{
+	public:
+	///	Vector type
+		typedef TVector vector_type;
+
+	///	Base type
+		typedef IPreconditionedLinearOperatorInverse<vector_type> base_type;
+
+	protected:
+		using base_type::convergence_check;
+		using base_type::linear_operator;
+		using base_type::preconditioner;
+		using base_type::write_debug;
+
+	public:
+	///	constructors
+		PipelinedCG() : base_type(), m_replaceFreq(0) {}
+
+		PipelinedCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond)
+			: base_type ( spPrecond ), m_replaceFreq(0)  {}
+
+		PipelinedCG(SmartPtr<ILinearIterator<vector_type,vector_type> > spPrecond, SmartPtr<IConvergenceCheck<vector_type> > spConvCheck)
+			: base_type ( spPrecond, spConvCheck), m_replaceFreq(0)  {}
+
+	///	name of solver
+		virtual const char* name() const {return "PipelinedCG";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const
+		{
+			if(preconditioner().valid())
+				return preconditioner()->supports_parallel();
+			return true;
+		}
+
+	///	sets the number of iterations after which the residual is recomputed (0 = never)
+		void set_replace_residual(size_t freq) {m_replaceFreq = freq;}
+
+	///	Solve J(u)*x = b, such that x = J(u)^{-1} b
+		virtual bool apply_return_defect(vector_type& x, vector_type& b)
+		{
+			PROFILE_BEGIN_GROUP(PipelinedCG_apply_return_defect, "CG algebra");
+		//	check parallel storage types
+			#ifdef UG_PARALLEL
+			if(!b.has_storage_type(PST_ADDITIVE) || !x.has_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedCG::apply_return_defect:"
+								"Inadequate storage format of Vectors.");
+			#endif
+
+		//	keep rhs for residual replacement
+			SmartPtr<vector_type> spB;
+			if(m_replaceFreq > 0) spB = b.clone();
+
+		// 	rename r as b (for convenience)
+			vector_type& r = b;
+
+		// 	Build defect:  r := b - J(u)*x
+			linear_operator()->apply_sub(r, x);
+
+		// 	create help vectors
+		//	consistent: u = M^-1 r, m = M^-1 w, p, q
+		//	additive:	w = A u, n = A m, s, z
+			SmartPtr<vector_type> spU = x.clone_without_values(); vector_type& u = *spU;
+			SmartPtr<vector_type> spM = x.clone_without_values(); vector_type& m = *spM;
+			SmartPtr<vector_type> spP = x.clone_without_values(); vector_type& p = *spP;
+			SmartPtr<vector_type> spQ = x.clone_without_values(); vector_type& q = *spQ;
+			SmartPtr<vector_type> spW = r.clone_without_values(); vector_type& w = *spW;
+			SmartPtr<vector_type> spN = r.clone_without_values(); vector_type& n = *spN;
+			SmartPtr<vector_type> spS = r.clone_without_values(); vector_type& s = *spS;
+			SmartPtr<vector_type> spZ = r.clone_without_values(); vector_type& z = *spZ;
+
+			prepare_conv_check();
+
+		// 	u = M^-1 r, w = A u
+			if(!precondition(u, r)) return false;
+			linear_operator()->apply_making_consistent(w, u);
+
+			FusedDotProducts<vector_type> dots;
+			number gamma = 0.0, gammaOld = 0.0, alpha = 0.0;
+
+			for(size_t iter = 0; ; ++iter)
+			{
+			//	residual replacement: recompute r = b - A x, u = M^-1 r,
+			//	w = A u and s = A p, q = M^-1 s, z = A q
+				if(iter > 0 && m_replaceFreq > 0 && iter % m_replaceFreq == 0)
+				{
+					r = *spB;
+					linear_operator()->apply_sub(r, x);
+					if(!precondition(u, r)) return false;
+					linear_operator()->apply_making_consistent(w, u);
+					linear_operator()->apply_making_consistent(s, p);
+					if(!precondition(q, s)) return false;
+					linear_operator()->apply_making_consistent(z, q);
+				}
+
+			// 	make r unique for the norm
+				#ifdef UG_PARALLEL
+				if(!r.change_storage_type(PST_UNIQUE))
+					UG_THROW("PipelinedCG::apply_return_defect: "
+									"Cannot convert r to unique vector.");
+				#endif
+
+			//	start reduction of gamma = (r,u), delta = (w,u), ||r||^2
+				dots.clear();
+				const size_t iGamma = dots.add(r, u);
+				const size_t iDelta = dots.add(w, u);
+				const size_t iNorm = dots.add(r, r);
+				dots.start(r);
+
+			//	overlap: m = M^-1 w, n = A m
+				if(!precondition(m, w)) return false;
+				linear_operator()->apply_making_consistent(n, m);
+
+				dots.finish();
+
+				const number defect = std::sqrt(std::max(dots[iNorm], 0.0));
+				if(iter == 0) convergence_check()->start_defect(defect);
+				else convergence_check()->update_defect(defect);
+
+				write_debugXR(x, r, convergence_check()->step());
+				if(convergence_check()->iteration_ended()) break;
+
+				gamma = dots[iGamma];
+				const number delta = dots[iDelta];
+
+				number beta = 0.0, lambda = delta;
+				if(iter > 0){
+					beta = gamma / gammaOld;
+					lambda = delta - beta * gamma / alpha;
+				}
+
+			//	check lambda
+				if(lambda == 0.0)
+				{
+				    if (p.size())
+				    {
+				        UG_LOG("ERROR in 'PipelinedCG::apply_return_defect': lambda=" <<
+				            lambda<< " is not admitted. Aborting solver.\n");
+				        return false;
+				    }
+				    else
+				        lambda = 1.0;
+				}
+
+				alpha = gamma / lambda;
+
+			//	update recurrences
+				if(iter == 0){z = n; q = m; s = w; p = u;}
+				else{
+					VecScaleAdd(z, beta, z, 1.0, n);
+					VecScaleAdd(q, beta, q, 1.0, m);
+					VecScaleAdd(s, beta, s, 1.0, w);
+					VecScaleAdd(p, beta, p, 1.0, u);
+				}
+
+				VecScaleAdd(x, 1.0, x, alpha, p);
+				VecScaleAdd(r, 1.0, r, -alpha, s);
+				VecScaleAdd(u, 1.0, u, -alpha, q);
+				VecScaleAdd(w, 1.0, w, -alpha, z);
+
+				gammaOld = gamma;
+			}
+
+		//	post output
+			return convergence_check()->post();
+		}
+
+		virtual std::string config_string() const
+		{
+			std::stringstream ss;
+			ss << "PipelinedCG ( replace residual = " << m_replaceFreq << ")\n";
+			ss << base_type::config_string_preconditioner_convergence_check();
+			return ss.str();
+		}
+
+	protected:
+	///	applies the preconditioner (if present), the result is consistent after the next apply of A
+		bool precondition(vector_type& c, vector_type& d)
+		{
+			if(preconditioner().valid())
+			{
+				enter_precond_debug_section(convergence_check()->step());
+				if(!preconditioner()->apply(c, d))
+				{
+					UG_LOG("ERROR in 'PipelinedCG::apply_return_defect': "
+							"Cannot apply preconditioner. Aborting.\n");
+					this->leave_vector_debug_writer_section();
+					return false;
+				}
+				this->leave_vector_debug_writer_section();
+			}
+			else c = d;
+
+		//	c is always applied next, an additive matrix makes it consistent
+		//	while doing so
+			#ifdef UG_PARALLEL
+			if(!linear_operator()->accepts_additive_input()
+				&& !c.change_storage_type(PST_CONSISTENT))
+				UG_THROW("PipelinedCG::apply_return_defect: "
+								"Cannot convert vector to consistent vector.");
+			#endif
+			return true;
+		}
+
+	///	adjust output of convergence check
+		void prepare_conv_check()
+		{
+		//	set iteration symbol and name
+			convergence_check()->set_name(name());
+			convergence_check()->set_symbol('%');
+
+		//	set preconditioner string
+			std::string s;
+			if(preconditioner().valid())
+			  s = std::string(" (Precond: ") + preconditioner()->name() + ")";
+			else
+				s = " (No Preconditioner) ";
+			convergence_check()->set_info(s);
+		}
+
+	/// debugger output: solution and residual
+		void write_debugXR(vector_type &x, vector_type &r, int loopCnt)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; snprintf(ext, 20, "_iter%03d", loopCnt);
+			write_debug(r, std::string("PipelinedCG_Residual") + ext + ".vec");
+			write_debug(x, std::string("PipelinedCG_Solution") + ext + ".vec");
+		}
+
+	/// debugger section for the preconditioner
+		void enter_precond_debug_section(int loopCnt)
+		{
+			if(!this->vector_debug_writer_valid()) return;
+			char ext[20]; snprintf(ext, 20, "_iter%03d", loopCnt);
+			this->enter_vector_debug_writer_section(std::string("PipelinedCG_Precond_") + ext);
+		}
+
+	protected:
+	///	frequency of residual replacement
+		size_t m_replaceFreq;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_ALGEBRA__OPERATOR__LINEAR_SOLVER__PIPELINED_CG__ */
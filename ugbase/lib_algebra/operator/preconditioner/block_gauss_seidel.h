@@ -624,7 +624,7 @@ class BlockGaussSeidelIterative : public IBlockJacobiPreconditioner<TAlgebra>
 			for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
 				s -= it.value() * x[it.index()];
 			smallvec_type c;
-			InverseMatMult(c, 1.0, A(i,i), s);
+			InverseMatMult(c, 1.0, A.diag(i), s);
 			x[i] += c;
 
 		}
@@ -649,6 +649,7 @@ class BlockGaussSeidelIterative : public IBlockJacobiPreconditioner<TAlgebra>
 		virtual bool block_step(matrix_type &A, vector_type& c, const vector_type& d)
 		{
 			PROFILE_BEGIN(BlockGaussSeidelIterative_step);
+			A.update_diag_index();
 			vector_type &x = c;
 			x.set(0.0);
 			vector_type b;
@@ -36,6 +36,7 @@
 #include "lib_algebra/operator/interface/preconditioner.h"
 #include "lib_algebra/algebra_common/core_smoothers.h"
 #include "lib_algebra/algebra_common/sparsematrix_util.h"
+#include "lib_algebra/cpu_algebra/single_precision_matrix.h"
 #ifdef UG_PARALLEL
 	#include "lib_algebra/parallelization/parallelization.h"
 	#include "lib_algebra/parallelization/matrix_overlap.h"
@@ -70,6 +71,12 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 		typedef std::vector<size_t> ordering_container_type;
 		typedef IOrderingAlgorithm<TAlgebra, ordering_container_type> ordering_algo_type;
 
+	///	type of the pre-inverted diagonal
+		typedef typename InvDiagArray<matrix_type>::type inv_diag_type;
+
+	///	type of the single precision copy of the matrix
+		typedef SinglePrecisionMatrix<matrix_type> single_matrix_type;
+
 	protected:
 		using base_type::set_debug;
 		using base_type::debug_writer;
@@ -80,14 +87,22 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 		GaussSeidelBase() :
 			m_relax(1.0),
 			m_bConsistentInterfaces(false),
-			m_useOverlap(false) {};
+			m_useOverlap(false),
+			m_bLevelScheduling(false),
+			m_bSinglePrecision(false),
+			m_pPreparedA(NULL),
+			m_preparedRevision(0) {};
 
 	/// clone constructor
 		GaussSeidelBase( const GaussSeidelBase<TAlgebra> &parent )
 			: base_type(parent),
 			  m_bConsistentInterfaces(parent.m_bConsistentInterfaces),
 			  m_useOverlap(parent.m_useOverlap),
-			  m_spOrderingAlgo(parent.m_spOrderingAlgo)
+			  m_bLevelScheduling(parent.m_bLevelScheduling),
+			  m_bSinglePrecision(parent.m_bSinglePrecision),
+			  m_spOrderingAlgo(parent.m_spOrderingAlgo),
+			  m_pPreparedA(NULL),
+			  m_preparedRevision(0)
 		{
 			set_sor_relax(parent.m_relax);
 		}
@@ -100,6 +115,22 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 
 		void enable_overlap (bool enable) {m_useOverlap = enable;}
 
+	///	processes independent rows of a sweep in parallel threads (disabled by default)
+	/**
+	 * The rows are grouped into the level sets of the dependency graph at
+	 * init, the levels are processed one after another. The result is the
+	 * same as for the sequential sweep. Needs UG_OPENMP for threading.
+	 */
+		void enable_level_scheduling(bool enable) {m_bLevelScheduling = enable;}
+
+	///	sweeps with a single precision copy of the matrix (disabled by default)
+	/**
+	 * The matrix entries are stored as floats, which halves the memory
+	 * traffic of a sweep. Defect and correction stay in double precision.
+	 * Only available for algebras with blocks of static size.
+	 */
+		void enable_single_precision(bool enable) {m_bSinglePrecision = enable;}
+
 	/// 	sets an ordering algorithm
 		void set_ordering_algorithm(SmartPtr<ordering_algo_type> ordering_algo){
 			m_spOrderingAlgo = ordering_algo;
@@ -151,14 +182,96 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 //			UG_ASSERT(CheckDiagonalInvertible(A), "GS: A has noninvertible diagonal");
 			UG_COND_THROW(CheckDiagonalInvertible(*pA) == false, name() << ": A has noninvertible diagonal");
 
+		//	the data below is recomputed on every preprocess and only used in
+		//	sweeps with this matrix (\sa prepared_for)
+			m_pPreparedA = NULL;
+
+		//	cache the diagonal positions and, for block algebras, invert the
+		//	diagonal blocks once instead of in every sweep
+			pA->update_diag_index();
+			m_vInvDiag.clear();
+			if(block_traits<typename matrix_type::value_type>::depth > 0)
+			{
+				m_vInvDiag.resize(pA->num_rows());
+				for(size_t i = 0; i < m_vInvDiag.size(); ++i)
+					UG_COND_THROW(!GetInverse(m_vInvDiag[i], pA->diag(i)),
+					              name() << ": could not invert diagonal block " << i);
+			}
+
+		//	level sets of the forward and backward sweeps
+			if(m_bLevelScheduling)
+			{
+				m_lowerLevels.init(*pA, true);
+				m_upperLevels.init(*pA, false);
+			}
+			else
+			{
+				m_lowerLevels.clear();
+				m_upperLevels.clear();
+			}
+
+		//	single precision copy used in the sweeps
+			if(m_bSinglePrecision) m_Af.init(*pA);
+			else m_Af.clear();
+
+			m_pPreparedA = pA;
+			m_preparedRevision = pA->pattern_revision();
 			return true;
 		}
 
+	///	returns true if the last preprocess has been done for A
+	/**
+	 * The pre-inverted diagonal, the level schedules and the single precision
+	 * copy belong to the matrix passed to the last preprocess. They are only
+	 * used for this matrix object and as long as its pattern is unchanged.
+	 * Changed values require a new init, as for all other preconditioners.
+	 */
+		bool prepared_for(const matrix_type &A) const
+		{
+			return m_pPreparedA == &A
+				&& m_preparedRevision == A.pattern_revision();
+		}
+
+	///	the single precision copy is always the one of the last preprocess
+		bool prepared_for(const single_matrix_type &A) const
+		{
+			return m_pPreparedA != NULL && &A == &m_Af;
+		}
+
+	///	returns true if the level schedules have been computed for A
+		template <typename TMatrix>
+		bool use_level_schedule(const TMatrix &A) const
+		{
+			return m_bLevelScheduling && m_lowerLevels.num_rows() != 0 && prepared_for(A);
+		}
+
+	///	returns the pre-inverted diagonal blocks, or NULL if not used
+		template <typename TMatrix>
+		const inv_diag_type* inv_diag(const TMatrix &A) const
+		{
+			if(m_vInvDiag.empty() || !prepared_for(A)) return NULL;
+			return &m_vInvDiag;
+		}
+
 	//	Postprocess routine
 		virtual bool postprocess() {return true;}
 
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax) = 0;
 
+		virtual void step(const single_matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			UG_THROW(name() << ": single precision storage is not supported.");
+		}
+
+	///	performs the sweep with the single precision copy of A, if enabled
+		void sweep(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			if(m_bSinglePrecision && m_Af.num_rows() != 0 && prepared_for(A))
+				step(m_Af, c, d, relax);
+			else
+				step(A, c, d, relax);
+		}
+
 	//	Stepping routine
 		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
 		{
@@ -175,7 +288,7 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 					m_oD.set_storage_type(PST_ADDITIVE);
 					m_oD.change_storage_type(PST_CONSISTENT);
 
-					step(m_A, m_oC, m_oD, m_relax);
+					sweep(m_A, m_oC, m_oD, m_relax);
 
 					for(size_t i = 0; i < c.size(); ++i)
 						c[i] = m_oC[i];
@@ -189,7 +302,7 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 					spDtmp->change_storage_type(PST_CONSISTENT);
 
 					THROW_IF_NOT_EQUAL_3(c.size(), spDtmp->size(), m_A.num_rows());
-					step(m_A, c, *spDtmp, m_relax);
+					sweep(m_A, c, *spDtmp, m_relax);
 
 					// declare c unique to enforce that only master correction is used
 					// when it is made consistent below
@@ -207,7 +320,7 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 					spDtmp->change_storage_type(PST_UNIQUE);
 
 					THROW_IF_NOT_EQUAL_3(c.size(), spDtmp->size(), m_A.num_rows());
-					step(m_A, c, *spDtmp, m_relax);
+					sweep(m_A, c, *spDtmp, m_relax);
 					c.set_storage_type(PST_UNIQUE);
 				}
 
@@ -222,7 +335,7 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 				matrix_type &A = *pOp;
 				THROW_IF_NOT_EQUAL_4(c.size(), d.size(), A.num_rows(), A.num_cols());
 
-				step(A, c, d, m_relax);
+				sweep(A, c, d, m_relax);
 #ifdef UG_PARALLEL
 				c.set_storage_type(PST_CONSISTENT);
 #endif
@@ -245,6 +358,22 @@ class GaussSeidelBase : public IPreconditioner<TAlgebra>
 		bool m_bConsistentInterfaces;
 		bool m_useOverlap;
 
+	///	pre-inverted diagonal blocks (block algebras only)
+		inv_diag_type m_vInvDiag;
+
+	///	level scheduling of the sweeps
+		bool m_bLevelScheduling;
+		LevelSchedule m_lowerLevels;
+		LevelSchedule m_upperLevels;
+
+	///	single precision copy of the matrix
+		bool m_bSinglePrecision;
+		single_matrix_type m_Af;
+
+	///	matrix and pattern revision of the last preprocess (\sa prepared_for)
+		const matrix_type* m_pPreparedA;
+		size_t m_preparedRevision;
+
 
 	/// for ordering algorithms
 		SmartPtr<ordering_algo_type> m_spOrderingAlgo;
@@ -274,6 +403,7 @@ class GaussSeidel : public GaussSeidelBase<TAlgebra>
 	typedef typename TAlgebra::vector_type vector_type;
 	typedef typename TAlgebra::matrix_type matrix_type;
 	typedef GaussSeidelBase<TAlgebra> base_type;
+	typedef typename base_type::single_matrix_type single_matrix_type;
 
 public:
 	//	Name of preconditioner
@@ -296,7 +426,22 @@ public:
 	//	Stepping routine
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
 		{
-			gs_step_LL(A, c, d, relax);
+			sweep_impl(A, c, d, relax);
+		}
+
+		virtual void step(const single_matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			sweep_impl(A, c, d, relax);
+		}
+
+	protected:
+		template <typename TMatrix>
+		void sweep_impl(const TMatrix &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			if(this->use_level_schedule(A))
+				gs_step_LL_levels(A, c, d, relax, this->m_lowerLevels, this->inv_diag(A));
+			else
+				gs_step_LL(A, c, d, relax, this->inv_diag(A));
 		}
 };
 
@@ -319,6 +464,7 @@ class BackwardGaussSeidel : public GaussSeidelBase<TAlgebra>
 	typedef typename TAlgebra::vector_type vector_type;
 	typedef typename TAlgebra::matrix_type matrix_type;
 	typedef GaussSeidelBase<TAlgebra> base_type;
+	typedef typename base_type::single_matrix_type single_matrix_type;
 
 public:
 	//	Name of preconditioner
@@ -341,7 +487,22 @@ public:
 	//	Stepping routine
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
 		{
-			gs_step_UR(A, c, d, relax);
+			sweep_impl(A, c, d, relax);
+		}
+
+		virtual void step(const single_matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			sweep_impl(A, c, d, relax);
+		}
+
+	protected:
+		template <typename TMatrix>
+		void sweep_impl(const TMatrix &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			if(this->use_level_schedule(A))
+				gs_step_UR_levels(A, c, d, relax, this->m_upperLevels, this->inv_diag(A));
+			else
+				gs_step_UR(A, c, d, relax, this->inv_diag(A));
 		}
 };
 
@@ -353,6 +514,7 @@ class SymmetricGaussSeidel : public GaussSeidelBase<TAlgebra>
 	typedef typename TAlgebra::vector_type vector_type;
 	typedef typename TAlgebra::matrix_type matrix_type;
 	typedef GaussSeidelBase<TAlgebra> base_type;
+	typedef typename base_type::single_matrix_type single_matrix_type;
 
 public:
 	//	Name of preconditioner
@@ -375,7 +537,22 @@ public:
 	//	Stepping routine
 		virtual void step(const matrix_type &A, vector_type &c, const vector_type &d, const number relax)
 		{
-			sgs_step(A, c, d, relax);
+			sweep_impl(A, c, d, relax);
+		}
+
+		virtual void step(const single_matrix_type &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			sweep_impl(A, c, d, relax);
+		}
+
+	protected:
+		template <typename TMatrix>
+		void sweep_impl(const TMatrix &A, vector_type &c, const vector_type &d, const number relax)
+		{
+			if(this->use_level_schedule(A))
+				sgs_step_levels(A, c, d, relax, this->m_lowerLevels, this->m_upperLevels, this->inv_diag(A));
+			else
+				sgs_step(A, c, d, relax, this->inv_diag(A));
 		}
 };
 
@@ -53,6 +53,8 @@
 #include "lib_algebra/ordering_strategies/algorithms/native_cuthill_mckee.h" // for backward compatibility
 
 #include "lib_algebra/algebra_common/permutation_util.h"
+#include "lib_algebra/algebra_common/level_schedule.h"
+#include "lib_algebra/cpu_algebra/single_precision_matrix.h"
 
 namespace ug{
 
@@ -66,6 +68,9 @@ bool FactorizeILU(Matrix_type &A)
 	typedef typename Matrix_type::row_iterator row_iterator;
 	typedef typename Matrix_type::value_type block_type;
 
+	// the pattern does not change, so the diagonal positions stay valid
+	A.update_diag_index();
+
 	// for all rows
 	for(size_t i=1; i < A.num_rows(); i++)
 	{
@@ -79,10 +84,11 @@ bool FactorizeILU(Matrix_type &A)
 			// add row k to row i by A(i, .) -= A(k,.)  A(i,k) / A(k,k)
 			// so that A(i,k) is zero.
 			// save A(i,k)/A(k,k) in A(i,k)
-			if(fabs(BlockNorm(A(k,k))) < 1e-15*BlockNorm(A(i,k)))
+			const block_type &a_kk = A.diag(k);
+			if(fabs(BlockNorm(a_kk)) < 1e-15*BlockNorm(a_ik))
 				UG_THROW("Diag is Zero for k="<<k<<", cannot factorize ILU.");
 
-			a_ik /= A(k,k);
+			a_ik /= a_kk;
 
 			row_iterator it_j = it_k;
 			for(++it_j; it_j != rowEnd; ++it_j)
@@ -177,6 +183,9 @@ bool FactorizeILUSorted(Matrix_type &A, const number eps = 1e-50)
 	typedef typename Matrix_type::row_iterator row_iterator;
 	typedef typename Matrix_type::value_type block_type;
 
+	// the pattern does not change, so the diagonal positions stay valid
+	A.update_diag_index();
+
 	// for all rows
 	for(size_t i=1; i < A.num_rows(); i++)
 	{
@@ -186,7 +195,7 @@ bool FactorizeILUSorted(Matrix_type &A, const number eps = 1e-50)
 		{
 			const size_t k = it_k.index();
 			block_type &a_ik = it_k.value();
-			block_type &a_kk = A(k,k);
+			const block_type &a_kk = A.diag(k);
 
 			// add row k to row i by A(i, .) -= A(k,.)  A(i,k) / A(k,k)
 			// so that A(i,k) is zero.
@@ -199,12 +208,12 @@ bool FactorizeILUSorted(Matrix_type &A, const number eps = 1e-50)
 				         " with eps: "<< eps <<", ||A_kk||="<<fabs(BlockNorm(A(k,k)))
 				         <<", ||A_ik||="<<BlockNorm(A(i,k)));
 			*/			 
-			if(fabs(BlockNorm(A(k,k))) < eps * BlockNorm(A(i,k)))
+			if(fabs(BlockNorm(a_kk)) < eps * BlockNorm(a_ik))
 			{
 				UG_LOG("Shuai Debug:ilu.h \n");
 				UG_THROW("ILU: Blocknorm of diagonal is near-zero for k="<<k<<
-						 " with eps: "<< eps <<", ||A_kk||="<<fabs(BlockNorm(A(k,k)))
-						 <<", ||A_ik||="<<BlockNorm(A(i,k)));
+						 " with eps: "<< eps <<", ||A_kk||="<<fabs(BlockNorm(a_kk))
+						 <<", ||A_ik||="<<BlockNorm(a_ik));
 			}
 			//Shuai debug end
 			
@@ -248,14 +257,14 @@ bool invert_L(const Matrix_type &A, Vector_type &x, const Vector_type &b)
 	typedef typename Matrix_type::const_row_iterator const_row_iterator;
 
 	typename Vector_type::value_type s;
+	A.update_diag_index();
 	for(size_t i=0; i < x.size(); i++)
 	{
 		s = b[i];
-		for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
-		{
-			if(it.index() >= i) continue;
+		// rows are sorted, so the lower part ends at the diagonal
+		const const_row_iterator diag = A.get_diag_connection(i);
+		for(const_row_iterator it = A.begin_row(i); it != diag && it.index() < i; ++it)
 			MatMultAdd(s, 1.0, s, -1.0, it.value(), x[it.index()]);
-		}
 		x[i] = s;
 	}
 
@@ -275,6 +284,7 @@ bool invert_U(const Matrix_type &A, Vector_type &x, const Vector_type &b,
 	typename Vector_type::value_type s;
 
 	bool result = true;
+	A.update_diag_index();
 
 	// last row diagonal U entry might be close to zero with corresponding close to zero rhs
 	// when solving Navier Stokes system, therefore handle separately
@@ -293,10 +303,10 @@ bool invert_U(const Matrix_type &A, Vector_type &x, const Vector_type &b,
 		// non-zero kernels, e.g. for the Stokes equation. One should
 		// probably suppress this message in those cases but set the
 		// rhs to 0.
-		if (BlockNorm(A(i,i)) <= eps * BlockNorm(s))
+		if (BlockNorm(A.diag(i)) <= eps * BlockNorm(s))
 		{
 			UG_LOG("ILU Warning: Near-zero last diagonal entry "
-					"with norm "<<BlockNorm(A(i,i))<<" in U "
+					"with norm "<<BlockNorm(A.diag(i))<<" in U "
 					"for non-near-zero rhs entry with norm "
 					<< BlockNorm(s) << ". Setting rhs to zero.\n"
 					"NOTE: Reduce 'eps' using e.g. ILU::set_inversion_eps(...) "
@@ -306,7 +316,7 @@ bool invert_U(const Matrix_type &A, Vector_type &x, const Vector_type &b,
 			result = false;
 		} else {
 			// c[i] = s/uii;
-			InverseMatMult(x[i], 1.0, A(i,i), s);
+			InverseMatMult(x[i], 1.0, A.diag(i), s);
 		}
 	}
 	if(x.size() <= 1) return result;
@@ -315,21 +325,115 @@ bool invert_U(const Matrix_type &A, Vector_type &x, const Vector_type &b,
 	for(size_t i = x.size()-2; ; --i)
 	{
 		s = b[i];
-		for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
-		{
-			if(it.index() <= i) continue;
+		// rows are sorted, so the upper part starts behind the diagonal
+		const const_row_iterator diag = A.get_diag_connection(i);
+		const const_row_iterator rowEnd = A.end_row(i);
+		const_row_iterator it = diag;
+		if(it != rowEnd) ++it;
+		for(; it != rowEnd; ++it)
 			// s -= it.value() * x[it.index()];
 			MatMultAdd(s, 1.0, s, -1.0, it.value(), x[it.index()]);
 
-		}
 		// x[i] = s/A(i,i);
-		InverseMatMult(x[i], 1.0, A(i,i), s);
+		InverseMatMult(x[i], 1.0, A.diag(i), s);
 		if(i == 0) break;
 	}
 
 	return result;
 }
 
+/// computes row i of the forward substitution x = L^-1 b
+template<typename Matrix_type, typename Vector_type>
+struct ILURowL
+{
+	ILURowL(const Matrix_type &A_, Vector_type &x_, const Vector_type &b_)
+		: A(A_), x(x_), b(b_) {}
+
+	void operator()(size_t i) const
+	{
+		typename Vector_type::value_type s = b[i];
+		int k, end;
+		A.get_row_range(i, k, end);
+		for(; k < end && A.col_index_at(k) < (int)i; ++k)
+			MatMultAdd(s, 1.0, s, -1.0, A.value_at(k), x[A.col_index_at(k)]);
+		x[i] = s;
+	}
+
+	const Matrix_type &A;
+	Vector_type &x;
+	const Vector_type &b;
+};
+
+/// computes row i of the backward substitution x = U^-1 b
+template<typename Matrix_type, typename Vector_type>
+struct ILURowU
+{
+	ILURowU(const Matrix_type &A_, Vector_type &x_, const Vector_type &b_,
+	        number eps_, bool &bResult_)
+		: A(A_), x(x_), b(b_), eps(eps_), bResult(bResult_) {}
+
+	void operator()(size_t i) const
+	{
+		typename Vector_type::value_type s = b[i];
+		int begin, end;
+		A.get_row_range(i, begin, end);
+		const int diag = A.diag_index(i);
+		for(int k = (diag != -1) ? diag+1 : begin; k < end; ++k)
+			if(A.col_index_at(k) > (int)i)
+				// s -= it.value() * x[it.index()];
+				MatMultAdd(s, 1.0, s, -1.0, A.value_at(k), x[A.col_index_at(k)]);
+
+		// near-zero last diagonal entry, see invert_U
+		if(i == x.size()-1 && BlockNorm(A.diag(i)) <= eps * BlockNorm(s))
+		{
+			UG_LOG("ILU Warning: Near-zero last diagonal entry "
+					"with norm "<<BlockNorm(A.diag(i))<<" in U "
+					"for non-near-zero rhs entry with norm "
+					<< BlockNorm(s) << ". Setting rhs to zero.\n"
+					"NOTE: Reduce 'eps' using e.g. ILU::set_inversion_eps(...) "
+					"to avoid this warning. Current eps: " << eps << ".\n")
+			x[i] = 0;
+			bResult = false;
+			return;
+		}
+
+		// x[i] = s/A(i,i);
+		InverseMatMult(x[i], 1.0, A.diag(i), s);
+	}
+
+	const Matrix_type &A;
+	Vector_type &x;
+	const Vector_type &b;
+	number eps;
+	bool &bResult;
+};
+
+// solve x = L^-1 b, using the level schedule of the lower triangle of A
+// (same result as invert_L, the rows of each level are processed in parallel)
+template<typename Matrix_type, typename Vector_type>
+bool invert_L_levels(const Matrix_type &A, Vector_type &x, const Vector_type &b,
+                     const LevelSchedule &lowerLevels)
+{
+	PROFILE_FUNC_GROUP("algebra ILU");
+	UG_ASSERT(lowerLevels.num_rows() == x.size(), "level schedule does not match vector size.");
+	ForEachRowInLevels(lowerLevels, ILURowL<Matrix_type, Vector_type>(A, x, b));
+	return true;
+}
+
+// solve x = U^-1 b, using the level schedule of the upper triangle of A
+// (same result as invert_U, the rows of each level are processed in parallel)
+template<typename Matrix_type, typename Vector_type>
+bool invert_U_levels(const Matrix_type &A, Vector_type &x, const Vector_type &b,
+                     const LevelSchedule &upperLevels, const number eps = 1e-8)
+{
+	PROFILE_FUNC_GROUP("algebra ILU");
+	UG_ASSERT(upperLevels.num_rows() == x.size(), "level schedule does not match vector size.");
+	bool bResult = true;
+	A.update_diag_index();
+	ForEachRowInLevels(upperLevels, ILURowU<Matrix_type, Vector_type>(A, x, b, eps, bResult));
+	return bResult;
+}
+
 ///	ILU / ILU(beta) preconditioner
 template <typename TAlgebra>
 class ILU : public IPreconditioner<TAlgebra>
@@ -371,6 +475,8 @@ class ILU : public IPreconditioner<TAlgebra>
 			m_useOverlap(false),
 			m_spOrderingAlgo(SPNULL),
 			m_bSortIsIdentity(false),
+			m_bLevelScheduling(false),
+			m_bSinglePrecision(false),
 			m_u(nullptr)
 		{};
 
@@ -385,6 +491,8 @@ class ILU : public IPreconditioner<TAlgebra>
 			m_useOverlap(parent.m_useOverlap),
 			m_spOrderingAlgo(parent.m_spOrderingAlgo),
 			m_bSortIsIdentity(false),
+			m_bLevelScheduling(parent.m_bLevelScheduling),
+			m_bSinglePrecision(parent.m_bSinglePrecision),
 			m_u(nullptr)
 		{}
 
@@ -437,6 +545,19 @@ class ILU : public IPreconditioner<TAlgebra>
 
 		void enable_overlap (bool enable)				{m_useOverlap = enable;}
 
+	///	processes independent rows of the triangular solves in parallel threads
+	/**	The rows are grouped into the level sets of the dependency graph of
+	 * the factorization, the result is the same as for the sequential solves.
+	 * Needs UG_OPENMP for threading.*/
+		void enable_level_scheduling(bool enable)		{m_bLevelScheduling = enable;}
+
+	///	stores the factors in single precision for the triangular solves
+	/**	The factorization is computed in double precision, afterwards the
+	 * factors are copied to a SinglePrecisionMatrix, which is used in the
+	 * application. Defect and correction stay in double precision. Only
+	 * available for algebras with blocks of static size.*/
+		void enable_single_precision(bool enable)		{m_bSinglePrecision = enable;}
+
 	protected:
 	//	Name of preconditioner
 		virtual const char* name() const {return "ILU";}
@@ -527,6 +648,9 @@ class ILU : public IPreconditioner<TAlgebra>
 			// do not do a thing if preprocessing disabled
 			if (m_bDisablePreprocessing) return true;
 
+		//	the single precision copy must not outlive the factors it was made of
+			m_ILUf.clear();
+
 			matrix_type &mat = *pOp;
 			PROFILE_BEGIN_GROUP(ILU_preprocess, "algebra ILU");
 		//	Debug output of matrices
@@ -587,6 +711,22 @@ class ILU : public IPreconditioner<TAlgebra>
 			else FactorizeILU(m_ILU);
 			m_ILU.defragment();
 
+		//	level sets for the triangular solves
+			if(m_bLevelScheduling)
+			{
+				m_lowerLevels.init(m_ILU, true);
+				m_upperLevels.init(m_ILU, false);
+			}
+			else
+			{
+				m_lowerLevels.clear();
+				m_upperLevels.clear();
+			}
+
+		//	single precision copy of the factors
+			if(m_bSinglePrecision) m_ILUf.init(m_ILU);
+			else m_ILUf.clear();
+
 		//	Debug output of matrices
 			#ifdef UG_PARALLEL
 			write_overlap_debug(m_ILU, "ILU_prep_04_A_AfterFactorize");
@@ -601,13 +741,28 @@ class ILU : public IPreconditioner<TAlgebra>
 
 		void applyLU(vector_type &c, const vector_type &d, vector_type &tmp)
 		{
+			if(m_bSinglePrecision && m_ILUf.num_rows() == m_ILU.num_rows())
+				applyLU(m_ILUf, c, d, tmp);
+			else
+				applyLU(m_ILU, c, d, tmp);
+		}
+
+	///	applies the factors stored in LU (either m_ILU or its single precision copy)
+		template <typename TLUMatrix>
+		void applyLU(const TLUMatrix &LU, vector_type &c, const vector_type &d, vector_type &tmp)
+		{
+			if(m_bLevelScheduling && m_lowerLevels.num_rows() == LU.num_rows())
+			{
+				applyLU_levels(LU, c, d, tmp);
+				return;
+			}
 
 			if(m_spOrderingAlgo.invalid() || m_bSortIsIdentity)
 			{
 				// 	apply iterator: c = LU^{-1}*d
-				if(! invert_L(m_ILU, tmp, d)) // h := L^-1 d
+				if(! invert_L(LU, tmp, d)) // h := L^-1 d
 					print_debugger_message("ILU: There were issues at inverting L\n");
-				if(! invert_U(m_ILU, c, tmp, m_invEps)) // c := U^-1 h = (LU)^-1 d
+				if(! invert_U(LU, c, tmp, m_invEps)) // c := U^-1 h = (LU)^-1 d
 					print_debugger_message("ILU: There were issues at inverting U\n");
 			}
 ///*
@@ -615,15 +770,37 @@ class ILU : public IPreconditioner<TAlgebra>
 			{
 				// we save one vector here by renaming
 				SetVectorAsPermutation(tmp, d, m_ordering);
-				if(! invert_L(m_ILU, c, tmp)) // c = L^{-1} d
+				if(! invert_L(LU, c, tmp)) // c = L^{-1} d
 					print_debugger_message("ILU: There were issues at inverting L (after permutation)\n");
-				if(! invert_U(m_ILU, tmp, c, m_invEps)) // tmp = (LU)^{-1} d
+				if(! invert_U(LU, tmp, c, m_invEps)) // tmp = (LU)^{-1} d
 					print_debugger_message("ILU: There were issues at inverting U (after permutation)\n");
 				SetVectorAsPermutation(c, tmp, m_old_ordering);
 			}
 //*/
 		}
 
+	///	applyLU using the level-scheduled triangular solves
+		template <typename TLUMatrix>
+		void applyLU_levels(const TLUMatrix &LU, vector_type &c, const vector_type &d, vector_type &tmp)
+		{
+			if(m_spOrderingAlgo.invalid() || m_bSortIsIdentity)
+			{
+				if(! invert_L_levels(LU, tmp, d, m_lowerLevels))
+					print_debugger_message("ILU: There were issues at inverting L\n");
+				if(! invert_U_levels(LU, c, tmp, m_upperLevels, m_invEps))
+					print_debugger_message("ILU: There were issues at inverting U\n");
+			}
+			else
+			{
+				SetVectorAsPermutation(tmp, d, m_ordering);
+				if(! invert_L_levels(LU, c, tmp, m_lowerLevels))
+					print_debugger_message("ILU: There were issues at inverting L (after permutation)\n");
+				if(! invert_U_levels(LU, tmp, c, m_upperLevels, m_invEps))
+					print_debugger_message("ILU: There were issues at inverting U (after permutation)\n");
+				SetVectorAsPermutation(c, tmp, m_old_ordering);
+			}
+		}
+
 	//	Stepping routine
 		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp,
 		                  vector_type& c,
@@ -745,6 +922,14 @@ class ILU : public IPreconditioner<TAlgebra>
 		std::vector<size_t> m_newIndex, m_oldIndex;
 		bool m_bSortIsIdentity;
 
+	/// level sets of L and U for the threaded triangular solves
+		bool m_bLevelScheduling;
+		LevelSchedule m_lowerLevels, m_upperLevels;
+
+	///	single precision copy of the factors
+		bool m_bSinglePrecision;
+		SinglePrecisionMatrix<matrix_type> m_ILUf;
+
 		const vector_type* m_u;
 };
 
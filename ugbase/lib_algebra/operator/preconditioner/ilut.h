@@ -17,6 +17,7 @@
 #include "lib_algebra/ordering_strategies/algorithms/native_cuthill_mckee.h" // for backward compatibility
 
 #include "lib_algebra/algebra_common/permutation_util.h"
+#include "lib_algebra/cpu_algebra/single_precision_matrix.h"
 
 namespace ug{
 
@@ -58,7 +59,8 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 	public:
 	///	Constructor
 		ILUTPreconditioner(double eps=1e-6)
-			: m_eps(eps), m_info(false), m_show_progress(true), m_bSortIsIdentity(false)
+			: m_eps(eps), m_info(false), m_show_progress(true), m_bSortIsIdentity(false),
+			  m_bSinglePrecision(false)
 		{
 			//default was set true
 			m_spOrderingAlgo = make_sp(new NativeCuthillMcKeeOrdering<TAlgebra, ordering_container_type>());
@@ -71,6 +73,7 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			m_eps = parent.m_eps;
 			set_info(parent.m_info);
 			m_bSortIsIdentity = parent.m_bSortIsIdentity;
+			m_bSinglePrecision = parent.m_bSinglePrecision;
 		}
 
 	///	Clone
@@ -105,6 +108,13 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			m_show_progress = s;
 		}
 
+	///	stores the factors L and U in single precision for the application
+	/**	Only available for algebras with blocks of static size.*/
+		void enable_single_precision(bool enable)
+		{
+			m_bSinglePrecision = enable;
+		}
+
 		virtual std::string config_string() const
 		{
 			std::stringstream ss;
@@ -241,6 +251,10 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			STATIC_ASSERT(matrix_type::rows_sorted, Matrix_has_to_have_sorted_rows);
 			write_debug(mat, "ILUT_PreprocessIn");
 
+		//	the single precision copies must not outlive the factors they were made of
+			m_Lf.clear();
+			m_Uf.clear();
+
 			matrix_type* A;
 			matrix_type permA;
 
@@ -397,6 +411,15 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 				m_U.defragment();
 			}
 
+			if(m_bSinglePrecision){
+				m_Lf.init(m_L);
+				m_Uf.init(m_U);
+			}
+			else{
+				m_Lf.clear();
+				m_Uf.clear();
+			}
+
 			if (m_info==true)
 			{
 				m_L.print("L");
@@ -458,14 +481,24 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 
 		virtual bool applyLU(vector_type& c, const vector_type& d)
 		{
+			if(m_bSinglePrecision && m_Lf.num_rows() == m_L.num_rows())
+				return applyLU(m_Lf, m_Uf, c, d);
+			return applyLU(m_L, m_U, c, d);
+		}
+
+	///	applies the factors L and U (either m_L, m_U or their single precision copies)
+		template <typename TLUMatrix>
+		bool applyLU(const TLUMatrix& L, const TLUMatrix& U, vector_type& c, const vector_type& d)
+		{
+			typedef typename TLUMatrix::const_row_iterator lu_row_iterator;
 			PROFILE_BEGIN_GROUP(ILUT_step, "ilut algebra");
 			// apply iterator: c = LU^{-1}*d (damp is not used)
 			// L
-			for(size_t i=0; i < m_L.num_rows(); i++)
+			for(size_t i=0; i < L.num_rows(); i++)
 			{
 				// c[i] = d[i] - m_L[i]*c;
 				c[i] = d[i];
-				for(matrix_row_iterator it = m_L.begin_row(i); it != m_L.end_row(i); ++it)
+				for(lu_row_iterator it = L.begin_row(i); it != L.end_row(i); ++it)
 					MatMultAdd(c[i], 1.0, c[i], -1.0, it.value(), c[it.index()] );
 				// lii = 1.0.
 			}
@@ -474,13 +507,13 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			//
 			// last row diagonal U entry might be close to zero with corresponding zero rhs 
 			// when solving Navier Stokes system, therefore handle separately
-			if(m_U.num_rows() > 0)
+			if(U.num_rows() > 0)
 			{
-				size_t i=m_U.num_rows()-1;
-				matrix_row_iterator it = m_U.begin_row(i);
-				UG_ASSERT(it != m_U.end_row(i), i);
+				size_t i=U.num_rows()-1;
+				lu_row_iterator it = U.begin_row(i);
+				UG_ASSERT(it != U.end_row(i), i);
 				UG_ASSERT(it.index() == i, i);
-				block_type &uii = it.value();
+				const block_type &uii = it.value();
 				vector_value s = c[i];
 				// check if diag part is significantly smaller than rhs
 				// This may happen when matrix is indefinite with one eigenvalue
@@ -502,17 +535,17 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 			}
 
 			// handle all other rows
-			if(m_U.num_rows() > 1){
-				for(size_t i=m_U.num_rows()-2; ; i--)
+			if(U.num_rows() > 1){
+				for(size_t i=U.num_rows()-2; ; i--)
 				{
-					matrix_row_iterator it = m_U.begin_row(i);
-					UG_ASSERT(it != m_U.end_row(i), i);
+					lu_row_iterator it = U.begin_row(i);
+					UG_ASSERT(it != U.end_row(i), i);
 					UG_ASSERT(it.index() == i, i);
-					block_type &uii = it.value();
+					const block_type &uii = it.value();
 
 					vector_value s = c[i];
 					++it; // skip diag
-					for(; it != m_U.end_row(i); ++it){
+					for(; it != U.end_row(i); ++it){
 						// s -= it.value() * c[it.index()];
 						MatMultAdd(s, 1.0, s, -1.0, it.value(), c[it.index()] );
 					}
@@ -627,6 +660,10 @@ class ILUTPreconditioner : public IPreconditioner<TAlgebra>
 
 		bool m_bSortIsIdentity;
 
+	///	single precision copies of the factors
+		bool m_bSinglePrecision;
+		SinglePrecisionMatrix<matrix_type> m_Lf, m_Uf;
+
 		const vector_type* m_u;
 };
 
@@ -114,16 +114,17 @@ class Jacobi : public IPreconditioner<TAlgebra>
 
 	public:
 	///	default constructor
-		Jacobi() {this->set_damp(1.0); m_bBlock = true;};
+		Jacobi() {this->set_damp(1.0); m_bBlock = true; init_interface_marks();};
 
 	///	constructor setting the damping parameter
-		Jacobi(number damp) {this->set_damp(damp); m_bBlock = true;};
+		Jacobi(number damp) {this->set_damp(damp); m_bBlock = true; init_interface_marks();};
 
 	/// clone constructor
 		Jacobi( const Jacobi<TAlgebra> &parent )
 			: base_type(parent)
 		{
 			set_block(parent.m_bBlock);
+			init_interface_marks();
 		}
 
 	///	Clone
@@ -148,6 +149,14 @@ class Jacobi : public IPreconditioner<TAlgebra>
 		}
 
 	protected:
+	///	resets the interface marks, they are computed in preprocess
+		void init_interface_marks()
+		{
+#ifdef UG_PARALLEL
+			m_interfaceRevision = 0;
+#endif
+		}
+
 	///	Name of preconditioner
 		virtual const char* name() const {return "Jacobi";}
 
@@ -178,7 +187,7 @@ class Jacobi : public IPreconditioner<TAlgebra>
 
 		// 	copy diagonal
 			for(size_t i = 0; i < diag.size(); ++i){
-				diag[i] = mat(i, i);
+				diag[i] = mat.diag(i);
 			}
 
 		//	make diagonal consistent
@@ -191,6 +200,15 @@ class Jacobi : public IPreconditioner<TAlgebra>
 					return false;
 //			UG_ASSERT(CheckVectorInvertible(diag), "Jacobi: A has noninvertible diagonal");
 
+		//	remember the interface indices, their entries of the correction are
+		//	computed first in step()
+			m_interfaceRevision = mat.layouts()->revision();
+			m_vOnInterface.clear(); m_vOnInterface.resize(size, 0);
+			MarkAllFromLayout<char>(m_vOnInterface, mat.layouts()->master(), 1);
+			MarkAllFromLayout<char>(m_vOnInterface, mat.layouts()->slave(), 1);
+			m_vInterfaceIndex.clear();
+			for(size_t i = 0; i < size; ++i)
+				if(m_vOnInterface[i]) m_vInterfaceIndex.push_back(i);
 #endif
 
 //	get damping in constant case to damp at once
@@ -203,9 +221,9 @@ class Jacobi : public IPreconditioner<TAlgebra>
 			for(size_t i = 0; i < mat.num_rows(); ++i)
 			{
 #ifdef UG_PARALLEL
-				typename matrix_type::value_type &d = diag[i];
+				const typename matrix_type::value_type &d = diag[i];
 #else
-				typename matrix_type::value_type &d = mat(i,i);
+				const typename matrix_type::value_type &d = mat.diag(i);
 #endif
 				if(!m_bBlock)
 					GetDiag(m, d);
@@ -223,6 +241,35 @@ class Jacobi : public IPreconditioner<TAlgebra>
 		{
 			PROFILE_BEGIN_GROUP(Jacobi_step, "algebra Jacobi");
 
+#ifdef UG_PARALLEL
+		//	the computed correction is additive. Its interface entries are
+		//	computed first and made consistent while the others are computed.
+			if(c.layouts().valid() && c.layouts()->revision() == m_interfaceRevision
+				&& m_vOnInterface.size() == m_diagInv.size())
+			{
+				for(size_t k = 0; k < m_vInterfaceIndex.size(); ++k)
+				{
+					const size_t i = m_vInterfaceIndex[k];
+					MatMult(c[i], 1.0, m_diagInv[i], d[i]);
+				}
+
+				const AlgebraLayouts& layouts = *c.layouts();
+				SplitToConsistent<vector_type> exchange(&c, false, layouts);
+				exchange.start();
+
+				for(size_t i = 0; i < m_diagInv.size(); ++i)
+					if(!m_vOnInterface[i])
+						MatMult(c[i], 1.0, m_diagInv[i], d[i]);
+
+				exchange.finish();
+				if(layouts.overlap_enabled())
+					CopyValues(&c, layouts.slave_overlap(),
+					           layouts.master_overlap(), &layouts.comm());
+				c.set_storage_type(PST_CONSISTENT);
+				return true;
+			}
+#endif
+
 		// 	multiply defect with diagonal, c = damp * D^{-1} * d
 		//	note, that the damping is already included in the inverse diagonal
 			for(size_t i = 0; i < m_diagInv.size(); ++i)
@@ -288,7 +335,8 @@ class Jacobi : public IPreconditioner<TAlgebra>
 				}
 			}
 
-		//	Correction is always consistent
+		//	Correction is always consistent (step() already made it so, the
+		//	scaling keeps it)
 			#ifdef 	UG_PARALLEL
 			if(!c.change_storage_type(PST_CONSISTENT))
 				UG_THROW(name() << "::apply': Cannot change "
@@ -307,6 +355,15 @@ class Jacobi : public IPreconditioner<TAlgebra>
 		std::vector<inverse_type> m_diagInv;
 		bool m_bBlock;
 
+#ifdef UG_PARALLEL
+	///	revision of the layouts the interface marks were computed for
+		size_t m_interfaceRevision;
+
+	///	marks and list of the master and slave indices
+		std::vector<char> m_vOnInterface;
+		std::vector<size_t> m_vInterfaceIndex;
+#endif
+
 
 };
 
@@ -39,6 +39,7 @@
 #include "lib_algebra/operator/preconditioner/ilut.h"
 #include "lib_algebra/operator/preconditioner/iterator_product.h"
 #include "lib_algebra/operator/preconditioner/vanka.h"
+#include "lib_algebra/operator/preconditioner/smoothed_aggregation_amg.h"
 #include "lib_algebra/operator/preconditioner/schur/schur_precond.h"
 #include "lib_algebra/operator/preconditioner/transforming.h"
 #endif /* __UG__PRECONDITIONERS_H__ */
@@ -0,0 +1,1011 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__SMOOTHED_AGGREGATION_AMG__
+#define __H__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__SMOOTHED_AGGREGATION_AMG__
+
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cmath>
+
+#include "common/common.h"
+#include "common/util/smart_pointer.h"
+#include "lib_algebra/operator/interface/preconditioner.h"
+#include "lib_algebra/cpu_algebra/sparsematrix.h"
+#include "lib_algebra/cpu_algebra/vector.h"
+#include "lib_algebra/algebra_common/sparsematrix_util.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+
+#ifdef UG_PARALLEL
+	#include "lib_algebra/parallelization/parallelization.h"
+	#include "lib_algebra/parallelization/parallelization_util.h"
+	#include "lib_algebra/parallelization/collect_matrix.h"
+#endif
+
+namespace ug{
+
+///	Smoothed aggregation algebraic multigrid
+/**
+ * This preconditioner performs one multigrid cycle on a hierarchy of
+ * matrices that is constructed from the system matrix only. The coarse
+ * spaces are built by aggregation of strongly coupled unknowns
+ * (|a_ij| >= theta * sqrt(|a_ii| |a_jj|), block norms for block matrices),
+ * the tentative prolongation P0 (identity blocks on the aggregates) is
+ * smoothed by one damped Jacobi step
+ *
+ * 		P = (I - omega D^{-1} A) P0,	omega = 4/3 / rho(D^{-1} A),
+ *
+ * the restriction is R = P^T and the coarse matrices are computed as the
+ * Galerkin product R A P by CreateAsMultiplyOf. On each level damped
+ * (block-)Jacobi is used as smoother, the coarsest level is solved by a
+ * dense LU decomposition.
+ *
+ * In parallel, the fine levels stay distributed: each process aggregates
+ * the unknowns it owns (i.e. that are no slaves), the slaves are assigned
+ * to the aggregates of their masters and the coarse layouts connect these
+ * aggregates with their copies on the neighbor processes. The prolongation
+ * is smoothed in the rows away from the process interfaces only, since
+ * just there the (additive) matrix rows are complete. Smoothing uses the
+ * consistent diagonal. Once the global size of a coarse level falls below
+ * the agglomeration size (see set_agglomeration_size), this level is
+ * gathered on the first process of the communicator, which builds and
+ * cycles the remaining levels serially.
+ *
+ * References:
+ * <ul>
+ * <li> P. Vanek, J. Mandel, M. Brezina. Algebraic multigrid by smoothed
+ *		aggregation for second and fourth order elliptic problems.
+ *		Computing 56 (1996)
+ * </ul>
+ *
+ * \tparam	TAlgebra	algebra type
+ */
+template <typename TAlgebra>
+class SmoothedAggregationAMG : public IPreconditioner<TAlgebra>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Matrix type
+		typedef typename TAlgebra::matrix_type matrix_type;
+
+	///	Matrix Operator type
+		typedef typename IPreconditioner<TAlgebra>::matrix_operator_type matrix_operator_type;
+
+	///	Base type
+		typedef IPreconditioner<TAlgebra> base_type;
+
+	///	value types
+		typedef typename matrix_type::value_type value_type;
+		typedef typename vector_type::value_type vec_value_type;
+
+	///	process-local level matrix and vector types
+		typedef SparseMatrix<value_type> level_matrix_type;
+		typedef Vector<vec_value_type> level_vector_type;
+
+	protected:
+		using base_type::set_debug;
+		using base_type::debug_writer;
+		using base_type::write_debug;
+
+	public:
+	///	default constructor
+		SmoothedAggregationAMG()
+			: m_theta(0.08), m_maxLevels(20), m_maxCoarseSize(500),
+			  m_numPreSmooth(2), m_numPostSmooth(2), m_smoothDamp(0.66),
+			  m_cycleType(1), m_numPowerIt(10), m_agglomerationSize(2000),
+			  m_bInfo(false), m_operatorComplexity(0.0), m_gridComplexity(0.0),
+			  m_numDistLevels(0)
+		{}
+
+	///	clone constructor
+		SmoothedAggregationAMG(const SmoothedAggregationAMG<TAlgebra>& parent)
+			: base_type(parent),
+			  m_theta(parent.m_theta), m_maxLevels(parent.m_maxLevels),
+			  m_maxCoarseSize(parent.m_maxCoarseSize),
+			  m_numPreSmooth(parent.m_numPreSmooth),
+			  m_numPostSmooth(parent.m_numPostSmooth),
+			  m_smoothDamp(parent.m_smoothDamp), m_cycleType(parent.m_cycleType),
+			  m_numPowerIt(parent.m_numPowerIt),
+			  m_agglomerationSize(parent.m_agglomerationSize),
+			  m_bInfo(parent.m_bInfo),
+			  m_operatorComplexity(0.0), m_gridComplexity(0.0),
+			  m_numDistLevels(0)
+		{}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new SmoothedAggregationAMG<algebra_type>(*this));
+		}
+
+	///	Destructor
+		virtual ~SmoothedAggregationAMG() {}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const {return true;}
+
+	///	sets the strength threshold theta for aggregation
+		void set_strength_threshold(number theta) {m_theta = theta;}
+
+	///	sets the maximal number of levels
+		void set_max_levels(size_t maxLevels) {m_maxLevels = maxLevels;}
+
+	///	sets the size below which the coarsest level is solved directly
+		void set_max_coarse_size(size_t maxCoarseSize) {m_maxCoarseSize = maxCoarseSize;}
+
+	///	sets the global size below which a distributed level is gathered on one process
+		void set_agglomeration_size(size_t size) {m_agglomerationSize = size;}
+
+	///	sets the number of pre- and postsmoothing steps
+		void set_num_presmooth(size_t num) {m_numPreSmooth = num;}
+		void set_num_postsmooth(size_t num) {m_numPostSmooth = num;}
+
+	///	sets the damping of the jacobi smoother
+		void set_smoother_damp(number damp) {m_smoothDamp = damp;}
+
+	///	sets the cycle type (1 = V-cycle, 2 = W-cycle)
+		void set_cycle_type(int type) {m_cycleType = type;}
+
+	///	sets if hierarchy information is printed after setup
+		void set_info(bool bInfo) {m_bInfo = bInfo;}
+
+	///	returns the number of levels of the current hierarchy
+		size_t num_levels() const {return m_vLevelRows.size();}
+
+	///	returns sum of nonzeros of all levels / nonzeros of finest level
+		number operator_complexity() const {return m_operatorComplexity;}
+
+	///	returns sum of unknowns of all levels / unknowns of finest level
+		number grid_complexity() const {return m_gridComplexity;}
+
+	protected:
+	///	Name of preconditioner
+		virtual const char* name() const {return "SmoothedAggregationAMG";}
+
+	///	Preprocess routine
+		virtual bool preprocess(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp)
+		{
+			PROFILE_BEGIN_GROUP(SAAMG_preprocess, "algebra SAAMG");
+
+			matrix_type& mat = *pOp;
+			if(mat.num_rows() != mat.num_cols())
+				UG_THROW(name() << ": Square matrix needed.");
+
+			m_vLevel.clear();
+			m_vLevel.push_back(SmartPtr<Level>(new Level));
+			m_numDistLevels = 0;
+
+		//	fine level matrix
+			m_vLevel[0]->A = mat;
+
+		//	distributed levels, the remaining ones are built on one process
+			bool bSerialLevels = true;
+			#ifdef UG_PARALLEL
+			if(mat.layouts()->proc_comm().size() > 1)
+			{
+				m_vLevel[0]->spLayouts = mat.layouts();
+				init_interface_flags(*m_vLevel[0]);
+				create_distributed_levels();
+				bSerialLevels = m_bAggloRoot;
+			}
+			#endif
+
+		//	build coarser levels (the agglomerated level is a copy of the
+		//	last distributed one and not counted)
+			const size_t numCopies = (m_numDistLevels > 0) ? 1 : 0;
+			while(bSerialLevels && m_vLevel.size() - numCopies < m_maxLevels
+					&& m_vLevel.back()->A.num_rows() > m_maxCoarseSize)
+			{
+				if(!create_coarse_level(*m_vLevel.back())) break;
+			}
+
+		//	smoothers and level vectors
+			for(size_t lev = 0; lev < m_vLevel.size(); ++lev)
+				init_level(*m_vLevel[lev]);
+
+		//	direct solver on coarsest level
+			if(bSerialLevels)
+			{
+				PROFILE_BEGIN_GROUP(SAAMG_coarse_lu, "algebra SAAMG");
+				GetDenseDoubleFromSparse(m_coarseInv, m_vLevel.back()->A);
+				if(!m_coarseInv.invert())
+					UG_THROW(name() << ": Coarsest level matrix is singular.");
+			}
+
+			compute_statistics();
+			if(m_bInfo) print_info();
+
+			return true;
+		}
+
+		virtual bool step(SmartPtr<MatrixOperator<matrix_type, vector_type> > pOp, vector_type& c, const vector_type& d)
+		{
+			PROFILE_BEGIN_GROUP(SAAMG_step, "algebra SAAMG");
+			if(m_vLevel.empty())
+				UG_THROW(name() << "::step: Hierarchy not initialized.");
+
+			Level& fine = *m_vLevel[0];
+
+		//	copy defect to fine level
+			for(size_t i = 0; i < d.size(); ++i)
+				fine.d[i] = d[i];
+
+			cycle(0);
+
+			for(size_t i = 0; i < c.size(); ++i)
+				c[i] = fine.c[i];
+
+			#ifdef UG_PARALLEL
+		//	the cycle returns a consistent correction
+			c.set_storage_type(PST_CONSISTENT);
+			#endif
+
+			return true;
+		}
+
+	///	Postprocess routine
+		virtual bool postprocess() {return true;}
+
+	protected:
+	///	data of one level
+		struct Level
+		{
+		///	level matrix, prolongation to this level and restriction
+			level_matrix_type A, P, R;
+
+		///	inverted diagonal blocks for smoothing
+			std::vector<typename block_traits<value_type>::inverse_type> vDiagInv;
+
+		///	correction, defect and residual
+			level_vector_type c, d, r;
+
+		#ifdef UG_PARALLEL
+		///	layouts of a distributed level (invalid on levels of one process)
+			ConstSmartPtr<AlgebraLayouts> spLayouts;
+
+		///	flags for indices in a slave interface and in any interface
+			std::vector<bool> vSlave, vInterface;
+		#endif
+		};
+
+	///	returns if the level is distributed over several processes
+		bool distributed(const Level& lev) const
+		{
+			#ifdef UG_PARALLEL
+			return lev.spLayouts.valid();
+			#else
+			return false;
+			#endif
+		}
+
+	///	returns if the index is a slave of a distributed level
+		bool is_slave(const Level& lev, size_t i) const
+		{
+			#ifdef UG_PARALLEL
+			return distributed(lev) && lev.vSlave[i];
+			#else
+			return false;
+			#endif
+		}
+
+	///	returns if the index lies on an interface of a distributed level
+		bool on_interface(const Level& lev, size_t i) const
+		{
+			#ifdef UG_PARALLEL
+			return distributed(lev) && lev.vInterface[i];
+			#else
+			return false;
+			#endif
+		}
+
+	///	returns the number of unknowns owned by this process
+		size_t num_owned(const Level& lev) const
+		{
+			size_t num = 0;
+			for(size_t i = 0; i < lev.A.num_rows(); ++i)
+				if(!is_slave(lev, i)) ++num;
+			return num;
+		}
+
+	///	changes an additive vector of the level to consistent
+		template <typename TVector>
+		void make_consistent(TVector& v, const Level& lev) const
+		{
+			#ifdef UG_PARALLEL
+			if(distributed(lev))
+				AdditiveToConsistent(&v, lev.spLayouts->master(),
+				                     lev.spLayouts->slave(), &lev.spLayouts->comm());
+			#endif
+		}
+
+	///	returns the euclidean norm of a consistent level vector
+		number norm(const level_vector_type& v, const Level& lev) const
+		{
+			if(!distributed(lev)) return v.norm();
+
+			number sum = 0.0;
+			for(size_t i = 0; i < v.size(); ++i)
+				if(!is_slave(lev, i)) sum += BlockNorm2(v[i]);
+			#ifdef UG_PARALLEL
+			sum = lev.spLayouts->proc_comm().allreduce(sum, PCL_RO_SUM);
+			#endif
+			return std::sqrt(sum);
+		}
+
+	///	builds the next coarser level, returns false if coarsening stagnates
+		bool create_coarse_level(Level& fine)
+		{
+			PROFILE_BEGIN_GROUP(SAAMG_coarsen, "algebra SAAMG");
+			const level_matrix_type& A = fine.A;
+			const size_t n = A.num_rows();
+
+		//	aggregation
+			std::vector<int> vAgg;
+			const size_t nAgg = aggregate(vAgg, fine);
+			size_t nCoarse = nAgg;
+
+			#ifdef UG_PARALLEL
+			SmartPtr<AlgebraLayouts> spCoarseLayouts;
+			if(distributed(fine))
+			{
+			//	stagnation is decided on all processes alike
+				const pcl::ProcessCommunicator& pc = fine.spLayouts->proc_comm();
+				const size_t nAggGlobal = pc.allreduce(nAgg, PCL_RO_SUM);
+				const size_t nGlobal = pc.allreduce(num_owned(fine), PCL_RO_SUM);
+				if(nAggGlobal == 0 || nAggGlobal >= 0.9 * nGlobal) return false;
+
+				spCoarseLayouts = make_sp(new AlgebraLayouts);
+				nCoarse = distribute_aggregates(vAgg, nAgg, fine, *spCoarseLayouts);
+			}
+			#endif
+			if(!distributed(fine) && (nAgg == 0 || nAgg >= 0.9 * n)) return false;
+
+		//	tentative prolongation
+			level_matrix_type P0;
+			P0.resize_and_clear(n, nCoarse);
+			for(size_t i = 0; i < n; ++i)
+			{
+				if(vAgg[i] < 0) continue;
+				value_type id = A(i, i);
+				id *= 0.0;
+				for(size_t alpha = 0; alpha < GetRows(id) && alpha < GetCols(id); ++alpha)
+					BlockRef(id, alpha, alpha) = 1.0;
+				P0(i, vAgg[i]) = id;
+			}
+			P0.defragment();
+
+		//	smoothed prolongation P = P0 - omega D^{-1} A P0
+			Level* pCoarse = new Level;
+			m_vLevel.push_back(SmartPtr<Level>(pCoarse));
+			smooth_prolongation(pCoarse->P, fine, P0);
+
+		//	restriction and Galerkin product (additive if distributed, since
+		//	the rows of P are the same on all copies)
+			pCoarse->R.set_as_transpose_of(pCoarse->P);
+			CreateAsMultiplyOf(pCoarse->A, pCoarse->R, A, pCoarse->P);
+			pCoarse->A.defragment();
+
+			#ifdef UG_PARALLEL
+			if(spCoarseLayouts.valid())
+			{
+				pCoarse->spLayouts = spCoarseLayouts;
+				init_interface_flags(*pCoarse);
+			}
+			#endif
+
+			return true;
+		}
+
+		#ifdef UG_PARALLEL
+	///	marks the slave and interface indices of a distributed level
+		void init_interface_flags(Level& lev) const
+		{
+			const AlgebraLayouts& layouts = *lev.spLayouts;
+			lev.vSlave.assign(lev.A.num_rows(), false);
+			lev.vInterface.assign(lev.A.num_rows(), false);
+
+			for(IndexLayout::const_iterator it = layouts.slave().begin();
+				it != layouts.slave().end(); ++it)
+			{
+				const IndexLayout::Interface& itf = layouts.slave().interface(it);
+				for(IndexLayout::Interface::const_iterator iit = itf.begin(); iit != itf.end(); ++iit)
+					lev.vSlave[itf.get_element(iit)] = lev.vInterface[itf.get_element(iit)] = true;
+			}
+			for(IndexLayout::const_iterator it = layouts.master().begin();
+				it != layouts.master().end(); ++it)
+			{
+				const IndexLayout::Interface& itf = layouts.master().interface(it);
+				for(IndexLayout::Interface::const_iterator iit = itf.begin(); iit != itf.end(); ++iit)
+					lev.vInterface[itf.get_element(iit)] = true;
+			}
+		}
+
+	///	assigns the slaves to the aggregates of their masters
+	/**
+	 * The own aggregates are numbered 0, ..., nAgg-1. An aggregate of a
+	 * neighbor process that contains a local slave gets a copy (slave) on
+	 * the coarse level, numbered after the own aggregates. The coarse
+	 * interfaces contain the aggregates sorted by their index on the master
+	 * process, so that both sides match. On return, vAgg holds the coarse
+	 * index of all unknowns.
+	 *
+	 * 
+eturns number of coarse unknowns on this process
+	 */
+		size_t distribute_aggregates(std::vector<int>& vAgg, size_t nAgg,
+		                             const Level& fine, AlgebraLayouts& coarseLayouts) const
+		{
+			const AlgebraLayouts& layouts = *fine.spLayouts;
+			const IndexLayout& master = layouts.master();
+			const IndexLayout& slave = layouts.slave();
+
+		//	the masters send the index of their aggregate, -1 if isolated
+			Vector<number> vAggIndex(vAgg.size());
+			for(size_t i = 0; i < vAgg.size(); ++i)
+				vAggIndex[i] = (vAgg[i] >= 0) ? vAgg[i] : -1;
+
+			ComPol_VecCopy<Vector<number> > cpCopy(&vAggIndex);
+			layouts.comm().send_data(master, cpCopy);
+			layouts.comm().receive_data(slave, cpCopy);
+			layouts.comm().communicate();
+
+			coarseLayouts.proc_comm() = layouts.proc_comm();
+
+		//	master interfaces: own aggregates containing an interface unknown
+			std::vector<size_t> vIndex;
+			for(IndexLayout::const_iterator it = master.begin(); it != master.end(); ++it)
+			{
+				const IndexLayout::Interface& itf = master.interface(it);
+				vIndex.clear();
+				for(IndexLayout::Interface::const_iterator iit = itf.begin(); iit != itf.end(); ++iit)
+					if(vAgg[itf.get_element(iit)] >= 0)
+						vIndex.push_back(vAgg[itf.get_element(iit)]);
+				if(vIndex.empty()) continue;
+
+				std::sort(vIndex.begin(), vIndex.end());
+				vIndex.erase(std::unique(vIndex.begin(), vIndex.end()), vIndex.end());
+
+				IndexLayout::Interface& coarseItf = coarseLayouts.master().interface(master.proc_id(it));
+				for(size_t k = 0; k < vIndex.size(); ++k)
+					coarseItf.push_back(vIndex[k]);
+			}
+
+		//	slave interfaces: copies of the aggregates of the master process
+			size_t nCoarse = nAgg;
+			std::map<int, size_t> mCopy;
+			for(IndexLayout::const_iterator it = slave.begin(); it != slave.end(); ++it)
+			{
+				const IndexLayout::Interface& itf = slave.interface(it);
+				mCopy.clear();
+				for(IndexLayout::Interface::const_iterator iit = itf.begin(); iit != itf.end(); ++iit)
+				{
+					const int agg = (int)vAggIndex[itf.get_element(iit)];
+					if(agg >= 0) mCopy[agg] = 0;
+				}
+				if(mCopy.empty()) continue;
+
+				IndexLayout::Interface& coarseItf = coarseLayouts.slave().interface(slave.proc_id(it));
+				for(std::map<int, size_t>::iterator mit = mCopy.begin(); mit != mCopy.end(); ++mit)
+				{
+					mit->second = nCoarse++;
+					coarseItf.push_back(mit->second);
+				}
+
+				for(IndexLayout::Interface::const_iterator iit = itf.begin(); iit != itf.end(); ++iit)
+				{
+					const size_t i = itf.get_element(iit);
+					const int agg = (int)vAggIndex[i];
+					vAgg[i] = (agg >= 0) ? (int)mCopy[agg] : -1;
+				}
+			}
+
+			return nCoarse;
+		}
+
+	///	coarsens in parallel, then gathers the last level on one process
+		void create_distributed_levels()
+		{
+			PROFILE_BEGIN_GROUP(SAAMG_distributed_levels, "algebra SAAMG");
+			const pcl::ProcessCommunicator pc = m_vLevel[0]->spLayouts->proc_comm();
+
+			while(m_vLevel.size() < m_maxLevels)
+			{
+				const size_t nGlobal = pc.allreduce(num_owned(*m_vLevel.back()), PCL_RO_SUM);
+				if(nGlobal <= m_agglomerationSize) break;
+				if(!create_coarse_level(*m_vLevel.back())) break;
+			}
+			m_numDistLevels = m_vLevel.size();
+
+			agglomerate(*m_vLevel.back());
+		}
+
+	///	gathers the level matrix on the first process of the communicator
+	/**
+	 * The first process appends the gathered matrix as a new level, its own
+	 * indices come first. The other processes end their hierarchy here.
+	 */
+		void agglomerate(const Level& lev)
+		{
+			PROFILE_BEGIN_GROUP(SAAMG_agglomerate, "algebra SAAMG");
+			const pcl::ProcessCommunicator& pc = lev.spLayouts->proc_comm();
+			m_bAggloRoot = (pcl::ProcRank() == pc.get_proc_id(0));
+
+			matrix_type A, collectedA;
+			static_cast<level_matrix_type&>(A) = lev.A;
+			A.set_layouts(lev.spLayouts);
+			A.set_storage_type(PST_ADDITIVE);
+			CollectMatrixOnOneProc(A, collectedA, m_aggloMaster, m_aggloSlave);
+
+			if(!m_bAggloRoot) return;
+			m_vLevel.push_back(SmartPtr<Level>(new Level));
+			m_vLevel.back()->A = collectedA;
+			m_vLevel.back()->A.defragment();
+		}
+
+	///	gathers the defect, cycles the agglomerated levels and distributes the correction
+		void agglomerated_cycle(Level& lev)
+		{
+			PROFILE_BEGIN_GROUP(SAAMG_agglomerated_cycle, "algebra SAAMG");
+			pcl::InterfaceCommunicator<IndexLayout>& com = lev.spLayouts->comm();
+
+			if(m_bAggloRoot)
+			{
+				Level& collected = *m_vLevel[m_numDistLevels];
+				collected.d.set(0.0);
+				for(size_t i = 0; i < lev.d.size(); ++i)
+					collected.d[i] = lev.d[i];
+
+				ComPol_VecAdd<level_vector_type> cpAdd(&collected.d);
+				com.receive_data(m_aggloMaster, cpAdd);
+				com.communicate();
+
+				cycle(m_numDistLevels);
+
+				for(size_t i = 0; i < lev.c.size(); ++i)
+					lev.c[i] = collected.c[i];
+
+				ComPol_VecCopy<level_vector_type> cpCopy(&collected.c);
+				com.send_data(m_aggloMaster, cpCopy);
+				com.communicate();
+			}
+			else
+			{
+				ComPol_VecAdd<level_vector_type> cpAdd(&lev.d);
+				com.send_data(m_aggloSlave, cpAdd);
+				com.communicate();
+
+				ComPol_VecCopy<level_vector_type> cpCopy(&lev.c);
+				com.receive_data(m_aggloSlave, cpCopy);
+				com.communicate();
+			}
+		}
+		#endif
+
+	///	strength of connection for off-diagonal entry
+		bool strong(const std::vector<number>& vDiagNorm,
+		            size_t i, size_t j, const value_type& aij) const
+		{
+			if(i == j) return false;
+			return BlockNorm(aij) >= m_theta * std::sqrt(vDiagNorm[i] * vDiagNorm[j]);
+		}
+
+	///	aggregation of strongly coupled unknowns (three phases)
+	/**	On distributed levels only the own unknowns are aggregated, the
+	 * slaves are left to the aggregates of their masters.*/
+		size_t aggregate(std::vector<int>& vAgg, const Level& lev) const
+		{
+			typedef typename level_matrix_type::const_row_iterator const_row_iterator;
+			const level_matrix_type& A = lev.A;
+			const size_t n = A.num_rows();
+			const int unaggregated = -1, isolated = -2, foreign = -3;
+
+			std::vector<number> vDiagNorm(n, 0.0);
+			for(size_t i = 0; i < n; ++i)
+				vDiagNorm[i] = BlockNorm(A(i, i));
+
+		//	unknowns without strong couplings are not aggregated
+			vAgg.assign(n, unaggregated);
+			for(size_t i = 0; i < n; ++i)
+			{
+				if(is_slave(lev, i)) {vAgg[i] = foreign; continue;}
+
+				bool bStrong = false;
+				for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+					if(strong(vDiagNorm, i, it.index(), it.value())) {bStrong = true; break;}
+				if(!bStrong) vAgg[i] = isolated;
+			}
+
+		//	phase 1: unknowns whose strong neighbors are all free form an aggregate
+			int numAgg = 0;
+			for(size_t i = 0; i < n; ++i)
+			{
+				if(vAgg[i] != unaggregated) continue;
+
+				bool bFree = true;
+				for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+					if(strong(vDiagNorm, i, it.index(), it.value())
+						&& vAgg[it.index()] >= 0) {bFree = false; break;}
+				if(!bFree) continue;
+
+				vAgg[i] = numAgg;
+				for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+					if(strong(vDiagNorm, i, it.index(), it.value())
+						&& vAgg[it.index()] == unaggregated)
+						vAgg[it.index()] = numAgg;
+				++numAgg;
+			}
+
+		//	phase 2: join the aggregate of the strongest aggregated neighbor
+			std::vector<int> vAggPhase1 = vAgg;
+			for(size_t i = 0; i < n; ++i)
+			{
+				if(vAgg[i] != unaggregated) continue;
+
+				number maxStrength = 0.0;
+				for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+				{
+					const size_t j = it.index();
+					if(!strong(vDiagNorm, i, j, it.value()) || vAggPhase1[j] < 0) continue;
+					const number s = BlockNorm(it.value());
+					if(s > maxStrength) {maxStrength = s; vAgg[i] = vAggPhase1[j];}
+				}
+			}
+
+		//	phase 3: remaining unknowns form aggregates with free strong neighbors
+			for(size_t i = 0; i < n; ++i)
+			{
+				if(vAgg[i] != unaggregated) continue;
+
+				vAgg[i] = numAgg;
+				for(const_row_iterator it = A.begin_row(i); it != A.end_row(i); ++it)
+					if(strong(vDiagNorm, i, it.index(), it.value())
+						&& vAgg[it.index()] == unaggregated)
+						vAgg[it.index()] = numAgg;
+				++numAgg;
+			}
+
+			return numAgg;
+		}
+
+	///	returns the inverse of the (consistent) pointwise diagonal of the matrix
+		void pointwise_diagonal(level_vector_type& diag, const Level& lev) const
+		{
+			const level_matrix_type& A = lev.A;
+			diag.resize(A.num_rows());
+			for(size_t i = 0; i < A.num_rows(); ++i)
+			{
+				const value_type& aii = A(i, i);
+				for(size_t alpha = 0; alpha < GetSize(diag[i]); ++alpha)
+				{
+					number val = 0.0;
+					if(alpha < GetRows(aii) && alpha < GetCols(aii))
+						val = BlockRef(aii, alpha, alpha);
+					BlockRef(diag[i], alpha) = val;
+				}
+			}
+			make_consistent(diag, lev);
+
+			for(size_t i = 0; i < diag.size(); ++i)
+				for(size_t alpha = 0; alpha < GetSize(diag[i]); ++alpha)
+				{
+					const number val = BlockRef(diag[i], alpha);
+					BlockRef(diag[i], alpha) = (val != 0.0) ? 1.0 / val : 0.0;
+				}
+		}
+
+	///	estimates the largest eigenvalue of D^{-1} A by the power method
+		number estimate_max_eigenvalue(const Level& lev,
+		                               const level_vector_type& diagInv) const
+		{
+			const level_matrix_type& A = lev.A;
+			level_vector_type x(A.num_rows()), y(A.num_rows());
+			for(size_t i = 0; i < x.size(); ++i)
+				for(size_t alpha = 0; alpha < GetSize(x[i]); ++alpha)
+					BlockRef(x[i], alpha) = 1.0 + 0.1 * ((i * 7 + alpha * 3) % 11);
+
+		//	the start vector has to be consistent
+			#ifdef UG_PARALLEL
+			if(distributed(lev))
+			{
+				ComPol_VecCopy<level_vector_type> cpCopy(&x);
+				lev.spLayouts->comm().send_data(lev.spLayouts->master(), cpCopy);
+				lev.spLayouts->comm().receive_data(lev.spLayouts->slave(), cpCopy);
+				lev.spLayouts->comm().communicate();
+			}
+			#endif
+
+			number lambda = 0.0;
+			for(size_t k = 0; k < m_numPowerIt; ++k)
+			{
+				const number normX = norm(x, lev);
+				if(normX == 0.0) break;
+
+				A.apply(y, x);
+				make_consistent(y, lev);
+				for(size_t i = 0; i < y.size(); ++i)
+					for(size_t alpha = 0; alpha < GetSize(y[i]); ++alpha)
+						BlockRef(x[i], alpha) = BlockRef(diagInv[i], alpha)
+												* BlockRef(y[i], alpha) / normX;
+				lambda = norm(x, lev);
+			}
+			return lambda;
+		}
+
+	///	computes P = P0 - omega D^{-1} A P0
+	/**	On distributed levels, the rows on the process interfaces keep P0,
+	 * since the local matrix rows are incomplete there.*/
+		void smooth_prolongation(level_matrix_type& P, const Level& fine,
+		                         const level_matrix_type& P0) const
+		{
+			typedef typename level_matrix_type::row_iterator row_iterator;
+			typedef typename level_matrix_type::const_row_iterator const_row_iterator;
+
+			level_vector_type diagInv;
+			pointwise_diagonal(diagInv, fine);
+			const number rho = estimate_max_eigenvalue(fine, diagInv);
+			const number omega = (rho > 0.0) ? 4.0 / (3.0 * rho) : 0.0;
+
+		//	matrix rows used for smoothing
+			const level_matrix_type* pA = &fine.A;
+			level_matrix_type AInner;
+			if(distributed(fine))
+			{
+				AInner.resize_and_clear(fine.A.num_rows(), fine.A.num_cols());
+				for(size_t i = 0; i < fine.A.num_rows(); ++i)
+				{
+					if(on_interface(fine, i)) continue;
+					for(const_row_iterator it = fine.A.begin_row(i); it != fine.A.end_row(i); ++it)
+						AInner(i, it.index()) = it.value();
+				}
+				AInner.defragment();
+				pA = &AInner;
+			}
+
+		//	P = A P0, rows scaled by -omega D^{-1}
+			CreateAsMultiplyOf(P, *pA, P0);
+			for(size_t i = 0; i < P.num_rows(); ++i)
+				for(row_iterator it = P.begin_row(i); it != P.end_row(i); ++it)
+				{
+					value_type& pij = it.value();
+					for(size_t alpha = 0; alpha < GetRows(pij); ++alpha)
+						for(size_t beta = 0; beta < GetCols(pij); ++beta)
+							BlockRef(pij, alpha, beta) *= -omega * BlockRef(diagInv[i], alpha);
+				}
+
+		//	P += P0
+			MatAdd(P, 1.0, P, 1.0, P0);
+			P.defragment();
+		}
+
+	///	initializes smoother and vectors of a level
+		void init_level(Level& lev)
+		{
+			const level_matrix_type& A = lev.A;
+			const size_t n = A.num_rows();
+
+		//	diagonal blocks, consistent on distributed levels
+			Vector<value_type> vDiag(n);
+			for(size_t i = 0; i < n; ++i)
+				vDiag[i] = A(i, i);
+			make_consistent(vDiag, lev);
+
+			lev.vDiagInv.resize(n);
+			for(size_t i = 0; i < n; ++i)
+			{
+				value_type d = vDiag[i];
+				d *= 1./m_smoothDamp;
+				GetInverse(lev.vDiagInv[i], d);
+			}
+
+			lev.c.resize(n); lev.d.resize(n); lev.r.resize(n);
+		}
+
+	///	damped jacobi step c += D^{-1} (d - A c)
+	/**	On distributed levels d is additive and c consistent.*/
+		void smooth(Level& lev)
+		{
+			lev.A.axpy(lev.r, 1.0, lev.d, -1.0, lev.c);
+			make_consistent(lev.r, lev);
+			vec_value_type tmp;
+			for(size_t i = 0; i < lev.c.size(); ++i)
+			{
+				tmp = lev.r[i];
+				MatMult(tmp, 1.0, lev.vDiagInv[i], lev.r[i]);
+				lev.c[i] += tmp;
+			}
+		}
+
+	///	multigrid cycle on level lev for defect lev.d
+		void cycle(size_t l)
+		{
+			Level& lev = *m_vLevel[l];
+
+		//	last distributed level: continue on one process
+			#ifdef UG_PARALLEL
+			if(l+1 == m_numDistLevels)
+			{
+				agglomerated_cycle(lev);
+				return;
+			}
+			#endif
+
+		//	coarsest level: direct solve
+			if(l+1 == m_vLevel.size())
+			{
+				PROFILE_BEGIN_GROUP(SAAMG_coarse_solve, "algebra SAAMG");
+				m_coarseTmp.resize(GetDoubleSize(lev.A));
+				for(size_t i = 0, k = 0; i < lev.d.size(); ++i)
+					for(size_t j = 0; j < GetSize(lev.d[i]); ++j)
+						m_coarseTmp[k++] = BlockRef(lev.d[i], j);
+				m_coarseInv.apply(m_coarseTmp);
+				for(size_t i = 0, k = 0; i < lev.c.size(); ++i)
+					for(size_t j = 0; j < GetSize(lev.c[i]); ++j)
+						BlockRef(lev.c[i], j) = m_coarseTmp[k++];
+				return;
+			}
+
+			Level& coarse = *m_vLevel[l+1];
+
+			lev.c.set(0.0);
+			for(size_t nu = 0; nu < m_numPreSmooth; ++nu) smooth(lev);
+
+			for(int k = 0; k < m_cycleType; ++k)
+			{
+			//	restrict residual and correct (the coarse defect is additive
+			//	and the coarse correction consistent if distributed)
+				lev.A.axpy(lev.r, 1.0, lev.d, -1.0, lev.c);
+				coarse.R.apply(coarse.d, lev.r);
+				cycle(l+1);
+				coarse.P.axpy(lev.c, 1.0, lev.c, 1.0, coarse.c);
+			}
+
+			for(size_t nu = 0; nu < m_numPostSmooth; ++nu) smooth(lev);
+		}
+
+	///	computes the size of the levels, operator and grid complexity
+	/**	Unknowns are counted once, nonzeros are summed over the processes.
+	 * The agglomerated copy of the last distributed level is not counted.*/
+		void compute_statistics()
+		{
+			const size_t numCopies = (m_numDistLevels > 0) ? 1 : 0;
+			size_t numLevels = m_numDistLevels;
+			if(m_vLevel.size() > m_numDistLevels)
+				numLevels = m_vLevel.size() - numCopies;
+
+			#ifdef UG_PARALLEL
+			const pcl::ProcessCommunicator pc = (m_numDistLevels > 0)
+				? m_vLevel[0]->spLayouts->proc_comm() : pcl::ProcessCommunicator();
+			if(m_numDistLevels > 0)
+				numLevels = pc.allreduce(numLevels, PCL_RO_MAX);
+			#endif
+
+			std::vector<number> vRows(numLevels, 0.0), vNNZ(numLevels, 0.0);
+			for(size_t l = 0; l < numLevels; ++l)
+			{
+				const size_t lev = (l < m_numDistLevels) ? l : l + numCopies;
+				if(lev >= m_vLevel.size()) continue;
+				vRows[l] = num_owned(*m_vLevel[lev]);
+				vNNZ[l] = m_vLevel[lev]->A.total_num_connections();
+			}
+
+			m_vLevelRows = vRows;
+			m_vLevelNNZ = vNNZ;
+			#ifdef UG_PARALLEL
+			if(m_numDistLevels > 0)
+			{
+				pc.allreduce(vRows, m_vLevelRows, PCL_RO_SUM);
+				pc.allreduce(vNNZ, m_vLevelNNZ, PCL_RO_SUM);
+			}
+			#endif
+
+			number nnz = 0.0, rows = 0.0;
+			for(size_t l = 0; l < numLevels; ++l)
+			{
+				nnz += m_vLevelNNZ[l];
+				rows += m_vLevelRows[l];
+			}
+			m_operatorComplexity = (m_vLevelNNZ[0] > 0) ? nnz / m_vLevelNNZ[0] : 0.0;
+			m_gridComplexity = (m_vLevelRows[0] > 0) ? rows / m_vLevelRows[0] : 0.0;
+		}
+
+	///	prints the hierarchy
+		void print_info() const
+		{
+			UG_LOG("SmoothedAggregationAMG: " << m_vLevelRows.size() << " levels\n");
+			for(size_t lev = 0; lev < m_vLevelRows.size(); ++lev)
+			{
+				UG_LOG("  Level " << lev << ": " << (size_t)m_vLevelRows[lev]
+						<< " unknowns, " << (size_t)m_vLevelNNZ[lev] << " nonzeros");
+				if(lev+1 == m_numDistLevels) UG_LOG(" (agglomerated)");
+				UG_LOG("\n");
+			}
+			UG_LOG("  Operator complexity: " << m_operatorComplexity
+					<< ", grid complexity: " << m_gridComplexity << "\n");
+		}
+
+	protected:
+	///	strength threshold
+		number m_theta;
+
+	///	maximal number of levels, size of coarsest level
+		size_t m_maxLevels;
+		size_t m_maxCoarseSize;
+
+	///	smoothing parameters
+		size_t m_numPreSmooth, m_numPostSmooth;
+		number m_smoothDamp;
+
+	///	cycle type
+		int m_cycleType;
+
+	///	number of power iterations for the prolongation smoother
+		size_t m_numPowerIt;
+
+	///	global size below which a distributed level is gathered on one process
+		size_t m_agglomerationSize;
+
+	///	flag if info is printed
+		bool m_bInfo;
+
+	///	complexities of the hierarchy
+		number m_operatorComplexity, m_gridComplexity;
+
+	///	global number of unknowns and nonzeros per level
+		std::vector<number> m_vLevelRows, m_vLevelNNZ;
+
+	///	levels (finest is 0)
+		std::vector<SmartPtr<Level> > m_vLevel;
+
+	///	number of distributed levels (0 if the hierarchy is built on one process)
+		size_t m_numDistLevels;
+
+		#ifdef UG_PARALLEL
+	///	layouts between the last distributed level and its agglomerated copy
+		IndexLayout m_aggloMaster, m_aggloSlave;
+
+	///	flag if this process holds the agglomerated levels
+		bool m_bAggloRoot;
+		#endif
+
+	///	dense inverse of the coarsest level
+		DenseMatrixInverse<DenseMatrix<VariableArray2<double> > > m_coarseInv;
+		DenseVector<VariableArray1<double> > m_coarseTmp;
+};
+
+} // end namespace ug
+
+#endif /* __H__LIB_ALGEBRA__OPERATOR__PRECONDITIONER__SMOOTHED_AGGREGATION_AMG__ */
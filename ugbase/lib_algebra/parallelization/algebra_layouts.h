@@ -36,6 +36,7 @@
 #ifdef UG_PARALLEL
 #include "pcl/pcl_base.h"
 #include "lib_algebra/parallelization/parallel_index_layout.h"
+#include "pcl/pcl_interface_communication_plan.h"
 #endif
 
 namespace ug{
@@ -47,14 +48,28 @@ namespace ug{
 class HorizontalAlgebraLayouts
 {
 	public:
-		HorizontalAlgebraLayouts() : m_overlapEnabled(false) 	{}
+		HorizontalAlgebraLayouts() :
+			slaveToMasterPlan(749346),
+			masterToSlavePlan(749347),
+			m_overlapEnabled(false),
+			m_commPlansEnabled(false),
+			m_revision(next_revision())
+		{}
 
 	///	clears the struct
 		void clear()
 		{
 			masterLayout.clear();			slaveLayout.clear();
+			changed();
 		}
 
+	///	returns the revision of the layouts
+	/**	The revision changes whenever the layouts are cleared or accessed
+	 * non-const, since they may be modified then. It is unique among all
+	 * layouts objects, thus caches computed for some layouts only have to
+	 * store the revision to detect that they are outdated.*/
+		size_t revision() const		{return m_revision;}
+
 	public:
 	/// returns the horizontal slave/master index layout
 	/// \{
@@ -77,19 +92,45 @@ class HorizontalAlgebraLayouts
 	 */
 		pcl::InterfaceCommunicator<IndexLayout>& comm() const  	{return const_cast<HorizontalAlgebraLayouts*>(this)->communicator;}
 
+	///	returns (non-const !!!) plans for repeated exchanges between master and slave layouts
+	/**	The plans cache neighbor processes and buffer sizes of the exchanges
+	 * from the slave to the master layout and vice versa, and reuse persistent
+	 * requests. They are non-const for the same reason as comm().
+	 * \sa pcl::InterfaceCommunicationPlan
+	 * \{ */
+		pcl::InterfaceCommunicationPlan<IndexLayout>& slave_to_master_plan() const
+			{return const_cast<HorizontalAlgebraLayouts*>(this)->slaveToMasterPlan;}
+		pcl::InterfaceCommunicationPlan<IndexLayout>& master_to_slave_plan() const
+			{return const_cast<HorizontalAlgebraLayouts*>(this)->masterToSlavePlan;}
+	/** \} */
+
+	/**	Communication plans are disabled by default, since they hold persistent
+	 * requests and buffers for each layout. As for overlap, they have to be
+	 * enabled or disabled on all involved processes at the same time.*/
+		void enable_communication_plans(bool enable)
+		{
+			m_commPlansEnabled = enable;
+			if(!enable){
+				slaveToMasterPlan.clear();
+				masterToSlavePlan.clear();
+			}
+		}
+	///	Tells whether the master/slave exchanges shall use communication plans
+		bool communication_plans_enabled() const	{return m_commPlansEnabled;}
+
 	/**	It is important to enable or disable overlap on all involved processes
 	 * at the same time. Otherwise communication issues may arise.*/
-		void enable_overlap(bool enable)	{m_overlapEnabled = enable;}
+		void enable_overlap(bool enable)	{m_overlapEnabled = enable; changed();}
 	///	Tells whether overlap interfaces should be considered
 		bool overlap_enabled() const		{return m_overlapEnabled;}
 
 	public:
 	/// returns the horizontal slave/master index layout
 	/// \{
-		IndexLayout& master()			{return masterLayout;}
-		IndexLayout& master_overlap() 	{return masterOverlapLayout;}
-		IndexLayout& slave()			{return slaveLayout;}
-		IndexLayout& slave_overlap() 	{return slaveOverlapLayout;}
+		IndexLayout& master()			{changed(); return masterLayout;}
+		IndexLayout& master_overlap() 	{changed(); return masterOverlapLayout;}
+		IndexLayout& slave()			{changed(); return slaveLayout;}
+		IndexLayout& slave_overlap() 	{changed(); return slaveOverlapLayout;}
 	/// \}
 
 	///	returns communicator
@@ -98,6 +139,17 @@ class HorizontalAlgebraLayouts
 		pcl::ProcessCommunicator& proc_comm()				{return processCommunicator;}
 	/// \}
 
+	protected:
+	///	assigns a new revision
+		void changed()	{m_revision = next_revision();}
+
+	///	returns a revision not used before
+		static size_t next_revision()
+		{
+			static size_t s_revision = 0;
+			return ++s_revision;
+		}
+
 	protected:
 		///	(horizontal) master index layout
 		IndexLayout masterLayout;
@@ -113,7 +165,15 @@ class HorizontalAlgebraLayouts
 		///	communicator
 		pcl::InterfaceCommunicator<IndexLayout> communicator;
 
+		///	plans for the exchange from slaves to masters and vice versa
+		pcl::InterfaceCommunicationPlan<IndexLayout> slaveToMasterPlan;
+		pcl::InterfaceCommunicationPlan<IndexLayout> masterToSlavePlan;
+
 		bool m_overlapEnabled;
+		bool m_commPlansEnabled;
+
+		///	revision of the layouts
+		size_t m_revision;
 };
 
 ///	Extends the HorizontalAlgebraLayouts by vertical layouts.
@@ -137,8 +197,8 @@ class AlgebraLayouts : public HorizontalAlgebraLayouts
 	public:
 	/// returns the vertical slave/master index layout
 	/// \{
-		IndexLayout& vertical_master() 		{return verticalMasterLayout;}
-		IndexLayout& vertical_slave()  		{return verticalSlaveLayout;}
+		IndexLayout& vertical_master() 		{changed(); return verticalMasterLayout;}
+		IndexLayout& vertical_slave()  		{changed(); return verticalSlaveLayout;}
 	/// \}
 
 	protected:
@@ -36,6 +36,7 @@
 #include "parallel_nodes.h"
 #include "serialize_interfaces.h"
 #include "common/debug_print.h"
+#include "lib_algebra/common/stl_debug.h"
 
 namespace ug{
 
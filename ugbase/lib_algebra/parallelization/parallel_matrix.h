@@ -125,26 +125,70 @@ class ParallelMatrix : public TMatrix
 		/////////////////////////
 
 	/// calculate res = A x
+	/**
+	 * Besides the combinations of storage types for which no communication
+	 * is needed, an additive matrix may be applied to an additive (or unique)
+	 * vector x. In that case a consistent copy of x is used, x is unchanged.
+	 */
 		template<typename TPVector>
 		bool apply(TPVector &res, const TPVector &x) const;
 
+	/// calculate res = A x, changing an additive x to consistent
+	/**
+	 * As apply(), but if the matrix and x are additive (or x is unique), x is
+	 * made consistent in place while the rows not coupled to the interface
+	 * entries of x are computed. x is consistent after the call then.
+	 */
+		template<typename TPVector>
+		bool apply_making_consistent(TPVector &res, TPVector &x) const;
+
 	/// calculate res = A.T x
 		template<typename TPVector>
 		bool apply_transposed(TPVector &res, const TPVector &x) const;
 
 	/// calculate res -= A x
+	/**	As for apply(), x may be additive if the matrix is additive. A
+	 * 	consistent copy of x is used then.*/
 		template<typename TPVector>
 		bool matmul_minus(TPVector &res, const TPVector &x) const;
 
 	///	assignment
 		this_type &operator =(const this_type &M);
 
+	protected:
+	///	res = alpha*res + beta*A*x for additive x, overlapping the change of x to consistent
+		template<typename TPVector>
+		void axpy_overlapped(TPVector &res, number alpha, number beta, TPVector &x) const;
+
+	///	rows of the matrix split by whether they couple to interface entries of a vector
+		struct RowSplit
+		{
+			RowSplit() : layoutsRevision(0), patternRevision(0), numRows(0),
+						 bValid(false) {}
+
+			size_t layoutsRevision;
+			size_t patternRevision;
+			size_t numRows;
+			bool bValid;
+
+			std::vector<size_t> vInteriorRow;	///< rows without interface coupling
+			std::vector<size_t> vCoupledRow;	///< rows coupling to interface entries
+		};
+
+	///	returns the row split for vectors of size vecSize with the given layouts
+	/**	The split is cached and only recomputed if the sparsity pattern or
+	 * 	the revision of the layouts changed.*/
+		const RowSplit& row_split(const AlgebraLayouts& layouts, size_t vecSize) const;
+
 	private:
 	/// type of storage  (i.e. consistent, additiv, additiv unique)
 		uint m_type;
 
 	/// algebra layouts and communicators
 		ConstSmartPtr<AlgebraLayouts> m_spAlgebraLayouts;
+
+	///	cached row split used by axpy_overlapped
+		mutable RowSplit m_rowSplit;
 };
 
 //	predaclaration.
@@ -48,6 +48,7 @@ ParallelMatrix<TMatrix>::operator =(const typename ParallelMatrix<TMatrix>::this
 //	copy storage type and layouts
 	this->set_storage_type(M.get_storage_mask());
 	this->set_layouts(M.layouts());
+	m_rowSplit = RowSplit();
 
 //	we're done
 	return *this;
@@ -91,19 +92,22 @@ apply(TPVector &res, const TPVector &x) const
 			&& x.has_storage_type(PST_ADDITIVE)) type = 1;
 	if(has_storage_type(PST_CONSISTENT)
 			&& x.has_storage_type(PST_CONSISTENT)) type = 2;
+	if(type == -1 && has_storage_type(PST_ADDITIVE)
+			&& x.has_storage_type(PST_ADDITIVE)) type = 3;
 
 //	if no admissible type is found, return error
 	if(type == -1)
 	{
 		UG_THROW("ParallelMatrix::apply (b = A*x): "
 				"Wrong storage type of Matrix/Vector: Possibilities are:\n"
-				"    - A is PST_ADDITIVE and x is PST_CONSISTENT\n"
+				"    - A is PST_ADDITIVE and x is PST_CONSISTENT or PST_ADDITIVE\n"
 				"    - A is PST_CONSISTENT and x is PST_ADDITIVE\n"
 				"    (storage type of A = " << get_storage_type() << ", x = " << x.get_storage_type() << ")");
 	}
 
 //	apply on single process vector
-	TMatrix::axpy(res, 0.0, res, 1.0, x);
+	if(type == 3) axpy_overlapped(res, 0.0, 1.0, *x.clone());
+	else TMatrix::axpy(res, 0.0, res, 1.0, x);
 
 //	set outgoing vector to additive storage
 	switch(type)
@@ -111,12 +115,122 @@ apply(TPVector &res, const TPVector &x) const
 		case 0: res.set_storage_type(PST_ADDITIVE); break;
 		case 1: res.set_storage_type(PST_ADDITIVE); break;
 		case 2: res.set_storage_type(PST_CONSISTENT); break;
+		case 3: res.set_storage_type(PST_ADDITIVE); break;
 	}
 
 //	we're done.
 	return true;
 }
 
+// calculate res = A x, x is made consistent if additive
+template <typename TMatrix>
+template<typename TPVector>
+bool
+ParallelMatrix<TMatrix>::
+apply_making_consistent(TPVector &res, TPVector &x) const
+{
+//	only the combination that needs communication is handled here
+	if(!has_storage_type(PST_ADDITIVE) || has_storage_type(PST_CONSISTENT)
+		|| !x.has_storage_type(PST_ADDITIVE) || x.has_storage_type(PST_CONSISTENT))
+		return apply(res, x);
+
+	PROFILE_FUNC_GROUP("algebra");
+	axpy_overlapped(res, 0.0, 1.0, x);
+	res.set_storage_type(PST_ADDITIVE);
+	return true;
+}
+
+template <typename TMatrix>
+const typename ParallelMatrix<TMatrix>::RowSplit&
+ParallelMatrix<TMatrix>::
+row_split(const AlgebraLayouts& layouts, size_t vecSize) const
+{
+	RowSplit& split = m_rowSplit;
+	if(split.bValid && split.layoutsRevision == layouts.revision()
+		&& split.patternRevision == this->pattern_revision()
+		&& split.numRows == this->num_rows())
+		return split;
+
+	PROFILE_FUNC_GROUP("algebra parallelization");
+
+//	mark the entries of x that change when made consistent, all others
+//	already have their consistent value
+	std::vector<char> vInterface(vecSize, 0);
+	MarkAllFromLayout<char>(vInterface, layouts.master(), 1);
+	MarkAllFromLayout<char>(vInterface, layouts.slave(), 1);
+	if(layouts.overlap_enabled()){
+		MarkAllFromLayout<char>(vInterface, layouts.master_overlap(), 1);
+		MarkAllFromLayout<char>(vInterface, layouts.slave_overlap(), 1);
+	}
+
+	const size_t numRows = this->num_rows();
+	split.vInteriorRow.clear();
+	split.vCoupledRow.clear();
+	for(size_t i = 0; i < numRows; ++i)
+	{
+		bool bCoupled = false;
+		for(typename TMatrix::const_row_iterator conn = this->begin_row(i);
+				conn != this->end_row(i); ++conn)
+			if(vInterface[conn.index()]) {bCoupled = true; break;}
+
+		if(bCoupled) split.vCoupledRow.push_back(i);
+		else split.vInteriorRow.push_back(i);
+	}
+
+	split.layoutsRevision = layouts.revision();
+	split.patternRevision = this->pattern_revision();
+	split.numRows = numRows;
+	split.bValid = true;
+	return split;
+}
+
+// calculate res = alpha*res + beta*A*x, while x is made consistent
+template <typename TMatrix>
+template<typename TPVector>
+void
+ParallelMatrix<TMatrix>::
+axpy_overlapped(TPVector &res, number alpha, number beta, TPVector &x) const
+{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+
+	if(x.layouts().invalid())
+		UG_THROW("ParallelMatrix::apply: No layouts given for the vector.");
+	const AlgebraLayouts& layouts = *x.layouts();
+	UG_COND_THROW(x.size() < this->num_cols(),
+			"ParallelMatrix::apply: Vector size " << x.size() << " smaller "
+			"than number of columns " << this->num_cols() << ".");
+
+	const RowSplit& split = row_split(layouts, x.size());
+
+//	start the exchange of the interface values
+	SplitToConsistent<TPVector> exchange(&x, x.has_storage_type(PST_UNIQUE),
+	                                     layouts);
+	exchange.start();
+
+//	compute the rows not coupled to the interface while messages are in flight
+	for(size_t k = 0; k < split.vInteriorRow.size(); ++k)
+	{
+		const size_t i = split.vInteriorRow[k];
+		if(alpha == 0.0) res[i] = 0.0; else res[i] *= alpha;
+		TMatrix::mat_mult_add_row(i, res[i], beta, x);
+	}
+
+//	complete the exchange
+	exchange.finish();
+	if(layouts.overlap_enabled())
+		CopyValues(&x, layouts.slave_overlap(), layouts.master_overlap(),
+		           &layouts.comm());
+	x.set_storage_type(PST_CONSISTENT);
+
+//	compute the remaining rows
+	for(size_t k = 0; k < split.vCoupledRow.size(); ++k)
+	{
+		const size_t i = split.vCoupledRow[k];
+		if(alpha == 0.0) res[i] = 0.0; else res[i] *= alpha;
+		TMatrix::mat_mult_add_row(i, res[i], beta, x);
+	}
+}
+
 // calculate res = A.T x
 template <typename TMatrix>
 template<typename TPVector>
@@ -172,24 +286,29 @@ matmul_minus(TPVector &res, const TPVector &x) const
 	if(this->has_storage_type(PST_ADDITIVE)
 			&& x.has_storage_type(PST_CONSISTENT)
 			&& res.has_storage_type(PST_ADDITIVE)) type = 0;
+	if(type == -1 && this->has_storage_type(PST_ADDITIVE)
+			&& x.has_storage_type(PST_ADDITIVE)
+			&& res.has_storage_type(PST_ADDITIVE)) type = 1;
 
 //	if no admissible type is found, return error
 	if(type == -1)
 	{
 		UG_THROW("ParallelMatrix::matmul_minus (b -= A*x):"
 				" Wrong storage type of Matrix/Vector: Possibilities are:\n"
-				"    - A is PST_ADDITIVE and x is PST_CONSISTENT and b is PST_ADDITIVE\n"
+				"    - A is PST_ADDITIVE and x is PST_CONSISTENT or PST_ADDITIVE and b is PST_ADDITIVE\n"
 				"    (storage type of A = " << this->get_storage_type() << ", x = " << x.get_storage_type() << ", b = " << res.get_storage_type() << ")");
 	}
 
 //	apply on single process vector
-	TMatrix::axpy(res, 1.0, res, -1.0, x);
+	if(type == 1) axpy_overlapped(res, 1.0, -1.0, *x.clone());
+	else TMatrix::axpy(res, 1.0, res, -1.0, x);
 
 //	set outgoing vector to additive storage
 //	(it could have been PST_UNIQUE before)
 	switch(type)
 	{
 		case 0: res.set_storage_type(PST_ADDITIVE); break;
+		case 1: res.set_storage_type(PST_ADDITIVE); break;
 	}
 
 //	we're done.
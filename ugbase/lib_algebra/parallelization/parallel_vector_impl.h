@@ -138,15 +138,13 @@ change_storage_type(ParallelStorageType type)
 		case PST_CONSISTENT:
 			if(has_storage_type(PST_UNIQUE)){
 				PARVEC_PROFILE_BEGIN(ParVec_CSTUnique2Consistent);
-				UniqueToConsistent(this, layouts()->master(), layouts()->slave(),
-				                   &layouts()->comm());
+				UniqueToConsistent(this, *layouts());
 				set_storage_type(PST_CONSISTENT);
 				PARVEC_PROFILE_END(); //ParVec_CSTUnique2Consistent
 			}
 			else if(has_storage_type(PST_ADDITIVE)){
 				PARVEC_PROFILE_BEGIN(ParVec_CSTAdditive2Consistent);
-				AdditiveToConsistent(this, layouts()->master(), layouts()->slave(),
-				                     &layouts()->comm());
+				AdditiveToConsistent(this, *layouts());
 				set_storage_type(PST_CONSISTENT);
 				PARVEC_PROFILE_END(); //ParVec_CSTAdditive2Consistent
 			}
@@ -182,15 +180,13 @@ change_storage_type(ParallelStorageType type)
 			if(has_storage_type(PST_ADDITIVE)){
 				PARVEC_PROFILE_BEGIN(ParVec_CSTAdditive2Unique);
 				if(layouts()->overlap_enabled()){
-					AdditiveToConsistent(this, layouts()->master(), layouts()->slave(),
-				                     	 &layouts()->comm());
+					AdditiveToConsistent(this, *layouts());
 					CopyValues(this, layouts()->slave_overlap(),
 				           	   layouts()->master_overlap(), &layouts()->comm());
 					ConsistentToUnique(this, layouts()->slave());
 				}
 				else{
-					AdditiveToUnique(this, layouts()->master(), layouts()->slave(),
-					                 &layouts()->comm());
+					AdditiveToUnique(this, *layouts());
 				}
 				add_storage_type(PST_UNIQUE);
 				PARVEC_PROFILE_END(); //ParVec_CSTAdditive2Unique
@@ -222,6 +222,85 @@ void UniqueToConsistent(	TVector* pVec,
 	com.communicate();
 }
 
+/// split-phase change of the storage type from additive or unique to consistent
+/**
+ * start() sends the first communication step and returns immediately, such
+ * that local work not touching the interface entries of the vector can be
+ * done while the messages are in flight. finish() waits for the messages
+ * and performs the remaining step. An additive vector needs two steps (slave
+ * values are added to the masters, then copied back), a unique vector only
+ * the copy.
+ * The interface entries must not be changed between start() and finish().
+ */
+template <typename TVector>
+class SplitToConsistent
+{
+	public:
+		SplitToConsistent(TVector* pVec, bool bUnique,
+		                  const HorizontalAlgebraLayouts& layouts)
+			: m_bUnique(bUnique), m_layouts(layouts),
+			  m_bPlans(layouts.communication_plans_enabled()),
+			  m_cpVecAdd(pVec), m_cpVecCopy(pVec)
+		{}
+
+	///	sends the first step of the exchange
+		void start()
+		{
+			PROFILE_FUNC_GROUP("algebra parallelization");
+			const IndexLayout& master = m_layouts.master();
+			const IndexLayout& slave = m_layouts.slave();
+			if(m_bPlans){
+				if(m_bUnique)
+					m_layouts.master_to_slave_plan().start(master, slave, m_cpVecCopy);
+				else
+					m_layouts.slave_to_master_plan().start(slave, master, m_cpVecAdd);
+				return;
+			}
+
+			pcl::InterfaceCommunicator<IndexLayout>& com = m_layouts.comm();
+			if(m_bUnique){
+				com.send_data(master, m_cpVecCopy);
+				com.receive_data(slave, m_cpVecCopy);
+			}
+			else{
+				com.send_data(slave, m_cpVecAdd);
+				com.receive_data(master, m_cpVecAdd);
+			}
+			com.communicate_and_resume();
+		}
+
+	///	completes the exchange
+		void finish()
+		{
+			PROFILE_FUNC_GROUP("algebra parallelization");
+			const IndexLayout& master = m_layouts.master();
+			const IndexLayout& slave = m_layouts.slave();
+			if(m_bPlans){
+				if(m_bUnique){
+					m_layouts.master_to_slave_plan().wait();
+					return;
+				}
+				m_layouts.slave_to_master_plan().wait();
+				m_layouts.master_to_slave_plan().communicate(master, slave, m_cpVecCopy);
+				return;
+			}
+
+			pcl::InterfaceCommunicator<IndexLayout>& com = m_layouts.comm();
+			com.wait();
+			if(m_bUnique) return;
+
+			com.send_data(master, m_cpVecCopy);
+			com.receive_data(slave, m_cpVecCopy);
+			com.communicate();
+		}
+
+	protected:
+		bool m_bUnique;
+		const HorizontalAlgebraLayouts& m_layouts;
+		bool m_bPlans;
+		ComPol_VecAdd<TVector> m_cpVecAdd;
+		ComPol_VecCopy<TVector> m_cpVecCopy;
+};
 
 ///	Copies values from the source to the target layout
 template <typename TVector>
@@ -279,6 +358,79 @@ void AdditiveToUnique(	TVector* pVec,
 		com.communicate();
 }
 
+/// changes parallel storage type from additive to consistent
+/**
+ * Same as AdditiveToConsistent above, but uses the communication plans of
+ * the given layouts if they are enabled. This avoids the setup of the
+ * exchange in each call and should be used for repeated conversions.
+ *
+ * \param[in,out]		pVec			Parallel Vector
+ * \param[in]			layouts			Algebra Layouts
+ */
+template <typename TVector>
+void AdditiveToConsistent(TVector* pVec, const HorizontalAlgebraLayouts& layouts)
+{
+	if(!layouts.communication_plans_enabled()){
+		AdditiveToConsistent(pVec, layouts.master(), layouts.slave(), &layouts.comm());
+		return;
+	}
+
+	PROFILE_FUNC_GROUP("algebra parallelization");
+//	step 1: add slave values to master
+	ComPol_VecAdd<TVector> cpVecAdd(pVec);
+	layouts.slave_to_master_plan().communicate(layouts.slave(), layouts.master(),
+	                                           cpVecAdd);
+
+//	step 2: copy master values to slaves
+	ComPol_VecCopy<TVector> cpVecCopy(pVec);
+	layouts.master_to_slave_plan().communicate(layouts.master(), layouts.slave(),
+	                                           cpVecCopy);
+}
+
+/// changes parallel storage type from unique to consistent
+/**
+ * Same as UniqueToConsistent above, but uses the communication plans of
+ * the given layouts if they are enabled.
+ *
+ * \param[in,out]		pVec			Parallel Vector
+ * \param[in]			layouts			Algebra Layouts
+ */
+template <typename TVector>
+void UniqueToConsistent(TVector* pVec, const HorizontalAlgebraLayouts& layouts)
+{
+	if(!layouts.communication_plans_enabled()){
+		UniqueToConsistent(pVec, layouts.master(), layouts.slave(), &layouts.comm());
+		return;
+	}
+
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	ComPol_VecCopy<TVector> cpVecCopy(pVec);
+	layouts.master_to_slave_plan().communicate(layouts.master(), layouts.slave(),
+	                                           cpVecCopy);
+}
+
+/// changes parallel storage type from additive to unique
+/**
+ * Same as AdditiveToUnique above, but uses the communication plans of
+ * the given layouts if they are enabled.
+ *
+ * \param[in,out]		pVec			Parallel Vector
+ * \param[in]			layouts			Algebra Layouts
+ */
+template <typename TVector>
+void AdditiveToUnique(TVector* pVec, const HorizontalAlgebraLayouts& layouts)
+{
+	if(!layouts.communication_plans_enabled()){
+		AdditiveToUnique(pVec, layouts.master(), layouts.slave(), &layouts.comm());
+		return;
+	}
+
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	ComPol_VecAddSetZero<TVector> cpVecAddSetZero(pVec);
+	layouts.slave_to_master_plan().communicate(layouts.slave(), layouts.master(),
+	                                           cpVecAddSetZero);
+}
+
 /// sets the values of a vector to a given number only on the interface indices
 /**
  * \param[in,out]		pVec			Vector
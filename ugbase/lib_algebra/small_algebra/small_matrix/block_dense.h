@@ -366,6 +366,7 @@ struct block_traits< DenseMatrix< FixedArray2<number, 1, 1, TOrdering> > >
 	enum { is_static = true};
 	enum { static_num_rows = 1};
 	enum { static_num_cols = 1};
+	enum { depth = 1 };
 
 	typedef DenseMatrix< FixedArray2<number, 1, 1, TOrdering> > inverse_type;
 };
@@ -377,6 +378,7 @@ struct block_traits< DenseMatrix< FixedArray2<number, 2, 2, TOrdering> > >
 	enum { is_static = true};
 	enum { static_num_rows = 2};
 	enum { static_num_cols = 2};
+	enum { depth = 1 };
 
 	typedef DenseMatrix< FixedArray2<number, 2, 2, TOrdering> > inverse_type;
 };
@@ -388,6 +390,7 @@ struct block_traits< DenseMatrix< FixedArray2<number, 3, 3, TOrdering> > >
 	enum { is_static = true};
 	enum { static_num_rows = 3};
 	enum { static_num_cols = 3};
+	enum { depth = 1 };
 
 	typedef DenseMatrix< FixedArray2<number, 3, 3, TOrdering> > inverse_type;
 };
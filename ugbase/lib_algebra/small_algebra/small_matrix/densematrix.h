@@ -134,7 +134,7 @@ public:
 	
 	inline
 	this_type&
-	operator /= (this_type &other);
+	operator /= (const this_type &other);
 	
 	
 ////// +
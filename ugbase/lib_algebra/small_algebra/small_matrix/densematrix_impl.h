@@ -190,7 +190,7 @@ DenseMatrix<TStorage>::operator /= (double alpha)
 
 template<typename TStorage>
 DenseMatrix<TStorage> &
-DenseMatrix<TStorage>::operator /= (this_type &other)
+DenseMatrix<TStorage>::operator /= (const this_type &other)
 {
 	this_type tmp = other;
 	bool success = Invert(tmp);
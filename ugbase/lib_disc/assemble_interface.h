@@ -36,6 +36,7 @@
 #include "lib_grid/tools/selector_grid.h"
 #include "lib_grid/tools/grid_level.h"
 #include "lib_disc/spatial_disc/ass_tuner.h"
+#include "lib_disc/common/local_jacobian_cache.h"
 
 namespace ug{
 
@@ -195,6 +196,53 @@ class IAssemble
 		void assemble_stiffness_matrix(matrix_type& A, const vector_type& u)
 		{assemble_stiffness_matrix(A,u,GridLevel());}
 
+	///	applies the Jacobian without assembling it, i.e. d = J(u)*c
+	/**
+	 * Computes the product of the Jacobian at a given iterate u with a
+	 * vector c element by element, without forming the global matrix.
+	 *
+	 * \param[out]	d	result J(u)*c
+	 * \param[in]	u	Current iterate (linearization point)
+	 * \param[in]	c	vector the Jacobian is applied to
+	 * \param[in]	gl	Grid Level
+	 */
+		virtual void apply_jacobian(vector_type& d, const vector_type& u, const vector_type& c, const GridLevel& gl)
+		{UG_THROW("IAssemble: apply_jacobian not implemented.");}
+
+		void apply_jacobian(vector_type& d, const vector_type& u, const vector_type& c)
+		{apply_jacobian(d,u,c,GridLevel());}
+
+	///	assembles the diagonal of the Jacobian without assembling the Jacobian
+		virtual void assemble_jacobian_diagonal(vector_type& diag, const vector_type& u, const GridLevel& gl)
+		{UG_THROW("IAssemble: assemble_jacobian_diagonal not implemented.");}
+
+		void assemble_jacobian_diagonal(vector_type& diag, const vector_type& u)
+		{assemble_jacobian_diagonal(diag,u,GridLevel());}
+
+	///	computes the local Jacobians at u and stores them for repeated application
+	/**
+	 * The stored local Jacobians can be passed to apply_jacobian and
+	 * assemble_jacobian_diagonal, which then only apply the stored element
+	 * matrices instead of recomputing them. The cache is only valid as long
+	 * as u, the grid and the discretization do not change.
+	 *
+	 * \param[out]	cache	local Jacobians
+	 * \param[in]	u		Current iterate (linearization point)
+	 * \param[in]	gl		Grid Level
+	 */
+		virtual void assemble_local_jacobians(LocalJacobianCache& cache, const vector_type& u, const GridLevel& gl)
+		{UG_THROW("IAssemble: assemble_local_jacobians not implemented.");}
+
+	///	applies the Jacobian given by stored local Jacobians, i.e. d = J(u)*c
+		virtual void apply_jacobian(vector_type& d, const vector_type& u, const vector_type& c,
+		                            const LocalJacobianCache& cache, const GridLevel& gl)
+		{UG_THROW("IAssemble: apply_jacobian not implemented.");}
+
+	///	assembles the diagonal of the Jacobian given by stored local Jacobians
+		virtual void assemble_jacobian_diagonal(vector_type& diag, const vector_type& u,
+		                                        const LocalJacobianCache& cache, const GridLevel& gl)
+		{UG_THROW("IAssemble: assemble_jacobian_diagonal not implemented.");}
+
 	/// \{
 		virtual SmartPtr<AssemblingTuner<TAlgebra> > ass_tuner() = 0;
 		virtual ConstSmartPtr<AssemblingTuner<TAlgebra> > ass_tuner() const = 0;
@@ -107,6 +107,13 @@ class LocalIndices
 			m_vvIndex[fct].push_back(DoFIndex(index,comp));
 		}
 
+	///	sets the dofs of a function from a contiguous range
+		void assign_dof(size_t fct, const DoFIndex* first, const DoFIndex* last)
+		{
+			check_fct(fct);
+			m_vvIndex[fct].assign(first, last);
+		}
+
 	///	clears all fct
 		void clear() {m_vvIndex.clear();}
 
@@ -788,6 +795,28 @@ void AddLocalMatrixToGlobal(TMatrix& mat, const LocalMatrix& lmat)
 		}
 }
 
+///	computes the local matrix-vector product, i.e. lres = lmat * lvec
+inline void LocalMatVec(LocalVector& lres, const LocalMatrix& lmat, const LocalVector& lvec)
+{
+	for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+		for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+		{
+			number sum = 0.0;
+			for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+				for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+					sum += lmat.value(fct1,dof1,fct2,dof2) * lvec.value(fct2,dof2);
+			lres.value(fct1,dof1) = sum;
+		}
+}
+
+///	extracts the couplings of each local dof to itself, i.e. ldiag = diag(lmat)
+inline void GetLocalDiagonal(LocalVector& ldiag, const LocalMatrix& lmat)
+{
+	for(size_t fct=0; fct < lmat.num_all_row_fct(); ++fct)
+		for(size_t dof=0; dof < lmat.num_all_row_dof(fct); ++dof)
+			ldiag.value(fct,dof) = lmat.value(fct,dof,fct,dof);
+}
+
 } // end namespace ug
 
 #endif /* __H__UG__LIB_DISC__COMMON__LOCAL_ALGEBRA__ */
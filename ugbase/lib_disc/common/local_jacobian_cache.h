@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__COMMON__LOCAL_JACOBIAN_CACHE__
+#define __H__UG__LIB_DISC__COMMON__LOCAL_JACOBIAN_CACHE__
+
+#include <vector>
+
+#include "./local_algebra.h"
+
+namespace ug{
+
+///	stores the local jacobians of a set of elements
+/**
+ * This class collects the local (element) jacobians of a discretization
+ * together with the algebra indices of the element dofs. The jacobian can
+ * then be applied to a vector or its diagonal be extracted without
+ * recomputing the element contributions. The storage is flat: for every
+ * element the indices and the dense local matrix (row-major) are appended
+ * to contiguous arrays.
+ *
+ * The memory needed is the sum of the squared number of local dofs over all
+ * elements, i.e. typically a few times the memory of the assembled matrix.
+ * Thus, users like the MatrixFreeOperator only fill the cache on request.
+ */
+class LocalJacobianCache
+{
+	public:
+	///	Constructor
+		LocalJacobianCache() : m_vIndOffset(1, 0), m_vValOffset(1, 0) {}
+
+	///	removes all stored element jacobians
+		void clear()
+		{
+			m_vIndOffset.assign(1, 0); m_vValOffset.assign(1, 0);
+			m_vIndex.clear(); m_vComp.clear(); m_vValue.clear();
+		}
+
+	///	exchanges the content (used to release the memory)
+		void swap(LocalJacobianCache& other)
+		{
+			m_vIndOffset.swap(other.m_vIndOffset); m_vValOffset.swap(other.m_vValOffset);
+			m_vIndex.swap(other.m_vIndex); m_vComp.swap(other.m_vComp);
+			m_vValue.swap(other.m_vValue);
+		}
+
+	///	returns the number of stored element jacobians
+		size_t num_elems() const {return m_vIndOffset.size() - 1;}
+
+	///	returns if no element jacobian is stored
+		bool empty() const {return num_elems() == 0;}
+
+	///	appends a local jacobian (row and column indices must coincide)
+		void add(const LocalMatrix& lmat)
+		{
+			const LocalIndices& ind = lmat.get_row_indices();
+			const size_t first = m_vIndex.size();
+
+			for(size_t fct=0; fct < lmat.num_all_row_fct(); ++fct)
+				for(size_t dof=0; dof < lmat.num_all_row_dof(fct); ++dof)
+				{
+					m_vIndex.push_back(ind.index(fct,dof));
+					m_vComp.push_back(ind.comp(fct,dof));
+				}
+
+			for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+				for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+					for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+						for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+							m_vValue.push_back(lmat.value(fct1,dof1,fct2,dof2));
+
+			UG_ASSERT(m_vValue.size() - m_vValOffset.back()
+			          == (m_vIndex.size() - first) * (m_vIndex.size() - first),
+			          "Local jacobian must be square.");
+
+			m_vIndOffset.push_back(m_vIndex.size());
+			m_vValOffset.push_back(m_vValue.size());
+		}
+
+	///	adds the product of all stored jacobians and c to d, i.e. d += J*c
+		template <typename TVector>
+		void apply(TVector& d, const TVector& c) const
+		{
+			for(size_t e = 0; e < num_elems(); ++e)
+			{
+				const size_t first = m_vIndOffset[e];
+				const size_t n = m_vIndOffset[e+1] - first;
+				const number* val = &m_vValue[m_vValOffset[e]];
+
+				for(size_t i = 0; i < n; ++i, val += n)
+				{
+					number sum = 0.0;
+					for(size_t j = 0; j < n; ++j)
+						sum += val[j] * BlockRef(c[m_vIndex[first+j]], m_vComp[first+j]);
+					BlockRef(d[m_vIndex[first+i]], m_vComp[first+i]) += sum;
+				}
+			}
+		}
+
+	///	adds the diagonal entries of all stored jacobians to diag
+		template <typename TVector>
+		void add_diagonal(TVector& diag) const
+		{
+			for(size_t e = 0; e < num_elems(); ++e)
+			{
+				const size_t first = m_vIndOffset[e];
+				const size_t n = m_vIndOffset[e+1] - first;
+				const number* val = &m_vValue[m_vValOffset[e]];
+
+				for(size_t i = 0; i < n; ++i)
+					BlockRef(diag[m_vIndex[first+i]], m_vComp[first+i]) += val[i*n+i];
+			}
+		}
+
+	protected:
+	///	offsets of the element dofs in m_vIndex/m_vComp (size: num_elems()+1)
+		std::vector<size_t> m_vIndOffset;
+
+	///	offsets of the element matrices in m_vValue (size: num_elems()+1)
+		std::vector<size_t> m_vValOffset;
+
+	///	algebra indices and components of the element dofs
+		std::vector<size_t> m_vIndex, m_vComp;
+
+	///	local jacobians, row-major
+		std::vector<number> m_vValue;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__COMMON__LOCAL_JACOBIAN_CACHE__ */
@@ -71,6 +71,8 @@ DoFDistribution(SmartPtr<MultiGrid> spMG,
 	  m_spSurfView(spSurfView),
 	  m_gridLevel(level),
 	  m_spDoFIndexStorage(spDoFIndexStorage),
+	  m_revCnt(this),
+	  m_bIndexCache(false),
 	  m_numIndex(0)
 {
 	if(m_spDoFIndexStorage.invalid())
@@ -88,7 +90,10 @@ DoFDistribution(SmartPtr<MultiGrid> spMG,
 
 
 DoFDistribution::
-~DoFDistribution() {}
+~DoFDistribution()
+{
+	enable_index_cache(false);
+}
 
 
 void DoFDistribution::check_subsets()
@@ -1117,6 +1122,15 @@ constrained_face_indices(TBaseElem* elem,LocalIndices& ind,
 template<typename TBaseElem>
 void DoFDistribution::_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) const
 {
+//	use precomputed indices if available
+	if(m_bIndexCache && cached_indices<TBaseElem>(elem, ind, bHang)) return;
+
+	collect_indices<TBaseElem>(elem, ind, bHang);
+}
+
+template<typename TBaseElem>
+void DoFDistribution::collect_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) const
+{
 //	reference dimension
 	static const int dim = TBaseElem::dim;
 
@@ -1178,6 +1192,126 @@ void DoFDistribution::_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) c
 }
 
 
+///////////////////////////////////////////////////////////////////////////////
+// element index cache
+///////////////////////////////////////////////////////////////////////////////
+
+void DoFDistribution::enable_index_cache(bool bEnable)
+{
+	if(bEnable == m_bIndexCache) return;
+
+	if(bEnable){
+		m_pMG->attach_to_all_dv(m_aCacheSlot, -1, false);
+		m_aaCacheSlot.access(*m_pMG, m_aCacheSlot);
+		m_bIndexCache = true;
+		rebuild_index_cache();
+	}
+	else{
+		clear_index_cache();
+		m_aaCacheSlot.invalidate();
+		m_pMG->detach_from_all(m_aCacheSlot);
+		m_bIndexCache = false;
+	}
+}
+
+void DoFDistribution::clear_index_cache()
+{
+	for(int i = 0; i < NUM_GEOMETRIC_BASE_OBJECTS; ++i){
+		IndexCache& cache = m_vIndexCache[i];
+		std::vector<GridObject*>().swap(cache.vElem);
+		for(int t = 0; t < 2; ++t){
+			std::vector<size_t>().swap(cache.vOffset[t]);
+			std::vector<DoFIndex>().swap(cache.vDoF[t]);
+		}
+		cache.bHasHang = false;
+	}
+}
+
+void DoFDistribution::rebuild_index_cache()
+{
+	PROFILE_FUNC();
+	clear_index_cache();
+	if(!m_bIndexCache) return;
+
+	rebuild_index_cache<Vertex>();
+	rebuild_index_cache<Edge>();
+	rebuild_index_cache<Face>();
+	rebuild_index_cache<Volume>();
+}
+
+template <typename TBaseElem>
+void DoFDistribution::rebuild_index_cache()
+{
+	IndexCache& cache = m_vIndexCache[TBaseElem::BASE_OBJECT_ID];
+
+//	assign slots to all elements with full dimension in their subset
+	for(int si = 0; si < num_subsets(); ++si)
+	{
+		if(dim_subset(si) != TBaseElem::dim) continue;
+
+		typename traits<TBaseElem>::const_iterator iter = begin<TBaseElem>(si);
+		typename traits<TBaseElem>::const_iterator iterEnd = end<TBaseElem>(si);
+		for(; iter != iterEnd; ++iter){
+			m_aaCacheSlot[*iter] = (int)cache.vElem.size();
+			cache.vElem.push_back(*iter);
+		}
+	}
+	if(cache.vElem.empty()) return;
+
+//	hanging dofs differ from the regular ones only if constraints exist
+	cache.bHasHang = (m_pMG->num<ConstrainingEdge>() > 0
+					|| m_pMG->num<ConstrainingTriangle>() > 0
+					|| m_pMG->num<ConstrainingQuadrilateral>() > 0);
+
+//	fill the tables (element by element, as the grid queries in
+//	collect_indices are not thread safe)
+	const size_t numFct = num_fct();
+	LocalIndices ind;
+	for(int t = 0; t < (cache.bHasHang ? 2 : 1); ++t)
+	{
+		std::vector<size_t>& vOffset = cache.vOffset[t];
+		std::vector<DoFIndex>& vDoF = cache.vDoF[t];
+
+		vOffset.reserve(cache.vElem.size() * numFct + 1);
+		vOffset.push_back(0);
+		for(size_t slot = 0; slot < cache.vElem.size(); ++slot)
+		{
+			collect_indices<TBaseElem>(static_cast<TBaseElem*>(cache.vElem[slot]),
+			                           ind, t == 1);
+			for(size_t fct = 0; fct < numFct; ++fct){
+				for(size_t dof = 0; dof < ind.num_dof(fct); ++dof)
+					vDoF.push_back(ind.multi_index(fct, dof));
+				vOffset.push_back(vDoF.size());
+			}
+		}
+	}
+}
+
+template <typename TBaseElem>
+bool DoFDistribution::cached_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) const
+{
+	const IndexCache& cache = m_vIndexCache[TBaseElem::BASE_OBJECT_ID];
+	if(cache.vElem.empty()) return false;
+
+//	check that the element is stored in the cache
+	const int slot = m_aaCacheSlot[elem];
+	if(slot < 0 || (size_t)slot >= cache.vElem.size()
+		|| cache.vElem[slot] != elem) return false;
+
+//	copy the stored indices
+	const int t = (bHang && cache.bHasHang) ? 1 : 0;
+	const size_t numFct = num_fct();
+	const size_t* vOffset = &cache.vOffset[t][slot * numFct];
+
+	ind.resize_fct(numFct);
+	for(size_t fct = 0; fct < numFct; ++fct){
+		if(vOffset[fct] == vOffset[fct+1]) {ind.clear_dof(fct); continue;}
+		const DoFIndex* pDoF = &cache.vDoF[t][0];
+		ind.assign_dof(fct, pDoF + vOffset[fct], pDoF + vOffset[fct+1]);
+	}
+	return true;
+}
+
 template <typename TBaseElem>
 void DoFDistribution::
 changable_indices(std::vector<size_t>& vIndex,
@@ -1441,6 +1575,12 @@ void DoFDistribution::reinit()
 #ifdef UG_PARALLEL
 	reinit_layouts_and_communicator();
 #endif
+
+//	increase revision counter
+	++m_revCnt;
+
+//	update cached element indices
+	if(m_bIndexCache) rebuild_index_cache();
 }
 
 
@@ -1762,6 +1902,12 @@ void DoFDistribution::permute_indices(const std::vector<size_t>& vNewInd)
 	reinit_layouts_and_communicator();
 #endif
 
+//	increase revision counter
+	++m_revCnt;
+
+//	update cached element indices
+	if(m_bIndexCache) rebuild_index_cache();
+
 //	permute indices in associated vectors
 	permute_values(vNewInd);
 }
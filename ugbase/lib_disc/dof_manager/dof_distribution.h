@@ -34,8 +34,10 @@
 #define __H__UG__LIB_DISC__DOF_MANAGER__DOF_DISTRIBUTION__
 
 #include "lib_grid/tools/surface_view.h"
+#include "lib_grid/algorithms/attachment_util.h"
 #include "lib_disc/domain_traits.h"
 #include "lib_disc/common/local_algebra.h"
+#include "lib_disc/common/revision_counter.h"
 #include "dof_index_storage.h"
 #include "dof_count.h"
 
@@ -73,6 +75,9 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		///	returns grid level
 		const GridLevel& grid_level() const {return m_gridLevel;}
 
+		///	returns the revision, increased whenever the indices are changed
+		const RevisionCounter& revision() const {return m_revCnt;}
+
 	public:
 		template <typename TElem>
 		struct traits
@@ -350,10 +355,45 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		                             bool bClear = true) const;
 		/// \}
 
+	public:
+		///	enables a cache of the local indices of the elements
+		/**
+		 * If enabled, the local indices of all elements with the dimension of
+		 * their subset are stored in one contiguous table per base object
+		 * type, rebuilt whenever the indices are reinitialized or permuted.
+		 * indices() then copies the stored indices for those elements instead
+		 * of collecting the sub-elements and their index attachments (and the
+		 * constrained objects, if hanging dofs are requested).
+		 *
+		 * \param[in]		bEnable		flag if the cache is used
+		 */
+		void enable_index_cache(bool bEnable);
+
+		///	returns if the element index cache is enabled
+		bool index_cache_enabled() const {return m_bIndexCache;}
+
+		///	drops the cached indices until the next reinit (e.g. on grid changes)
+		void clear_index_cache();
+
 	protected:
 		template <typename TBaseElem>
 		void _indices(TBaseElem* elem, LocalIndices& ind, bool bHang = false) const;
 
+		///	collects the indices of an element by walking its sub-elements
+		template <typename TBaseElem>
+		void collect_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) const;
+
+		///	fills the indices from the cache, returns false if not cached
+		template <typename TBaseElem>
+		bool cached_indices(TBaseElem* elem, LocalIndices& ind, bool bHang) const;
+
+		///	rebuilds the element index cache for all base object types
+		void rebuild_index_cache();
+
+		///	fills the element index cache for a base object type
+		template <typename TBaseElem>
+		void rebuild_index_cache();
+
 		template<typename TBaseElem>
 		size_t _dof_indices(TBaseElem* elem, size_t fct,
 		                     std::vector<DoFIndex>& ind,
@@ -478,6 +518,36 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		/// DoF-Index Memory Storage
 		SmartPtr<DoFIndexStorage> m_spDoFIndexStorage;
 
+		///	revision of the index distribution
+		RevisionCounter m_revCnt;
+
+	protected:
+		///	cached local indices of the elements of one base object type
+		struct IndexCache
+		{
+			///	element stored in a slot
+			std::vector<GridObject*> vElem;
+
+			///	start of a (slot, fct) in vDoF, regular [0] and with hanging dofs [1]
+			std::vector<size_t> vOffset[2];
+
+			///	dof indices, contiguous per slot and function
+			std::vector<DoFIndex> vDoF[2];
+
+			///	flag if the hanging table is stored (else the regular one is used)
+			bool bHasHang;
+		};
+
+		///	flag if the element index cache is used
+		bool m_bIndexCache;
+
+		///	cache per base object type
+		IndexCache m_vIndexCache[NUM_GEOMETRIC_BASE_OBJECTS];
+
+		///	slot of an element in the cache (-1 if not cached)
+		AInt m_aCacheSlot;
+		MultiElementAttachmentAccessor<AInt> m_aaCacheSlot;
+
 	protected:
 		/// number of distributed indices on whole domain
 		size_t m_numIndex;
@@ -36,6 +36,7 @@
 #include "common/util/file_util.h"
 #include "lib_grid/file_io/file_io.h"
 #include "lib_grid/file_io/file_io_ugx.h"
+#include "lib_grid/file_io/file_io_ugb.h"
 #include "lib_grid/algorithms/geom_obj_util/misc_util.h"
 #include "lib_grid/refinement/projectors/projection_handler.h"
 #include "common/profiler/profiler.h"
@@ -94,6 +95,21 @@ void SaveDomain(TDomain& domain, const char* filename)
 			UG_THROW("Couldn't save domain to the specified file: " << filename);
 		}
 	}
+	else if(GetFilenameExtension(string(filename)) == string("ugb")){
+		GridWriterUGB ugbWriter;
+		ugbWriter.add_grid(*domain.grid(), domain.position_attachment());
+		ugbWriter.add_subset_handler(*domain.subset_handler(), "defSH");
+
+		vector<string> additionalSHNames = domain.additional_subset_handler_names();
+		for(size_t i_name = 0; i_name < additionalSHNames.size(); ++i_name){
+			const char* shName = additionalSHNames[i_name].c_str();
+			ugbWriter.add_subset_handler(*domain.additional_subset_handler(shName), shName);
+		}
+
+		if(!ugbWriter.write_to_file(filename)){
+			UG_THROW("Couldn't save domain to the specified file: " << filename);
+		}
+	}
 	else if(!SaveGridToFile(*domain.grid(), *domain.subset_handler(),
 						  filename, domain.position_attachment()))
 		UG_THROW("SaveDomain: Could not save to file: "<<filename);
@@ -41,6 +41,7 @@
 #endif
 
 #include "lib_disc/dof_manager/dof_distribution.h"
+#include "lib_disc/spatial_disc/disc_util/geom_cache.h"
 #include "grid_function.h"
 
 #include <algorithm> // std::sort
@@ -83,6 +84,8 @@ init(SmartPtr<subset_handler_type> spMGSH,
 	m_spDoFDistributionInfo = SmartPtr<DoFDistributionInfo>(new DoFDistributionInfo(spMGSH));
 	m_algebraType = algebraType;
 	m_bAdaptionIsActive = false;
+	m_bIndexCache = false;
+	m_bCommPlans = false;
 	m_RevCnt = RevisionCounter(this);
 
 	this->set_dof_distribution_info(m_spDoFDistributionInfo);
@@ -342,12 +345,32 @@ void IApproximationSpace::create_dof_distribution(const GridLevel& gl)
 	SmartPtr<DoFDistribution> spDD = SmartPtr<DoFDistribution>(new
 		DoFDistribution(m_spMG, m_spMGSH, m_spDoFDistributionInfo,
 						m_spSurfaceView, gl, m_bGrouped, spIndexStrg));
+	if(m_bIndexCache) spDD->enable_index_cache(true);
+#ifdef UG_PARALLEL
+	if(m_bCommPlans) spDD->layouts()->enable_communication_plans(true);
+#endif
 
 //	add to list and sort
 	m_vDD.push_back(spDD);
 	std::sort(m_vDD.begin(), m_vDD.end(), SortDD);
 }
 
+void IApproximationSpace::set_index_cache(bool bEnable)
+{
+	m_bIndexCache = bEnable;
+	for(size_t i = 0; i < m_vDD.size(); ++i)
+		m_vDD[i]->enable_index_cache(bEnable);
+}
+
+void IApproximationSpace::set_communication_plans(bool bEnable)
+{
+	m_bCommPlans = bEnable;
+#ifdef UG_PARALLEL
+	for(size_t i = 0; i < m_vDD.size(); ++i)
+		m_vDD[i]->layouts()->enable_communication_plans(bEnable);
+#endif
+}
+
 void IApproximationSpace::surface_view_required()
 {
 //	allocate surface view if needed
@@ -416,6 +439,9 @@ void IApproximationSpace::reinit()
 
 //	increase revision counter
 	++m_RevCnt;
+
+//	element geometries may have changed
+	GeomCacheControl::invalidate();
 }
 
 void IApproximationSpace::register_at_adaption_msg_hub()
@@ -434,9 +460,14 @@ void IApproximationSpace::register_at_adaption_msg_hub()
 void IApproximationSpace::
 grid_changed_callback(const GridMessage_Adaption& msg)
 {
-	if(msg.adaption_begins())
+	if(msg.adaption_begins()){
 		m_bAdaptionIsActive = true;
 
+	//	cached element indices are rebuilt on reinit
+		for(size_t i = 0; i < m_vDD.size(); ++i)
+			m_vDD[i]->clear_index_cache();
+	}
+
 	else if(m_bAdaptionIsActive){
 			if(msg.adaption_ends())
 			{
@@ -480,6 +511,8 @@ grid_distribution_callback(const GridMessage_Distribution& msg)
 	PROFILE_FUNC();
 	switch(msg.msg()){
 		case GMDT_DISTRIBUTION_STARTS:
+			for(size_t i = 0; i < m_vDD.size(); ++i)
+				m_vDD[i]->clear_index_cache();
 			break;
 
 		case GMDT_DISTRIBUTION_STOPS:
@@ -210,6 +210,14 @@ class IApproximationSpace : public DoFDistributionInfoProvider
 	///	returns the current revision
 		const RevisionCounter& revision() const {return m_RevCnt;}
 
+	///	enables the element index cache in all (also future) dof distributions
+		void set_index_cache(bool bEnable);
+
+	///	enables communication plans in the layouts of all (also future) dof distributions
+	/**	cf. HorizontalAlgebraLayouts::enable_communication_plans. Has to be
+	 * called on all processes. Without effect in serial builds.*/
+		void set_communication_plans(bool bEnable);
+
 	protected:
 	///	creates a dof distribution
 		void create_dof_distribution(const GridLevel& gl);
@@ -256,6 +264,12 @@ class IApproximationSpace : public DoFDistributionInfoProvider
 	///	flag if DoFs should be grouped
 		bool m_bGrouped;
 
+	///	flag if dof distributions cache the element indices
+		bool m_bIndexCache;
+
+	///	flag if communication plans are enabled in new dof distributions
+		bool m_bCommPlans;
+
 	///	DofDistributionInfo
 		SmartPtr<DoFDistributionInfo> m_spDoFDistributionInfo;
 
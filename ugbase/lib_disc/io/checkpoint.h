@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__IO__CHECKPOINT__
+#define __H__UG__LIB_DISC__IO__CHECKPOINT__
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "common/util/binary_buffer.h"
+#include "lib_disc/domain.h"
+#include "lib_disc/function_spaces/grid_function.h"
+#include "lib_disc/time_disc/solution_time_series.h"
+
+namespace ug{
+
+///	writes a buffer from each process into one combined checkpoint file
+/**	In parallel environments pcl::WriteCombinedParallelFile is used, in serial
+ * environments the buffer is written to a plain file.*/
+void WriteCheckpointFile(BinaryBuffer& buf, const char* filename);
+
+///	reads the buffer of the local process from a combined checkpoint file
+void ReadCheckpointFile(BinaryBuffer& buf, const char* filename);
+
+
+////////////////////////////////////////////////////////////////////////
+///	Checkpoint of a distributed domain and of grid functions defined on it
+/**
+ * A checkpoint stores the local part of the multigrid hierarchy of each
+ * process together with positions, subset handlers, projection handler and
+ * grid layouts (i.e. the distributed hierarchy), the ordering of the
+ * algebraic indices of each involved DoFDistribution and the values of all
+ * registered grid functions and time series. All data is written to one
+ * combined file (see pcl::WriteCombinedParallelFile).
+ *
+ * Restarting from a checkpoint requires the same number of processes. It
+ * restores the exact hierarchy, interfaces and DoF ordering, so that no
+ * re-distribution, re-refinement or re-interpolation has to be performed.
+ * Restarting is a two-step process:
+ * \code
+ * cp = DomainCheckpoint(dom)		-- dom has to be empty
+ * cp:read_domain("restart.ugcp")
+ * -- create approximation space and grid functions as usual
+ * cp:add(u, "u")
+ * cp:add(timeSeries, u, "uOld")
+ * cp:read_grid_functions()
+ * time = cp:time()
+ * \endcode
+ * Note that the grid must not be altered between read_domain and
+ * read_grid_functions.
+ */
+template <typename TDomain, typename TAlgebra>
+class DomainCheckpoint
+{
+	public:
+	///	domain type
+		typedef TDomain domain_type;
+
+	///	grid function type
+		typedef GridFunction<TDomain, TAlgebra> grid_function_type;
+
+	///	vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	time series type
+		typedef VectorTimeSeries<vector_type> time_series_type;
+
+	public:
+	///	constructor
+		DomainCheckpoint(SmartPtr<TDomain> spDomain);
+
+	///	registers a grid function, which will be written or restored
+		void add(SmartPtr<grid_function_type> spGridFct, const char* name);
+
+	///	registers a time series of grid functions
+	/**	All solutions of the time series have to share the DoFDistribution of
+	 * the given grid function. During restart the solutions of the series are
+	 * created as clones of the given grid function.*/
+		void add(SmartPtr<time_series_type> spTimeSeries,
+		         SmartPtr<grid_function_type> spGridFct, const char* name);
+
+	///	removes all registered grid functions and time series
+		void clear();
+
+	///	sets the point in time, which is stored with the checkpoint
+		void set_time(number time)	{m_time = time;}
+
+	///	returns the point in time stored with the checkpoint
+		number time() const			{return m_time;}
+
+	///	writes domain and all registered grid functions to the given file
+		void write(const char* filename);
+
+	///	restores the domain from the given file
+	/**	The domain has to be empty. The data for grid functions is kept,
+	 * until read_grid_functions is called.*/
+		void read_domain(const char* filename);
+
+	///	restores DoF ordering and values of all registered grid functions
+	/**	read_domain has to be called before.*/
+		void read_grid_functions();
+
+	protected:
+	///	entry for a grid function or time series
+		struct Entry
+		{
+			SmartPtr<grid_function_type> spGridFct;
+			SmartPtr<time_series_type> spTimeSeries;
+		};
+
+	///	restored information about a DoFDistribution
+		struct DoFRecord
+		{
+			GridLevel gridLevel;
+			size_t numIndex;
+			size_t readPos;
+		};
+
+	///	restored information about a grid function or time series
+		struct ValueRecord
+		{
+			int ddID;
+			size_t readPos;
+		};
+
+	protected:
+		void write_grid(BinaryBuffer& out, MultiElementAttachmentAccessor<AInt>& aaInt);
+		void read_grid(BinaryBuffer& in);
+
+		template <typename TBaseElem>
+		void write_dof_indices(BinaryBuffer& out, ConstSmartPtr<DoFDistribution> dd,
+		                       MultiElementAttachmentAccessor<AInt>& aaInt);
+
+		template <typename TBaseElem>
+		void read_dof_indices(BinaryBuffer& in, ConstSmartPtr<DoFDistribution> dd,
+		                      const std::vector<TBaseElem*>& vElem,
+		                      std::vector<size_t>& vNewInd);
+
+		void permute_dof_distribution(SmartPtr<DoFDistribution> dd, int ddID);
+
+		void write_values(BinaryBuffer& out, const vector_type& v) const;
+		void read_values(BinaryBuffer& in, vector_type& v) const;
+
+	protected:
+		SmartPtr<TDomain> m_spDomain;
+
+	///	registered grid functions and time series
+		std::map<std::string, Entry> m_mEntry;
+
+	///	point in time
+		number m_time;
+
+	///	buffer holding the data of the last read checkpoint
+		BinaryBuffer m_buf;
+
+	///	restored elements in the order of their checkpoint indices
+		std::vector<Vertex*> m_vVrt;
+		std::vector<Edge*> m_vEdge;
+		std::vector<Face*> m_vFace;
+		std::vector<Volume*> m_vVol;
+
+	///	restored DoF and value information
+		std::vector<DoFRecord> m_vDoFRecord;
+		std::map<std::string, ValueRecord> m_mValueRecord;
+};
+
+} // end namespace ug
+
+#include "checkpoint_impl.h"
+
+#endif /* __H__UG__LIB_DISC__IO__CHECKPOINT__ */
@@ -0,0 +1,569 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__IO__CHECKPOINT_IMPL__
+#define __H__UG__LIB_DISC__IO__CHECKPOINT_IMPL__
+
+#include "checkpoint.h"
+#include "common/serialization.h"
+#include "common/profiler/profiler.h"
+#include "lib_grid/algorithms/serialization.h"
+#include "lib_grid/file_io/file_io_lgb.h"
+#include "lib_grid/refinement/projectors/projection_handler.h"
+#include "lib_algebra/parallelization/parallel_storage_type.h"
+#ifdef UG_PARALLEL
+	#include "pcl/pcl_base.h"
+	#include "lib_grid/parallelization/parallelization_util.h"
+#endif
+
+namespace ug{
+
+namespace detail{
+namespace checkpoint{
+	const int magicNumber = 61823;
+	const int version = 2;
+
+///	fills vElemOut with all elements of mg in the order of the indices in aaInt
+	template <typename TElem>
+	void CollectElementsByIndex(std::vector<TElem*>& vElemOut, MultiGrid& mg,
+	                            MultiElementAttachmentAccessor<AInt>& aaInt)
+	{
+		typedef typename MultiGrid::traits<TElem>::iterator iterator;
+		vElemOut.resize(mg.num<TElem>());
+		for(iterator iter = mg.begin<TElem>(); iter != mg.end<TElem>(); ++iter){
+			const int ind = aaInt[*iter];
+			UG_COND_THROW(ind < 0 || ind >= (int)vElemOut.size(),
+			              "DomainCheckpoint: Bad element index " << ind);
+			vElemOut[ind] = *iter;
+		}
+	}
+}
+}
+
+template <typename TDomain, typename TAlgebra>
+DomainCheckpoint<TDomain, TAlgebra>::
+DomainCheckpoint(SmartPtr<TDomain> spDomain) :
+	m_spDomain(spDomain), m_time(0.0)
+{
+	UG_COND_THROW(spDomain.invalid(), "DomainCheckpoint: Invalid domain given.");
+}
+
+template <typename TDomain, typename TAlgebra>
+void DomainCheckpoint<TDomain, TAlgebra>::
+add(SmartPtr<grid_function_type> spGridFct, const char* name)
+{
+	UG_COND_THROW(spGridFct.invalid(), "DomainCheckpoint: Invalid grid function given for '" << name << "'.");
+	Entry& e = m_mEntry[std::string(name)];
+	e.spGridFct = spGridFct;
+	e.spTimeSeries = SPNULL;
+}
+
+template <typename TDomain, typename TAlgebra>
+void DomainCheckpoint<TDomain, TAlgebra>::
+add(SmartPtr<time_series_type> spTimeSeries,
+    SmartPtr<grid_function_type> spGridFct, const char* name)
+{
+	UG_COND_THROW(spTimeSeries.invalid(), "DomainCheckpoint: Invalid time series given for '" << name << "'.");
+	UG_COND_THROW(spGridFct.invalid(), "DomainCheckpoint: Invalid grid function given for '" << name << "'.");
+	Entry& e = m_mEntry[std::string(name)];
+	e.spGridFct = spGridFct;
+	e.spTimeSeries = spTimeSeries;
+}
+
+template <typename TDomain, typename TAlgebra>
+void DomainCheckpoint<TDomain, TAlgebra>::
+clear()
+{
+	m_mEntry.clear();
+}
+
+template <typename TDomain, typename TAlgebra>
+void DomainCheckpoint<TDomain, TAlgebra>::
+write(const char* filename)
+{
+	PROFILE_FUNC_GROUP("disc");
+	using namespace detail::checkpoint;
+
+	MultiGrid& mg = *m_spDomain->grid();
+
+//	the attachment holds the index of each element in the checkpoint
+	AInt aInt;
+	mg.attach_to_all(aInt);
+	MultiElementAttachmentAccessor<AInt> aaInt(mg, aInt);
+
+	BinaryBuffer out;
+	Serialize(out, magicNumber);
+	Serialize(out, version);
+	Serialize(out, (int)TDomain::dim);
+	#ifdef UG_PARALLEL
+		Serialize(out, pcl::NumProcs());
+	#else
+		Serialize(out, (int)1);
+	#endif
+	Serialize(out, m_time);
+
+	write_grid(out, aaInt);
+
+//	collect the DoFDistributions of all grid functions
+	std::map<const DoFDistribution*, int> mDDID;
+	std::vector<ConstSmartPtr<DoFDistribution> > vDD;
+	typedef typename std::map<std::string, Entry>::iterator entry_iterator;
+	for(entry_iterator iter = m_mEntry.begin(); iter != m_mEntry.end(); ++iter){
+		ConstSmartPtr<DoFDistribution> dd = iter->second.spGridFct->dd();
+		if(mDDID.find(dd.get()) == mDDID.end()){
+			mDDID[dd.get()] = (int)vDD.size();
+			vDD.push_back(dd);
+		}
+	}
+
+//	write the algebraic indices of all elements for each DoFDistribution
+	Serialize(out, (int)vDD.size());
+	for(size_t i = 0; i < vDD.size(); ++i){
+		const GridLevel& gl = vDD[i]->grid_level();
+		Serialize(out, gl.level());
+		Serialize(out, (int)gl.type());
+		Serialize(out, gl.ghosts());
+		Serialize(out, vDD[i]->num_indices());
+
+		BinaryBuffer block;
+		write_dof_indices<Vertex>(block, vDD[i], aaInt);
+		write_dof_indices<Edge>(block, vDD[i], aaInt);
+		write_dof_indices<Face>(block, vDD[i], aaInt);
+		write_dof_indices<Volume>(block, vDD[i], aaInt);
+		Serialize(out, block.write_pos());
+		out.write(block.buffer(), block.write_pos());
+	}
+
+//	write the values of grid functions and time series
+	Serialize(out, (int)m_mEntry.size());
+	for(entry_iterator iter = m_mEntry.begin(); iter != m_mEntry.end(); ++iter){
+		Entry& e = iter->second;
+		Serialize(out, iter->first);
+		Serialize(out, mDDID[e.spGridFct->dd().get()]);
+
+		BinaryBuffer block;
+		if(e.spTimeSeries.valid()){
+			time_series_type& ts = *e.spTimeSeries;
+			Serialize(block, (int)ts.size());
+		//	oldest solution first, so that pushing restores the order
+			for(int i = (int)ts.size() - 1; i >= 0; --i){
+				ConstSmartPtr<vector_type> sol = ts.solution(i);
+				const grid_function_type* gf =
+						dynamic_cast<const grid_function_type*>(sol.get());
+				UG_COND_THROW((gf && gf->dd().get() != e.spGridFct->dd().get())
+				              || sol->size() != e.spGridFct->size(),
+				              "DomainCheckpoint: Solutions of time series '"
+				              << iter->first << "' have to share the DoFDistribution "
+				              "of the associated grid function.");
+				Serialize(block, ts.time(i));
+				write_values(block, *sol);
+			}
+		}
+		else{
+			Serialize(block, (int)1);
+			Serialize(block, m_time);
+			write_values(block, *e.spGridFct);
+		}
+		Serialize(out, block.write_pos());
+		out.write(block.buffer(), block.write_pos());
+	}
+
+	Serialize(out, magicNumber);
+	mg.detach_from_all(aInt);
+
+	WriteCheckpointFile(out, filename);
+}
+
+template <typename TDomain, typename TAlgebra>
+void DomainCheckpoint<TDomain, TAlgebra>::
+write_grid(BinaryBuffer& out, MultiElementAttachmentAccessor<AInt>& aaInt)
+{
+	using namespace detail::checkpoint;
+	TDomain& dom = *m_spDomain;
+	MultiGrid& mg = *dom.grid();
+
+	SerializeMultiGridElements(mg, mg.get_grid_objects(), aaInt, out);
+
+	std::vector<Vertex*> vVrt;
+	std::vector<Edge*> vEdge;
+	std::vector<Face*> vFace;
+	std::vector<Volume*> vVol;
+	CollectElementsByIndex(vVrt, mg, aaInt);
+	CollectElementsByIndex(vEdge, mg, aaInt);
+	CollectElementsByIndex(vFace, mg, aaInt);
+	CollectElementsByIndex(vVol, mg, aaInt);
+
+//	positions and subset handlers
+	std::vector<std::string> vSHName = dom.additional_subset_handler_names();
+	Serialize(out, (int)vSHName.size());
+	for(size_t i = 0; i < vSHName.size(); ++i)
+		Serialize(out, vSHName[i]);
+
+	GridDataSerializationHandler serializer;
+	serializer.add(GeomObjAttachmentSerializer<Vertex, typename TDomain::position_attachment_type>
+					::create(mg, dom.position_attachment()));
+	serializer.add(SubsetHandlerSerializer::create(*dom.subset_handler()));
+	for(size_t i = 0; i < vSHName.size(); ++i)
+		serializer.add(SubsetHandlerSerializer::create(*dom.additional_subset_handler(vSHName[i])));
+
+	serializer.write_infos(out);
+	serializer.serialize(out, vVrt.begin(), vVrt.end());
+	serializer.serialize(out, vEdge.begin(), vEdge.end());
+	serializer.serialize(out, vFace.begin(), vFace.end());
+	serializer.serialize(out, vVol.begin(), vVol.end());
+
+//	projection handler
+	ProjectionHandler* ph = dynamic_cast<ProjectionHandler*>(dom.refinement_projector().get());
+	Serialize(out, (ph != NULL));
+	if(ph)
+		SerializeProjectionHandler(out, *ph);
+
+//	interfaces of the distributed grid
+	#ifdef UG_PARALLEL
+		Serialize(out, true);
+		SerializeGridLayoutMap(dom.distributed_grid_manager()->grid_layout_map(), aaInt, out);
+	#else
+		Serialize(out, false);
+	#endif
+}
+
+template <typename TDomain, typename TAlgebra>
+template <typename TBaseElem>
+void DomainCheckpoint<TDomain, TAlgebra>::
+write_dof_indices(BinaryBuffer& out, ConstSmartPtr<DoFDistribution> dd,
+                  MultiElementAttachmentAccessor<AInt>& aaInt)
+{
+	typedef typename DoFDistribution::traits<TBaseElem>::const_iterator const_iterator;
+
+	std::vector<size_t> vInd;
+	int numElem = 0;
+	const_iterator iterEnd = dd->template end<TBaseElem>(SurfaceView::ALL);
+	for(const_iterator iter = dd->template begin<TBaseElem>(SurfaceView::ALL);
+		iter != iterEnd; ++iter)
+		++numElem;
+
+	Serialize(out, numElem);
+	for(const_iterator iter = dd->template begin<TBaseElem>(SurfaceView::ALL);
+		iter != iterEnd; ++iter)
+	{
+		dd->inner_algebra_indices(*iter, vInd);
+		Serialize(out, aaInt[*iter]);
+		Serialize(out, (int)vInd.size());
+		for(size_t i = 0; i < vInd.size(); ++i)
+			Serialize(out, vInd[i]);
+	}
+}
+
+template <typename TDomain, typename TAlgebra>
+void DomainCheckpoint<TDomain, TAlgebra>::
+write_values(BinaryBuffer& out, const vector_type& v) const
+{
+//	the storage mask is written in serial builds as well, so that the files
+//	don't depend on the build. Without slaves a vector has all storage types.
+	#ifdef UG_PARALLEL
+		Serialize(out, v.get_storage_mask());
+	#else
+		Serialize(out, (uint)(PST_CONSISTENT | PST_ADDITIVE | PST_UNIQUE));
+	#endif
+	Serialize(out, v.size());
+	for(size_t i = 0; i < v.size(); ++i)
+		Serialize(out, v[i]);
+}
+
+template <typename TDomain, typename TAlgebra>
+void DomainCheckpoint<TDomain, TAlgebra>::
+read_values(BinaryBuffer& in, vector_type& v) const
+{
+	#ifdef UG_PARALLEL
+		v.set_storage_type(Deserialize<uint>(in));
+	#else
+		Deserialize<uint>(in);
+	#endif
+	const size_t size = Deserialize<size_t>(in);
+	UG_COND_THROW(size != v.size(), "DomainCheckpoint: Size mismatch. Stored vector has "
+	              << size << " entries, but " << v.size() << " are required.");
+	for(size_t i = 0; i < v.size(); ++i)
+		Deserialize(in, v[i]);
+}
+
+template <typename TDomain, typename TAlgebra>
+void DomainCheckpoint<TDomain, TAlgebra>::
+read_domain(const char* filename)
+{
+	PROFILE_FUNC_GROUP("disc");
+	using namespace detail::checkpoint;
+
+	UG_COND_THROW(m_spDomain->grid()->num_vertices() != 0,
+	              "DomainCheckpoint::read_domain: The domain has to be empty.");
+
+	m_buf.clear();
+	m_vDoFRecord.clear();
+	m_mValueRecord.clear();
+	ReadCheckpointFile(m_buf, filename);
+	BinaryBuffer& in = m_buf;
+
+	UG_COND_THROW(Deserialize<int>(in) != magicNumber,
+	              "DomainCheckpoint: " << filename << " is not a checkpoint file.");
+	const int fileVersion = Deserialize<int>(in);
+	UG_COND_THROW(fileVersion != version,
+	              "DomainCheckpoint: Unsupported checkpoint version " << fileVersion);
+	const int dim = Deserialize<int>(in);
+	UG_COND_THROW(dim != TDomain::dim, "DomainCheckpoint: Checkpoint was written for a "
+	              << dim << "d domain, but the given domain is " << TDomain::dim << "d.");
+	const int numProcs = Deserialize<int>(in);
+	#ifdef UG_PARALLEL
+		UG_COND_THROW(numProcs != pcl::NumProcs(), "DomainCheckpoint: Checkpoint was written on "
+		              << numProcs << " processes, but running on " << pcl::NumProcs());
+	#else
+		UG_COND_THROW(numProcs != 1, "DomainCheckpoint: Checkpoint was written on "
+		              << numProcs << " processes, but running serial.");
+	#endif
+	Deserialize(in, m_time);
+
+	read_grid(in);
+
+//	remember where index orderings and values are stored
+	const int numDD = Deserialize<int>(in);
+	m_vDoFRecord.resize(numDD);
+	for(int i = 0; i < numDD; ++i){
+		DoFRecord& rec = m_vDoFRecord[i];
+		const int level = Deserialize<int>(in);
+		const int type = Deserialize<int>(in);
+		const bool ghosts = Deserialize<bool>(in);
+		rec.gridLevel = GridLevel(level, (GridLevel::ViewType)type, ghosts);
+		Deserialize(in, rec.numIndex);
+		const size_t blockSize = Deserialize<size_t>(in);
+		rec.readPos = in.read_pos();
+		in.set_read_pos(rec.readPos + blockSize);
+	}
+
+	const int numEntries = Deserialize<int>(in);
+	for(int i = 0; i < numEntries; ++i){
+		std::string name = Deserialize<std::string>(in);
+		ValueRecord& rec = m_mValueRecord[name];
+		Deserialize(in, rec.ddID);
+		const size_t blockSize = Deserialize<size_t>(in);
+		rec.readPos = in.read_pos();
+		in.set_read_pos(rec.readPos + blockSize);
+	}
+
+	UG_COND_THROW(Deserialize<int>(in) != magicNumber,
+	              "DomainCheckpoint: Magic number mismatch at the end of " << filename);
+}
+
+template <typename TDomain, typename TAlgebra>
+void DomainCheckpoint<TDomain, TAlgebra>::
+read_grid(BinaryBuffer& in)
+{
+	TDomain& dom = *m_spDomain;
+	MultiGrid& mg = *dom.grid();
+	SPMessageHub msgHub = mg.message_hub();
+
+	msgHub->post_message(GridMessage_Creation(GMCT_CREATION_STARTS));
+
+//	interfaces are restored explicitly below
+	#ifdef UG_PARALLEL
+		DistributedGridManager& distGridMgr = *dom.distributed_grid_manager();
+		distGridMgr.enable_interface_management(false);
+	#endif
+
+	DeserializeMultiGridElements(mg, in, &m_vVrt, &m_vEdge, &m_vFace, &m_vVol);
+
+//	positions and subset handlers
+	const int numSH = Deserialize<int>(in);
+	std::vector<std::string> vSHName(numSH);
+	for(int i = 0; i < numSH; ++i){
+		Deserialize(in, vSHName[i]);
+		dom.create_additional_subset_handler(vSHName[i]);
+	}
+
+	GridDataSerializationHandler serializer;
+	serializer.add(GeomObjAttachmentSerializer<Vertex, typename TDomain::position_attachment_type>
+					::create(mg, dom.position_attachment()));
+	serializer.add(SubsetHandlerSerializer::create(*dom.subset_handler()));
+	for(size_t i = 0; i < vSHName.size(); ++i)
+		serializer.add(SubsetHandlerSerializer::create(*dom.additional_subset_handler(vSHName[i])));
+
+	serializer.deserialization_starts();
+	serializer.read_infos(in);
+	serializer.deserialize(in, m_vVrt.begin(), m_vVrt.end());
+	serializer.deserialize(in, m_vEdge.begin(), m_vEdge.end());
+	serializer.deserialize(in, m_vFace.begin(), m_vFace.end());
+	serializer.deserialize(in, m_vVol.begin(), m_vVol.end());
+	serializer.deserialization_done();
+
+//	projection handler
+	if(Deserialize<bool>(in)){
+		SPProjectionHandler ph = make_sp(new ProjectionHandler(dom.geometry3d(),
+		                                                       dom.subset_handler()));
+		DeserializeProjectionHandler(in, *ph);
+		dom.set_refinement_projector(ph);
+	}
+
+//	interfaces of the distributed grid
+	const bool hasLayouts = Deserialize<bool>(in);
+	#ifdef UG_PARALLEL
+		GridLayoutMap& glm = distGridMgr.grid_layout_map();
+		if(hasLayouts){
+			DeserializeGridLayoutMap(glm, in, m_vVrt, m_vEdge, m_vFace, m_vVol);
+			glm.remove_empty_interfaces();
+		}
+		distGridMgr.enable_interface_management(true);
+		distGridMgr.grid_layouts_changed(false);
+	#else
+		UG_COND_THROW(hasLayouts, "DomainCheckpoint: The checkpoint contains a "
+		              "distributed grid, which can't be restored in a serial build.");
+	#endif
+
+	msgHub->post_message(GridMessage_Creation(GMCT_CREATION_STOPS));
+}
+
+template <typename TDomain, typename TAlgebra>
+template <typename TBaseElem>
+void DomainCheckpoint<TDomain, TAlgebra>::
+read_dof_indices(BinaryBuffer& in, ConstSmartPtr<DoFDistribution> dd,
+                 const std::vector<TBaseElem*>& vElem,
+                 std::vector<size_t>& vNewInd)
+{
+	std::vector<size_t> vInd;
+	const int numElem = Deserialize<int>(in);
+	for(int i = 0; i < numElem; ++i){
+		const int elemInd = Deserialize<int>(in);
+		const int numInd = Deserialize<int>(in);
+		UG_COND_THROW(elemInd < 0 || elemInd >= (int)vElem.size(),
+		              "DomainCheckpoint: Bad element index " << elemInd);
+
+		dd->inner_algebra_indices(vElem[elemInd], vInd);
+		UG_COND_THROW((int)vInd.size() != numInd,
+		              "DomainCheckpoint: Number of DoFs on element does not match "
+		              "the checkpoint (" << vInd.size() << " instead of " << numInd
+		              << "). Was the approximation space set up identically?");
+
+		for(int k = 0; k < numInd; ++k){
+			const size_t ind = Deserialize<size_t>(in);
+			UG_COND_THROW(vInd[k] >= vNewInd.size() || ind >= vNewInd.size(),
+			              "DomainCheckpoint: Algebra index out of range.");
+			vNewInd[vInd[k]] = ind;
+		}
+	}
+}
+
+template <typename TDomain, typename TAlgebra>
+void DomainCheckpoint<TDomain, TAlgebra>::
+permute_dof_distribution(SmartPtr<DoFDistribution> dd, int ddID)
+{
+	UG_COND_THROW(ddID < 0 || ddID >= (int)m_vDoFRecord.size(),
+	              "DomainCheckpoint: Bad DoFDistribution id " << ddID);
+	const DoFRecord& rec = m_vDoFRecord[ddID];
+
+	UG_COND_THROW(dd->grid_level() != rec.gridLevel,
+	              "DomainCheckpoint: Grid level " << dd->grid_level() << " of the "
+	              "grid function does not match the stored level " << rec.gridLevel);
+	UG_COND_THROW(dd->num_indices() != rec.numIndex,
+	              "DomainCheckpoint: Number of indices (" << dd->num_indices()
+	              << ") does not match the checkpoint (" << rec.numIndex << "). "
+	              "Was the approximation space set up identically?");
+
+	const size_t invalidIndex = (size_t)-1;
+	std::vector<size_t> vNewInd(rec.numIndex, invalidIndex);
+
+	m_buf.set_read_pos(rec.readPos);
+	read_dof_indices<Vertex>(m_buf, dd, m_vVrt, vNewInd);
+	read_dof_indices<Edge>(m_buf, dd, m_vEdge, vNewInd);
+	read_dof_indices<Face>(m_buf, dd, m_vFace, vNewInd);
+	read_dof_indices<Volume>(m_buf, dd, m_vVol, vNewInd);
+
+	for(size_t i = 0; i < vNewInd.size(); ++i){
+		UG_COND_THROW(vNewInd[i] == invalidIndex,
+		              "DomainCheckpoint: No stored index for algebra index " << i);
+	}
+
+	dd->permute_indices(vNewInd);
+}
+
+template <typename TDomain, typename TAlgebra>
+void DomainCheckpoint<TDomain, TAlgebra>::
+read_grid_functions()
+{
+	PROFILE_FUNC_GROUP("disc");
+
+	UG_COND_THROW(m_buf.write_pos() == 0,
+	              "DomainCheckpoint: read_domain has to be called before read_grid_functions.");
+
+//	each DoFDistribution is brought into the stored order exactly once
+	std::map<const DoFDistribution*, int> mPermuted;
+
+	typedef typename std::map<std::string, Entry>::iterator entry_iterator;
+	for(entry_iterator iter = m_mEntry.begin(); iter != m_mEntry.end(); ++iter){
+		Entry& e = iter->second;
+		typename std::map<std::string, ValueRecord>::iterator recIter
+			= m_mValueRecord.find(iter->first);
+		UG_COND_THROW(recIter == m_mValueRecord.end(),
+		              "DomainCheckpoint: No data for '" << iter->first << "' in checkpoint.");
+		const ValueRecord& rec = recIter->second;
+
+		SmartPtr<DoFDistribution> dd = e.spGridFct->dd();
+		typename std::map<const DoFDistribution*, int>::iterator permIter
+			= mPermuted.find(dd.get());
+		if(permIter == mPermuted.end()){
+			permute_dof_distribution(dd, rec.ddID);
+			mPermuted[dd.get()] = rec.ddID;
+		}
+		else{
+			UG_COND_THROW(permIter->second != rec.ddID,
+			              "DomainCheckpoint: Grid function '" << iter->first << "' shares "
+			              "its DoFDistribution with a function, which was stored on a "
+			              "different one.");
+		}
+
+		m_buf.set_read_pos(rec.readPos);
+		const int numSol = Deserialize<int>(m_buf);
+		if(e.spTimeSeries.valid()){
+			e.spTimeSeries->clear();
+			for(int i = 0; i < numSol; ++i){
+				const number time = Deserialize<number>(m_buf);
+				SmartPtr<grid_function_type> sol = e.spGridFct->clone_without_values();
+				read_values(m_buf, *sol);
+				e.spTimeSeries->push(sol, time);
+			}
+		}
+		else{
+			UG_COND_THROW(numSol != 1, "DomainCheckpoint: '" << iter->first
+			              << "' was stored as time series, but is restored as grid function.");
+			Deserialize<number>(m_buf);
+			read_values(m_buf, *e.spGridFct);
+		}
+	}
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__IO__CHECKPOINT_IMPL__ */
@@ -76,7 +76,8 @@ print(const char* filename, Domain<TDim>& domain)
 //	open the file
 	try
 	{
-		VTKFileWriter File(name.c_str());
+		VTKFileWriter File;
+		open_file(File, name);
 
 	//	header
 		File << VTKFileWriter::normal;
@@ -84,10 +85,7 @@ print(const char* filename, Domain<TDim>& domain)
 
 		write_comment(File);
 
-		File << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-		if(IsLittleEndian()) File << "LittleEndian";
-		else File << "BigEndian";
-		File << "\">\n";
+		write_vtkfile_tag(File);
 
 	//	opening the grid
 		File << "  <UnstructuredGrid>\n";
@@ -99,6 +97,7 @@ print(const char* filename, Domain<TDim>& domain)
 		if(dim >= 0)
 		{
 			try{
+				m_pCellCache = NULL;
 				write_grid_piece<MGSubsetHandler>
 				(File, aaVrtIndex, domain.position_accessor(), grid, sh, ssg, dim);
 			}
@@ -117,8 +116,9 @@ print(const char* filename, Domain<TDim>& domain)
 		}
 
 	//	write closing xml tags
+		File << VTKFileWriter::normal;
 		File << "  </UnstructuredGrid>\n";
-		File << "</VTKFile>\n";
+		close_file(File, name);
 
 	// 	detach help indices
 		grid.detach_from_vertices(aVrtIndex);
@@ -140,7 +140,7 @@ write_empty_grid_piece(VTKFileWriter& File, bool binary)
 	File << "    <Piece NumberOfPoints=\"0\" NumberOfCells=\"0\">\n";
 	File << "      <Points>\n";
 	File << "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, binary) << ">\n";
 	if(binary)
 		File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
 	else
@@ -149,18 +149,18 @@ write_empty_grid_piece(VTKFileWriter& File, bool binary)
 	File << "      </Points>\n";
 	File << "      <Cells>\n";
 	File << "        <DataArray type=\"Int32\" Name=\"connectivity\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, binary) << ">\n";
 	if(binary)
 		File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
 	else
 		File << n;
 	File << "\n        </DataArray>\n";
 	File << "        <DataArray type=\"Int32\" Name=\"offsets\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, binary) << ">\n";
 	File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
 	File << "\n        </DataArray>\n";
 	File << "        <DataArray type=\"Int8\" Name=\"types\" format="
-		 <<	(binary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, binary) << ">\n";
 	if(binary)
 		File << VTKFileWriter::base64_binary << n << VTKFileWriter::normal;
 	else
@@ -201,6 +201,99 @@ write_comment_printf(FILE* File)
 	fprintf(File, "-->\n");
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Appended data and asynchronous output
+////////////////////////////////////////////////////////////////////////////////
+
+template <int TDim>
+std::string VTKOutput<TDim>::
+format_attribute(VTKFileWriter& File, bool binary)
+{
+	if(!binary) return "\"ascii\"";
+	if(!File.appended()) return "\"binary\"";
+
+	std::stringstream ss;
+	ss << "\"appended\" offset=\"" << File.appended_offset() << "\"";
+	return ss.str();
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+set_compression(int level)
+{
+#ifndef UG_ZLIB
+	if(level != 0)
+		UG_THROW("VTK::set_compression: ug was compiled without zlib support."
+				" Reconfigure with 'cmake -DUSE_ZLIB=ON'.");
+#endif
+	if(level < 0 || level > 9)
+		UG_THROW("VTK::set_compression: Compression level must be in [0,9],"
+				" but is " << level);
+	m_compressionLevel = level;
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+set_async(bool b)
+{
+	if(!b) wait_for_output();
+	m_bAsync = b;
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+wait_for_output()
+{
+	if(m_spAsyncWriter.valid())
+		m_spAsyncWriter->wait();
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+open_file(VTKFileWriter& File, const std::string& name)
+{
+	if(m_bAsync) File.open_memory();
+	else File.open(name.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+	File.set_appended(m_bBinary && m_bAppended);
+	if(File.appended())
+		File.set_compression_level(m_compressionLevel);
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+write_vtkfile_tag(VTKFileWriter& File)
+{
+	File << VTKFileWriter::normal;
+	File << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
+	if(IsLittleEndian()) File << "LittleEndian";
+	else File << "BigEndian";
+	File << "\"";
+	if(File.appended() && File.compression_level() > 0)
+		File << " compressor=\"vtkZLibDataCompressor\"";
+	File << ">\n";
+}
+
+template <int TDim>
+void VTKOutput<TDim>::
+close_file(VTKFileWriter& File, const std::string& name)
+{
+	if(File.appended())
+		File.write_appended_data();
+
+	File << VTKFileWriter::normal;
+	File << "</VTKFile>\n";
+
+	if(m_bAsync){
+		std::string buffer;
+		File.take_buffer(buffer);
+		if(m_spAsyncWriter.invalid())
+			m_spAsyncWriter = make_sp(new AsyncFileWriter);
+		m_spAsyncWriter->submit(name, buffer);
+	}
+	else File.close();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // FileNames
 ////////////////////////////////////////////////////////////////////////////////
@@ -43,7 +43,10 @@
 // other ug modules
 #include "common/util/string_util.h"
 #include "common/util/base64_file_writer.h"
+#include "common/util/async_file_writer.h"
+#include "common/util/smart_pointer.h"
 #include "lib_disc/common/function_group.h"
+#include "lib_disc/common/revision_counter.h"
 #include "lib_disc/domain.h"
 #include "lib_disc/spatial_disc/user_data/user_data.h"
 
@@ -526,6 +529,9 @@ public:
 		static void write_empty_grid_piece(VTKFileWriter& File,
 				bool binary = true);
 
+	///	returns the format attribute of a DataArray (with offset if appended)
+		static std::string format_attribute(VTKFileWriter& File, bool binary);
+
 		void set_user_defined_comment(const char* comment) {m_sComment = comment;};
 
 protected:
@@ -533,6 +539,15 @@ protected:
 		// writes an xml comment to a vtu file
 		void write_comment(VTKFileWriter& File);
 
+		// opens a vtu file (or a memory buffer, if written asynchronously)
+		void open_file(VTKFileWriter& File, const std::string& name);
+
+		// writes the opening VTKFile tag
+		void write_vtkfile_tag(VTKFileWriter& File);
+
+		// writes the appended data and the closing VTKFile tag and closes the file
+		void close_file(VTKFileWriter& File, const std::string& name);
+
 		// writes an xml comment to a pvd file
 		void write_comment_printf(FILE* File);
 
@@ -879,11 +894,24 @@ protected:
 
 	public:
 	///	default constructor
-		VTKOutput()	: m_bSelectAll(true), m_bBinary(true), m_bWriteGrid(true), m_bWriteSubsetIndices(false), m_bWriteProcRanks(false) {} //TODO: maybe true?
+		VTKOutput()	: m_bSelectAll(true), m_bBinary(true), m_bWriteGrid(true), m_bWriteSubsetIndices(false), m_bWriteProcRanks(false),
+					  m_bAppended(false), m_compressionLevel(0), m_bAsync(false), m_pCellCache(NULL) {} //TODO: maybe true?
 
 	/// should values be printed in binary (base64 encoded way ) or plain ascii
 		void set_binary(bool b) {m_bBinary = b;};
 
+	/// should binary values be written raw in an appended block (instead of base64 inline)
+		void set_appended(bool b) {m_bAppended = b;};
+
+	/// zlib compression level (0 = none, 1-9) of appended binary data
+		void set_compression(int level);
+
+	/// should vtu files be written by a background thread
+		void set_async(bool b);
+
+	///	waits until all files written in the background are finished
+		void wait_for_output();
+
 		void set_write_grid(bool b) {m_bWriteGrid = b;};
 
 		void set_write_subset_indices(bool b) {m_bWriteSubsetIndices = b;};
@@ -957,6 +985,35 @@ protected:
 
 		bool m_bWriteSubsetIndices;
 		bool m_bWriteProcRanks;
+
+	///	raw appended binary data, its compression and asynchronous writing
+		bool m_bAppended;
+		int m_compressionLevel;
+		bool m_bAsync;
+		SmartPtr<AsyncFileWriter> m_spAsyncWriter;
+
+	///	cached appended cell arrays (connectivity, offsets, types)
+	/**
+	 * For time series on an unchanged grid, the cell arrays are the same in
+	 * each file. In appended mode they are encoded once and reused as long as
+	 * the revision of the approximation space and the sizes do not change.
+	 * Points are always rewritten, since the positions may change.
+	 */
+		struct CellCache
+		{
+			CellCache() : numElem(-1), numConn(-1), compressionLevel(0) {}
+			RevisionCounter revision;
+			int numElem, numConn;
+			int compressionLevel;
+			std::string vArray[3];
+		};
+		std::map<std::string, CellCache> m_mCellCache;
+		CellCache* m_pCellCache;
+
+	///	selects the cell cache for the given output (or NULL if not appended)
+		template <typename TFunction>
+		CellCache* cell_cache(VTKFileWriter& File, const char* filename,
+		                      TFunction& u, const SubsetGroup& ssGrp, int dim);
 };
 
 } // namespace ug
@@ -35,6 +35,7 @@
 #include <iostream>
 #include <cstring>
 #include <string>
+#include <sstream>
 #include <algorithm>
 
 // ug4 libraries
@@ -283,7 +284,8 @@ print_subset(const char* filename, TFunction& u, int si, int step, number time,
 //	open the file
 	try
 	{
-		VTKFileWriter File(name.c_str());
+		VTKFileWriter File;
+		open_file(File, name);
 
 	//	bool if time point should be written to *.vtu file
 	//	in parallel we must not (!) write it to the *.vtu file, but to the *.pvtu
@@ -298,10 +300,7 @@ print_subset(const char* filename, TFunction& u, int si, int step, number time,
 
 		write_comment(File);
 
-		File << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-		if(IsLittleEndian()) File << "LittleEndian";
-		else File << "BigEndian";
-		File << "\">\n";
+		write_vtkfile_tag(File);
 
 	//	writing time point
 		if(bTimeDep)
@@ -319,7 +318,9 @@ print_subset(const char* filename, TFunction& u, int si, int step, number time,
 		if(dim >= 0)
 		{
 			try{
+				m_pCellCache = cell_cache(File, filename, u, ssg, dim);
 				write_grid_solution_piece(File, aaVrtIndex, grid, u, time, ssg, dim);
+				m_pCellCache = NULL;
 			}
 			UG_CATCH_THROW("VTK::print_subset: Can not write Subset: "<<si);
 		}
@@ -338,7 +339,7 @@ print_subset(const char* filename, TFunction& u, int si, int step, number time,
 	//	write closing xml tags
 		File << VTKFileWriter::normal;
 		File << "  </UnstructuredGrid>\n";
-		File << "</VTKFile>\n";
+		close_file(File, name);
 
 	// 	detach help indices
 		grid.detach_from_vertices(aVrtIndex);
@@ -416,7 +417,8 @@ print_subsets(const char* filename, TFunction& u, const SubsetGroup& ssGrp, int
 //	open the file
 	try
 	{
-		VTKFileWriter File(name.c_str());
+		VTKFileWriter File;
+		open_file(File, name);
 
 	//	bool if time point should be written to *.vtu file
 	//	in parallel we must not (!) write it to the *.vtu file, but to the *.pvtu
@@ -431,10 +433,7 @@ print_subsets(const char* filename, TFunction& u, const SubsetGroup& ssGrp, int
 
 		write_comment(File);
 
-		File << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-		if(IsLittleEndian()) File << "LittleEndian";
-		else File << "BigEndian";
-		File << "\">\n";
+		write_vtkfile_tag(File);
 
 	//	writing time point
 		if(bTimeDep)
@@ -458,7 +457,9 @@ print_subsets(const char* filename, TFunction& u, const SubsetGroup& ssGrp, int
 		if(dim >= 0)
 		{
 			try{
+				m_pCellCache = cell_cache(File, filename, u, ssGrp, dim);
 				write_grid_solution_piece(File, aaVrtIndex, grid, u, time, ssGrp, dim);
+				m_pCellCache = NULL;
 			}
 			UG_CATCH_THROW("VTK::print_subsets: Can not write the subsets");
 		}
@@ -471,7 +472,7 @@ print_subsets(const char* filename, TFunction& u, const SubsetGroup& ssGrp, int
 	//	write closing xml tags
 		File << VTKFileWriter::normal;
 		File << "  </UnstructuredGrid>\n";
-		File << "</VTKFile>\n";
+		close_file(File, name);
 
 	// 	detach help indices
 		grid.detach_from_vertices(aVrtIndex);
@@ -822,7 +823,7 @@ write_points(VTKFileWriter& File,
 	File << VTKFileWriter::normal;
 	File << "      <Points>\n";
 	File << "        <DataArray type=\"Float32\" NumberOfComponents=\"3\" format="
-		 <<	(m_bBinary ? "\"binary\"" : "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, m_bBinary) << ">\n";
 	int n = 3*sizeof(float) * numVert;
 	if(m_bBinary)
 		File << VTKFileWriter::base64_binary << n;
@@ -879,6 +880,35 @@ write_cell_subset_names(VTKFileWriter& File, MGSubsetHandler &sh)
 	File << "      </RegionInfo>\n";
 }
 
+/**
+ * Returns the cache of the cell arrays for the given output. The cache is
+ * reset if the approximation space has been modified or the compression
+ * changed since the cache has been filled.
+ */
+template <int TDim>
+template <typename TFunction>
+typename VTKOutput<TDim>::CellCache* VTKOutput<TDim>::
+cell_cache(VTKFileWriter& File, const char* filename, TFunction& u,
+           const SubsetGroup& ssGrp, int dim)
+{
+	if(!File.appended()) return NULL;
+
+	std::stringstream ss;
+	ss << filename << ':' << u.grid_level() << ':' << dim;
+	for(size_t i = 0; i < ssGrp.size(); ++i)
+		ss << ':' << ssGrp[i];
+
+	CellCache& cache = m_mCellCache[ss.str()];
+	if(cache.revision != u.approx_space()->revision()
+		|| cache.compressionLevel != File.compression_level())
+	{
+		cache = CellCache();
+		cache.revision = u.approx_space()->revision();
+		cache.compressionLevel = File.compression_level();
+	}
+	return &cache;
+}
+
 /**
  * This function writes the elements that are part of the specified subsets.
  */
@@ -895,14 +925,41 @@ write_cells(VTKFileWriter& File,
 //	write opening tag to indicate that elements will be written
 	File << "      <Cells>\n";
 
+//	reuse the appended arrays of the last output, if the grid is unchanged
+	CellCache* pCache = File.appended() ? m_pCellCache : NULL;
+	if(pCache && pCache->numElem == numElem && pCache->numConn == numConn)
+	{
+		static const char* vType[] = {"Int32", "Int32", "Int8"};
+		static const char* vName[] = {"connectivity", "offsets", "types"};
+		for(int i = 0; i < 3; ++i){
+			File << "        <DataArray type=\"" << vType[i] << "\" Name=\""
+				 << vName[i] << "\" format=" << format_attribute(File, m_bBinary) << ">\n";
+			File.append_encoded_array(pCache->vArray[i]);
+			File << "\n        </DataArray>\n";
+		}
+
+		File << "      </Cells>\n";
+		return;
+	}
+
+	size_t offset = File.appended_offset();
+
 //	write connectivities of elements
 	write_cell_connectivity(File, aaVrtIndex, grid, iterContainer, ssGrp, dim, numConn);
+	if(pCache) {pCache->vArray[0] = File.appended_data(offset); offset = File.appended_offset();}
 
 //	write offsets for elements (i.e. number of nodes counted up)
 	write_cell_offsets(File, iterContainer, ssGrp, dim, numElem);
+	if(pCache) {pCache->vArray[1] = File.appended_data(offset); offset = File.appended_offset();}
 
 //	write a defined type for each cell
 	write_cell_types(File, iterContainer, ssGrp, dim, numElem);
+	if(pCache){
+		File << VTKFileWriter::normal;
+		pCache->vArray[2] = File.appended_data(offset);
+		pCache->numElem = numElem;
+		pCache->numConn = numConn;
+	}
 
 //	write closing tag
 	File << VTKFileWriter::normal;
@@ -1016,7 +1073,7 @@ write_cell_connectivity(VTKFileWriter& File,
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that connections will be written
 	File << "        <DataArray type=\"Int32\" Name=\"connectivity\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, m_bBinary) << ">\n";
 	int n = sizeof(int) * numConn;
 
 	if(m_bBinary)
@@ -1119,7 +1176,7 @@ write_cell_offsets(VTKFileWriter& File, const T& iterContainer, const SubsetGrou
 	File << VTKFileWriter::normal;
 //	write opening tag indicating that offsets are going to be written
 	File << "        <DataArray type=\"Int32\" Name=\"offsets\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, m_bBinary) << ">\n";
 	int n = sizeof(int) * numElem;
 	if(m_bBinary)
 		File << VTKFileWriter::base64_binary << n;
@@ -1234,7 +1291,7 @@ write_cell_types(VTKFileWriter& File, const T& iterContainer, const SubsetGroup&
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that types will be written
 	File << "        <DataArray type=\"Int8\" Name=\"types\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, m_bBinary) << ">\n";
 	if(m_bBinary)
 		File << VTKFileWriter::base64_binary << numElem;
 
@@ -1316,7 +1373,7 @@ write_cell_subsets(VTKFileWriter& File, const T& iterContainer, const SubsetGrou
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that types will be written
 	File << "        <DataArray type=\"Int8\" Name=\"regions\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, m_bBinary) << ">\n";
 	if(m_bBinary)
 		File << VTKFileWriter::base64_binary << numElem;
 
@@ -1399,7 +1456,7 @@ write_cell_proc_ranks(VTKFileWriter& File, const T& iterContainer, const SubsetG
 	File << VTKFileWriter::normal;
 //	write opening tag to indicate that types will be written
 	File << "        <DataArray type=\"Int8\" Name=\"proc_ranks\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, m_bBinary) << ">\n";
 	if(m_bBinary)
 		File << VTKFileWriter::base64_binary << numElem;
 
@@ -1550,7 +1607,7 @@ write_nodal_data(VTKFileWriter& File, TFunction& u, number time,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<numCmp<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numVert * numCmp;
 	if(m_bBinary)
@@ -1667,7 +1724,7 @@ write_nodal_values(VTKFileWriter& File, TFunction& u,
 //	write opening tag
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<(vFct.size() == 1 ? 1 : 3)<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numVert * (vFct.size() == 1 ? 1 : 3);
 	if(m_bBinary)
@@ -1936,7 +1993,7 @@ write_cell_data(VTKFileWriter& File, TFunction& u, number time,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<numCmp<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numElem * numCmp;
 	if(m_bBinary)
@@ -2074,7 +2131,7 @@ write_cell_values(VTKFileWriter& File, TFunction& u,
 	File << VTKFileWriter::normal;
 	File << "        <DataArray type=\"Float32\" Name=\""<<name<<"\" "
 	"NumberOfComponents=\""<<(vFct.size() == 1 ? 1 : 3)<<"\" format="
-		 <<	(m_bBinary ? "\"binary\"": "\"ascii\"") << ">\n";
+		 <<	format_attribute(File, m_bBinary) << ">\n";
 
 	int n = sizeof(float) * numElem * (vFct.size() == 1 ? 1 : 3);
 	if(m_bBinary)
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__LAGRANGE__LAGRANGE_TENSOR_PROD__
+#define __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__LAGRANGE__LAGRANGE_TENSOR_PROD__
+
+#include <vector>
+#include <cmath>
+
+#include "common/common.h"
+#include "common/math/ugmath.h"
+#include "lib_disc/local_finite_element/local_shape_function_set.h"
+#include "lib_disc/local_finite_element/common/lagrange1d.h"
+#include "lib_disc/quadrature/quadrature.h"
+
+namespace ug{
+
+///	Sum-factorized evaluation of Lagrange shape functions on tensor-product elements
+/**
+ * On edges, quadrilaterals and hexahedra the Lagrange shape functions of
+ * order p are products of 1D Lagrange polynomials and a Gauss-Legendre rule
+ * is the tensor product of a 1D rule. Thus, interpolation of a function to
+ * the integration points, its local gradient and the transposed operations
+ * (testing with the shape functions or their gradients) can be computed by
+ * applying the 1D tables along one direction after the other. This costs
+ * O(p^(dim+1)) per element instead of O(p^(2*dim)) for the evaluation with
+ * the full tables.
+ *
+ * The dofs are passed in the ordering of the local shape function set, the
+ * values at the integration points are in the ordering of the tensor-product
+ * Gauss-Legendre rules (GaussQuadratureQuadrilateral etc.), i.e. with the
+ * first coordinate running slowest.
+ *
+ * Only local quantities are handled: the pull-back of gradients with the
+ * Jacobian of the element mapping and the integration weights are left to
+ * the caller. Element discretizations use the kernel through the
+ * TensorProductFEGeometry, which is obtained from the GeomProvider like the
+ * other FE geometries and adds the element mapping.
+ *
+ * \tparam	TDim	reference element dimension
+ */
+template <int TDim>
+class LagrangeTensorProduct
+{
+	public:
+	///	reference element dimension
+		static const int dim = TDim;
+
+	public:
+	///	Constructor
+		LagrangeTensorProduct() : m_p(0), m_n1d(0), m_nq1d(0), m_nsh(0), m_nip(0) {}
+
+	///	initializes the 1D tables
+	/**
+	 * \param[in]	lsfs		the Lagrange shape function set (for dof ordering),
+	 * 							a LocalShapeFunctionSet or a LagrangeLSFS
+	 * \param[in]	p			order of the Lagrange space
+	 * \param[in]	quadRule1D	1D Gauss-Legendre rule the tensor rule is built of
+	 */
+		template <typename TLSFS>
+		void init(const TLSFS& lsfs, size_t p,
+		          const QuadratureRule<1>& quadRule1D)
+		{
+			m_p = p;
+			m_n1d = p+1;
+			m_nq1d = quadRule1D.size();
+			m_nsh = 1; m_nip = 1;
+			for(int d = 0; d < dim; ++d) {m_nsh *= m_n1d; m_nip *= m_nq1d;}
+
+			if(lsfs.num_sh() != m_nsh)
+				UG_THROW("LagrangeTensorProduct: Expected "<<m_nsh<<" shape "
+						"functions for order "<<p<<", but got "<<lsfs.num_sh());
+
+		//	1D tables: B(q,i) = phi_i(x_q), D(q,i) = phi_i'(x_q)
+			m_vB.resize(m_nq1d*m_n1d);
+			m_vD.resize(m_nq1d*m_n1d);
+			for(size_t i = 0; i < m_n1d; ++i)
+			{
+				EquidistantLagrange1D phi(i, p);
+				Polynomial1D dphi = phi.derivative();
+				for(size_t q = 0; q < m_nq1d; ++q)
+				{
+					m_vB[q*m_n1d + i] = phi.value(quadRule1D.point(q)[0]);
+					m_vD[q*m_n1d + i] = dphi.value(quadRule1D.point(q)[0]);
+				}
+			}
+
+		//	map lexicographic dof index to shape index via interpolation points
+			m_vLexToShape.assign(m_nsh, m_nsh);
+			for(size_t sh = 0; sh < m_nsh; ++sh)
+			{
+				MathVector<dim> pos;
+				if(!lsfs.position(sh, pos))
+					UG_THROW("LagrangeTensorProduct: No position for shape "<<sh);
+
+				size_t lex = 0;
+				for(int d = 0; d < dim; ++d)
+					lex = lex * m_n1d + (size_t)std::floor(pos[d] * p + 0.5);
+
+				if(lex >= m_nsh || m_vLexToShape[lex] != m_nsh)
+					UG_THROW("LagrangeTensorProduct: Shape functions are not "
+							"of tensor-product type.");
+				m_vLexToShape[lex] = sh;
+			}
+		}
+
+	///	number of shape functions
+		size_t num_sh() const {return m_nsh;}
+
+	///	number of integration points
+		size_t num_ip() const {return m_nip;}
+
+	///	values at the integration points: vValue[ip] = sum_sh vDoF[sh] * phi_sh(x_ip)
+		void interpolate(number* vValue, const number* vDoF) const
+		{
+			gather(m_vIn, vDoF);
+			for(int a = 0; a < dim; ++a)
+				apply_1d(m_vIn, m_vB, false, a);
+			for(size_t ip = 0; ip < m_nip; ++ip) vValue[ip] = m_vIn[ip];
+		}
+
+	///	local gradients at the integration points
+		void local_grad(MathVector<dim>* vGrad, const number* vDoF) const
+		{
+			for(int d = 0; d < dim; ++d)
+			{
+				gather(m_vIn, vDoF);
+				for(int a = 0; a < dim; ++a)
+					apply_1d(m_vIn, (a == d) ? m_vD : m_vB, false, a);
+				for(size_t ip = 0; ip < m_nip; ++ip) vGrad[ip][d] = m_vIn[ip];
+			}
+		}
+
+	///	adds the tested values: vDoF[sh] += sum_ip vValue[ip]*phi_sh(x_ip) + vGrad[ip]*grad phi_sh(x_ip)
+	/**
+	 * Both, vValue and vGrad, may be NULL if not needed.
+	 */
+		void integrate(number* vDoF, const number* vValue,
+		               const MathVector<dim>* vGrad) const
+		{
+			if(vValue != NULL)
+			{
+				m_vIn.assign(vValue, vValue + m_nip);
+				for(int a = 0; a < dim; ++a)
+					apply_1d(m_vIn, m_vB, true, a);
+				scatter_add(vDoF, m_vIn);
+			}
+
+			if(vGrad != NULL)
+			{
+				for(int d = 0; d < dim; ++d)
+				{
+					m_vIn.resize(m_nip);
+					for(size_t ip = 0; ip < m_nip; ++ip) m_vIn[ip] = vGrad[ip][d];
+					for(int a = 0; a < dim; ++a)
+						apply_1d(m_vIn, (a == d) ? m_vD : m_vB, true, a);
+					scatter_add(vDoF, m_vIn);
+				}
+			}
+		}
+
+	protected:
+	///	copies the dofs to lexicographic ordering
+		void gather(std::vector<number>& vLex, const number* vDoF) const
+		{
+			vLex.resize(m_nsh);
+			for(size_t lex = 0; lex < m_nsh; ++lex)
+				vLex[lex] = vDoF[m_vLexToShape[lex]];
+		}
+
+	///	adds lexicographic values to the dofs
+		void scatter_add(number* vDoF, const std::vector<number>& vLex) const
+		{
+			for(size_t lex = 0; lex < m_nsh; ++lex)
+				vDoF[m_vLexToShape[lex]] += vLex[lex];
+		}
+
+	///	applies a 1D table (or its transposed) along one direction
+	/**
+	 * The tensor in vT has extent m_nq1d in all directions < axis and m_n1d in
+	 * all directions >= axis when applying the table (dof -> ip), resp. m_n1d
+	 * in directions < axis and m_nq1d in directions >= axis when applying the
+	 * transposed (ip -> dof).
+	 */
+		void apply_1d(std::vector<number>& vT, const std::vector<number>& vTable,
+		              bool bTransposed, int axis) const
+		{
+			const size_t nIn = bTransposed ? m_nq1d : m_n1d;
+			const size_t nOut = bTransposed ? m_n1d : m_nq1d;
+
+			size_t outer = 1, inner = 1;
+			for(int d = 0; d < axis; ++d) outer *= nOut;
+			for(int d = axis+1; d < dim; ++d) inner *= nIn;
+
+			m_vOut.assign(outer*nOut*inner, 0.0);
+			for(size_t o = 0; o < outer; ++o)
+				for(size_t r = 0; r < nOut; ++r)
+				{
+					number* out = &m_vOut[(o*nOut + r)*inner];
+					for(size_t c = 0; c < nIn; ++c)
+					{
+						const number m = bTransposed ? vTable[c*m_n1d + r]
+						                             : vTable[r*m_n1d + c];
+						if(m == 0.0) continue;
+						const number* in = &vT[(o*nIn + c)*inner];
+						for(size_t i = 0; i < inner; ++i)
+							out[i] += m * in[i];
+					}
+				}
+			vT.swap(m_vOut);
+		}
+
+	protected:
+	///	order, number of 1D dofs and integration points
+		size_t m_p, m_n1d, m_nq1d;
+
+	///	number of shape functions and integration points
+		size_t m_nsh, m_nip;
+
+	///	1D tables of shape values and derivatives (size: nq1d x n1d)
+		std::vector<number> m_vB, m_vD;
+
+	///	mapping lexicographic index -> shape index
+		std::vector<size_t> m_vLexToShape;
+
+	///	work arrays
+		mutable std::vector<number> m_vIn, m_vOut;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__LAGRANGE__LAGRANGE_TENSOR_PROD__ */
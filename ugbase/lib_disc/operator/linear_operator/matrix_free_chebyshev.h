@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_CHEBYSHEV__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_CHEBYSHEV__
+
+#include "lib_algebra/operator/interface/linear_iterator.h"
+#include "matrix_free_operator.h"
+#include "matrix_free_jacobi.h"
+
+namespace ug{
+
+///	Chebyshev smoother for matrix-free operators
+/**
+ * This iterator applies a Chebyshev polynomial in D^{-1}A to the defect,
+ * where D is the diagonal of a MatrixFreeOperator A. The polynomial damps the
+ * error components with eigenvalues of D^{-1}A in [lambda_max/ratio,
+ * lambda_max]. Only applications of A and the diagonal are needed, thus no
+ * matrix is required.
+ *
+ * The largest eigenvalue is estimated by a few steps of the power method on
+ * the first application after init (or set explicitly). It is enlarged by
+ * 10 percent for safety.
+ *
+ * References:
+ * <ul>
+ * <li> Y. Saad. Iterative Methods for Sparse Linear Systems, Alg. 12.1
+ * <li> M. Adams, M. Brezina, J. Hu, R. Tuminaro. Parallel multigrid smoothing:
+ *		polynomial versus Gauss-Seidel. J. Comput. Phys. 188 (2003)
+ * </ul>
+ *
+ * \tparam	TAlgebra	algebra type
+ */
+template <typename TAlgebra>
+class MatrixFreeChebyshev : public ILinearIterator<typename TAlgebra::vector_type>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Base type
+		typedef ILinearIterator<vector_type> base_type;
+
+	protected:
+		using base_type::damping;
+
+	public:
+	///	default constructor
+		MatrixFreeChebyshev()
+			: m_degree(4), m_eigRatio(20.0), m_numPowerIt(10),
+			  m_userLambdaMax(0.0), m_lambdaMax(0.0)
+		{}
+
+	/// clone constructor
+		MatrixFreeChebyshev(const MatrixFreeChebyshev<TAlgebra>& parent)
+			: base_type(parent),
+			  m_degree(parent.m_degree), m_eigRatio(parent.m_eigRatio),
+			  m_numPowerIt(parent.m_numPowerIt),
+			  m_userLambdaMax(parent.m_userLambdaMax), m_lambdaMax(0.0)
+		{}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new MatrixFreeChebyshev<algebra_type>(*this));
+		}
+
+	///	Destructor
+		virtual ~MatrixFreeChebyshev() {};
+
+	///	sets the degree of the polynomial (number of operator applications)
+		void set_degree(int degree)
+		{
+			if(degree < 1) UG_THROW("MatrixFreeChebyshev: Degree must be positive.");
+			m_degree = degree;
+		}
+
+	///	sets the ratio lambda_max / lambda_min of the damped eigenvalue range
+		void set_eigenvalue_ratio(number ratio)
+		{
+			if(ratio <= 1.0) UG_THROW("MatrixFreeChebyshev: Ratio must be greater than 1.");
+			m_eigRatio = ratio;
+		}
+
+	///	sets the number of power iterations used to estimate lambda_max
+		void set_num_power_iterations(int num) {m_numPowerIt = num;}
+
+	///	sets lambda_max of D^{-1}A (no estimation is performed if positive)
+		void set_max_eigenvalue(number lambdaMax) {m_userLambdaMax = lambdaMax;}
+
+	///	returns the name of iterator
+		virtual const char* name() const {return "MatrixFreeChebyshev";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const {return true;}
+
+	///	initialize for operator J(u) and linearization point u
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > J, const vector_type& u)
+		{
+			return init(J);
+		}
+
+	///	initialize for linear operator L
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > L)
+		{
+			m_spOp = L.template cast_dynamic<MatrixFreeOperator<TAlgebra> >();
+			if(m_spOp.invalid())
+				UG_THROW(name() << "::init: Passed operator is not a MatrixFreeOperator.");
+			m_lambdaMax = m_userLambdaMax;
+			return true;
+		}
+
+	///	compute new correction c = B*d
+		virtual bool apply(vector_type& c, const vector_type& d)
+		{
+			SmartPtr<vector_type> spR = d.clone();
+			if(!chebyshev(c, *spR, false)) return false;
+
+		//	apply scaling
+			const number kappa = damping()->damping(c, d, m_spOp);
+			if(kappa != 1.0) c *= kappa;
+
+			return true;
+		}
+
+	///	compute new correction c = B*d and update defect d := d - A*c
+		virtual bool apply_update_defect(vector_type& c, vector_type& d)
+		{
+		//	the defect is updated during the iteration only if the correction
+		//	is not scaled afterwards
+			if(damping()->constant_damping() && damping()->damping() == 1.0)
+				return chebyshev(c, d, true);
+
+			if(!apply(c, d)) return false;
+			m_spOp->apply_sub(d, c);
+			return true;
+		}
+
+	protected:
+	///	estimates the largest eigenvalue of D^{-1}A by the power method
+		void estimate_max_eigenvalue(const vector_type& d)
+		{
+			PROFILE_BEGIN_GROUP(MatrixFreeChebyshev_estimate, "discretization");
+			const vector_type& diag = m_spOp->diagonal(d);
+
+			SmartPtr<vector_type> spX = d.clone_without_values();
+			SmartPtr<vector_type> spY = d.clone_without_values();
+			spX->set_random(-1.0, 1.0);
+
+			number lambda = 0.0;
+			for(int k = 0; k < m_numPowerIt; ++k)
+			{
+				const number normX = spX->norm();
+				if(normX == 0.0) break;
+
+			//	y = A x, x_new = D^{-1} y
+				m_spOp->apply(*spY, *spX);
+				ApplyInverseDiagonal(*spX, diag, *spY, 1.0/normX);
+				lambda = spX->norm();
+			}
+
+			if(lambda <= 0.0)
+				UG_THROW(name() << ": Cannot estimate largest eigenvalue.");
+			m_lambdaMax = 1.1 * lambda;
+		}
+
+	///	Chebyshev iteration, r holds the defect and is updated if requested
+		bool chebyshev(vector_type& c, vector_type& r, bool bUpdateDefect)
+		{
+			PROFILE_BEGIN_GROUP(MatrixFreeChebyshev_apply, "discretization");
+			if(m_spOp.invalid())
+			{
+				UG_LOG("ERROR in '"<<name()<<"::apply': Iterator not initialized.\n");
+				return false;
+			}
+
+		//	Check parallel status
+			#ifdef UG_PARALLEL
+			if(!r.has_storage_type(PST_ADDITIVE))
+				UG_THROW(name() << "::apply: Wrong parallel "
+				               "storage format. Defect must be additive.");
+			#endif
+
+			if(m_lambdaMax <= 0.0) estimate_max_eigenvalue(r);
+			const vector_type& diag = m_spOp->diagonal(r);
+
+		//	parameters of the polynomial on [lambdaMin, lambdaMax]
+			const number lambdaMin = m_lambdaMax / m_eigRatio;
+			const number theta = 0.5 * (m_lambdaMax + lambdaMin);
+			const number delta = 0.5 * (m_lambdaMax - lambdaMin);
+			const number sigma = theta / delta;
+			number rho = 1.0 / sigma;
+
+		//	first step: p = 1/theta * D^{-1} r
+			SmartPtr<vector_type> spP = c.clone_without_values();
+			SmartPtr<vector_type> spZ = c.clone_without_values();
+			ApplyInverseDiagonal(*spP, diag, r, 1.0/theta);
+			c = *spP;
+
+			for(int k = 1; k < m_degree; ++k)
+			{
+				m_spOp->apply_sub(r, *spP);
+
+			//	p = rho_new*rho * p + 2*rho_new/delta * D^{-1} r
+				const number rhoNew = 1.0 / (2.0*sigma - rho);
+				ApplyInverseDiagonal(*spZ, diag, r, 1.0);
+				VecScaleAdd(*spP, rhoNew*rho, *spP, 2.0*rhoNew/delta, *spZ);
+				c += *spP;
+				rho = rhoNew;
+			}
+
+			if(bUpdateDefect)
+				m_spOp->apply_sub(r, *spP);
+
+			return true;
+		}
+
+	protected:
+	///	underlying operator
+		SmartPtr<MatrixFreeOperator<TAlgebra> > m_spOp;
+
+	///	degree of the polynomial
+		int m_degree;
+
+	///	ratio lambda_max / lambda_min
+		number m_eigRatio;
+
+	///	number of power iterations
+		int m_numPowerIt;
+
+	///	eigenvalue bound set by user, estimated value
+		number m_userLambdaMax;
+		number m_lambdaMax;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_CHEBYSHEV__ */
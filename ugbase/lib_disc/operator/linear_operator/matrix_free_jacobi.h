@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_JACOBI__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_JACOBI__
+
+#include "lib_algebra/operator/interface/linear_iterator.h"
+#include "lib_algebra/small_algebra/small_algebra.h"
+#include "matrix_free_operator.h"
+
+namespace ug{
+
+///	computes c = damp * D^{-1} * d for a (pointwise) diagonal D
+/**
+ * The diagonal is given as a vector. For block algebras the diagonal of each
+ * block is used, i.e. this is a pointwise Jacobi.
+ */
+template <typename TVector>
+void ApplyInverseDiagonal(TVector& c, const TVector& diag, const TVector& d, number damp)
+{
+	for(size_t i = 0; i < d.size(); ++i)
+		for(size_t alpha = 0; alpha < GetSize(d[i]); ++alpha)
+		{
+			const number& dii = BlockRef(diag[i], alpha);
+			if(dii == 0.0)
+				UG_THROW("ApplyInverseDiagonal: Zero diagonal entry at index "
+						<<i<<", component "<<alpha<<".");
+			BlockRef(c[i], alpha) = damp * BlockRef(d[i], alpha) / dii;
+		}
+
+#ifdef UG_PARALLEL
+// 	the computed correction is additive, we make it consistent
+	c.set_storage_type(PST_ADDITIVE);
+	if(!c.change_storage_type(PST_CONSISTENT))
+		UG_THROW("ApplyInverseDiagonal: Cannot change parallel storage type "
+				"of correction to consistent.");
+#endif
+}
+
+///	Jacobi smoother for matrix-free operators
+/**
+ * This iterator computes the correction c = damp * D^{-1} * d, where D is
+ * the diagonal of a MatrixFreeOperator. The diagonal is assembled element-wise
+ * by the operator, no matrix is needed. For block algebras the pointwise
+ * diagonal is used.
+ *
+ * \tparam	TAlgebra	algebra type
+ */
+template <typename TAlgebra>
+class MatrixFreeJacobi : public ILinearIterator<typename TAlgebra::vector_type>
+{
+	public:
+	///	Algebra type
+		typedef TAlgebra algebra_type;
+
+	///	Vector type
+		typedef typename TAlgebra::vector_type vector_type;
+
+	///	Base type
+		typedef ILinearIterator<vector_type> base_type;
+
+	protected:
+		using base_type::damping;
+
+	public:
+	///	default constructor
+		MatrixFreeJacobi() {this->set_damp(1.0);};
+
+	///	constructor setting the damping parameter
+		MatrixFreeJacobi(number damp) {this->set_damp(damp);};
+
+	/// clone constructor
+		MatrixFreeJacobi(const MatrixFreeJacobi<TAlgebra>& parent)
+			: base_type(parent) {}
+
+	///	Clone
+		virtual SmartPtr<ILinearIterator<vector_type> > clone()
+		{
+			return make_sp(new MatrixFreeJacobi<algebra_type>(*this));
+		}
+
+	///	Destructor
+		virtual ~MatrixFreeJacobi() {};
+
+	///	returns the name of iterator
+		virtual const char* name() const {return "MatrixFreeJacobi";}
+
+	///	returns if parallel solving is supported
+		virtual bool supports_parallel() const {return true;}
+
+	///	initialize for operator J(u) and linearization point u
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > J, const vector_type& u)
+		{
+			return init(J);
+		}
+
+	///	initialize for linear operator L
+		virtual bool init(SmartPtr<ILinearOperator<vector_type> > L)
+		{
+			m_spOp = L.template cast_dynamic<MatrixFreeOperator<TAlgebra> >();
+			if(m_spOp.invalid())
+				UG_THROW(name() << "::init: Passed operator is not a MatrixFreeOperator.");
+			return true;
+		}
+
+	///	compute new correction c = B*d
+		virtual bool apply(vector_type& c, const vector_type& d)
+		{
+			PROFILE_BEGIN_GROUP(MatrixFreeJacobi_apply, "discretization");
+			if(m_spOp.invalid())
+			{
+				UG_LOG("ERROR in '"<<name()<<"::apply': Iterator not initialized.\n");
+				return false;
+			}
+
+		//	Check parallel status
+			#ifdef UG_PARALLEL
+			if(!d.has_storage_type(PST_ADDITIVE))
+				UG_THROW(name() << "::apply: Wrong parallel "
+				               "storage format. Defect must be additive.");
+			#endif
+
+		// 	c = damp * D^{-1} * d
+			number damp = 1.0;
+			if(damping()->constant_damping())
+				damp = damping()->damping();
+			ApplyInverseDiagonal(c, m_spOp->diagonal(d), d, damp);
+
+		//	apply scaling
+			if(!damping()->constant_damping()){
+				const number kappa = damping()->damping(c, d, m_spOp);
+				if(kappa != 1.0) c *= kappa;
+			}
+
+			return true;
+		}
+
+	///	compute new correction c = B*d and update defect d := d - A*c
+		virtual bool apply_update_defect(vector_type& c, vector_type& d)
+		{
+			if(!apply(c, d)) return false;
+			m_spOp->apply_sub(d, c);
+			return true;
+		}
+
+	protected:
+	///	underlying operator
+		SmartPtr<MatrixFreeOperator<TAlgebra> > m_spOp;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_JACOBI__ */
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__
+
+#include "lib_algebra/operator/interface/linear_operator.h"
+
+#ifdef UG_PARALLEL
+#include "lib_disc/parallelization/parallelization_util.h"
+#endif
+
+#include "lib_disc/assemble_interface.h"
+#include "lib_disc/common/local_jacobian_cache.h"
+
+namespace ug{
+
+///	linear operator applying the jacobian of a discretization without a matrix
+/**
+ * This operator implements the ILinearOperator interface without storing a
+ * matrix. Instead, the application d = J(u)*c is computed element by element
+ * using IAssemble::apply_jacobian: for every element the local Jacobian is
+ * computed by the element discretizations and applied to the local values of
+ * c. This is useful if the assembled matrix is too expensive to be assembled
+ * and transferred, e.g. for higher order approximation spaces.
+ *
+ * By default, only the linearization point u is stored and the local
+ * Jacobians are recomputed on every application, so the operator needs no
+ * memory beyond a few vectors. If memory permits, the local Jacobians can be
+ * stored instead (set_cache_local_jacobians): they are then computed on the
+ * first application after each init (see LocalJacobianCache) and further
+ * applications only perform the element-wise products. Note that the cache
+ * typically needs a few times the memory of the assembled matrix.
+ *
+ * The operator can be used wherever a linear operator is needed (NewtonSolver,
+ * LinearSolver, CG, GMRES, ...). Preconditioners relying on the matrix entries
+ * can not be used; the diagonal needed by Jacobi-type smoothers is provided
+ * by diagonal().
+ *
+ * \tparam	TAlgebra			algebra type
+ */
+template <typename TAlgebra>
+class MatrixFreeOperator :
+	public virtual ILinearOperator<typename TAlgebra::vector_type>
+{
+	public:
+	///	Type of Algebra
+		typedef TAlgebra algebra_type;
+
+	///	Type of Vector
+		typedef typename TAlgebra::vector_type vector_type;
+
+	public:
+	///	Default Constructor
+		MatrixFreeOperator()
+			: m_spAss(NULL), m_bDiagValid(false),
+			  m_bCacheJacobians(false), m_bCacheValid(false) {};
+
+	///	Constructor
+		MatrixFreeOperator(SmartPtr<IAssemble<TAlgebra> > ass)
+			: m_spAss(ass), m_bDiagValid(false),
+			  m_bCacheJacobians(false), m_bCacheValid(false) {};
+
+	///	Constructor
+		MatrixFreeOperator(SmartPtr<IAssemble<TAlgebra> > ass, const GridLevel& gl)
+			: m_spAss(ass), m_gridLevel(gl), m_bDiagValid(false),
+			  m_bCacheJacobians(false), m_bCacheValid(false) {};
+
+	///	sets the discretization to be used
+		void set_discretization(SmartPtr<IAssemble<TAlgebra> > ass) {m_spAss = ass; invalidate();}
+
+	///	returns the discretization to be used
+		SmartPtr<IAssemble<TAlgebra> > discretization() {return m_spAss;}
+
+	///	sets the level used for assembling
+		void set_level(const GridLevel& gl) {m_gridLevel = gl; invalidate();}
+
+	///	returns the level
+		const GridLevel& level() const {return m_gridLevel;}
+
+	///	sets if the local Jacobians are stored for repeated application (default: false)
+		void set_cache_local_jacobians(bool bCache) {m_bCacheJacobians = bCache; invalidate();}
+
+	///	returns if the local Jacobians are stored for repeated application
+		bool cache_local_jacobians() const {return m_bCacheJacobians;}
+
+	///	initializes the operator at the linearization point u (stores a copy of u)
+		virtual void init(const vector_type& u);
+
+	///	initializes the operator of a linear problem (linearization point zero)
+		virtual void init();
+
+	///	compute d = J(u)*c
+		virtual void apply(vector_type& d, const vector_type& c);
+
+	///	Compute d := d - J(u)*c
+		virtual void apply_sub(vector_type& d, const vector_type& c);
+
+	///	returns the (consistent) diagonal of J(u)
+	/**
+	 * The diagonal is assembled element-wise on the first request after each
+	 * init. The passed vector only provides the size (and layouts) if the
+	 * operator has been initialized by init() and not been applied yet.
+	 */
+		const vector_type& diagonal(const vector_type& v);
+
+	///	Set Dirichlet values
+		void set_dirichlet_values(vector_type& u);
+
+	///	Destructor
+		virtual ~MatrixFreeOperator() {};
+
+	protected:
+	///	returns the linearization point, creates zero point if none given
+		const vector_type& linearization_point(const vector_type& v);
+
+	///	computes the local Jacobians if not yet done for the current linearization point
+		void update_cache(const vector_type& v);
+
+	///	discards the diagonal and the stored local Jacobians
+		void invalidate();
+
+	protected:
+	// 	assembling procedure
+		SmartPtr<IAssemble<TAlgebra> > m_spAss;
+
+	// 	DoF Distribution used
+		GridLevel m_gridLevel;
+
+	//	linearization point
+		SmartPtr<vector_type> m_spU;
+
+	//	diagonal of the jacobian
+		SmartPtr<vector_type> m_spDiag;
+		bool m_bDiagValid;
+
+	//	local jacobians at the linearization point
+		LocalJacobianCache m_jacCache;
+		bool m_bCacheJacobians;
+		bool m_bCacheValid;
+};
+
+} // namespace ug
+
+// include implementation
+#include "matrix_free_operator_impl.h"
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR__ */
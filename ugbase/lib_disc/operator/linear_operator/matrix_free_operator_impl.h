@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR_IMPL__
+#define __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR_IMPL__
+
+#include "matrix_free_operator.h"
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::init(const vector_type& u)
+{
+	if(m_spAss.invalid())
+		UG_THROW("MatrixFreeOperator: Assembling routine not set.");
+
+#ifdef UG_PARALLEL
+	if(!u.has_storage_type(PST_CONSISTENT))
+		UG_THROW("MatrixFreeOperator::init: Linearization point must be consistent.");
+#endif
+
+//	remember linearization point
+	m_spU = u.clone();
+	invalidate();
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::init()
+{
+	if(m_spAss.invalid())
+		UG_THROW("MatrixFreeOperator: Assembling routine not set.");
+
+//	linear problem: the zero linearization point is created on first use
+	m_spU = SPNULL;
+	invalidate();
+}
+
+template <typename TAlgebra>
+const typename TAlgebra::vector_type&
+MatrixFreeOperator<TAlgebra>::linearization_point(const vector_type& v)
+{
+	if(m_spU.invalid()){
+		m_spU = v.clone_without_values();
+		m_spU->set(0.0);
+	}
+	return *m_spU;
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::update_cache(const vector_type& v)
+{
+	if(m_bCacheValid) return;
+
+	PROFILE_BEGIN_GROUP(MatrixFreeOperator_update_cache, "discretization");
+	try{
+		m_spAss->assemble_local_jacobians(m_jacCache, linearization_point(v), m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeOperator: Cannot compute local Jacobians.");
+
+	m_bCacheValid = true;
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::invalidate()
+{
+	m_bDiagValid = false;
+	m_bCacheValid = false;
+
+//	release the memory of the stored jacobians
+	LocalJacobianCache().swap(m_jacCache);
+}
+
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::apply(vector_type& d, const vector_type& c)
+{
+	PROFILE_BEGIN_GROUP(MatrixFreeOperator_apply, "discretization");
+	if(m_spAss.invalid())
+		UG_THROW("MatrixFreeOperator: Assembling routine not set.");
+
+#ifdef UG_PARALLEL
+	if(!c.has_storage_type(PST_CONSISTENT))
+		UG_THROW("Inadequate storage format of Vector c.");
+#endif
+
+//	compute d = J(u)*c element-wise
+	try{
+		if(m_bCacheJacobians){
+			update_cache(c);
+			m_spAss->apply_jacobian(d, linearization_point(c), c, m_jacCache, m_gridLevel);
+		}
+		else
+			m_spAss->apply_jacobian(d, linearization_point(c), c, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeOperator::apply: Cannot apply Jacobian.");
+}
+
+//	Compute d := d - J(u)*c
+template <typename TAlgebra>
+void
+MatrixFreeOperator<TAlgebra>::apply_sub(vector_type& d, const vector_type& c)
+{
+#ifdef UG_PARALLEL
+	if(!d.has_storage_type(PST_ADDITIVE))
+		UG_THROW("Inadequate storage format of Vector d.");
+#endif
+
+	if(c.size() != d.size())
+		UG_THROW("MatrixFreeOperator::apply_sub: Size of vectors x ["<<c.size()<<
+		         "], b ["<<d.size()<<"] must match for the operation b -= A*x.");
+
+	SmartPtr<vector_type> spTmp = d.clone_without_values();
+	apply(*spTmp, c);
+	d -= *spTmp;
+}
+
+template <typename TAlgebra>
+const typename TAlgebra::vector_type&
+MatrixFreeOperator<TAlgebra>::diagonal(const vector_type& v)
+{
+	if(m_bDiagValid) return *m_spDiag;
+
+	PROFILE_BEGIN_GROUP(MatrixFreeOperator_diagonal, "discretization");
+	if(m_spAss.invalid())
+		UG_THROW("MatrixFreeOperator: Assembling routine not set.");
+
+	const vector_type& u = linearization_point(v);
+	m_spDiag = u.clone_without_values();
+	try{
+		if(m_bCacheJacobians){
+			update_cache(v);
+			m_spAss->assemble_jacobian_diagonal(*m_spDiag, u, m_jacCache, m_gridLevel);
+		}
+		else
+			m_spAss->assemble_jacobian_diagonal(*m_spDiag, u, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeOperator::diagonal: Cannot assemble diagonal.");
+
+#ifdef UG_PARALLEL
+//	make diagonal consistent
+	m_spDiag->change_storage_type(PST_CONSISTENT);
+#endif
+
+	m_bDiagValid = true;
+	return *m_spDiag;
+}
+
+template <typename TAlgebra>
+void MatrixFreeOperator<TAlgebra>::set_dirichlet_values(vector_type& u)
+{
+//	checks
+	if(m_spAss.invalid())
+		UG_THROW("MatrixFreeOperator: Assembling routine not set.");
+
+//	set dirichlet values etc.
+	try{
+		m_spAss->adjust_solution(u, m_gridLevel);
+	}
+	UG_CATCH_THROW("MatrixFreeOperator::set_dirichlet_values:"
+				" Cannot assemble solution.");
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__OPERATOR__LINEAR_OPERATOR__MATRIX_FREE_OPERATOR_IMPL__ */
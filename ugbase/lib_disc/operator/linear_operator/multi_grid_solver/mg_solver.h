@@ -56,6 +56,7 @@
 // library intern headers
 #include "lib_disc/function_spaces/grid_function_util.h"
 #include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
+#include "lib_disc/operator/linear_operator/matrix_free_operator.h"
 
 #include "mg_stats.h"
 
@@ -148,6 +149,17 @@ class AssembledMultiGridCycle :
 	///	sets if RAP - Product used to build coarse grid matrices
 		void set_rap(bool bRAP) {m_bUseRAP = bRAP;}
 
+	///	sets if the level operators above the base level are applied matrix-free
+	/**
+	 * If enabled, no level matrices are assembled on the levels above the
+	 * base level. Instead, a MatrixFreeOperator is used for the smoothers and
+	 * the defect updates, thus only smoothers working on the operator
+	 * diagonal (e.g. MatrixFreeJacobi, MatrixFreeChebyshev) can be used. The
+	 * base level matrix is still assembled for the base solver. Only
+	 * supported for full refinement without RAP.
+	 */
+		void set_matrix_free(bool bMatrixFree) {m_bMatrixFree = bMatrixFree;}
+
 	///	sets if smoothing is performed on surface rim
 		void set_smooth_on_surface_rim(bool bSmooth) {m_bSmoothOnSurfaceRim = bSmooth;}
 
@@ -316,6 +328,7 @@ class AssembledMultiGridCycle :
 	protected:
 	/// operator to invert (surface grid)
 		ConstSmartPtr<matrix_type> m_spSurfaceMat;
+		SmartPtr<ILinearOperator<vector_type> > m_spSurfaceOp;
 
 	///	Solution on surface grid
 		const vector_type* m_pSurfaceSol;
@@ -355,6 +368,9 @@ class AssembledMultiGridCycle :
 	///	using RAP-Product (assemble coarse-grid matrices otherwise)
 		bool m_bUseRAP;
 
+	///	using matrix-free level operators above the base level
+		bool m_bMatrixFree;
+
 	///	flag if smoothing on surface rim
 		bool m_bSmoothOnSurfaceRim;
 
@@ -419,6 +435,12 @@ class AssembledMultiGridCycle :
 		///	Level matrix operator
 			SmartPtr<MatrixOperator<matrix_type, vector_type> > A;
 
+		///	Matrix-free level operator
+			SmartPtr<MatrixFreeOperator<TAlgebra> > MFA;
+
+		///	Level operator used for smoothing (either A or MFA)
+			SmartPtr<ILinearOperator<vector_type> > Op;
+
 		///	Smoother
 			SmartPtr<ILinearIterator<vector_type> > PreSmoother;
 			SmartPtr<ILinearIterator<vector_type> > PostSmoother;
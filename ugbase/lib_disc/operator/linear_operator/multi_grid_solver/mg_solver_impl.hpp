@@ -82,7 +82,7 @@ AssembledMultiGridCycle() :
 	m_baseLev(0), m_cycleType(_V_),
 	m_numPreSmooth(2), m_numPostSmooth(2),
 	m_LocalFullRefLevel(0), m_GridLevelType(GridLevel::LEVEL),
-	m_bUseRAP(false), m_bSmoothOnSurfaceRim(false),
+	m_bUseRAP(false), m_bMatrixFree(false), m_bSmoothOnSurfaceRim(false),
 	m_bCommCompOverlap(false),
 	m_spPreSmootherPrototype(new Jacobi<TAlgebra>()),
 	m_spPostSmootherPrototype(m_spPreSmootherPrototype),
@@ -107,7 +107,7 @@ AssembledMultiGridCycle(SmartPtr<ApproximationSpace<TDomain> > approxSpace) :
 	m_baseLev(0), m_cycleType(_V_),
 	m_numPreSmooth(2), m_numPostSmooth(2),
 	m_LocalFullRefLevel(0), m_GridLevelType(GridLevel::LEVEL),
-	m_bUseRAP(false), m_bSmoothOnSurfaceRim(false),
+	m_bUseRAP(false), m_bMatrixFree(false), m_bSmoothOnSurfaceRim(false),
 	m_bCommCompOverlap(false),
 	m_spPreSmootherPrototype(new Jacobi<TAlgebra>()),
 	m_spPostSmootherPrototype(m_spPreSmootherPrototype),
@@ -197,7 +197,8 @@ apply(vector_type& rC, const vector_type& rD)
 
 //	debug output
 	write_debug(d, "Defect_In");
-	write_debug(*m_spSurfaceMat, "SurfaceStiffness", c, c);
+	if(m_spSurfaceMat.valid())
+		write_debug(*m_spSurfaceMat, "SurfaceStiffness", c, c);
 	for(int lev = m_baseLev; lev <= m_topLev; ++lev)
 	{
 		LevData& ld = *m_vLevData[lev];
@@ -256,7 +257,7 @@ apply(vector_type& rC, const vector_type& rD)
 //	apply scaling
 	GMG_PROFILE_BEGIN(GMG_Apply_Scaling);
 	try{
-		const number kappa = this->damping()->damping(c, d, m_spSurfaceMat.template cast_dynamic<ILinearOperator<vector_type> >());
+		const number kappa = this->damping()->damping(c, d, m_spSurfaceOp);
 		if(kappa != 1.0) c *= kappa;
 	}
 	UG_CATCH_THROW("GMG: Damping failed.")
@@ -308,7 +309,10 @@ apply_update_defect(vector_type &c, vector_type& rD)
 	if(!apply(c, rD)) return false;
 
 //	update defect: d = d - A*c
-	m_spSurfaceMat->matmul_minus(rD, c);
+	if(m_spSurfaceMat.valid())
+		m_spSurfaceMat->matmul_minus(rD, c);
+	else
+		m_spSurfaceOp->apply_sub(rD, c);
 
 //	write for debugging
 	const GF* pD = dynamic_cast<const GF*>(&rD);
@@ -332,9 +336,15 @@ init(SmartPtr<ILinearOperator<vector_type> > J, const vector_type& u)
 	if(spALO.valid()){
 		m_spAss = spALO->discretization();
 	}
+	SmartPtr<MatrixFreeOperator<TAlgebra> > spMFO =
+			J.template cast_dynamic<MatrixFreeOperator<TAlgebra> >();
+	if(spMFO.valid()){
+		m_spAss = spMFO->discretization();
+	}
 
 	// Store Surface Matrix
 	m_spSurfaceMat = J.template cast_dynamic<matrix_type>();
+	m_spSurfaceOp = J;
 
 	// Store Surface Solution
 	m_pSurfaceSol = &u;
@@ -359,9 +369,15 @@ init(SmartPtr<ILinearOperator<vector_type> > L)
 	if(spALO.valid()){
 		m_spAss = spALO->discretization();
 	}
+	SmartPtr<MatrixFreeOperator<TAlgebra> > spMFO =
+			L.template cast_dynamic<MatrixFreeOperator<TAlgebra> >();
+	if(spMFO.valid()){
+		m_spAss = spMFO->discretization();
+	}
 
 	// Store Surface Matrix
 	m_spSurfaceMat = L.template cast_dynamic<matrix_type>();
+	m_spSurfaceOp = L;
 
 	// Store Surface Solution
 	m_pSurfaceSol = NULL;
@@ -385,9 +401,12 @@ init()
 	try{
 
 // 	Cast Operator
-	if(m_spSurfaceMat.invalid())
+	if(m_spSurfaceMat.invalid() && !m_bMatrixFree)
 		UG_THROW("GMG:init: Can not cast Operator to Matrix.");
 
+	if(m_bMatrixFree && m_bUseRAP)
+		UG_THROW("GMG::init: Matrix-free level operators cannot be used with set_rap(true).");
+
 //	Check Approx Space
 	if(m_spApproxSpace.invalid())
 		UG_THROW("GMG::init: Approximation Space not set.");
@@ -461,6 +480,15 @@ init()
 		m_ApproxSpaceRevision = m_spApproxSpace->revision();
 	}
 
+//	matrix-free level operators provide no rim couplings (adaptive case)
+	if(m_bMatrixFree && m_LocalFullRefLevel < m_topLev)
+		UG_THROW("GMG::init: Matrix-free level operators are only "
+				"supported for full refinement.");
+
+//	level matrices are used for smoothing unless set matrix-free below
+	for(int lev = m_baseLev; lev <= m_topLev; ++lev)
+		m_vLevData[lev]->Op = m_vLevData[lev]->A;
+
 //	Assemble coarse grid operators
 	GMG_PROFILE_BEGIN(GMG_Init_CreateLevelMatrices);
 	try{
@@ -602,8 +630,29 @@ assemble_level_operator()
 		}
 		#endif
 
+	//	matrix-free operators above the base level only need the
+	//	linearization point (projection of solution below is still needed)
+		if(m_bMatrixFree && lev > m_baseLev)
+		{
+			UG_DLOG(LIB_DISC_MULTIGRID, 4, "  start assemble_level_operator: matrix-free on lev "<<lev<<"\n");
+			ld.MFA->set_discretization(m_spAss);
+			ld.MFA->set_level(GridLevel(lev, m_GridLevelType, false));
+			if(m_pSurfaceSol){
+				#ifdef UG_PARALLEL
+				if(lev == m_topLev)
+					ld.st->set_storage_type(m_pSurfaceSol->get_storage_mask());
+				#endif
+				ld.MFA->init(*ld.st);
+			}
+			else ld.MFA->init();
+			ld.Op = ld.MFA;
+			UG_DLOG(LIB_DISC_MULTIGRID, 4, "  end   assemble_level_operator: matrix-free on lev "<<lev<<"\n");
+		}
+		else
+		{
 	//	In Full-Ref case we can copy the Matrix from the surface
-		bool bCpyFromSurface = ((lev == m_topLev) && (lev <= m_LocalFullRefLevel));
+		bool bCpyFromSurface = ((lev == m_topLev) && (lev <= m_LocalFullRefLevel)
+								&& m_spSurfaceMat.valid());
 		if(!bCpyFromSurface)
 		{
 			UG_DLOG(LIB_DISC_MULTIGRID, 4, "  start assemble_level_operator: assemble on lev "<<lev<<"\n");
@@ -662,6 +711,7 @@ assemble_level_operator()
 			GMG_PROFILE_END();
 			UG_DLOG(LIB_DISC_MULTIGRID, 4, "  end   assemble_level_operator: copy mat on lev "<<lev<<"\n");
 		}
+		}
 
 		if(m_pSurfaceSol && lev > m_baseLev)
 		{
@@ -692,7 +742,8 @@ assemble_level_operator()
 //	write computed level matrices for debug purpose
 	for(int lev = m_baseLev; lev <= m_topLev; ++lev){
 		LevData& ld = *m_vLevData[lev];
-		write_debug(*ld.A, "LevelMatrix", *ld.st, *ld.st);
+		if(!m_bMatrixFree || lev == m_baseLev)
+			write_debug(*ld.A, "LevelMatrix", *ld.st, *ld.st);
 	}
 
 //	if no ghosts are present we can simply use the whole grid. If the base
@@ -966,7 +1017,8 @@ init_rap_operator()
 //	write computed level matrices for debug purpose
 	for(int lev = m_baseLev; lev <= m_topLev; ++lev){
 		LevData& ld = *m_vLevData[lev];
-		write_debug(*ld.A, "LevelMatrix", *ld.st, *ld.st);
+		if(!m_bMatrixFree || lev == m_baseLev)
+			write_debug(*ld.A, "LevelMatrix", *ld.st, *ld.st);
 	}
 
 	if(m_bGatheredBaseUsed)
@@ -1147,7 +1199,7 @@ init_smoother()
 		UG_DLOG(LIB_DISC_MULTIGRID, 4, "  init_smoother: initializing pre-smoother on lev "<<lev<<"\n");
 		bool success;
 		GridLevel gw_gl; enter_debug_writer_section(gw_gl, "PreSmootherInit", lev);
-		try {success = ld.PreSmoother->init(ld.A, *ld.sc);}
+		try {success = ld.PreSmoother->init(ld.Op, *ld.sc);}
 		UG_CATCH_THROW("GMG::init: Cannot init pre-smoother for level "<<lev);
 		leave_debug_writer_section(gw_gl);
 		if (!success)
@@ -1157,7 +1209,7 @@ init_smoother()
 		if(ld.PreSmoother != ld.PostSmoother)
 		{
 			GridLevel gw_gl; enter_debug_writer_section(gw_gl, "PostSmootherInit", lev);
-			try {success = ld.PostSmoother->init(ld.A, *ld.sc);}
+			try {success = ld.PostSmoother->init(ld.Op, *ld.sc);}
 			UG_CATCH_THROW("GMG::init: Cannot init post-smoother for level "<<lev);
 			leave_debug_writer_section(gw_gl);
 			if (!success)
@@ -1557,6 +1609,9 @@ init_level_memory(int baseLev, int topLev)
 
 		ld.A = SmartPtr<MatrixOperator<matrix_type, vector_type> >(
 				new MatrixOperator<matrix_type, vector_type>);
+		ld.MFA = SmartPtr<MatrixFreeOperator<TAlgebra> >(
+				new MatrixFreeOperator<TAlgebra>);
+		ld.Op = ld.A;
 
 		ld.PreSmoother = m_spPreSmootherPrototype->clone();
 		if(m_spPreSmootherPrototype == m_spPostSmootherPrototype)
@@ -1723,7 +1778,7 @@ presmooth_and_restriction(int lev)
 			}
 
 		//	c) update the defect with this correction ...
-			lf.A->apply_sub(*lf.sd, *lf.st);
+			lf.Op->apply_sub(*lf.sd, *lf.st);
 
 		//	d) ... and add the correction to the overall correction
 			if(nu < m_numPreSmooth-1)
@@ -1916,7 +1971,7 @@ prolongation_and_postsmooth(int lev)
 		for(int nu = 0; nu < m_numPostSmooth; ++nu)
 		{
 		//	update defect
-			lf.A->apply_sub(*lf.sd, *lf.st);
+			lf.Op->apply_sub(*lf.sd, *lf.st);
 
 			if(nu == 0){
 				log_debug_data(lev, lf.n_prolong_calls, "BeforePostSmooth");
@@ -1953,7 +2008,7 @@ prolongation_and_postsmooth(int lev)
 //	We also need it if we want to write stats or debug data
 	if(lev >= m_LocalFullRefLevel || m_mgstats.valid() || m_spDebugWriter.valid()){
 		GMG_PROFILE_BEGIN(GMG_UpdateDefectAfterPostSmooth);
-		lf.A->apply_sub(*lf.sd, *lf.st);
+		lf.Op->apply_sub(*lf.sd, *lf.st);
 		GMG_PROFILE_END();
 	}
 
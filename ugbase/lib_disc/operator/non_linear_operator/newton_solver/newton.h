@@ -43,6 +43,7 @@
 #include "lib_disc/assemble_interface.h"
 #include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
 #include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
+#include "lib_disc/operator/linear_operator/matrix_free_operator.h"
 #include "../line_search.h"
 #include "newton_update_interface.h"
 #include "lib_algebra/operator/debug_writer.h"
@@ -156,6 +157,16 @@ class NewtonSolver
 		void set_reassemble_J_freq(int freq)
 			{m_reassembe_J_freq = freq;};
 
+	///	sets if the Jacobian is applied matrix-free instead of being assembled
+	/**
+	 * If enabled, the linear solver is initialized with a MatrixFreeOperator
+	 * that computes J*c element-wise. The linear solver must then only use
+	 * operator applications (e.g. Krylov methods with MatrixFreeJacobi or
+	 * MatrixFreeChebyshev preconditioners).
+	 */
+		void set_matrix_free(bool bMatrixFree)
+			{m_bMatrixFree = bMatrixFree;}
+
 #if ENABLE_NESTED_NEWTON_RESOLFUNC_UPDATE
 		void setNewtonUpdater( SmartPtr<NewtonUpdaterGeneric<vector_type> > nU )
 		{
@@ -192,6 +203,10 @@ class NewtonSolver
 		SmartPtr<IAssemble<TAlgebra> > m_spAss;
 	/// how often to reassemble the Jacobian (0 == 1 == in every step, i.e. classically)
 		int m_reassembe_J_freq;
+	///	matrix-free jacobi operator
+		SmartPtr<MatrixFreeOperator<algebra_type> > m_spMatrixFreeJ;
+	///	flag if the Jacobian is applied matrix-free
+		bool m_bMatrixFree;
 
 	///	call counter
 		int m_dgbCall;
@@ -68,6 +68,7 @@ NewtonSolver(SmartPtr<ILinearOperatorInverse<vector_type> > LinearSolver,
 			m_J(NULL),
 			m_spAss(NULL),
 			m_reassembe_J_freq(0),
+			m_bMatrixFree(false),
 			m_dgbCall(0),
 			m_lastNumSteps(0)
 #if ENABLE_NESTED_NEWTON_RESOLFUNC_UPDATE
@@ -86,6 +87,7 @@ NewtonSolver() :
 	m_J(NULL),
 	m_spAss(NULL),
 	m_reassembe_J_freq(0),
+	m_bMatrixFree(false),
 	m_dgbCall(0),
 	m_lastNumSteps(0)
 #if ENABLE_NESTED_NEWTON_RESOLFUNC_UPDATE
@@ -104,6 +106,7 @@ NewtonSolver(SmartPtr<IOperator<vector_type> > N) :
 	m_J(NULL),
 	m_spAss(NULL),
 	m_reassembe_J_freq(0),
+	m_bMatrixFree(false),
 	m_dgbCall(0),
 	m_lastNumSteps(0)
 #if ENABLE_NESTED_NEWTON_RESOLFUNC_UPDATE
@@ -124,6 +127,7 @@ NewtonSolver(SmartPtr<IAssemble<TAlgebra> > spAss) :
 	m_J(NULL),
 	m_spAss(NULL),
 	m_reassembe_J_freq(0),
+	m_bMatrixFree(false),
 	m_dgbCall(0),
 	m_lastNumSteps(0)
 #if ENABLE_NESTED_NEWTON_RESOLFUNC_UPDATE
@@ -181,6 +185,14 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 	}
 	m_J->set_level(m_N->level());
 
+	if(m_bMatrixFree){
+		if(m_spMatrixFreeJ.invalid() || m_spMatrixFreeJ->discretization() != m_spAss)
+			m_spMatrixFreeJ = make_sp(new MatrixFreeOperator<TAlgebra>(m_spAss));
+		m_spMatrixFreeJ->set_level(m_N->level());
+	}
+	SmartPtr<ILinearOperator<vector_type> > spJ = m_J;
+	if(m_bMatrixFree) spJ = m_spMatrixFreeJ;
+
 //	create tmp vectors
 	SmartPtr<vector_type> spD = u.clone_without_values();
 	SmartPtr<vector_type> spC = u.clone_without_values();
@@ -243,7 +255,8 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 			if(m_reassembe_J_freq == 0 || loopCnt % m_reassembe_J_freq == 0) // if we need to reassemble
 			{
 				NEWTON_PROFILE_BEGIN(NewtonComputeJacobian);
-				m_J->init(u);
+				if(m_bMatrixFree) m_spMatrixFreeJ->init(u);
+				else m_J->init(u);
 				NEWTON_PROFILE_END();
 			}
 		}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Jacobian failed.");
@@ -251,14 +264,15 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 	//	Write the current Jacobian for debug and prepare the section for the lin. solver
 		if (this->debug_writer_valid())
 		{
-			write_debug(m_J->get_matrix(), std::string("NEWTON_Jacobian") + debug_name_ext);
+			if(!m_bMatrixFree)
+				write_debug(m_J->get_matrix(), std::string("NEWTON_Jacobian") + debug_name_ext);
 			this->enter_debug_writer_section(std::string("NEWTON_LinSolver") + debug_name_ext);
 		}
 
 	// 	Init Jacobi Inverse
 		try{
 			NEWTON_PROFILE_BEGIN(NewtonPrepareLinSolver);
-			if(!m_spLinearSolver->init(m_J, u))
+			if(!m_spLinearSolver->init(spJ, u))
 			{
 				UG_LOG("ERROR in 'NewtonSolver::apply': Cannot init Inverse Linear "
 						"Operator for Jacobi-Operator.\n");
@@ -500,6 +514,7 @@ std::string NewtonSolver<TAlgebra>::config_string() const
 	if(m_spLineSearch.valid())		ss << ConfigShift(m_spLineSearch->config_string()) << "\n";
 	else							ss << " not set.\n";
 	if(m_reassembe_J_freq != 0)		ss << " Reassembling Jacobian only once per " << m_reassembe_J_freq << " step(s)\n";
+	if(m_bMatrixFree)				ss << " Jacobian is applied matrix-free\n";
 	return ss.str();
 }
 
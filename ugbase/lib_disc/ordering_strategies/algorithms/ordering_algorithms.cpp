@@ -1,4 +1,5 @@
 #include "lexorder.h"
+#include "sfc_order.h"
 #include "riverorder.h"
 #include "directional_ordering.cpp"
 
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <vector>
+#include <utility>
+
+#include "common/common.h"
+#include "lib_disc/function_spaces/dof_position_util.h"
+#include "lib_disc/local_finite_element/local_finite_element_provider.h"
+#include "lib_disc/domain.h"
+
+#include "lib_disc/ordering_strategies/algorithms/sfc_order.h"
+
+namespace ug{
+
+static bool CompareSFCKey(const std::pair<uint64, size_t>& k1,
+                          const std::pair<uint64, size_t>& k2)
+{
+	return k1.first < k2.first;
+}
+
+template<int dim>
+void ComputeSpaceFillingCurveOrder(std::vector<size_t>& vNewIndex,
+                                   std::vector<std::pair<MathVector<dim>, size_t> >& vPos,
+                                   SpaceFillingCurve sfc)
+{
+	if(vPos.empty()){
+		for(size_t i = 0; i < vNewIndex.size(); ++i)
+			vNewIndex[i] = i;
+		return;
+	}
+
+//	the curve is placed in the bounding box of all positions
+	MathVector<dim> boxMin = vPos[0].first, boxMax = vPos[0].first;
+	for(size_t i = 1; i < vPos.size(); ++i){
+		for(int d = 0; d < dim; ++d){
+			boxMin[d] = std::min(boxMin[d], vPos[i].first[d]);
+			boxMax[d] = std::max(boxMax[d], vPos[i].first[d]);
+		}
+	}
+
+//	sort the positions by their curve index. Indices at the same position
+//	(e.g. several components on one vertex) keep their relative order.
+	std::vector<std::pair<uint64, size_t> > vKey(vPos.size());
+	for(size_t i = 0; i < vPos.size(); ++i){
+		vKey[i].first = SpaceFillingCurveIndex<dim>(sfc, vPos[i].first, boxMin, boxMax);
+		vKey[i].second = i;
+	}
+	std::stable_sort(vKey.begin(), vKey.end(), CompareSFCKey);
+
+//	a) order all indices
+	if(vNewIndex.size() == vPos.size()){
+		for(size_t i = 0; i < vKey.size(); ++i)
+			vNewIndex[vPos[vKey[i].second].second] = i;
+	}
+//	b) only some indices to order: the ordered indices take the slots of
+//	   the original ones
+	else{
+		for(size_t i = 0; i < vNewIndex.size(); ++i)
+			vNewIndex[i] = i;
+		for(size_t i = 0; i < vKey.size(); ++i)
+			vNewIndex[vPos[vKey[i].second].second] = vPos[i].second;
+	}
+}
+
+/// orders the dof distribution along a space filling curve
+template <typename TDomain>
+void OrderSpaceFillingCurveForDofDist(SmartPtr<DoFDistribution> dd,
+                                      ConstSmartPtr<TDomain> domain,
+                                      SpaceFillingCurve sfc)
+{
+//	As for the lexicographic ordering, all dofs can only be ordered at once,
+//	if the number of DoFs is the same on each geometric object. Otherwise
+//	only those components are ordered, which do not share their geometric
+//	objects with other components (cf. OrderLexForDofDist)
+	bool bEqualNumDoFOnEachGeomObj = true;
+	int numDoFOnGeomObj = -1;
+	for(int si = 0; si < dd->num_subsets(); ++si){
+		for(int roid = 0; roid < NUM_REFERENCE_OBJECTS; ++roid){
+			const int numDoF = dd->num_dofs((ReferenceObjectID)roid, si);
+
+			if(numDoF == 0) continue;
+
+			if(numDoFOnGeomObj == -1)
+				numDoFOnGeomObj = numDoF;
+			else if(numDoFOnGeomObj != numDoF)
+				bEqualNumDoFOnEachGeomObj = false;
+		}
+	}
+
+	typedef typename std::pair<MathVector<TDomain::dim>, size_t> pos_type;
+	std::vector<pos_type> vPositions;
+
+//	a) we can order globally
+	if(bEqualNumDoFOnEachGeomObj)
+	{
+		ExtractPositions(domain, dd, vPositions);
+
+	//	get mapping: old -> new index
+		std::vector<size_t> vNewIndex(dd->num_indices());
+		ComputeSpaceFillingCurveOrder<TDomain::dim>(vNewIndex, vPositions, sfc);
+
+	//	reorder indices
+		dd->permute_indices(vNewIndex);
+		return;
+	}
+
+//	b) we can only order some spaces
+	std::vector<int> vNumSpaces(NUM_REFERENCE_OBJECTS, 0);
+	for(size_t fct = 0; fct < dd->num_fct(); ++fct){
+		const CommonLocalDoFSet& locDoF =
+			LocalFiniteElementProvider::get_dofs(dd->local_finite_element_id(fct));
+		for(int roid = 0; roid < NUM_REFERENCE_OBJECTS; ++roid)
+			if(locDoF.num_dof((ReferenceObjectID)roid) > 0)
+				++vNumSpaces[roid];
+	}
+
+	UG_LOG("OrderSpaceFillingCurve: Cannot order globally, trying to order some components:\n");
+	for(size_t fct = 0; fct < dd->num_fct(); ++fct){
+		const CommonLocalDoFSet& locDoF =
+			LocalFiniteElementProvider::get_dofs(dd->local_finite_element_id(fct));
+
+		bool bSortable = true;
+		for(int roid = 0; roid < NUM_REFERENCE_OBJECTS; ++roid)
+			if(locDoF.num_dof((ReferenceObjectID)roid) != 0 && vNumSpaces[roid] > 1)
+				bSortable = false;
+
+		if(!bSortable){
+			UG_LOG("OrderSpaceFillingCurve: '"<<dd->name(fct)<<" NOT SORTED.\n");
+			continue;
+		}
+
+		ExtractPositions(domain, dd, fct, vPositions);
+
+	//	get mapping: old -> new index
+		std::vector<size_t> vNewIndex(dd->num_indices());
+		ComputeSpaceFillingCurveOrder<TDomain::dim>(vNewIndex, vPositions, sfc);
+
+	//	reorder indices
+		dd->permute_indices(vNewIndex);
+
+		UG_LOG("OrderSpaceFillingCurve: '"<<dd->name(fct)<<" SORTED.\n");
+	}
+}
+
+template <typename TDomain>
+void OrderSpaceFillingCurve(ApproximationSpace<TDomain>& approxSpace)
+{
+	OrderSpaceFillingCurve(approxSpace, "hilbert");
+}
+
+template <typename TDomain>
+void OrderSpaceFillingCurve(ApproximationSpace<TDomain>& approxSpace, const char* curve)
+{
+	const SpaceFillingCurve sfc = SpaceFillingCurveFromString(curve);
+
+	std::vector<SmartPtr<DoFDistribution> > vDD = approxSpace.dof_distributions();
+	for(size_t i = 0; i < vDD.size(); ++i)
+		OrderSpaceFillingCurveForDofDist<TDomain>(vDD[i], approxSpace.domain(), sfc);
+}
+
+#ifdef UG_DIM_1
+template void ComputeSpaceFillingCurveOrder<1>(std::vector<size_t>& vNewIndex, std::vector<std::pair<MathVector<1>, size_t> >& vPos, SpaceFillingCurve);
+template void OrderSpaceFillingCurveForDofDist<Domain1d>(SmartPtr<DoFDistribution> dd, ConstSmartPtr<Domain1d> domain, SpaceFillingCurve);
+template void OrderSpaceFillingCurve<Domain1d>(ApproximationSpace<Domain1d>& approxSpace);
+template void OrderSpaceFillingCurve<Domain1d>(ApproximationSpace<Domain1d>& approxSpace, const char* curve);
+#endif
+#ifdef UG_DIM_2
+template void ComputeSpaceFillingCurveOrder<2>(std::vector<size_t>& vNewIndex, std::vector<std::pair<MathVector<2>, size_t> >& vPos, SpaceFillingCurve);
+template void OrderSpaceFillingCurveForDofDist<Domain2d>(SmartPtr<DoFDistribution> dd, ConstSmartPtr<Domain2d> domain, SpaceFillingCurve);
+template void OrderSpaceFillingCurve<Domain2d>(ApproximationSpace<Domain2d>& approxSpace);
+template void OrderSpaceFillingCurve<Domain2d>(ApproximationSpace<Domain2d>& approxSpace, const char* curve);
+#endif
+#ifdef UG_DIM_3
+template void ComputeSpaceFillingCurveOrder<3>(std::vector<size_t>& vNewIndex, std::vector<std::pair<MathVector<3>, size_t> >& vPos, SpaceFillingCurve);
+template void OrderSpaceFillingCurveForDofDist<Domain3d>(SmartPtr<DoFDistribution> dd, ConstSmartPtr<Domain3d> domain, SpaceFillingCurve);
+template void OrderSpaceFillingCurve<Domain3d>(ApproximationSpace<Domain3d>& approxSpace);
+template void OrderSpaceFillingCurve<Domain3d>(ApproximationSpace<Domain3d>& approxSpace, const char* curve);
+#endif
+
+}
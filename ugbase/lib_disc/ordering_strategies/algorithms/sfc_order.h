@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__ORDERING_STRATEGIES_ALGORITHMS__SFC_ORDER__
+#define __H__UG__LIB_DISC__ORDERING_STRATEGIES_ALGORITHMS__SFC_ORDER__
+
+#include <vector>
+#include <utility> // for pair
+
+#include "lib_disc/function_spaces/approximation_space.h"
+#include "lib_grid/algorithms/space_filling_curve_util.h"
+
+namespace ug{
+
+///	computes an order of the given positions along a space filling curve
+/**	The curve is placed in the bounding box of the given positions. The
+ * mapping old -> new index is written to vNewIndex. If vPos does not contain
+ * all indices, the given indices are ordered among themselves, all others
+ * keep their index (cf. ComputeLexicographicOrder).*/
+template<int dim>
+void ComputeSpaceFillingCurveOrder(std::vector<size_t>& vNewIndex,
+                                   std::vector<std::pair<MathVector<dim>, size_t> >& vPos,
+                                   SpaceFillingCurve sfc = SFC_HILBERT);
+
+/// orders the dof distribution along a space filling curve through the dof positions
+template <typename TDomain>
+void OrderSpaceFillingCurveForDofDist(SmartPtr<DoFDistribution> dd,
+                                      ConstSmartPtr<TDomain> domain,
+                                      SpaceFillingCurve sfc = SFC_HILBERT);
+
+/// orders all DofDistributions of the ApproximationSpace along a Hilbert curve
+template <typename TDomain>
+void OrderSpaceFillingCurve(ApproximationSpace<TDomain>& approxSpace);
+
+/// orders all DofDistributions of the ApproximationSpace along the given curve ("hilbert" or "morton")
+template <typename TDomain>
+void OrderSpaceFillingCurve(ApproximationSpace<TDomain>& approxSpace, const char* curve);
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__ORDERING_STRATEGIES_ALGORITHMS__SFC_ORDER__ */
@@ -36,6 +36,7 @@
 #include "lib_grid/tools/bool_marker.h"
 #include "lib_grid/tools/selector_grid.h"
 #include "lib_disc/spatial_disc/local_to_global/local_to_global_mapper.h"
+#include "lib_disc/spatial_disc/local_to_global/local_to_global_scatter_map.h"
 #include "lib_disc/spatial_disc/elem_disc/elem_disc_interface.h"
 
 namespace ug{
@@ -107,7 +108,8 @@ class AssemblingTuner
 		m_bSingleAssIndex(false), m_SingleAssIndex(0),
 		m_bForceRegGrid(false), m_bModifySolutionImplemented(false),
 		m_ConstraintTypesEnabled(CT_ALL), m_ElemTypesEnabled(EDT_ALL),
-		m_bMatrixIsConst(false), m_bMatrixStructureIsConst(false), m_bClearOnResize(true) {}
+		m_bMatrixIsConst(false), m_bMatrixStructureIsConst(false), m_bClearOnResize(true),
+		m_bUseScatterMap(true), m_numThreads(1) {}
 
 	/// destructor
 		virtual ~AssemblingTuner() {}
@@ -133,6 +135,8 @@ class AssemblingTuner
 		{
 			if (m_pMapper)
 				m_pMapper->add_local_mat_to_global(mat, lmat, dd);
+			else if (scatter_map_used())
+				m_scatterMap.add(mat, lmat);
 			else
 				m_defaultMapper.add_local_mat_to_global(mat, lmat);
 		}
@@ -250,7 +254,27 @@ class AssemblingTuner
 	 */
 		void set_matrix_is_const(bool bCh) {m_bMatrixIsConst = bCh;}
 
-		void set_matrix_structure_is_const(bool b) {m_bMatrixStructureIsConst = b;}
+		void set_matrix_structure_is_const(bool b)
+		{
+			m_bMatrixStructureIsConst = b;
+			if(!b) m_scatterMap.invalidate();
+		}
+
+	/**
+	 * specify whether the positions of the local matrix entries in the
+	 * global matrix are cached, if the matrix structure is constant. In
+	 * this case the first assembling with constant structure records the
+	 * positions and all following ones add the local matrices directly by
+	 * these positions. The cache is renewed if the DoFDistribution changes
+	 * (cf. LocalToGlobalScatterMap). Thus, the cache is active whenever
+	 * set_matrix_structure_is_const is set, unless disabled here, e.g. to
+	 * save its memory. Default: true.
+	 */
+		void set_use_scatter_map(bool bUse)
+		{
+			m_bUseScatterMap = bUse;
+			if(!bUse) m_scatterMap.invalidate();
+		}
 
 	/**
 	 * whether matrix is to be modified by assembling
@@ -259,6 +283,32 @@ class AssemblingTuner
 	 */
 		bool matrix_is_const() const {return m_bMatrixIsConst;}
 
+	///	sets the number of threads used in the element loops
+	/**
+	 * If set to a value greater than one, the element loops of the stationary
+	 * jacobian, defect and linear assembling are colored, such that the
+	 * elements of one color share no algebra index, and the elements of one
+	 * color are assembled concurrently, each thread using its own
+	 * DataEvaluator and local algebra. This requires ug4 to be compiled with
+	 * OPENMP and all element discretizations of the subset to support
+	 * concurrent element assembling (cf.
+	 * IElemDiscBase::thread_safe_elem_assembling); otherwise the loops stay
+	 * serial. Default: 1.
+	 *
+	 * \param[in]	numThreads		number of threads (0 or 1 for serial assembling)
+	 */
+		void set_num_threads(size_t numThreads) {m_numThreads = (numThreads > 0) ? numThreads : 1;}
+
+	///	returns the number of threads used in the element loops
+		size_t num_threads() const {return m_numThreads;}
+
+	///	returns if the local algebra is added to the global one by index
+	/**
+	 * In this case local contributions of elements without common indices
+	 * may be added concurrently (no mapping, no single index assembling).
+	 */
+		bool local_to_global_by_index() const {return !m_pMapper && !m_bSingleAssIndex;}
+
 	protected:
 	///	default LocalToGlobalMapper
 		LocalToGlobalMapper<TAlgebra> m_defaultMapper;
@@ -266,6 +316,13 @@ class AssemblingTuner
 	///	LocalToGlobalMapper
 		ILocalToGlobalMapper<TAlgebra>* m_pMapper;
 
+	///	returns if the scatter map is used for the matrix assembling
+		bool scatter_map_used() const
+		{
+			return m_bUseScatterMap && m_bMatrixStructureIsConst
+					&& !m_pMapper && !m_bSingleAssIndex;
+		}
+
 	///	marker used to skip elements
 		BoolMarker* m_pBoolMarker;
 
@@ -297,6 +354,13 @@ class AssemblingTuner
 
 	/// disables clearing of vector/matrix on resize
 		bool m_bClearOnResize;
+
+	///	cache of the positions of local matrix entries in the global matrix
+		bool m_bUseScatterMap;
+		mutable LocalToGlobalScatterMap<matrix_type> m_scatterMap;
+
+	///	number of threads used in the element loops
+		size_t m_numThreads;
 };
 
 } // end namespace ug
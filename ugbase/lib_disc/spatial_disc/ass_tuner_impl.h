@@ -71,6 +71,8 @@ void AssemblingTuner<TAlgebra>::resize(ConstSmartPtr<DoFDistribution> dd,
 					"The assembling tuner is set to use a constant matrix structure, "
 					"but the number of indices in the new matrix is different from that in the old one.");
 				mat.clear_retain_structure();
+				if (scatter_map_used())
+					m_scatterMap.begin_pass(mat, *dd);
 			}
 			else
 				mat.resize_and_clear(numIndex, numIndex);
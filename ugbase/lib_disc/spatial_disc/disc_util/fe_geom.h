@@ -39,6 +39,7 @@
 #include "lib_disc/reference_element/reference_mapping_provider.h"
 #include "lib_disc/reference_element/reference_mapping.h"
 #include "common/util/provider.h"
+#include "geom_cache.h"
 
 #include <cmath>
 
@@ -174,6 +175,26 @@ class FEGeometry
 
 	///	determinate of transformation at ip
 		number m_vDetJ[nip];
+
+	protected:
+	///	element dependent data stored in the geometry cache
+	/**
+	 * For affine elements only one Jacobian is stored, since it is the same
+	 * for all integration points.
+	 */
+		struct CacheEntry
+		{
+			static const size_t numJac =
+				ReferenceMapping<ref_elem_type, worldDim>::isLinear ? 1 : nip;
+
+			MathVector<worldDim> vIPGlobal[nip];
+			MathVector<worldDim> vvGradGlobal[nip][nsh];
+			MathMatrix<worldDim,dim> vJTInv[numJac];
+			number vDetJ[numJac];
+		};
+
+	///	cached data per element
+		ElemGeomCache<CacheEntry, ref_elem_type::numCorners, worldDim> m_cache;
 };
 
 
@@ -88,6 +88,22 @@ update(GridObject* elem, const MathVector<worldDim>* vCorner,
 	if(pElem == m_pElem) return;
 	else m_pElem = pElem;
 
+//	reuse the data computed before for this element, if cached
+	if(GeomCacheControl::enabled()){
+		const CacheEntry* pEntry = m_cache.find(pElem, vCorner);
+		if(pEntry != NULL){
+			const size_t numJac = CacheEntry::numJac;
+			for(size_t ip = 0; ip < nip; ++ip){
+				m_vIPGlobal[ip] = pEntry->vIPGlobal[ip];
+				m_vJTInv[ip] = pEntry->vJTInv[(numJac == 1) ? 0 : ip];
+				m_vDetJ[ip] = pEntry->vDetJ[(numJac == 1) ? 0 : ip];
+				for(size_t sh = 0; sh < nsh; ++sh)
+					m_vvGradGlobal[ip][sh] = pEntry->vvGradGlobal[ip][sh];
+			}
+			return;
+		}
+	}
+
 //	update the mapping for the new corners
 	m_mapping.update(vCorner);
 
@@ -103,6 +119,22 @@ update(GridObject* elem, const MathVector<worldDim>* vCorner,
 		for(size_t sh = 0; sh < nsh; ++sh)
 			MatVecMult(m_vvGradGlobal[ip][sh],
 			           m_vJTInv[ip], m_vvGradLocal[ip][sh]);
+
+//	remember the data for the next update of this element
+	if(GeomCacheControl::enabled()){
+		CacheEntry* pEntry = m_cache.insert(pElem, vCorner);
+		if(pEntry != NULL){
+			for(size_t ip = 0; ip < nip; ++ip){
+				pEntry->vIPGlobal[ip] = m_vIPGlobal[ip];
+				for(size_t sh = 0; sh < nsh; ++sh)
+					pEntry->vvGradGlobal[ip][sh] = m_vvGradGlobal[ip][sh];
+			}
+			for(size_t j = 0; j < CacheEntry::numJac; ++j){
+				pEntry->vJTInv[j] = m_vJTInv[j];
+				pEntry->vDetJ[j] = m_vDetJ[j];
+			}
+		}
+	}
 }
 
 } // end namespace ug
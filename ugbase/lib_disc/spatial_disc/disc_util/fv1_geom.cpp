@@ -336,6 +336,12 @@ update(GridObject* elem, const MathVector<worldDim>* vCornerCoords, const ISubse
 // 	if already update for this element, do nothing
 	if(m_pElem == pElem) return; else m_pElem = pElem;
 
+//	reuse the data computed before for this element, if cached
+	if(GeomCacheControl::enabled() && restore_from_cache(vCornerCoords)){
+		if(num_boundary_subsets() == 0 || ish == NULL) return;
+		else {update_boundary_faces(pElem, vCornerCoords, ish); return;}
+	}
+
 // 	remember global position of nodes
 	for(size_t i = 0; i < m_rRefElem.num(0); ++i)
 		m_vvGloMid[0][i] = vCornerCoords[i];
@@ -458,11 +464,97 @@ update(GridObject* elem, const MathVector<worldDim>* vCornerCoords, const ISubse
 		for(size_t i = 0; i < num_scv(); ++i)
 			m_vGlobSCV_IP[i] = scv(i).global_ip();
 
+//	remember the data for the next update of this element
+	if(GeomCacheControl::enabled()) store_in_cache(vCornerCoords);
+
 //	if no boundary subsets required, return
 	if(num_boundary_subsets() == 0 || ish == NULL) return;
 	else update_boundary_faces(pElem, vCornerCoords, ish);
 }
 
+template <typename TElem, int TWorldDim, bool TCondensed>
+void FV1Geometry_gen<TElem, TWorldDim, TCondensed>::
+store_in_cache(const MathVector<worldDim>* vCornerCoords)
+{
+	CacheEntry* pEntry = m_cache.insert(m_pElem, vCornerCoords);
+	if(pEntry == NULL) return;
+	CacheEntry& e = *pEntry;
+
+	for(int d = 0; d <= dim; ++d)
+		for(int i = 0; i < maxMid; ++i)
+			e.vvGloMid[d][i] = m_vvGloMid[d][i];
+
+	for(size_t i = 0; i < num_scvf(); ++i){
+		e.vSCVFGlobalIP[i] = m_vSCVF[i].globalIP;
+		e.vSCVFNormal[i] = m_vSCVF[i].Normal;
+		for(size_t sh = 0; sh < nsh; ++sh)
+			e.vvSCVFGlobalGrad[i][sh] = m_vSCVF[i].vGlobalGrad[sh];
+	}
+
+	for(size_t i = 0; i < num_scv(); ++i){
+		e.vSCVVol[i] = m_vSCV[i].Vol;
+		for(size_t sh = 0; sh < nsh; ++sh)
+			e.vvSCVGlobalGrad[i][sh] = m_vSCV[i].vGlobalGrad[sh];
+	}
+
+	if(CacheEntry::numJac == 1){
+		e.vJtInv[0] = m_vSCVF[0].JtInv;
+		e.vDetJ[0] = m_vSCVF[0].detj;
+	}
+	else{
+		for(size_t i = 0; i < num_scvf(); ++i){
+			e.vJtInv[i] = m_vSCVF[i].JtInv;
+			e.vDetJ[i] = m_vSCVF[i].detj;
+		}
+		for(size_t i = 0; i < num_scv(); ++i){
+			e.vJtInv[numSCVF + i] = m_vSCV[i].JtInv;
+			e.vDetJ[numSCVF + i] = m_vSCV[i].detj;
+		}
+	}
+}
+
+template <typename TElem, int TWorldDim, bool TCondensed>
+bool FV1Geometry_gen<TElem, TWorldDim, TCondensed>::
+restore_from_cache(const MathVector<worldDim>* vCornerCoords)
+{
+	const CacheEntry* pEntry = m_cache.find(m_pElem, vCornerCoords);
+	if(pEntry == NULL) return false;
+	const CacheEntry& e = *pEntry;
+
+	for(int d = 0; d <= dim; ++d)
+		for(int i = 0; i < maxMid; ++i)
+			m_vvGloMid[d][i] = e.vvGloMid[d][i];
+
+	for(size_t i = 0; i < num_scvf(); ++i){
+		CopyCornerByMidID<worldDim, maxMid>(m_vSCVF[i].vGloPos, m_vSCVF[i].vMidID, m_vvGloMid, SCVF::numCo);
+		m_vSCVF[i].globalIP = e.vSCVFGlobalIP[i];
+		m_vSCVF[i].Normal = e.vSCVFNormal[i];
+		for(size_t sh = 0; sh < nsh; ++sh)
+			m_vSCVF[i].vGlobalGrad[sh] = e.vvSCVFGlobalGrad[i][sh];
+		m_vSCVF[i].JtInv = e.vJtInv[(CacheEntry::numJac == 1) ? 0 : i];
+		m_vSCVF[i].detj = e.vDetJ[(CacheEntry::numJac == 1) ? 0 : i];
+		m_vGlobSCVF_IP[i] = m_vSCVF[i].globalIP;
+	}
+
+	for(size_t i = 0; i < num_scv(); ++i){
+		CopyCornerByMidID<worldDim, maxMid>(m_vSCV[i].vGloPos, m_vSCV[i].midId, m_vvGloMid, m_vSCV[i].num_corners());
+		m_vSCV[i].Vol = e.vSCVVol[i];
+		for(size_t sh = 0; sh < nsh; ++sh)
+			m_vSCV[i].vGlobalGrad[sh] = e.vvSCVGlobalGrad[i][sh];
+		m_vSCV[i].JtInv = e.vJtInv[(CacheEntry::numJac == 1) ? 0 : numSCVF + i];
+		m_vSCV[i].detj = e.vDetJ[(CacheEntry::numJac == 1) ? 0 : numSCVF + i];
+	}
+
+	if(ref_elem_type::REFERENCE_OBJECT_ID == ROID_PYRAMID || ref_elem_type::REFERENCE_OBJECT_ID == ROID_OCTAHEDRON)
+		for(size_t i = 0; i < num_scv(); ++i)
+			m_vGlobSCV_IP[i] = scv(i).global_ip();
+
+//	the mapping is used for the boundary faces
+	m_mapping.update(vCornerCoords);
+
+	return true;
+}
+
 template <typename TElem, int TWorldDim, bool TCondensed>
 void FV1Geometry_gen<TElem, TWorldDim, TCondensed>::
 update_boundary_faces(GridObject* elem, const MathVector<worldDim>* vCornerCoords, const ISubsetHandler* ish)
@@ -52,6 +52,7 @@
 #include "lib_disc/quadrature/gauss/gauss_quad.h"
 #include "fv_util.h"
 #include "fv_geom_base.h"
+#include "geom_cache.h"
 
 namespace ug{
 
@@ -649,6 +650,35 @@ class FV1Geometry_gen : public FVGeometryBase
 
 	///	Shape function set
 		const local_shape_fct_set_type& m_rTrialSpace;
+
+	///	element dependent data stored in the geometry cache
+	/**
+	 * For affine elements only one Jacobian is stored, since it is the same
+	 * for all integration points.
+	 */
+		struct CacheEntry
+		{
+			static const size_t numJac =
+				ReferenceMapping<ref_elem_type, worldDim>::isLinear ? 1 : numSCVF + numSCV;
+
+			MathVector<worldDim> vvGloMid[dim+1][maxMid];
+			MathVector<worldDim> vSCVFGlobalIP[numSCVF];
+			MathVector<worldDim> vSCVFNormal[numSCVF];
+			MathVector<worldDim> vvSCVFGlobalGrad[numSCVF][nsh];
+			number vSCVVol[numSCV];
+			MathVector<worldDim> vvSCVGlobalGrad[numSCV][nsh];
+			MathMatrix<worldDim,dim> vJtInv[numJac];
+			number vDetJ[numJac];
+		};
+
+	///	cached data per element
+		ElemGeomCache<CacheEntry, ref_elem_type::numCorners, worldDim> m_cache;
+
+	///	stores the current element data in the cache
+		void store_in_cache(const MathVector<worldDim>* vCornerCoords);
+
+	///	restores the element data from the cache, returns false if not cached
+		bool restore_from_cache(const MathVector<worldDim>* vCornerCoords);
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include "geom_cache.h"
+
+namespace ug{
+
+GeomCacheControl::GeomCacheControl()
+	: m_bEnabled(false), m_maxBytes(256 << 20), m_usedBytes(0)
+{}
+
+GeomCacheControl& GeomCacheControl::inst()
+{
+	static GeomCacheControl inst;
+	return inst;
+}
+
+void GeomCacheControl::enable(bool bEnable)
+{
+	GeomCacheControl& c = inst();
+	if(c.m_bEnabled == bEnable) return;
+
+	c.m_bEnabled = bEnable;
+
+//	the stored data is not needed any longer and would be outdated when
+//	enabling again
+	if(!bEnable)
+		invalidate();
+}
+
+void GeomCacheControl::invalidate()
+{
+	GeomCacheControl& c = inst();
+	for(size_t i = 0; i < c.m_vCache.size(); ++i)
+		c.m_vCache[i]->clear();
+}
+
+void GeomCacheControl::set_memory_budget(number MB)
+{
+	if(MB < 0)
+		UG_THROW("GeomCacheControl: memory budget must be non-negative.");
+
+	inst().m_maxBytes = (size_t)(MB * (1 << 20));
+}
+
+bool GeomCacheControl::request(size_t numBytes)
+{
+	GeomCacheControl& c = inst();
+	if(c.m_usedBytes + numBytes > c.m_maxBytes) return false;
+	c.m_usedBytes += numBytes;
+	return true;
+}
+
+void GeomCacheControl::release(size_t numBytes)
+{
+	GeomCacheControl& c = inst();
+	c.m_usedBytes = (numBytes > c.m_usedBytes) ? 0 : c.m_usedBytes - numBytes;
+}
+
+void GeomCacheControl::register_cache(IElemGeomCache* pCache)
+{
+	inst().m_vCache.push_back(pCache);
+}
+
+void GeomCacheControl::unregister_cache(IElemGeomCache* pCache)
+{
+	std::vector<IElemGeomCache*>& vCache = inst().m_vCache;
+	vCache.erase(std::remove(vCache.begin(), vCache.end(), pCache), vCache.end());
+}
+
+} // end namespace ug
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__GEOM_CACHE__
+#define __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__GEOM_CACHE__
+
+#include <vector>
+#include "common/common.h"
+#include "common/math/ugmath.h"
+#include "lib_grid/grid/grid_base_objects.h"
+
+namespace ug{
+
+///	Base class of the element-wise geometry caches
+/**
+ * All caches register at GeomCacheControl, which clears them when caching
+ * is disabled or the cached data is invalidated.
+ */
+class IElemGeomCache
+{
+	public:
+		virtual ~IElemGeomCache() {}
+
+	///	removes all entries and gives their memory back to the budget
+		virtual void clear() = 0;
+};
+
+///	Global control of the element-wise geometry caches
+/**
+ * Geometries (e.g. FV1Geometry, FEGeometry) can store the element dependent
+ * part of their data for every element, such that on a static mesh the
+ * update for an already visited element reduces to a copy. The caches are
+ * disabled by default. All caches share one memory budget: if it is
+ * exhausted, further elements are computed as usual but not stored.
+ *
+ * Stored data is validated by the corner coordinates of the element. All
+ * caches are cleared when caching is disabled and whenever the data is
+ * invalidated, e.g. after the grid has been adapted or redistributed.
+ */
+class GeomCacheControl
+{
+	public:
+	///	enables or disables all geometry caches
+	/**	Disabling releases all cached data.*/
+		static void enable(bool bEnable);
+
+	///	returns if the geometry caches are used
+		static bool enabled() {return inst().m_bEnabled;}
+
+	///	sets the memory budget shared by all caches (in MB)
+		static void set_memory_budget(number MB);
+
+	///	returns the memory budget shared by all caches (in bytes)
+		static size_t memory_budget() {return inst().m_maxBytes;}
+
+	///	returns the memory currently used by all caches (in bytes)
+		static size_t memory_used() {return inst().m_usedBytes;}
+
+	///	clears all caches
+		static void invalidate();
+
+	///	requests memory from the budget, returns false if exhausted
+		static bool request(size_t numBytes);
+
+	///	gives memory back to the budget
+		static void release(size_t numBytes);
+
+	///	registers a cache, which is cleared on invalidate and when disabled
+		static void register_cache(IElemGeomCache* pCache);
+
+	///	unregisters a cache
+		static void unregister_cache(IElemGeomCache* pCache);
+
+	protected:
+		GeomCacheControl();
+		static GeomCacheControl& inst();
+
+		bool m_bEnabled;
+		size_t m_maxBytes;
+		size_t m_usedBytes;
+		std::vector<IElemGeomCache*> m_vCache;
+};
+
+///	Element-wise storage for the data of a geometry
+/**
+ * Maps an element to an entry of type TEntry, which holds whatever the
+ * geometry needs to restore its element dependent data. An entry is only
+ * returned if the element and the corners passed match those used when
+ * storing it.
+ *
+ * Geometries don't know the grid of the elements they are updated for.
+ * The entries are therefore found through the index by which the grid
+ * addresses the attachments of an element (GridObject::grid_data_index),
+ * i.e. by a direct lookup in an index array instead of a search.
+ *
+ * \tparam	TEntry			type of stored data
+ * \tparam	TNumCorners		number of corners of the element
+ * \tparam	TWorldDim		world dimension
+ */
+template <typename TEntry, int TNumCorners, int TWorldDim>
+class ElemGeomCache : public IElemGeomCache
+{
+	public:
+		ElemGeomCache()				{GeomCacheControl::register_cache(this);}
+
+		virtual ~ElemGeomCache()
+		{
+			clear();
+			GeomCacheControl::unregister_cache(this);
+		}
+
+	///	returns the entry stored for the element, NULL if not present
+		const TEntry* find(GridObject* elem, const MathVector<TWorldDim>* vCorner) const
+		{
+			const uint ind = elem->grid_data_index();
+			if(ind >= m_vSlotIndex.size() || m_vSlotIndex[ind] == s_invalid)
+				return NULL;
+
+			const Slot& slot = m_vSlot[m_vSlotIndex[ind]];
+			if(slot.pElem != elem) return NULL;
+			for(int co = 0; co < TNumCorners; ++co)
+				if(slot.vCorner[co] != vCorner[co]) return NULL;
+
+			return &slot.entry;
+		}
+
+	///	returns an entry to be filled for the element, NULL if budget is exhausted
+		TEntry* insert(GridObject* elem, const MathVector<TWorldDim>* vCorner)
+		{
+			const uint ind = elem->grid_data_index();
+			if(ind >= m_vSlotIndex.size()){
+				const size_t numNew = ind + 1 - m_vSlotIndex.size();
+				if(!GeomCacheControl::request(numNew * sizeof(uint))) return NULL;
+				m_vSlotIndex.resize(ind + 1, s_invalid);
+			}
+
+			if(m_vSlotIndex[ind] == s_invalid){
+				if(!GeomCacheControl::request(sizeof(Slot))) return NULL;
+				m_vSlotIndex[ind] = (uint)m_vSlot.size();
+				m_vSlot.resize(m_vSlot.size() + 1);
+			}
+
+			Slot& slot = m_vSlot[m_vSlotIndex[ind]];
+			slot.pElem = elem;
+			for(int co = 0; co < TNumCorners; ++co)
+				slot.vCorner[co] = vCorner[co];
+
+			return &slot.entry;
+		}
+
+	///	removes all entries and frees their memory
+		virtual void clear()
+		{
+			GeomCacheControl::release(m_vSlot.size() * sizeof(Slot)
+									  + m_vSlotIndex.size() * sizeof(uint));
+			std::vector<uint>().swap(m_vSlotIndex);
+			std::vector<Slot>().swap(m_vSlot);
+		}
+
+	///	number of cached elements
+		size_t size() const {return m_vSlot.size();}
+
+	protected:
+		struct Slot
+		{
+			GridObject* pElem;
+			MathVector<TWorldDim> vCorner[TNumCorners];
+			TEntry entry;
+		};
+
+		static const uint s_invalid = (uint)-1;
+
+	///	slot of an element by its grid data index
+		std::vector<uint> m_vSlotIndex;
+		std::vector<Slot> m_vSlot;
+};
+
+template <typename TEntry, int TNumCorners, int TWorldDim>
+const uint ElemGeomCache<TEntry, TNumCorners, TWorldDim>::s_invalid;
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__GEOM_CACHE__ */
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__TENSOR_PROD_FE_GEOM__
+#define __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__TENSOR_PROD_FE_GEOM__
+
+#include <vector>
+#include "common/common.h"
+#include "common/math/ugmath.h"
+#include "lib_grid/grid/grid_base_objects.h"
+#include "lib_disc/quadrature/quadrature_provider.h"
+#include "lib_disc/local_finite_element/local_finite_element_provider.h"
+#include "lib_disc/local_finite_element/lagrange/lagrange_tensor_prod.h"
+#include "lib_disc/reference_element/reference_mapping.h"
+
+namespace ug{
+
+///	Finite element geometry with sum-factorized evaluation of Lagrange spaces
+/**
+ * This geometry is meant for Lagrange spaces on edges, quadrilaterals and
+ * hexahedra. Instead of tables of all shape functions and their gradients at
+ * all integration points it only holds the 1D tables of a
+ * LagrangeTensorProduct kernel and the element mapping at the integration
+ * points of the tensor-product Gauss-Legendre rule. The values of a
+ * discrete function, its global gradients and the testing with the shape
+ * functions are computed by sum factorization.
+ *
+ * The geometry depends on the trial space and the quadrature order, thus it
+ * is obtained by
+ * \code
+ * 	TensorProductFEGeometry<Quadrilateral, 2>& geo
+ * 		= GeomProvider<TensorProductFEGeometry<Quadrilateral, 2> >::get(lfeID, quadOrder);
+ * 	geo.update(pElem, vCorner, lfeID, quadOrder);
+ * \endcode
+ *
+ * The integration points are those of the GAUSS_LEGENDRE rule of the
+ * QuadratureRuleProvider, i.e. with the first coordinate running slowest.
+ *
+ * \tparam	TElem		element type (Edge, Quadrilateral or Hexahedron)
+ * \tparam	TWorldDim	world dimension
+ */
+template <typename TElem, int TWorldDim>
+class TensorProductFEGeometry
+{
+	public:
+	///	type of reference element
+		typedef typename reference_element_traits<TElem>::reference_element_type ref_elem_type;
+
+	/// reference element dimension
+		static const int dim = ref_elem_type::dim;
+
+	/// world dimension
+		static const int worldDim = TWorldDim;
+
+	/// flag indicating if local data may change
+		static const bool staticLocalData = false;
+
+	public:
+	///	Constructor
+		TensorProductFEGeometry() : m_quadOrder(-1), m_pQuadRule(NULL) {}
+
+	/// number of integration points
+		size_t num_ip() const {return m_kernel.num_ip();}
+
+	/// number of shape functions
+		size_t num_sh() const {return m_kernel.num_sh();}
+
+	/// weight for integration point
+		number weight(size_t ip) const
+		{
+			UG_ASSERT(ip < num_ip(), "Wrong index");
+			return m_vDetJ[ip] * m_pQuadRule->weight(ip);
+		}
+
+	/// local integration point
+		const MathVector<dim>& local_ip(size_t ip) const
+		{
+			UG_ASSERT(ip < num_ip(), "Wrong index");
+			return m_pQuadRule->point(ip);
+		}
+
+	/// global integration point
+		const MathVector<worldDim>& global_ip(size_t ip) const
+		{
+			UG_ASSERT(ip < m_vIPGlobal.size(), "Wrong ip.");
+			return m_vIPGlobal[ip];
+		}
+
+	/// transposed inverse of the jacobian at ip
+		const MathMatrix<worldDim,dim>& JTInv(size_t ip) const
+		{
+			UG_ASSERT(ip < m_vJTInv.size(), "Wrong index");
+			return m_vJTInv[ip];
+		}
+
+	/// determinant of the jacobian at ip
+		number detJ(size_t ip) const
+		{
+			UG_ASSERT(ip < m_vDetJ.size(), "Wrong index");
+			return m_vDetJ[ip];
+		}
+
+	///	the underlying kernel (local quantities only)
+		const LagrangeTensorProduct<dim>& kernel() const {return m_kernel;}
+
+	public:
+	///	values at the integration points: vValue[ip] = sum_sh vDoF[sh] * phi_sh(x_ip)
+		void interpolate(number* vValue, const number* vDoF) const
+		{
+			m_kernel.interpolate(vValue, vDoF);
+		}
+
+	///	global gradients at the integration points
+		void global_grad(MathVector<worldDim>* vGrad, const number* vDoF) const
+		{
+			m_vLocalGrad.resize(num_ip());
+			m_kernel.local_grad(&m_vLocalGrad[0], vDoF);
+			for(size_t ip = 0; ip < m_vLocalGrad.size(); ++ip)
+				MatVecMult(vGrad[ip], m_vJTInv[ip], m_vLocalGrad[ip]);
+		}
+
+	///	adds the integral: vDoF[sh] += sum_ip weight(ip) * (vValue[ip]*phi_sh + vGrad[ip]*grad phi_sh)
+	/**
+	 * The gradients of the shape functions are the global ones. Both, vValue
+	 * and vGrad, may be NULL if not needed.
+	 */
+		void integrate(number* vDoF, const number* vValue,
+		               const MathVector<worldDim>* vGrad) const
+		{
+			const size_t nip = num_ip();
+			if(vValue != NULL)
+			{
+				m_vWeighted.resize(nip);
+				for(size_t ip = 0; ip < nip; ++ip)
+					m_vWeighted[ip] = weight(ip) * vValue[ip];
+				m_kernel.integrate(vDoF, &m_vWeighted[0], NULL);
+			}
+
+			if(vGrad != NULL)
+			{
+			//	grad phi = JTInv * local grad phi, thus test with JTInv^T * vGrad
+				m_vLocalGrad.resize(nip);
+				for(size_t ip = 0; ip < nip; ++ip)
+				{
+					TransposedMatVecMult(m_vLocalGrad[ip], m_vJTInv[ip], vGrad[ip]);
+					m_vLocalGrad[ip] *= weight(ip);
+				}
+				m_kernel.integrate(vDoF, NULL, &m_vLocalGrad[0]);
+			}
+		}
+
+	public:
+	/// update local data for a trial space and quadrature order
+		void update_local(const LFEID& lfeID, size_t orderQuad)
+		{
+			if(lfeID.type() != LFEID::LAGRANGE)
+				UG_THROW("TensorProductFEGeometry: Only Lagrange spaces "
+						"supported, but got "<<lfeID);
+
+			const ReferenceObjectID roid = ref_elem_type::REFERENCE_OBJECT_ID;
+			try{
+			m_pQuadRule = &QuadratureRuleProvider<dim>::get(roid, orderQuad, GAUSS_LEGENDRE);
+			const QuadratureRule<1>& quadRule1D
+				= QuadratureRuleProvider<1>::get(ROID_EDGE, orderQuad, GAUSS_LEGENDRE);
+
+			m_kernel.init(LocalFiniteElementProvider::get<dim>(roid, lfeID),
+			              lfeID.order(), quadRule1D);
+			}UG_CATCH_THROW("TensorProductFEGeometry: Cannot set up "<<lfeID
+			                <<" with quadrature order "<<orderQuad<<".");
+
+			if(m_pQuadRule->size() != m_kernel.num_ip())
+				UG_THROW("TensorProductFEGeometry: Quadrature rule is not of "
+						"tensor-product type.");
+
+			m_lfeID = lfeID;
+			m_quadOrder = orderQuad;
+
+			m_vIPGlobal.resize(num_ip());
+			m_vJTInv.resize(num_ip());
+			m_vDetJ.resize(num_ip());
+		}
+
+	/// update Geometry for corners
+		void update(GridObject* pElem, const MathVector<worldDim>* vCorner,
+		            const LFEID& lfeID, size_t orderQuad)
+		{
+		//	if already prepared for this space, skip update of local values
+			if(lfeID != m_lfeID || (int)orderQuad != m_quadOrder)
+				update_local(lfeID, orderQuad);
+
+			m_mapping.update(vCorner);
+			m_mapping.local_to_global(&m_vIPGlobal[0], m_pQuadRule->points(), num_ip());
+			m_mapping.jacobian_transposed_inverse(&m_vJTInv[0], &m_vDetJ[0],
+			                                      m_pQuadRule->points(), num_ip());
+		}
+		void update(GridObject* pElem, const MathVector<worldDim>* vCorner,
+		            const LFEID& lfeID){
+			update(pElem, vCorner, lfeID, 2*lfeID.order() + 1);
+		}
+
+	/// update Geometry for corners with the current space and order
+		void update(GridObject* pElem, const MathVector<worldDim>* vCorner)
+		{
+			update(pElem, vCorner, m_lfeID, m_quadOrder);
+		}
+
+	protected:
+	///	current trial space and quadrature order
+		LFEID m_lfeID;
+		int m_quadOrder;
+
+	///	tensor-product quadrature rule
+		const QuadratureRule<dim>* m_pQuadRule;
+
+	///	sum-factorization kernel
+		LagrangeTensorProduct<dim> m_kernel;
+
+	///	reference mapping
+		ReferenceMapping<ref_elem_type, worldDim> m_mapping;
+
+	///	global integration points
+		std::vector<MathVector<worldDim> > m_vIPGlobal;
+
+	///	transposed inverse of jacobian at ip
+		std::vector<MathMatrix<worldDim,dim> > m_vJTInv;
+
+	///	determinant of jacobian at ip
+		std::vector<number> m_vDetJ;
+
+	///	work arrays
+		mutable std::vector<MathVector<dim> > m_vLocalGrad;
+		mutable std::vector<number> m_vWeighted;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__TENSOR_PROD_FE_GEOM__ */
@@ -272,6 +272,47 @@ class DomainDiscretizationBase
 		                                       const GridLevel& gl)
 		{assemble_stiffness_matrix(A, u, dd(gl));}
 
+	///////////////////////////
+	// Matrix-free Jacobian
+	///////////////////////////
+
+	/// \copydoc IAssemble::apply_jacobian()
+		virtual void apply_jacobian(vector_type& d, const vector_type& u, const vector_type& c,
+		                            ConstSmartPtr<DoFDistribution> dd);
+		virtual void apply_jacobian(vector_type& d, const vector_type& u, const vector_type& c,
+		                            const GridLevel& gl)
+		{apply_jacobian(d, u, c, dd(gl));}
+
+	/// \copydoc IAssemble::assemble_jacobian_diagonal()
+		virtual void assemble_jacobian_diagonal(vector_type& diag, const vector_type& u,
+		                                        ConstSmartPtr<DoFDistribution> dd);
+		virtual void assemble_jacobian_diagonal(vector_type& diag, const vector_type& u,
+		                                        const GridLevel& gl)
+		{assemble_jacobian_diagonal(diag, u, dd(gl));}
+
+	/// \copydoc IAssemble::assemble_local_jacobians()
+		virtual void assemble_local_jacobians(LocalJacobianCache& cache, const vector_type& u,
+		                                      ConstSmartPtr<DoFDistribution> dd);
+		virtual void assemble_local_jacobians(LocalJacobianCache& cache, const vector_type& u,
+		                                      const GridLevel& gl)
+		{assemble_local_jacobians(cache, u, dd(gl));}
+
+	///	applies the Jacobian given by stored local Jacobians
+		virtual void apply_jacobian(vector_type& d, const vector_type& u, const vector_type& c,
+		                            const LocalJacobianCache& cache,
+		                            ConstSmartPtr<DoFDistribution> dd);
+		virtual void apply_jacobian(vector_type& d, const vector_type& u, const vector_type& c,
+		                            const LocalJacobianCache& cache, const GridLevel& gl)
+		{apply_jacobian(d, u, c, cache, dd(gl));}
+
+	///	assembles the diagonal of the Jacobian given by stored local Jacobians
+		virtual void assemble_jacobian_diagonal(vector_type& diag, const vector_type& u,
+		                                        const LocalJacobianCache& cache,
+		                                        ConstSmartPtr<DoFDistribution> dd);
+		virtual void assemble_jacobian_diagonal(vector_type& diag, const vector_type& u,
+		                                        const LocalJacobianCache& cache, const GridLevel& gl)
+		{assemble_jacobian_diagonal(diag, u, cache, dd(gl));}
+
 	///////////////////////////
 	// Init. all exports (an optional operation, to use the exports for plotting etc.)
 	///////////////////////////
@@ -505,6 +546,14 @@ public:
 		void update_disc_items();
 		void update_error_items();
 
+	///	checks that only constraints expressible without a matrix are enabled
+		void check_matrix_free_constraints(const char* caller);
+
+	///	sets the result of the matrix-free jacobian in dirichlet rows to c
+		void adjust_matrix_free_jacobian(vector_type& d, const vector_type& u,
+		                                 const vector_type& c,
+		                                 ConstSmartPtr<DoFDistribution> dd);
+
 	protected:
 	///	returns the level dof distribution
 		ConstSmartPtr<DoFDistribution> dd(const GridLevel& gl) const{return m_spApproxSpace->dof_distribution(gl);}
@@ -560,6 +609,25 @@ public:
 									vector_type& d,
 									const vector_type& u);
 	template <typename TElem>
+	void ApplyJacobian(				const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+									ConstSmartPtr<DoFDistribution> dd,
+									int si, bool bNonRegularGrid,
+									vector_type& d,
+									const vector_type& u,
+									const vector_type& c);
+	template <typename TElem>
+	void AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+									ConstSmartPtr<DoFDistribution> dd,
+									int si, bool bNonRegularGrid,
+									vector_type& diag,
+									const vector_type& u);
+	template <typename TElem>
+	void AssembleLocalJacobians(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+									ConstSmartPtr<DoFDistribution> dd,
+									int si, bool bNonRegularGrid,
+									LocalJacobianCache& cache,
+									const vector_type& u);
+	template <typename TElem>
 	void AssembleLinear( 			const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 									ConstSmartPtr<DoFDistribution> dd,
 									int si, bool bNonRegularGrid,
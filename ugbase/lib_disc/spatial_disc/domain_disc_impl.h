@@ -640,6 +640,614 @@ AssembleJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	}
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Matrix-free Jacobian (stationary)
+///////////////////////////////////////////////////////////////////////////////
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+apply_jacobian(vector_type& d,
+               const vector_type& u,
+               const vector_type& c,
+               ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+//	update the elem discs
+	update_disc_items();
+	prep_assemble_loop(m_vElemDisc);
+
+//	only dirichlet constraints can be expressed without the matrix
+	check_matrix_free_constraints("apply_jacobian");
+
+//	reset vector to zero and resize
+	m_spAssTuner->resize(dd, d);
+	if(c.size() != d.size())
+		UG_THROW("DomainDiscretization::apply_jacobian: Size of vector ("
+				<<c.size()<<") does not match number of DoFs ("<<d.size()<<").");
+
+//	Union of Subsets
+	SubsetGroup unionSubsets;
+	std::vector<SubsetGroup> vSSGrp;
+
+//	pre process -  modifies the solution, used for computing the defect
+	const vector_type* pModifyU = &u;
+	SmartPtr<vector_type> pModifyMemory;
+	if( m_spAssTuner->modify_solution_enabled() ){
+		pModifyMemory = u.clone();
+		pModifyU = pModifyMemory.get();
+		try{
+		for(int type = 1; type < CT_ALL; type = type << 1){
+			if(!(m_spAssTuner->constraint_type_enabled(type))) continue;
+			for(size_t i = 0; i < m_vConstraint.size(); ++i)
+				if(m_vConstraint[i]->type() & type)
+					m_vConstraint[i]->modify_solution(*pModifyMemory, u, dd, type);
+		}
+		} UG_CATCH_THROW("Cannot modify solution.");
+	}
+
+//	create list of all subsets
+	try{
+		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
+	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
+
+//	loop subsets
+	for(size_t i = 0; i < unionSubsets.size(); ++i)
+	{
+	//	get subset
+		const int si = unionSubsets[i];
+
+	//	get dimension of the subset
+		const int dim = DimensionOfSubset(*dd->subset_handler(), si);
+
+	//	request if subset is regular grid
+		bool bNonRegularGrid = !unionSubsets.regular_grid(i);
+
+	//	overrule by regular grid if required
+		if(m_spAssTuner->regular_grid_forced()) bNonRegularGrid = false;
+
+	//	Elem Disc on the subset
+		std::vector<IElemDisc<TDomain>*> vSubsetElemDisc;
+
+	//	get all element discretizations that work on the subset
+		GetElemDiscOnSubset(vSubsetElemDisc, m_vElemDisc, vSSGrp, si);
+
+	//	apply on suitable elements
+		try
+		{
+		switch(dim)
+		{
+		case 0:
+			this->template ApplyJacobian<RegularVertex>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			break;
+		case 1:
+			this->template ApplyJacobian<RegularEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template ApplyJacobian<ConstrainingEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			break;
+		case 2:
+			this->template ApplyJacobian<Triangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			this->template ApplyJacobian<Quadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template ApplyJacobian<ConstrainingTriangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			this->template ApplyJacobian<ConstrainingQuadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			break;
+		case 3:
+			this->template ApplyJacobian<Tetrahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			this->template ApplyJacobian<Pyramid>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			this->template ApplyJacobian<Prism>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			this->template ApplyJacobian<Hexahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			this->template ApplyJacobian<Octahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, d, *pModifyU, c);
+			break;
+		default:
+			UG_THROW("DomainDiscretization::apply_jacobian (stationary):"
+							"Dimension "<<dim<<"(subset="<<si<<") not supported");
+		}
+		}
+		UG_CATCH_THROW("DomainDiscretization::apply_jacobian (stationary):"
+						" Application of elements of Dimension " << dim << " in "
+						" subset "<<si<< " failed.");
+	}
+
+//	post process: the assembled jacobian has identity rows for dirichlet
+//	dofs, i.e. the result there is the input value itself
+	try{
+	adjust_matrix_free_jacobian(d, *pModifyU, c, dd);
+	post_assemble_loop(m_vElemDisc);
+	}UG_CATCH_THROW("DomainDiscretization::apply_jacobian:"
+					" Cannot execute post process.");
+
+//	Remember parallel storage type
+#ifdef UG_PARALLEL
+	d.set_storage_type(PST_ADDITIVE);
+#endif
+}
+
+/**
+ * This function adds the product of the Jacobian with a vector c of all
+ * passed element discretizations on one given subset to the vector d in
+ * the stationary case.
+ *
+ * \param[in]		vElemDisc		element discretizations
+ * \param[in]		si				subset index
+ * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+ * \param[in,out]	d				result vector
+ * \param[in]		u				solution
+ * \param[in]		c				vector the jacobian is applied to
+ */
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+template <typename TElem>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+ApplyJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+				ConstSmartPtr<DoFDistribution> dd,
+				int si, bool bNonRegularGrid,
+				vector_type& d,
+				const vector_type& u,
+				const vector_type& c)
+{
+	//	check if only some elements are selected
+	if(m_spAssTuner->selected_elements_used())
+	{
+		std::vector<TElem*> vElem;
+		m_spAssTuner->collect_selected_elements(vElem, dd, si);
+
+		//	application is carried out only over those elements
+		//	which are selected and in subset si
+		gass_type::template ApplyJacobian<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd, vElem.begin(), vElem.end(), si,
+			 bNonRegularGrid, d, u, c, m_spAssTuner);
+	}
+	else
+	{
+		//	general case: application over all elements in subset si
+		gass_type::template ApplyJacobian<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd,
+				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+					bNonRegularGrid, d, u, c, m_spAssTuner);
+	}
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+assemble_jacobian_diagonal(vector_type& diag,
+                           const vector_type& u,
+                           ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+//	update the elem discs
+	update_disc_items();
+	prep_assemble_loop(m_vElemDisc);
+
+//	only dirichlet constraints can be expressed without the matrix
+	check_matrix_free_constraints("assemble_jacobian_diagonal");
+
+//	reset vector to zero and resize
+	m_spAssTuner->resize(dd, diag);
+
+//	Union of Subsets
+	SubsetGroup unionSubsets;
+	std::vector<SubsetGroup> vSSGrp;
+
+//	pre process -  modifies the solution, used for computing the defect
+	const vector_type* pModifyU = &u;
+	SmartPtr<vector_type> pModifyMemory;
+	if( m_spAssTuner->modify_solution_enabled() ){
+		pModifyMemory = u.clone();
+		pModifyU = pModifyMemory.get();
+		try{
+		for(int type = 1; type < CT_ALL; type = type << 1){
+			if(!(m_spAssTuner->constraint_type_enabled(type))) continue;
+			for(size_t i = 0; i < m_vConstraint.size(); ++i)
+				if(m_vConstraint[i]->type() & type)
+					m_vConstraint[i]->modify_solution(*pModifyMemory, u, dd, type);
+		}
+		} UG_CATCH_THROW("Cannot modify solution.");
+	}
+
+//	create list of all subsets
+	try{
+		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
+	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
+
+//	loop subsets
+	for(size_t i = 0; i < unionSubsets.size(); ++i)
+	{
+	//	get subset
+		const int si = unionSubsets[i];
+
+	//	get dimension of the subset
+		const int dim = DimensionOfSubset(*dd->subset_handler(), si);
+
+	//	request if subset is regular grid
+		bool bNonRegularGrid = !unionSubsets.regular_grid(i);
+
+	//	overrule by regular grid if required
+		if(m_spAssTuner->regular_grid_forced()) bNonRegularGrid = false;
+
+	//	Elem Disc on the subset
+		std::vector<IElemDisc<TDomain>*> vSubsetElemDisc;
+
+	//	get all element discretizations that work on the subset
+		GetElemDiscOnSubset(vSubsetElemDisc, m_vElemDisc, vSSGrp, si);
+
+	//	assemble on suitable elements
+		try
+		{
+		switch(dim)
+		{
+		case 0:
+			this->template AssembleJacobianDiagonal<RegularVertex>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			break;
+		case 1:
+			this->template AssembleJacobianDiagonal<RegularEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template AssembleJacobianDiagonal<ConstrainingEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			break;
+		case 2:
+			this->template AssembleJacobianDiagonal<Triangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			this->template AssembleJacobianDiagonal<Quadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template AssembleJacobianDiagonal<ConstrainingTriangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			this->template AssembleJacobianDiagonal<ConstrainingQuadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			break;
+		case 3:
+			this->template AssembleJacobianDiagonal<Tetrahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			this->template AssembleJacobianDiagonal<Pyramid>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			this->template AssembleJacobianDiagonal<Prism>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			this->template AssembleJacobianDiagonal<Hexahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			this->template AssembleJacobianDiagonal<Octahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, diag, *pModifyU);
+			break;
+		default:
+			UG_THROW("DomainDiscretization::assemble_jacobian_diagonal (stationary):"
+							"Dimension "<<dim<<"(subset="<<si<<") not supported");
+		}
+		}
+		UG_CATCH_THROW("DomainDiscretization::assemble_jacobian_diagonal (stationary):"
+						" Assembling of elements of Dimension " << dim << " in "
+						" subset "<<si<< " failed.");
+	}
+
+//	post process: dirichlet rows of the assembled jacobian are identity rows
+	try{
+	SmartPtr<vector_type> spOne = diag.clone_without_values();
+	spOne->set(1.0);
+	adjust_matrix_free_jacobian(diag, *pModifyU, *spOne, dd);
+	post_assemble_loop(m_vElemDisc);
+	}UG_CATCH_THROW("DomainDiscretization::assemble_jacobian_diagonal:"
+					" Cannot execute post process.");
+
+//	Remember parallel storage type
+#ifdef UG_PARALLEL
+	diag.set_storage_type(PST_ADDITIVE);
+#endif
+}
+
+/**
+ * This function adds the diagonal of the Jacobian of all passed element
+ * discretizations on one given subset to the vector diag in the stationary
+ * case.
+ *
+ * \param[in]		vElemDisc		element discretizations
+ * \param[in]		si				subset index
+ * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+ * \param[in,out]	diag			diagonal of the jacobian
+ * \param[in]		u				solution
+ */
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+template <typename TElem>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+							ConstSmartPtr<DoFDistribution> dd,
+							int si, bool bNonRegularGrid,
+							vector_type& diag,
+							const vector_type& u)
+{
+	//	check if only some elements are selected
+	if(m_spAssTuner->selected_elements_used())
+	{
+		std::vector<TElem*> vElem;
+		m_spAssTuner->collect_selected_elements(vElem, dd, si);
+
+		//	assembling is carried out only over those elements
+		//	which are selected and in subset si
+		gass_type::template AssembleJacobianDiagonal<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd, vElem.begin(), vElem.end(), si,
+			 bNonRegularGrid, diag, u, m_spAssTuner);
+	}
+	else
+	{
+		//	general case: assembling over all elements in subset si
+		gass_type::template AssembleJacobianDiagonal<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd,
+				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+					bNonRegularGrid, diag, u, m_spAssTuner);
+	}
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+assemble_local_jacobians(LocalJacobianCache& cache,
+                         const vector_type& u,
+                         ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+//	update the elem discs
+	update_disc_items();
+	prep_assemble_loop(m_vElemDisc);
+
+//	only dirichlet constraints can be expressed without the matrix
+	check_matrix_free_constraints("assemble_local_jacobians");
+
+//	remove old jacobians
+	cache.clear();
+
+//	Union of Subsets
+	SubsetGroup unionSubsets;
+	std::vector<SubsetGroup> vSSGrp;
+
+//	pre process -  modifies the solution, used for computing the defect
+	const vector_type* pModifyU = &u;
+	SmartPtr<vector_type> pModifyMemory;
+	if( m_spAssTuner->modify_solution_enabled() ){
+		pModifyMemory = u.clone();
+		pModifyU = pModifyMemory.get();
+		try{
+		for(int type = 1; type < CT_ALL; type = type << 1){
+			if(!(m_spAssTuner->constraint_type_enabled(type))) continue;
+			for(size_t i = 0; i < m_vConstraint.size(); ++i)
+				if(m_vConstraint[i]->type() & type)
+					m_vConstraint[i]->modify_solution(*pModifyMemory, u, dd, type);
+		}
+		} UG_CATCH_THROW("Cannot modify solution.");
+	}
+
+//	create list of all subsets
+	try{
+		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
+	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
+
+//	loop subsets
+	for(size_t i = 0; i < unionSubsets.size(); ++i)
+	{
+	//	get subset
+		const int si = unionSubsets[i];
+
+	//	get dimension of the subset
+		const int dim = DimensionOfSubset(*dd->subset_handler(), si);
+
+	//	request if subset is regular grid
+		bool bNonRegularGrid = !unionSubsets.regular_grid(i);
+
+	//	overrule by regular grid if required
+		if(m_spAssTuner->regular_grid_forced()) bNonRegularGrid = false;
+
+	//	Elem Disc on the subset
+		std::vector<IElemDisc<TDomain>*> vSubsetElemDisc;
+
+	//	get all element discretizations that work on the subset
+		GetElemDiscOnSubset(vSubsetElemDisc, m_vElemDisc, vSSGrp, si);
+
+	//	assemble on suitable elements
+		try
+		{
+		switch(dim)
+		{
+		case 0:
+			this->template AssembleLocalJacobians<RegularVertex>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			break;
+		case 1:
+			this->template AssembleLocalJacobians<RegularEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template AssembleLocalJacobians<ConstrainingEdge>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			break;
+		case 2:
+			this->template AssembleLocalJacobians<Triangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			this->template AssembleLocalJacobians<Quadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			// When assembling over lower-dim manifolds that contain hanging nodes:
+			this->template AssembleLocalJacobians<ConstrainingTriangle>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			this->template AssembleLocalJacobians<ConstrainingQuadrilateral>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			break;
+		case 3:
+			this->template AssembleLocalJacobians<Tetrahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			this->template AssembleLocalJacobians<Pyramid>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			this->template AssembleLocalJacobians<Prism>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			this->template AssembleLocalJacobians<Hexahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			this->template AssembleLocalJacobians<Octahedron>
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, cache, *pModifyU);
+			break;
+		default:
+			UG_THROW("DomainDiscretization::assemble_local_jacobians (stationary):"
+							"Dimension "<<dim<<"(subset="<<si<<") not supported");
+		}
+		}
+		UG_CATCH_THROW("DomainDiscretization::assemble_local_jacobians (stationary):"
+						" Assembling of elements of Dimension " << dim << " in "
+						" subset "<<si<< " failed.");
+	}
+
+	try{
+	post_assemble_loop(m_vElemDisc);
+	}UG_CATCH_THROW("DomainDiscretization::assemble_local_jacobians:"
+					" Cannot execute post process.");
+}
+
+/**
+ * This function stores the local Jacobians of all passed element
+ * discretizations on one given subset in the stationary case.
+ *
+ * \param[in]		vElemDisc		element discretizations
+ * \param[in]		si				subset index
+ * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+ * \param[in,out]	cache			local jacobians
+ * \param[in]		u				solution
+ */
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+template <typename TElem>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+AssembleLocalJacobians(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+						ConstSmartPtr<DoFDistribution> dd,
+						int si, bool bNonRegularGrid,
+						LocalJacobianCache& cache,
+						const vector_type& u)
+{
+	//	check if only some elements are selected
+	if(m_spAssTuner->selected_elements_used())
+	{
+		std::vector<TElem*> vElem;
+		m_spAssTuner->collect_selected_elements(vElem, dd, si);
+
+		//	assembling is carried out only over those elements
+		//	which are selected and in subset si
+		gass_type::template AssembleLocalJacobians<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd, vElem.begin(), vElem.end(), si,
+			 bNonRegularGrid, cache, u, m_spAssTuner);
+	}
+	else
+	{
+		//	general case: assembling over all elements in subset si
+		gass_type::template AssembleLocalJacobians<TElem>
+			(vElemDisc, m_spApproxSpace->domain(), dd,
+				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+					bNonRegularGrid, cache, u, m_spAssTuner);
+	}
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+apply_jacobian(vector_type& d,
+               const vector_type& u,
+               const vector_type& c,
+               const LocalJacobianCache& cache,
+               ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+	update_constraints();
+
+//	reset vector to zero and resize
+	m_spAssTuner->resize(dd, d);
+	if(c.size() != d.size())
+		UG_THROW("DomainDiscretization::apply_jacobian: Size of vector ("
+				<<c.size()<<") does not match number of DoFs ("<<d.size()<<").");
+
+//	apply stored element jacobians
+	cache.apply(d, c);
+
+//	post process: dirichlet rows
+	try{
+	adjust_matrix_free_jacobian(d, u, c, dd);
+	}UG_CATCH_THROW("DomainDiscretization::apply_jacobian:"
+					" Cannot execute post process.");
+
+//	Remember parallel storage type
+#ifdef UG_PARALLEL
+	d.set_storage_type(PST_ADDITIVE);
+#endif
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+assemble_jacobian_diagonal(vector_type& diag,
+                           const vector_type& u,
+                           const LocalJacobianCache& cache,
+                           ConstSmartPtr<DoFDistribution> dd)
+{
+	PROFILE_FUNC_GROUP("discretization");
+	update_constraints();
+
+//	reset vector to zero and resize
+	m_spAssTuner->resize(dd, diag);
+
+//	add diagonals of stored element jacobians
+	cache.add_diagonal(diag);
+
+//	post process: dirichlet rows
+	try{
+	SmartPtr<vector_type> spOne = diag.clone_without_values();
+	spOne->set(1.0);
+	adjust_matrix_free_jacobian(diag, u, *spOne, dd);
+	}UG_CATCH_THROW("DomainDiscretization::assemble_jacobian_diagonal:"
+					" Cannot execute post process.");
+
+//	Remember parallel storage type
+#ifdef UG_PARALLEL
+	diag.set_storage_type(PST_ADDITIVE);
+#endif
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+check_matrix_free_constraints(const char* caller)
+{
+	for(size_t i = 0; i < m_vConstraint.size(); ++i)
+		if(m_spAssTuner->constraint_type_enabled(m_vConstraint[i]->type())
+			&& m_vConstraint[i]->type() != CT_DIRICHLET)
+			UG_THROW("DomainDiscretization::"<<caller<<": Only Dirichlet "
+					"constraints are supported for matrix-free application.");
+}
+
+/**
+ * The assembled jacobian has identity rows for dirichlet dofs (on every
+ * process sharing the dof). Thus, the matrix-free result d is set to the
+ * input value c there.
+ */
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+adjust_matrix_free_jacobian(vector_type& d, const vector_type& u,
+                            const vector_type& c,
+                            ConstSmartPtr<DoFDistribution> dd)
+{
+	if(!m_spAssTuner->constraint_type_enabled(CT_DIRICHLET)) return;
+
+	SmartPtr<vector_type> spCInner;
+	for(size_t i = 0; i < m_vConstraint.size(); ++i)
+		if(m_vConstraint[i]->type() & CT_DIRICHLET)
+		{
+			if(spCInner.invalid()) spCInner = c.clone();
+			m_vConstraint[i]->set_ass_tuner(m_spAssTuner);
+			m_vConstraint[i]->adjust_correction(*spCInner, dd, CT_DIRICHLET);
+			m_vConstraint[i]->adjust_defect(d, u, dd, CT_DIRICHLET);
+		}
+
+	if(spCInner.valid())
+		for(size_t i = 0; i < d.size(); ++i){
+			d[i] += c[i];
+			d[i] -= (*spCInner)[i];
+		}
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Defect (stationary)
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__SPATIAL_DISC__ELEM_DISC__ELEM_COLORING__
+#define __H__UG__LIB_DISC__SPATIAL_DISC__ELEM_DISC__ELEM_COLORING__
+
+#include <vector>
+#include <cstddef>
+
+namespace ug{
+
+/// colors elements, such that elements of one color have no index in common
+/**
+ * The elements are reordered by color and the start of each color in the
+ * element list is returned. Elements of one color may then be assembled
+ * concurrently, since their local contributions are added to disjoint rows
+ * of the global matrix/vector. The order of the elements within a color is
+ * kept.
+ *
+ * The coloring is greedy: in the c-th sweep over the uncolored elements,
+ * an element gets color c, if none of its indices has been used by an
+ * element of color c yet.
+ *
+ * \param[in,out]	vElem			elements (reordered by color on exit)
+ * \param[out]		vColorStart		start of each color in vElem (size: num colors + 1)
+ * \param[in]		numIndex		number of indices (all indices must be smaller)
+ * \param[in]		getIndices		functor getIndices(elem, vInd) writing the indices of elem
+ * \returns			number of colors
+ */
+template <typename TElem, typename TIndexFct>
+size_t ColorElementsByIndices(std::vector<TElem*>& vElem,
+                              std::vector<size_t>& vColorStart,
+                              size_t numIndex,
+                              TIndexFct& getIndices)
+{
+	vColorStart.clear();
+	vColorStart.push_back(0);
+	if(vElem.empty()) return 0;
+
+//	indices of all elements (CSR)
+	std::vector<size_t> vIndStart(1, 0), vInd, vElemInd;
+	vIndStart.reserve(vElem.size() + 1);
+	for(size_t e = 0; e < vElem.size(); ++e)
+	{
+		getIndices(vElem[e], vElemInd);
+		vInd.insert(vInd.end(), vElemInd.begin(), vElemInd.end());
+		vIndStart.push_back(vInd.size());
+	}
+
+//	color of the last element that used an index
+	std::vector<int> vStamp(numIndex, -1);
+
+	std::vector<size_t> vUncolored(vElem.size()), vNext;
+	for(size_t e = 0; e < vElem.size(); ++e) vUncolored[e] = e;
+
+	std::vector<TElem*> vColored;
+	vColored.reserve(vElem.size());
+
+	for(int color = 0; !vUncolored.empty(); ++color)
+	{
+		vNext.clear();
+		for(size_t k = 0; k < vUncolored.size(); ++k)
+		{
+			const size_t e = vUncolored[k];
+
+			bool bConflict = false;
+			for(size_t i = vIndStart[e]; i < vIndStart[e+1]; ++i)
+				if(vStamp[vInd[i]] == color) {bConflict = true; break;}
+
+			if(bConflict) {vNext.push_back(e); continue;}
+
+			for(size_t i = vIndStart[e]; i < vIndStart[e+1]; ++i)
+				vStamp[vInd[i]] = color;
+			vColored.push_back(vElem[e]);
+		}
+		vColorStart.push_back(vColored.size());
+		vUncolored.swap(vNext);
+	}
+
+	vElem.swap(vColored);
+	return vColorStart.size() - 1;
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__SPATIAL_DISC__ELEM_DISC__ELEM_COLORING__ */
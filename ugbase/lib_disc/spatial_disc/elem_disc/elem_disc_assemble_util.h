@@ -36,6 +36,10 @@
 // extern includes
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#ifdef UG_OPENMP
+#include <omp.h>
+#endif
 
 // other ug4 modules
 #include "common/common.h"
@@ -43,8 +47,11 @@
 // intern headers
 #include "../../reference_element/reference_element.h"
 #include "./elem_disc_interface.h"
+#include "./elem_coloring.h"
 #include "lib_disc/common/function_group.h"
 #include "lib_disc/common/local_algebra.h"
+#include "lib_disc/common/local_jacobian_cache.h"
+#include "lib_disc/spatial_disc/local_to_global/local_to_global_scatter_map.h"
 #include "lib_disc/spatial_disc/user_data/data_evaluator.h"
 #include "bridge/util_algebra_dependent.h"
 
@@ -338,6 +345,16 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	compute element contributions concurrently if requested
+		const int numThreads = NumElemLoopThreads(vElemDisc, spAssTuner);
+		if(numThreads > 1)
+		{
+			AssembleJacobianColored<TElem>(vElemDisc, spDomain, dd, iterBegin,
+			                               iterEnd, si, bNonRegularGrid, J, u,
+			                               spAssTuner, numThreads);
+			return;
+		}
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -412,6 +429,332 @@ public:
 		UG_CATCH_THROW("(stationary) AssembleJacobian: Cannot create Data Evaluator.");
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+// Apply (stationary) Jacobian matrix-free
+////////////////////////////////////////////////////////////////////////////////
+
+public:
+	/**
+	 * This function adds the product of the Jacobian and a given vector,
+	 * J(u)*c, for all passed element discretizations on one given subset to
+	 * the global vector d. The global Jacobian is never formed: the local
+	 * Jacobian of each element is computed and immediately applied to the
+	 * local values of c. (This version processes elements in a given interval.)
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		iterBegin		element iterator
+	 * \param[in]		iterEnd			element iterator
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in,out]	d				result vector
+	 * \param[in]		u				solution (linearization point)
+	 * \param[in]		c				vector the jacobian is applied to
+	 * \param[in]		spAssTuner		assemble adapter
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	ApplyJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+					ConstSmartPtr<domain_type> spDomain,
+					ConstSmartPtr<DoFDistribution> dd,
+					TIterator iterBegin,
+					TIterator iterEnd,
+					int si, bool bNonRegularGrid,
+					vector_type& d,
+					const vector_type& u,
+					const vector_type& c,
+					ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	check if there are any elements at all, otherwise return immediately
+		if(iterBegin == iterEnd) return;
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	prepare for given elem discs
+		try
+		{
+		DataEvaluator<domain_type> Eval(STIFF | RHS,
+						   vElemDisc, dd->function_pattern(), bNonRegularGrid);
+
+	//	prepare element loop
+		Eval.prepare_elem_loop(id, si);
+
+	//	local indices and local algebra
+		LocalIndices ind; LocalVector locU, locC, locD; LocalMatrix locJ;
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	get corner coordinates
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get global indices
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	adapt local algebra
+			locU.resize(ind); locC.resize(ind); locD.resize(ind); locJ.resize(ind);
+
+		//	read local values of u and c
+			GetLocalVector(locU, u);
+			GetLocalVector(locC, c);
+
+		//	prepare element
+			try
+			{
+				Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+			}
+			UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot prepare element.");
+
+		//	reset local algebra
+			locJ = 0.0;
+
+		//	Assemble JA
+			try
+			{
+				Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords);
+			}
+			UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot compute Jacobian (A).");
+
+		//	apply the local jacobian and send the result to the global vector
+			LocalMatVec(locD, locJ, locC);
+			try{
+				spAssTuner->add_local_vec_to_global(d, locD, dd);
+			}
+			UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot add local vector.");
+		}
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot finish element loop.");
+
+		}
+		UG_CATCH_THROW("(stationary) ApplyJacobian: Cannot create Data Evaluator.");
+	}
+
+	/**
+	 * This function computes the local Jacobians of all passed element
+	 * discretizations on one given subset and stores them in a cache, such
+	 * that J(u)*c can be applied repeatedly without recomputing the element
+	 * contributions. (This version processes elements in a given interval.)
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		iterBegin		element iterator
+	 * \param[in]		iterEnd			element iterator
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in,out]	cache			local jacobians
+	 * \param[in]		u				solution (linearization point)
+	 * \param[in]		spAssTuner		assemble adapter
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleLocalJacobians(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+							ConstSmartPtr<domain_type> spDomain,
+							ConstSmartPtr<DoFDistribution> dd,
+							TIterator iterBegin,
+							TIterator iterEnd,
+							int si, bool bNonRegularGrid,
+							LocalJacobianCache& cache,
+							const vector_type& u,
+							ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	check if there are any elements at all, otherwise return immediately
+		if(iterBegin == iterEnd) return;
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	prepare for given elem discs
+		try
+		{
+		DataEvaluator<domain_type> Eval(STIFF | RHS,
+						   vElemDisc, dd->function_pattern(), bNonRegularGrid);
+
+	//	prepare element loop
+		Eval.prepare_elem_loop(id, si);
+
+	//	local indices and local algebra
+		LocalIndices ind; LocalVector locU; LocalMatrix locJ;
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	get corner coordinates
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get global indices
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	adapt local algebra
+			locU.resize(ind); locJ.resize(ind);
+
+		//	read local values of u
+			GetLocalVector(locU, u);
+
+		//	prepare element
+			try
+			{
+				Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+			}
+			UG_CATCH_THROW("(stationary) AssembleLocalJacobians: Cannot prepare element.");
+
+		//	reset local algebra
+			locJ = 0.0;
+
+		//	Assemble JA
+			try
+			{
+				Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords);
+			}
+			UG_CATCH_THROW("(stationary) AssembleLocalJacobians: Cannot compute Jacobian (A).");
+
+		//	store local jacobian
+			cache.add(locJ);
+		}
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) AssembleLocalJacobians: Cannot finish element loop.");
+
+		}
+		UG_CATCH_THROW("(stationary) AssembleLocalJacobians: Cannot create Data Evaluator.");
+	}
+
+	/**
+	 * This function adds the diagonal of the Jacobian of all passed element
+	 * discretizations on one given subset to the global vector diag, without
+	 * forming the global Jacobian. (This version processes elements in a
+	 * given interval.)
+	 *
+	 * \param[in]		vElemDisc		element discretizations
+	 * \param[in]		spDomain		domain
+	 * \param[in]		dd				DoF Distribution
+	 * \param[in]		iterBegin		element iterator
+	 * \param[in]		iterEnd			element iterator
+	 * \param[in]		si				subset index
+	 * \param[in]		bNonRegularGrid flag to indicate if non regular grid is used
+	 * \param[in,out]	diag			diagonal of the jacobian
+	 * \param[in]		u				solution (linearization point)
+	 * \param[in]		spAssTuner		assemble adapter
+	 */
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleJacobianDiagonal(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+								ConstSmartPtr<domain_type> spDomain,
+								ConstSmartPtr<DoFDistribution> dd,
+								TIterator iterBegin,
+								TIterator iterEnd,
+								int si, bool bNonRegularGrid,
+								vector_type& diag,
+								const vector_type& u,
+								ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+	//	check if there are any elements at all, otherwise return immediately
+		if(iterBegin == iterEnd) return;
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+	//	storage for corner coordinates
+		MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+	//	prepare for given elem discs
+		try
+		{
+		DataEvaluator<domain_type> Eval(STIFF | RHS,
+						   vElemDisc, dd->function_pattern(), bNonRegularGrid);
+
+	//	prepare element loop
+		Eval.prepare_elem_loop(id, si);
+
+	//	local indices and local algebra
+		LocalIndices ind; LocalVector locU, locDiag; LocalMatrix locJ;
+
+	//	Loop over all elements
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+		//	get Element
+			TElem* elem = *iter;
+
+		//	get corner coordinates
+			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+		//	check if elem is skipped from assembling
+			if(!spAssTuner->element_used(elem)) continue;
+
+		//	get global indices
+			dd->indices(elem, ind, Eval.use_hanging());
+
+		//	adapt local algebra
+			locU.resize(ind); locDiag.resize(ind); locJ.resize(ind);
+
+		//	read local values of u
+			GetLocalVector(locU, u);
+
+		//	prepare element
+			try
+			{
+				Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot prepare element.");
+
+		//	reset local algebra
+			locJ = 0.0;
+
+		//	Assemble JA
+			try
+			{
+				Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot compute Jacobian (A).");
+
+		//	send local diagonal to global vector
+			GetLocalDiagonal(locDiag, locJ);
+			try{
+				spAssTuner->add_local_vec_to_global(diag, locDiag, dd);
+			}
+			UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot add local vector.");
+		}
+
+	//	finish element loop
+		try
+		{
+			Eval.finish_elem_loop();
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot finish element loop.");
+
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobianDiagonal: Cannot create Data Evaluator.");
+	}
+
 ////////////////////////////////////////////////////////////////////////////////
 // Assemble (instationary) Jacobian
 ////////////////////////////////////////////////////////////////////////////////
@@ -589,6 +932,16 @@ public:
 	//	check if at least one element exists, else return
 		if(iterBegin == iterEnd) return;
 
+	//	compute element contributions concurrently if requested
+		const int numThreads = NumElemLoopThreads(vElemDisc, spAssTuner);
+		if(numThreads > 1)
+		{
+			AssembleDefectColored<TElem>(vElemDisc, spDomain, dd, iterBegin,
+			                             iterEnd, si, bNonRegularGrid, d, u,
+			                             spAssTuner, numThreads);
+			return;
+		}
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -914,6 +1267,16 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	compute element contributions concurrently if requested
+		const int numThreads = NumElemLoopThreads(vElemDisc, spAssTuner);
+		if(numThreads > 1)
+		{
+			AssembleLinearColored<TElem>(vElemDisc, spDomain, dd, iterBegin,
+			                             iterEnd, si, bNonRegularGrid, A, rhs,
+			                             spAssTuner, numThreads);
+			return;
+		}
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -2129,6 +2492,455 @@ public:
 		UG_CATCH_THROW("AssembleErrorEstimator: Cannot create Data Evaluator.");
 	}
 
+////////////////////////////////////////////////////////////////////////////////
+// Colored element loops
+////////////////////////////////////////////////////////////////////////////////
+
+protected:
+///	number of elements per thread whose local contributions are buffered
+	static const size_t COLORED_ELEM_CHUNK_SIZE = 64;
+
+///	returns the number of threads to be used in an element loop
+/**
+ * The element loop is only carried out concurrently, if ug4 has been compiled
+ * with OpenMP, the AssemblingTuner requests more than one thread, the local
+ * algebra is added by index and all element discretizations support
+ * concurrent element assembling.
+ *
+ * \returns		number of threads (1 for the serial element loop)
+ */
+	static int
+	NumElemLoopThreads(const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+	                   ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+#ifdef UG_OPENMP
+		if(spAssTuner->num_threads() <= 1) return 1;
+		if(!spAssTuner->local_to_global_by_index()) return 1;
+
+		for(size_t i = 0; i < vElemDisc.size(); ++i)
+			if(!vElemDisc[i]->thread_safe_elem_assembling()) return 1;
+
+		return (int) spAssTuner->num_threads();
+#else
+		return 1;
+#endif
+	}
+
+///	writes the algebra indices of an element (used for the coloring)
+	template <typename TElem>
+	struct ElemAlgebraIndices
+	{
+		ElemAlgebraIndices(ConstSmartPtr<DoFDistribution> dd_, bool bHang_)
+			: dd(dd_), bHang(bHang_) {}
+
+		void operator()(TElem* elem, std::vector<size_t>& vInd)
+		{
+			dd->indices(elem, ind, bHang);
+			vInd.clear();
+			for(size_t fct = 0; fct < ind.num_fct(); ++fct)
+				for(size_t dof = 0; dof < ind.num_dof(fct); ++dof)
+					vInd.push_back(ind.index(fct, dof));
+		}
+
+		ConstSmartPtr<DoFDistribution> dd;
+		bool bHang;
+		LocalIndices ind;
+	};
+
+///	collects the elements of an interval used for assembling and colors them
+	template <typename TElem, typename TIterator>
+	static void
+	ColorUsedElements(std::vector<TElem*>& vElem, std::vector<size_t>& vColorStart,
+	                  TIterator iterBegin, TIterator iterEnd,
+	                  ConstSmartPtr<DoFDistribution> dd, bool bHang,
+	                  ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner)
+	{
+		vElem.clear();
+		for(TIterator iter = iterBegin; iter != iterEnd; ++iter)
+		{
+			TElem* elem = *iter;
+			if(spAssTuner->element_used(elem)) vElem.push_back(elem);
+		}
+
+		ElemAlgebraIndices<TElem> getIndices(dd, bHang);
+		ColorElementsByIndices(vElem, vColorStart, dd->num_indices(), getIndices);
+	}
+
+///	creates one DataEvaluator per thread and prepares its element loop
+	static void
+	CreateThreadEvaluators(std::vector<SmartPtr<DataEvaluator<domain_type> > >& vEval,
+	                       int numThreads, int discPart,
+	                       const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+	                       ConstSmartPtr<DoFDistribution> dd,
+	                       bool bNonRegularGrid, ReferenceObjectID id, int si)
+	{
+		vEval.resize(numThreads);
+		for(int t = 0; t < numThreads; ++t)
+		{
+			vEval[t] = make_sp(new DataEvaluator<domain_type>(discPart,
+			                   vElemDisc, dd->function_pattern(), bNonRegularGrid));
+			vEval[t]->prepare_elem_loop(id, si);
+		}
+	}
+
+///	finishes the element loop of all thread evaluators
+	static void
+	FinishThreadEvaluators(std::vector<SmartPtr<DataEvaluator<domain_type> > >& vEval)
+	{
+		for(size_t t = 0; t < vEval.size(); ++t)
+			vEval[t]->finish_elem_loop();
+	}
+
+///	adds a local matrix to existing connections of the global matrix
+/**
+ * No connection is inserted, so that local matrices of elements without
+ * common indices may be added concurrently.
+ *
+ * \returns 	false (and matrix unchanged), if a connection does not exist
+ */
+	static bool
+	AddLocalMatrixToPattern(matrix_type& mat, const LocalMatrix& lmat, std::vector<int>& vPos)
+	{
+		vPos.clear();
+		if(!LocalToGlobalScatterMap<matrix_type>::positions(mat, lmat, vPos))
+			return false;
+		if(!vPos.empty())
+			LocalToGlobalScatterMap<matrix_type>::replay(mat, lmat, &vPos[0]);
+		return true;
+	}
+
+///	stores the first error thrown inside of a parallel region
+/**
+ * Exceptions must not leave an OpenMP parallel region. Thus, errors thrown
+ * during the computation of the local contributions are stored and rethrown
+ * by the master thread after the region has been left.
+ */
+	struct ThreadErrorStore
+	{
+		ThreadErrorStore() : bFailed(false), err("") {}
+
+		void set(const UGError& e)
+		{
+#ifdef UG_OPENMP
+			#pragma omp critical (StdGlobAssembler_ThreadErrorStore)
+#endif
+			{
+				if(!bFailed) {bFailed = true; err = e;}
+			}
+		}
+
+		void rethrow() const {if(bFailed) throw err;}
+
+		bool bFailed;
+		UGError err;
+	};
+
+/// (stationary) AssembleJacobian with a colored, concurrent element loop
+/**
+ * The used elements are colored, such that the elements of one color share
+ * no algebra index (cf. ColorElementsByIndices). The elements of a color are
+ * processed in chunks; within a chunk, the local matrices are computed
+ * concurrently, each thread using its own DataEvaluator and local solution,
+ * and are added to the global matrix by the computing thread. Since the
+ * elements of one color write to disjoint rows, this needs no
+ * synchronization as long as the connections exist. Local matrices that
+ * need new connections are added by the calling thread after the chunk,
+ * because inserting a connection may reallocate the matrix storage.
+ *
+ * Every row receives at most one contribution per color and the colors are
+ * processed in a fixed order, so the result does not depend on the number
+ * of threads or the scheduling.
+ */
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleJacobianColored(const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+							ConstSmartPtr<domain_type> spDomain,
+							ConstSmartPtr<DoFDistribution> dd,
+							TIterator iterBegin,
+							TIterator iterEnd,
+							int si, bool bNonRegularGrid,
+							matrix_type& J,
+							const vector_type& u,
+							ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner,
+							int numThreads)
+	{
+#ifdef UG_OPENMP
+		EL_PROFILE_FUNC();
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+		try
+		{
+	//	one data evaluator per thread
+		std::vector<SmartPtr<DataEvaluator<domain_type> > > vEval;
+		CreateThreadEvaluators(vEval, numThreads, STIFF | RHS, vElemDisc, dd,
+		                       bNonRegularGrid, id, si);
+
+	//	colored elements
+		std::vector<TElem*> vElem; std::vector<size_t> vColorStart;
+		ColorUsedElements<TElem>(vElem, vColorStart, iterBegin, iterEnd, dd,
+		                         vEval[0]->use_hanging(), spAssTuner);
+
+	//	local indices and local algebra of one chunk, temporaries per thread
+		const size_t chunkSize = numThreads * COLORED_ELEM_CHUNK_SIZE;
+		std::vector<LocalIndices> vInd(chunkSize);
+		std::vector<LocalMatrix> vLocJ(chunkSize);
+		std::vector<char> vDeferred(chunkSize);
+		std::vector<LocalVector> vLocU(numThreads);
+		std::vector<std::vector<int> > vvPos(numThreads);
+		ThreadErrorStore errStore;
+
+	//	Loop over all colors and chunks of elements
+		for(size_t c = 0; c + 1 < vColorStart.size(); ++c)
+		for(size_t chunkBegin = vColorStart[c]; chunkBegin < vColorStart[c+1]; chunkBegin += chunkSize)
+		{
+			const int numInChunk = (int) std::min(chunkSize, vColorStart[c+1] - chunkBegin);
+
+		//	compute and add local matrices concurrently
+			#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 8)
+			for(int k = 0; k < numInChunk; ++k)
+			{
+				const int thread = omp_get_thread_num();
+				DataEvaluator<domain_type>& Eval = *vEval[thread];
+				LocalVector& locU = vLocU[thread];
+				LocalIndices& ind = vInd[k];
+				LocalMatrix& locJ = vLocJ[k];
+				TElem* elem = vElem[chunkBegin + k];
+				MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+				vDeferred[k] = false;
+
+				try
+				{
+					FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+					dd->indices(elem, ind, Eval.use_hanging());
+					locU.resize(ind); locJ.resize(ind);
+					GetLocalVector(locU, u);
+
+					Eval.prepare_elem(locU, elem, id, vCornerCoords, ind, true);
+
+					locJ = 0.0;
+					Eval.add_jac_A_elem(locJ, locU, elem, vCornerCoords);
+
+					vDeferred[k] = !AddLocalMatrixToPattern(J, locJ, vvPos[thread]);
+				}
+				catch(UGError& err){errStore.set(err);}
+				catch(std::exception& ex){errStore.set(UGError(ex.what()));}
+			}
+			errStore.rethrow();
+
+		//	add local matrices that need new connections
+			for(int k = 0; k < numInChunk; ++k)
+				if(vDeferred[k]) spAssTuner->add_local_mat_to_global(J, vLocJ[k], dd);
+		}
+
+	//	finish element loop
+		FinishThreadEvaluators(vEval);
+
+		}
+		UG_CATCH_THROW("(stationary) AssembleJacobianColored: Cannot assemble elements.");
+#else
+		UG_THROW("(stationary) AssembleJacobianColored: ug4 has been compiled without OpenMP.");
+#endif
+	}
+
+/// (stationary) AssembleDefect with a colored, concurrent element loop
+/**
+ * The local defects are computed and added concurrently for the elements
+ * of one color. \sa AssembleJacobianColored
+ */
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleDefectColored(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+							ConstSmartPtr<domain_type> spDomain,
+							ConstSmartPtr<DoFDistribution> dd,
+							TIterator iterBegin,
+							TIterator iterEnd,
+							int si, bool bNonRegularGrid,
+							vector_type& d,
+							const vector_type& u,
+							ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner,
+							int numThreads)
+	{
+#ifdef UG_OPENMP
+		EL_PROFILE_FUNC();
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+		try
+		{
+	//	one data evaluator per thread
+		std::vector<SmartPtr<DataEvaluator<domain_type> > > vEval;
+		CreateThreadEvaluators(vEval, numThreads, STIFF | RHS, vElemDisc, dd,
+		                       bNonRegularGrid, id, si);
+
+	//	colored elements
+		std::vector<TElem*> vElem; std::vector<size_t> vColorStart;
+		ColorUsedElements<TElem>(vElem, vColorStart, iterBegin, iterEnd, dd,
+		                         vEval[0]->use_hanging(), spAssTuner);
+
+	//	local indices and local algebra per thread
+		std::vector<LocalIndices> vInd(numThreads);
+		std::vector<LocalVector> vLocU(numThreads), vLocD(numThreads), vTmpLocD(numThreads);
+		ThreadErrorStore errStore;
+
+	//	Loop over all colors
+		for(size_t c = 0; c + 1 < vColorStart.size(); ++c)
+		{
+			const int colorBegin = (int) vColorStart[c];
+			const int colorEnd = (int) vColorStart[c+1];
+
+		//	compute and add local defects concurrently (the solution is not
+		//	modified, since the local algebra is added by index)
+			#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 8)
+			for(int e = colorBegin; e < colorEnd; ++e)
+			{
+				const int thread = omp_get_thread_num();
+				DataEvaluator<domain_type>& Eval = *vEval[thread];
+				LocalIndices& ind = vInd[thread];
+				LocalVector& locU = vLocU[thread];
+				LocalVector& locD = vLocD[thread];
+				LocalVector& tmpLocD = vTmpLocD[thread];
+				TElem* elem = vElem[e];
+				MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+
+				try
+				{
+					FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+					dd->indices(elem, ind, Eval.use_hanging());
+					locU.resize(ind); locD.resize(ind); tmpLocD.resize(ind);
+					GetLocalVector(locU, u);
+
+					Eval.prepare_elem(locU, elem, id, vCornerCoords, ind);
+
+					locD = 0.0;
+					Eval.add_def_A_elem(locD, locU, elem, vCornerCoords);
+
+					tmpLocD = 0.0;
+					Eval.add_rhs_elem(tmpLocD, elem, vCornerCoords);
+					locD.scale_append(-1, tmpLocD);
+
+					AddLocalVector(d, locD);
+				}
+				catch(UGError& err){errStore.set(err);}
+				catch(std::exception& ex){errStore.set(UGError(ex.what()));}
+			}
+			errStore.rethrow();
+		}
+
+	//	finish element loop
+		FinishThreadEvaluators(vEval);
+
+		}
+		UG_CATCH_THROW("(stationary) AssembleDefectColored: Cannot assemble elements.");
+#else
+		UG_THROW("(stationary) AssembleDefectColored: ug4 has been compiled without OpenMP.");
+#endif
+	}
+
+/// (stationary) AssembleLinear with a colored, concurrent element loop
+/**
+ * \sa AssembleJacobianColored
+ */
+	template <typename TElem, typename TIterator>
+	static void
+	AssembleLinearColored(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
+							ConstSmartPtr<domain_type> spDomain,
+							ConstSmartPtr<DoFDistribution> dd,
+							TIterator iterBegin,
+							TIterator iterEnd,
+							int si, bool bNonRegularGrid,
+							matrix_type& A,
+							vector_type& rhs,
+							ConstSmartPtr<AssemblingTuner<TAlgebra> > spAssTuner,
+							int numThreads)
+	{
+#ifdef UG_OPENMP
+		EL_PROFILE_FUNC();
+
+	//	reference object id
+		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+
+		try
+		{
+	//	one data evaluator per thread
+		std::vector<SmartPtr<DataEvaluator<domain_type> > > vEval;
+		CreateThreadEvaluators(vEval, numThreads, STIFF | RHS, vElemDisc, dd,
+		                       bNonRegularGrid, id, si);
+
+	//	colored elements
+		std::vector<TElem*> vElem; std::vector<size_t> vColorStart;
+		ColorUsedElements<TElem>(vElem, vColorStart, iterBegin, iterEnd, dd,
+		                         vEval[0]->use_hanging(), spAssTuner);
+
+	//	local indices and local matrices of one chunk, temporaries per thread
+		const size_t chunkSize = numThreads * COLORED_ELEM_CHUNK_SIZE;
+		std::vector<LocalIndices> vInd(chunkSize);
+		std::vector<LocalMatrix> vLocA(chunkSize);
+		std::vector<char> vDeferred(chunkSize);
+		std::vector<LocalVector> vLocRhs(numThreads);
+		std::vector<std::vector<int> > vvPos(numThreads);
+		ThreadErrorStore errStore;
+
+	//	Loop over all colors and chunks of elements
+		for(size_t c = 0; c + 1 < vColorStart.size(); ++c)
+		for(size_t chunkBegin = vColorStart[c]; chunkBegin < vColorStart[c+1]; chunkBegin += chunkSize)
+		{
+			const int numInChunk = (int) std::min(chunkSize, vColorStart[c+1] - chunkBegin);
+
+		//	compute and add local matrices and rhs concurrently
+			#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 8)
+			for(int k = 0; k < numInChunk; ++k)
+			{
+				const int thread = omp_get_thread_num();
+				DataEvaluator<domain_type>& Eval = *vEval[thread];
+				LocalVector& locRhs = vLocRhs[thread];
+				LocalIndices& ind = vInd[k];
+				LocalMatrix& locA = vLocA[k];
+				TElem* elem = vElem[chunkBegin + k];
+				MathVector<domain_type::dim> vCornerCoords[TElem::NUM_VERTICES];
+				vDeferred[k] = false;
+
+				try
+				{
+					FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+
+					dd->indices(elem, ind, Eval.use_hanging());
+					locRhs.resize(ind); locA.resize(ind);
+
+					Eval.prepare_elem(locRhs, elem, id, vCornerCoords, ind, true);
+
+					locA = 0.0;
+					locRhs = 0.0;
+					Eval.add_jac_A_elem(locA, locRhs, elem, vCornerCoords);
+					Eval.add_rhs_elem(locRhs, elem, vCornerCoords);
+
+					AddLocalVector(rhs, locRhs);
+					vDeferred[k] = !AddLocalMatrixToPattern(A, locA, vvPos[thread]);
+				}
+				catch(UGError& err){errStore.set(err);}
+				catch(std::exception& ex){errStore.set(UGError(ex.what()));}
+			}
+			errStore.rethrow();
+
+		//	add local matrices that need new connections
+			for(int k = 0; k < numInChunk; ++k)
+				if(vDeferred[k]) spAssTuner->add_local_mat_to_global(A, vLocA[k], dd);
+		}
+
+	//	finish element loop
+		FinishThreadEvaluators(vEval);
+
+		}
+		UG_CATCH_THROW("(stationary) AssembleLinearColored: Cannot assemble elements.");
+#else
+		UG_THROW("(stationary) AssembleLinearColored: ug4 has been compiled without OpenMP.");
+#endif
+	}
+
 }; // class StdGlobAssembler
 
 } // end namespace ug
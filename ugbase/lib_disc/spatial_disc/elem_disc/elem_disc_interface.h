@@ -750,6 +750,19 @@ class IElemDiscBase
 	 * element assemblings but is needed for finite volumes
 	 */
 		virtual bool use_hanging() const {return false;}
+
+	///	returns if the element assembling may be executed concurrently
+	/**
+	 * This function returns if the assembling functions of this discretization
+	 * may be called concurrently for different elements without common
+	 * indices, each thread using its own DataEvaluator. The element loop is
+	 * then prepared and finished once per thread. This requires that the
+	 * discretization (including its imports and the user data connected to
+	 * them) does not store element dependent data in shared members, or that
+	 * it keeps such data per thread. The default is false, i.e. the
+	 * assembling is performed serially.
+	 */
+		virtual bool thread_safe_elem_assembling() const {return false;}
 };
 
 
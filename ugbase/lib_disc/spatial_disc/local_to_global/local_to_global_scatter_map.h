@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__SPATIAL_DISC__LOCAL_TO_GLOBAL_SCATTER_MAP__
+#define __H__UG__LIB_DISC__SPATIAL_DISC__LOCAL_TO_GLOBAL_SCATTER_MAP__
+
+// extern headers
+#include <vector>
+#include <algorithm>
+
+// intern headers
+#include "lib_disc/common/local_algebra.h"
+#include "lib_disc/common/revision_counter.h"
+#include "lib_disc/dof_manager/dof_distribution.h"
+
+namespace ug{
+
+/// cached positions of local matrix entries in the global CSR matrix
+/**
+ * When a matrix with unchanged sparsity pattern is reassembled (e.g. the
+ * jacobian in every Newton step), the element matrices are added to the
+ * same global connections in the same order in every pass. This class
+ * records the positions of these connections in the value array of the
+ * matrix during one pass and replaces the search for the connections by
+ * direct indexed adds in the following passes.
+ *
+ * A pass is started by begin_pass. The recorded map is reused if the
+ * matrix, its number of connections and the revision of the
+ * DoFDistribution are unchanged. Every added local matrix is compared
+ * with the row and column indices (and components) recorded for it. If
+ * the sequence differs (e.g. a different set of elements is assembled),
+ * the remaining pass falls back to the standard add and the map is
+ * recorded anew in the next pass.
+ *
+ * \tparam	TMatrix		matrix type (SparseMatrix or derived)
+ */
+template <typename TMatrix>
+class LocalToGlobalScatterMap
+{
+	public:
+	///	Type of algebra matrix
+		typedef TMatrix matrix_type;
+
+	public:
+	///	constructor
+		LocalToGlobalScatterMap()
+			: m_state(INACTIVE), m_pMat(NULL), m_numRows(0), m_numConn(0),
+			  m_bComplete(false), m_callPos(0)
+		{}
+
+	///	invalidates the recorded map
+		void invalidate()
+		{
+			m_state = INACTIVE; m_bComplete = false; m_pMat = NULL;
+			m_vOffset.clear(); m_vCallStart.clear();
+			m_vIndex.clear(); m_vIndexStart.clear();
+			m_ddRev.invalidate();
+		}
+
+	///	starts a new assembling pass into the matrix
+	/**
+	 * The matrix must already have its final sparsity pattern. It is
+	 * finalized, such that the positions of the connections only depend on
+	 * the pattern.
+	 */
+		void begin_pass(matrix_type& mat, const DoFDistribution& dd)
+		{
+			mat.finalize();
+
+		//	reuse the map, if recorded for the same matrix and indices
+			if(m_bComplete && m_pMat == &mat && m_ddRev == dd.revision()
+				&& m_numRows == mat.num_rows()
+				&& m_numConn == mat.total_num_connections())
+			{
+				m_state = REPLAY;
+				m_callPos = 0;
+				return;
+			}
+
+		//	record a new map
+			invalidate();
+			m_state = RECORD;
+			m_pMat = &mat;
+			m_ddRev = dd.revision();
+			m_numRows = mat.num_rows();
+			m_numConn = mat.total_num_connections();
+			m_vCallStart.push_back(0);
+			m_vIndexStart.push_back(0);
+		}
+
+	///	adds a local matrix to the global one
+		void add(matrix_type& mat, const LocalMatrix& lmat)
+		{
+			if(m_state == INACTIVE || &mat != m_pMat)
+				{AddLocalMatrixToGlobal(mat, lmat); return;}
+
+			if(m_state == REPLAY)
+			{
+			//	the pattern must not have been changed in between
+				if(m_callPos + 1 < m_vCallStart.size()
+					&& mat.is_finalized() && mat.total_num_connections() == m_numConn
+					&& recorded_indices(lmat, m_callPos))
+				{
+					replay(mat, lmat, &m_vOffset[m_vCallStart[m_callPos]]);
+					++m_callPos;
+					return;
+				}
+
+			//	sequence differs: record anew next time
+				m_state = INACTIVE; m_bComplete = false;
+				AddLocalMatrixToGlobal(mat, lmat);
+				return;
+			}
+
+		//	RECORD
+			if(!record(mat, lmat))
+			{
+			//	connection missing, i.e. pattern not constant
+				invalidate();
+				AddLocalMatrixToGlobal(mat, lmat);
+				return;
+			}
+			append_indices(lmat, m_vIndex);
+			m_vIndexStart.push_back(m_vIndex.size());
+			m_vCallStart.push_back(m_vOffset.size());
+			m_bComplete = true;
+		}
+
+	///	returns the number of recorded local matrices
+		size_t num_recorded() const {return m_vCallStart.empty() ? 0 : m_vCallStart.size() - 1;}
+
+	///	returns if the last pass has been replayed up to its end
+		bool replayed() const {return m_state == REPLAY && m_callPos + 1 == m_vCallStart.size();}
+
+	///	appends the positions of the entries of a local matrix in the global one
+	/**
+	 * The matrix is not changed. If a connection does not exist, vPos is
+	 * restored and false is returned.
+	 */
+		static bool positions(const matrix_type& mat, const LocalMatrix& lmat,
+		                      std::vector<int>& vPos)
+		{
+			const LocalIndices& rowInd = lmat.get_row_indices();
+			const LocalIndices& colInd = lmat.get_col_indices();
+
+			const size_t start = vPos.size();
+			for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+				for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+				{
+					const size_t rowIndex = rowInd.index(fct1,dof1);
+					for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+						for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+						{
+							const int k = mat.connection_index(rowIndex, colInd.index(fct2,dof2));
+							if(k < 0) {vPos.resize(start); return false;}
+							vPos.push_back(k);
+						}
+				}
+			return true;
+		}
+
+	///	adds the local matrix using the positions of its entries
+		static void replay(matrix_type& mat, const LocalMatrix& lmat, const int* pOffset)
+		{
+			const LocalIndices& rowInd = lmat.get_row_indices();
+			const LocalIndices& colInd = lmat.get_col_indices();
+
+			for(size_t fct1=0; fct1 < lmat.num_all_row_fct(); ++fct1)
+				for(size_t dof1=0; dof1 < lmat.num_all_row_dof(fct1); ++dof1)
+				{
+					const size_t rowComp = rowInd.comp(fct1,dof1);
+					for(size_t fct2=0; fct2 < lmat.num_all_col_fct(); ++fct2)
+						for(size_t dof2=0; dof2 < lmat.num_all_col_dof(fct2); ++dof2)
+						{
+							BlockRef(mat.value_at(*pOffset++), rowComp, colInd.comp(fct2,dof2))
+										+= lmat.value(fct1,dof1,fct2,dof2);
+						}
+				}
+		}
+
+	protected:
+	///	appends the number of rows, the row and the column indices with components
+		static void append_indices(const LocalMatrix& lmat, std::vector<size_t>& vInd)
+		{
+			const LocalIndices& rowInd = lmat.get_row_indices();
+			const LocalIndices& colInd = lmat.get_col_indices();
+
+			size_t numRow = 0;
+			for(size_t fct = 0; fct < lmat.num_all_row_fct(); ++fct)
+				numRow += lmat.num_all_row_dof(fct);
+			vInd.push_back(numRow);
+
+			for(size_t fct = 0; fct < lmat.num_all_row_fct(); ++fct)
+				for(size_t dof = 0; dof < lmat.num_all_row_dof(fct); ++dof)
+				{
+					vInd.push_back(rowInd.index(fct,dof));
+					vInd.push_back(rowInd.comp(fct,dof));
+				}
+			for(size_t fct = 0; fct < lmat.num_all_col_fct(); ++fct)
+				for(size_t dof = 0; dof < lmat.num_all_col_dof(fct); ++dof)
+				{
+					vInd.push_back(colInd.index(fct,dof));
+					vInd.push_back(colInd.comp(fct,dof));
+				}
+		}
+
+	///	returns if the indices of the local matrix are those recorded for the call
+		bool recorded_indices(const LocalMatrix& lmat, size_t call)
+		{
+			m_vTmpIndex.clear();
+			append_indices(lmat, m_vTmpIndex);
+
+			const size_t start = m_vIndexStart[call];
+			if(m_vTmpIndex.size() != m_vIndexStart[call+1] - start) return false;
+			return std::equal(m_vTmpIndex.begin(), m_vTmpIndex.end(), m_vIndex.begin() + start);
+		}
+
+	///	adds the local matrix and records the positions of the connections
+		bool record(matrix_type& mat, const LocalMatrix& lmat)
+		{
+			const size_t start = m_vOffset.size();
+			if(!positions(mat, lmat, m_vOffset)) return false;
+
+			replay(mat, lmat, &m_vOffset[start]);
+			return true;
+		}
+
+	protected:
+	///	state of the current pass
+		enum State {INACTIVE, RECORD, REPLAY};
+		State m_state;
+
+	///	matrix, revision and pattern size the map has been recorded for
+		const matrix_type* m_pMat;
+		RevisionCounter m_ddRev;
+		size_t m_numRows;
+		size_t m_numConn;
+
+	///	flag if map has been recorded completely
+		bool m_bComplete;
+
+	///	positions of the entries (all local matrices in assembling order)
+		std::vector<int> m_vOffset;
+
+	///	start of each local matrix in m_vOffset (size = num calls + 1)
+		std::vector<size_t> m_vCallStart;
+
+	///	indices of all local matrices (cf. append_indices) and start of each call
+		std::vector<size_t> m_vIndex;
+		std::vector<size_t> m_vIndexStart;
+
+	///	indices of the current local matrix in replay
+		std::vector<size_t> m_vTmpIndex;
+
+	///	current local matrix in replay
+		size_t m_callPos;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__SPATIAL_DISC__LOCAL_TO_GLOBAL_SCATTER_MAP__ */
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__space_filling_curve_util__
+#define __H__UG__space_filling_curve_util__
+
+#include <vector>
+#include "common/types.h"
+#include "common/math/ugmath_types.h"
+#include "lib_grid/lg_base.h"
+
+namespace ug{
+
+/// \addtogroup lib_grid_algorithms
+///	\{
+
+///	space filling curves which can be used to order elements and points
+enum SpaceFillingCurve{
+	SFC_HILBERT,
+	SFC_MORTON
+};
+
+///	returns the curve which corresponds to the given name ("hilbert" or "morton")
+/**	Throws an error if the name is unknown.*/
+UG_API SpaceFillingCurve SpaceFillingCurveFromString(const char* name);
+
+///	number of bits per coordinate which are used by the curve indices in dim dimensions
+/**	The index of a point along a curve is stored in a single uint64.*/
+template <int dim>
+struct SpaceFillingCurveBits{
+	static const int value = (dim == 1) ? 32 : 63 / dim;
+};
+
+///	returns the index of a point along the Hilbert curve through the given box
+/**	Each coordinate is first mapped to an integer in [0, 2^b - 1] with
+ * b = SpaceFillingCurveBits<dim>::value. Points outside of the box are
+ * clamped to the box. Points which are close to each other along the curve
+ * are also close to each other in space.*/
+template <int dim>
+uint64 HilbertIndex(const MathVector<dim>& p, const MathVector<dim>& boxMin,
+					const MathVector<dim>& boxMax);
+
+///	returns the index of a point along the Morton (Z-order) curve through the given box
+/**	\sa HilbertIndex*/
+template <int dim>
+uint64 MortonIndex(const MathVector<dim>& p, const MathVector<dim>& boxMin,
+				   const MathVector<dim>& boxMax);
+
+///	returns the index of a point along the specified curve through the given box
+template <int dim>
+uint64 SpaceFillingCurveIndex(SpaceFillingCurve sfc, const MathVector<dim>& p,
+							  const MathVector<dim>& boxMin,
+							  const MathVector<dim>& boxMax);
+
+///	sorts the given elements along a space filling curve through their centers
+/**	The sort is stable, i.e. elements with the same curve index keep their
+ * relative order.*/
+template <class TElem, class TAAPos>
+void SortAlongSpaceFillingCurve(std::vector<TElem*>& elems, TAAPos aaPos,
+								const typename TAAPos::ValueType& boxMin,
+								const typename TAAPos::ValueType& boxMax,
+								SpaceFillingCurve sfc = SFC_HILBERT);
+
+///	changes the storage order of all elements of a grid to follow a space filling curve
+/**	Vertices, edges, faces and volumes of the grid are sorted by the curve
+ * index of their centers (cf. Grid::reorder_elements). The attachment data of
+ * the elements is rearranged accordingly, so that loops over the elements of
+ * the grid traverse memory and space coherently.
+ *
+ * If grid is a MultiGrid, the elements of each level are ordered, too.*/
+template <class TAAPos>
+void OrderAlongSpaceFillingCurve(Grid& grid, TAAPos aaPos,
+								 SpaceFillingCurve sfc = SFC_HILBERT);
+
+///	orders the grid and the subsets of the given handler along a space filling curve
+/**	Calls OrderAlongSpaceFillingCurve(Grid&, ...) for the grid of sh and then
+ * adjusts the element order in each subset of sh accordingly.*/
+template <class TAAPos>
+void OrderAlongSpaceFillingCurve(GridSubsetHandler& sh, TAAPos aaPos,
+								 SpaceFillingCurve sfc = SFC_HILBERT);
+
+///	orders the multi-grid and the subsets of the given handler along a space filling curve
+/**	Calls OrderAlongSpaceFillingCurve(Grid&, ...) for the multi-grid of sh and
+ * then adjusts the element order of each subset on each level accordingly.*/
+template <class TAAPos>
+void OrderAlongSpaceFillingCurve(MultiGridSubsetHandler& sh, TAAPos aaPos,
+								 SpaceFillingCurve sfc = SFC_HILBERT);
+
+/// \}
+
+}//	end of namespace
+
+////////////////////////////////
+//	include implementation
+#include "space_filling_curve_util_impl.hpp"
+
+#endif	//__H__UG__space_filling_curve_util__
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__space_filling_curve_util_impl__
+#define __H__UG__space_filling_curve_util_impl__
+
+#include <algorithm>
+#include <utility>
+#include "common/error.h"
+#include "lib_grid/algorithms/geom_obj_util/geom_obj_util.h"
+
+namespace ug{
+
+namespace detail{
+
+///	maps the coordinates of p to integers in [0, 2^bits - 1]
+template <int dim>
+inline void QuantizeForSpaceFillingCurve(uint64 coordsOut[],
+										 const MathVector<dim>& p,
+										 const MathVector<dim>& boxMin,
+										 const MathVector<dim>& boxMax)
+{
+	const uint64 maxCoord = ((uint64)1 << SpaceFillingCurveBits<dim>::value) - 1;
+	for(int i = 0; i < dim; ++i){
+		const number ext = boxMax[i] - boxMin[i];
+		if(ext <= 0){
+			coordsOut[i] = 0;
+			continue;
+		}
+		const number s = (p[i] - boxMin[i]) / ext;
+		if(s <= 0)
+			coordsOut[i] = 0;
+		else if(s >= 1)
+			coordsOut[i] = maxCoord;
+		else
+			coordsOut[i] = (uint64)(s * (number)maxCoord);
+	}
+}
+
+///	interleaves the bits of the given coordinates, most significant bits first
+template <int dim>
+inline uint64 InterleaveBits(const uint64 coords[])
+{
+	uint64 key = 0;
+	for(int b = SpaceFillingCurveBits<dim>::value - 1; b >= 0; --b){
+		for(int i = 0; i < dim; ++i)
+			key = (key << 1) | ((coords[i] >> b) & 1);
+	}
+	return key;
+}
+
+///	compares pairs by their first entry only
+template <class TPair>
+inline bool CompareFirst(const TPair& p1, const TPair& p2)
+{
+	return p1.first < p2.first;
+}
+
+}//	end of namespace detail
+
+
+template <int dim>
+uint64 HilbertIndex(const MathVector<dim>& p, const MathVector<dim>& boxMin,
+					const MathVector<dim>& boxMax)
+{
+	uint64 X[dim];
+	detail::QuantizeForSpaceFillingCurve<dim>(X, p, boxMin, boxMax);
+
+	if(dim == 1)
+		return X[0];
+
+//	transform the coordinates into the transposed Hilbert index, cf.
+//	J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707 (2004)
+	const uint64 M = (uint64)1 << (SpaceFillingCurveBits<dim>::value - 1);
+
+//	inverse undo
+	for(uint64 Q = M; Q > 1; Q >>= 1){
+		const uint64 P = Q - 1;
+		for(int i = 0; i < dim; ++i){
+			if(X[i] & Q)
+				X[0] ^= P;
+			else{
+				const uint64 t = (X[0] ^ X[i]) & P;
+				X[0] ^= t;
+				X[i] ^= t;
+			}
+		}
+	}
+
+//	gray encode
+	for(int i = 1; i < dim; ++i)
+		X[i] ^= X[i-1];
+
+	uint64 t = 0;
+	for(uint64 Q = M; Q > 1; Q >>= 1){
+		if(X[dim-1] & Q)
+			t ^= Q - 1;
+	}
+	for(int i = 0; i < dim; ++i)
+		X[i] ^= t;
+
+	return detail::InterleaveBits<dim>(X);
+}
+
+template <int dim>
+uint64 MortonIndex(const MathVector<dim>& p, const MathVector<dim>& boxMin,
+				   const MathVector<dim>& boxMax)
+{
+	uint64 X[dim];
+	detail::QuantizeForSpaceFillingCurve<dim>(X, p, boxMin, boxMax);
+	return detail::InterleaveBits<dim>(X);
+}
+
+template <int dim>
+uint64 SpaceFillingCurveIndex(SpaceFillingCurve sfc, const MathVector<dim>& p,
+							  const MathVector<dim>& boxMin,
+							  const MathVector<dim>& boxMax)
+{
+	switch(sfc){
+		case SFC_HILBERT:	return HilbertIndex<dim>(p, boxMin, boxMax);
+		case SFC_MORTON:	return MortonIndex<dim>(p, boxMin, boxMax);
+		default:	UG_THROW("SpaceFillingCurveIndex: Unknown curve type: " << sfc);
+	}
+}
+
+
+template <class TElem, class TAAPos>
+void SortAlongSpaceFillingCurve(std::vector<TElem*>& elems, TAAPos aaPos,
+								const typename TAAPos::ValueType& boxMin,
+								const typename TAAPos::ValueType& boxMax,
+								SpaceFillingCurve sfc)
+{
+	static const int dim = TAAPos::ValueType::Size;
+	typedef std::pair<uint64, TElem*>	key_pair_t;
+
+	std::vector<key_pair_t> vKeys(elems.size());
+	for(size_t i = 0; i < elems.size(); ++i){
+		vKeys[i].first = SpaceFillingCurveIndex<dim>(
+								sfc, CalculateCenter(elems[i], aaPos), boxMin, boxMax);
+		vKeys[i].second = elems[i];
+	}
+
+	std::stable_sort(vKeys.begin(), vKeys.end(), detail::CompareFirst<key_pair_t>);
+
+	for(size_t i = 0; i < vKeys.size(); ++i)
+		elems[i] = vKeys[i].second;
+}
+
+
+namespace detail{
+
+template <class TElem, class TAAPos>
+void OrderGridElementsAlongSpaceFillingCurve(Grid& grid, TAAPos aaPos,
+								const typename TAAPos::ValueType& boxMin,
+								const typename TAAPos::ValueType& boxMax,
+								SpaceFillingCurve sfc)
+{
+	std::vector<TElem*> elems(grid.begin<TElem>(), grid.end<TElem>());
+	if(elems.empty())
+		return;
+
+	SortAlongSpaceFillingCurve(elems, aaPos, boxMin, boxMax, sfc);
+	grid.reorder_elements(elems);
+
+//	levels of a multi-grid are stored in its hierarchy handler. Since the
+//	elements of the grid are sorted now, we simply adopt their order.
+	MultiGrid* mg = dynamic_cast<MultiGrid*>(&grid);
+	if(mg){
+		SubsetHandler& hierarchy = mg->get_hierarchy_handler();
+		std::vector<std::vector<TElem*> > vLevels(mg->num_levels());
+		for(size_t i = 0; i < elems.size(); ++i)
+			vLevels[mg->get_level(elems[i])].push_back(elems[i]);
+
+		for(size_t lvl = 0; lvl < vLevels.size(); ++lvl){
+			if(!vLevels[lvl].empty())
+				hierarchy.reorder_elements((int)lvl, vLevels[lvl]);
+		}
+	}
+}
+
+///	adopts the element order of the grid for the subsets of sh
+template <class TElem>
+void AdoptGridOrderInSubsetLists(GridSubsetHandler& sh)
+{
+	Grid& grid = *sh.grid();
+	std::vector<std::vector<TElem*> > vSubsets(sh.num_subsets());
+	for(typename Grid::traits<TElem>::iterator iter = grid.begin<TElem>();
+		iter != grid.end<TElem>(); ++iter)
+	{
+		const int si = sh.get_subset_index(*iter);
+		if(si >= 0)
+			vSubsets[si].push_back(*iter);
+	}
+
+	for(int si = 0; si < (int)vSubsets.size(); ++si){
+		if(!vSubsets[si].empty())
+			sh.reorder_elements(si, vSubsets[si]);
+	}
+}
+
+///	adopts the element order of the multi-grid for the subsets of sh on each level
+template <class TElem>
+void AdoptGridOrderInSubsetLists(MultiGridSubsetHandler& sh)
+{
+	MultiGrid& mg = *sh.multi_grid();
+	const size_t numLevels = sh.num_levels();
+	std::vector<std::vector<TElem*> > vSubsets(sh.num_subsets() * numLevels);
+	for(typename Grid::traits<TElem>::iterator iter = mg.begin<TElem>();
+		iter != mg.end<TElem>(); ++iter)
+	{
+		const int si = sh.get_subset_index(*iter);
+		if(si >= 0)
+			vSubsets[si * numLevels + mg.get_level(*iter)].push_back(*iter);
+	}
+
+	for(int si = 0; si < sh.num_subsets(); ++si){
+		for(size_t lvl = 0; lvl < numLevels; ++lvl){
+			const std::vector<TElem*>& elems = vSubsets[si * numLevels + lvl];
+			if(!elems.empty())
+				sh.reorder_elements(si, (int)lvl, elems);
+		}
+	}
+}
+
+template <class TSubsetHandler>
+void AdoptGridOrderInSubsets(TSubsetHandler& sh)
+{
+	AdoptGridOrderInSubsetLists<Vertex>(sh);
+	AdoptGridOrderInSubsetLists<Edge>(sh);
+	AdoptGridOrderInSubsetLists<Face>(sh);
+	AdoptGridOrderInSubsetLists<Volume>(sh);
+}
+
+}//	end of namespace detail
+
+
+template <class TAAPos>
+void OrderAlongSpaceFillingCurve(Grid& grid, TAAPos aaPos, SpaceFillingCurve sfc)
+{
+	typedef typename TAAPos::ValueType	vector_t;
+	static const int dim = vector_t::Size;
+
+	if(grid.num_vertices() == 0)
+		return;
+
+//	the curve is placed in the bounding box of all vertices
+	vector_t boxMin = aaPos[*grid.vertices_begin()];
+	vector_t boxMax = boxMin;
+	for(VertexIterator iter = grid.vertices_begin();
+		iter != grid.vertices_end(); ++iter)
+	{
+		const vector_t& p = aaPos[*iter];
+		for(int i = 0; i < dim; ++i){
+			boxMin[i] = std::min(boxMin[i], p[i]);
+			boxMax[i] = std::max(boxMax[i], p[i]);
+		}
+	}
+
+	detail::OrderGridElementsAlongSpaceFillingCurve<Vertex>(grid, aaPos, boxMin, boxMax, sfc);
+	detail::OrderGridElementsAlongSpaceFillingCurve<Edge>(grid, aaPos, boxMin, boxMax, sfc);
+	detail::OrderGridElementsAlongSpaceFillingCurve<Face>(grid, aaPos, boxMin, boxMax, sfc);
+	detail::OrderGridElementsAlongSpaceFillingCurve<Volume>(grid, aaPos, boxMin, boxMax, sfc);
+}
+
+template <class TAAPos>
+void OrderAlongSpaceFillingCurve(GridSubsetHandler& sh, TAAPos aaPos,
+								 SpaceFillingCurve sfc)
+{
+	UG_COND_THROW(!sh.grid(), "OrderAlongSpaceFillingCurve: "
+				  "No grid assigned to the subset handler.");
+
+	OrderAlongSpaceFillingCurve(*sh.grid(), aaPos, sfc);
+	detail::AdoptGridOrderInSubsets(sh);
+}
+
+template <class TAAPos>
+void OrderAlongSpaceFillingCurve(MultiGridSubsetHandler& sh, TAAPos aaPos,
+								 SpaceFillingCurve sfc)
+{
+	UG_COND_THROW(!sh.multi_grid(), "OrderAlongSpaceFillingCurve: "
+				  "No multi-grid assigned to the subset handler.");
+
+	OrderAlongSpaceFillingCurve(*sh.multi_grid(), aaPos, sfc);
+	detail::AdoptGridOrderInSubsets(sh);
+}
+
+}//	end of namespace
+
+#endif	//__H__UG__space_filling_curve_util_impl__
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <vector>
+#include "check_frozen_adjacency.h"
+
+namespace ug{
+namespace grid_unit_tests{
+
+///	collects the associated elements of type TAss of all elements of type TElem.
+/**	Since the order of associated higher dimensional elements is arbitrary,
+ * each list is sorted by address.*/
+template <class TElem, class TAss>
+static void CollectAllAssociated(std::vector<std::vector<TAss*> >& assOut, Grid& g)
+{
+	typedef typename geometry_traits<TElem>::iterator iter_t;
+	typename Grid::traits<TAss>::secure_container	assCon;
+
+	assOut.clear();
+	for(iter_t iter = g.begin<TElem>(); iter != g.end<TElem>(); ++iter){
+		g.associated_elements(assCon, *iter);
+		assOut.push_back(std::vector<TAss*>(assCon.size()));
+		std::vector<TAss*>& ass = assOut.back();
+		for(size_t i = 0; i < assCon.size(); ++i)
+			ass[i] = assCon[i];
+		std::sort(ass.begin(), ass.end());
+	}
+}
+
+template <class TElem, class TAss>
+static void CompareAssociated(Grid& g, const char* state)
+{
+	std::vector<std::vector<TAss*> > ref, cur;
+	CollectAllAssociated<TElem, TAss>(ref, g);
+
+	g.freeze_adjacency();
+	CollectAllAssociated<TElem, TAss>(cur, g);
+	g.thaw_adjacency();
+
+	UG_COND_THROW(ref != cur, "Associated elements differ " << state << " ("
+				  << TElem::BASE_OBJECT_ID << " -> " << TAss::BASE_OBJECT_ID << ")");
+}
+
+template <class TElem>
+static void CompareAllAssociated(Grid& g, const char* state)
+{
+	CompareAssociated<TElem, Vertex>(g, state);
+	CompareAssociated<TElem, Edge>(g, state);
+	CompareAssociated<TElem, Face>(g, state);
+	CompareAssociated<TElem, Volume>(g, state);
+}
+
+void CheckFrozenAdjacency(Grid& g)
+{
+	if(!g.option_is_enabled(GRIDOPT_FULL_INTERCONNECTION)){
+		UG_LOG("WARNING: Autoenabling GRIDOPT_FULL_INTERCONNECTION in CheckFrozenAdjacency.\n");
+		g.enable_options(GRIDOPT_FULL_INTERCONNECTION);
+	}
+
+	CompareAllAssociated<Vertex>(g, "in frozen grid");
+	CompareAllAssociated<Edge>(g, "in frozen grid");
+	CompareAllAssociated<Face>(g, "in frozen grid");
+	CompareAllAssociated<Volume>(g, "in frozen grid");
+
+//	options have to be reported unchanged and enabling them must not thaw the grid
+	const uint opts = g.get_options();
+	g.freeze_adjacency();
+	UG_COND_THROW(!g.adjacency_is_frozen(), "Grid::freeze_adjacency has no effect.");
+	UG_COND_THROW(g.get_options() != opts,
+				  "Grid::get_options changed through Grid::freeze_adjacency.");
+	UG_COND_THROW(!g.option_is_enabled(opts),
+				  "Grid::option_is_enabled doesn't report frozen options.");
+
+	g.enable_options(VRTOPT_STORE_ASSOCIATED_EDGES);
+	g.set_options(opts);
+	UG_COND_THROW(!g.adjacency_is_frozen(),
+				  "Enabling frozen options thawed the grid.");
+
+	g.thaw_adjacency();
+	UG_COND_THROW(g.adjacency_is_frozen(), "Grid::thaw_adjacency has no effect.");
+	UG_COND_THROW(g.get_options() != opts,
+				  "Grid::thaw_adjacency didn't restore the frozen options.");
+
+//	the restored containers have to match the snapshot, too
+	CompareAllAssociated<Vertex>(g, "after thawing");
+	CompareAllAssociated<Edge>(g, "after thawing");
+	CompareAllAssociated<Face>(g, "after thawing");
+	CompareAllAssociated<Volume>(g, "after thawing");
+
+//	further STORE_ASSOCIATED options are answered from the snapshot and
+//	have to be built when the grid thaws.
+	g.set_options(GRIDOPT_DEFAULT);
+	g.freeze_adjacency();
+	g.enable_options(GRIDOPT_FULL_INTERCONNECTION);
+	UG_COND_THROW(!g.adjacency_is_frozen(),
+				  "Enabling further STORE_ASSOCIATED options thawed the grid.");
+	g.thaw_adjacency();
+	UG_COND_THROW(!g.option_is_enabled(GRIDOPT_FULL_INTERCONNECTION),
+				  "Options enabled while frozen were lost on thawing.");
+	CompareAllAssociated<Vertex>(g, "after enabling options while frozen");
+	CompareAllAssociated<Volume>(g, "after enabling options while frozen");
+}
+
+}//	end of namespace
+}//	end of namespace
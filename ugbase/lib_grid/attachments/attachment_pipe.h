@@ -390,6 +390,12 @@ class UG_API AttachmentPipe
 	/**	Aligns data with elements and removes unused data-memory.*/
 		void defragment();
 
+	///	Renumbers the data entries in the current iteration order of the elements.
+	/**	In contrast to defragment, this method also operates on pipes which
+	 * are not fragmented. It is used to restore the alignment of data and
+	 * elements after the elements of the handler have been reordered.*/
+		void align_data_with_elements();
+
 	/**\brief attaches a new data-array to the pipe.
 	 *
 	 * Attachs a new attachment and creates a container which holds the
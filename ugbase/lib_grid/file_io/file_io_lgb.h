@@ -42,6 +42,13 @@ namespace ug
 {
 
 class ProjectionHandler;
+class BinaryBuffer;
+
+///	writes the projectors of a projection handler to a binary buffer
+void SerializeProjectionHandler(BinaryBuffer& out, ProjectionHandler& ph);
+
+///	reads the projectors of a projection handler from a binary buffer
+void DeserializeProjectionHandler(BinaryBuffer& in, ProjectionHandler& ph);
 
 /**
  * Saves a grid to LibGridBinary-format.
@@ -0,0 +1,767 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <fstream>
+#include <cstring>
+#include "file_io_ugb.h"
+#include "file_io_lgb.h"
+#include "lib_grid/algorithms/serialization.h"
+#include "lib_grid/tools/subset_handler_grid.h"
+#include "lib_grid/tools/selector_grid.h"
+#include "common/profiler/profiler.h"
+
+#ifdef UG_ZLIB
+	#include <zlib.h>
+#endif
+
+#ifdef UG_POSIX
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace ug
+{
+
+///	identifies ugb files
+static const char UGB_MAGIC[8] = {'U', 'G', 'B', 'I', 'N', 'A', 'R', 'Y'};
+static const uint32 UGB_VERSION = 2;
+///	written as is, allows to detect a different byte order
+static const uint32 UGB_BYTE_ORDER = 0x01020304;
+///	alignment of all sections in the file
+static const uint64 UGB_ALIGNMENT = 64;
+///	uncompressed size of the blocks of compressed sections
+static const uint32 UGB_BLOCK_SIZE = 1 << 20;
+
+///	header at the beginning of an ugb file, followed by the section table
+struct UGBFileHeader
+{
+	char magic[8];
+	uint32 version;
+	uint32 byteOrder;
+	uint32 numberSize;
+	uint32 numSections;
+};
+
+static uint64 UGBAlign(uint64 offset)
+{
+	return ((offset + UGB_ALIGNMENT - 1) / UGB_ALIGNMENT) * UGB_ALIGNMENT;
+}
+
+#ifdef UG_ZLIB
+///	compresses data block-wise (\sa UGBCompression). Returns false if the
+///	result would not be smaller than the input.
+static bool UGBCompress(BinaryBuffer& bufOut, const char* data, uint64 size,
+						int level)
+{
+	const uint64 numBlocks = (size + UGB_BLOCK_SIZE - 1) / UGB_BLOCK_SIZE;
+	if(numBlocks == 0 || numBlocks > 0xFFFFFFFF)
+		return false;
+
+	vector<uint32> vHeader(2 + numBlocks);
+	vHeader[0] = (uint32)numBlocks;
+	vHeader[1] = UGB_BLOCK_SIZE;
+
+	string compressed;
+	vector<Bytef> buff(compressBound(UGB_BLOCK_SIZE));
+	for(uint64 b = 0; b < numBlocks; ++b){
+		const uint64 len = min<uint64>(UGB_BLOCK_SIZE, size - b * UGB_BLOCK_SIZE);
+		uLongf cLen = buff.size();
+		if(compress2(&buff[0], &cLen, (const Bytef*)(data + b * UGB_BLOCK_SIZE),
+					 len, level) != Z_OK)
+			UG_THROW("GridWriterUGB: zlib compression failed.");
+		vHeader[2 + b] = (uint32)cLen;
+		compressed.append((const char*)&buff[0], cLen);
+		if(compressed.size() + vHeader.size() * sizeof(uint32) >= size)
+			return false;
+	}
+
+	bufOut.clear();
+	bufOut.reserve(vHeader.size() * sizeof(uint32) + compressed.size());
+	bufOut.write((const char*)&vHeader[0], vHeader.size() * sizeof(uint32));
+	bufOut.write(compressed.data(), compressed.size());
+	return true;
+}
+
+///	decompresses the data of a UGB_ZLIB section. Returns false on corrupt data.
+static bool UGBDecompress(vector<char>& vOut, const char* data, uint64 size,
+						  uint64 rawSize)
+{
+//	deflate does not compress better than 1032:1, larger sizes are corrupt
+	if(size < 2 * sizeof(uint32) || rawSize / 1032 > size)
+		return false;
+	uint32 numBlocks, blockSize;
+	memcpy(&numBlocks, data, sizeof(uint32));
+	memcpy(&blockSize, data + sizeof(uint32), sizeof(uint32));
+	if(blockSize == 0 || blockSize > UGB_BLOCK_SIZE
+		|| numBlocks != (rawSize + blockSize - 1) / blockSize
+		|| numBlocks > (size - 2 * sizeof(uint32)) / sizeof(uint32))
+		return false;
+
+	vector<uint32> vBlockSize(numBlocks);
+	if(numBlocks > 0)
+		memcpy(&vBlockSize[0], data + 2 * sizeof(uint32), numBlocks * sizeof(uint32));
+
+	vOut.resize(rawSize);
+	uint64 pos = (2 + (uint64)numBlocks) * sizeof(uint32);
+	for(uint32 b = 0; b < numBlocks; ++b){
+		const uint64 len = min<uint64>(blockSize, rawSize - (uint64)b * blockSize);
+		if(vBlockSize[b] > size - pos)
+			return false;
+		uLongf outLen = len;
+		if(uncompress((Bytef*)&vOut[(uint64)b * blockSize], &outLen,
+					  (const Bytef*)(data + pos), vBlockSize[b]) != Z_OK
+			|| outLen != len)
+			return false;
+		pos += vBlockSize[b];
+	}
+	return pos == size;
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////
+//	SaveGridToUGB / LoadGridFromUGB
+template <class TAPosition>
+bool SaveGridToUGB(Grid& grid, ISubsetHandler& sh, const char* filename,
+				   TAPosition& aPos)
+{
+	GridWriterUGB ugbWriter;
+	if(!ugbWriter.add_grid(grid, aPos))
+		return false;
+	ugbWriter.add_subset_handler(sh, "defSH");
+
+	return ugbWriter.write_to_file(filename);
+}
+
+template <class TAPosition>
+bool LoadGridFromUGB(Grid& grid, ISubsetHandler& sh, const char* filename,
+					 TAPosition& aPos)
+{
+	GridReaderUGB ugbReader;
+	if(!ugbReader.parse_file(filename)){
+		UG_LOG("ERROR in LoadGridFromUGB: Could not read file: " << filename << endl);
+		return false;
+	}
+
+	if(!ugbReader.grid(grid, aPos))
+		return false;
+
+	if(ugbReader.num_subset_handlers() > 0)
+		return ugbReader.subset_handler(sh, 0);
+
+	return true;
+}
+
+template <class TAPosition>
+bool LoadGridFromUGB(Grid& grid, SPProjectionHandler& ph, size_t& num_ph,
+					 ISubsetHandler& sh, vector<string> additionalSHNames,
+					 vector<SmartPtr<ISubsetHandler> > ash,
+					 const char* filename, TAPosition& aPos)
+{
+	GridReaderUGB ugbReader;
+	if(!ugbReader.parse_file(filename)){
+		UG_LOG("ERROR in LoadGridFromUGB: Could not read file: " << filename << endl);
+		return false;
+	}
+
+	if(!ugbReader.grid(grid, aPos))
+		return false;
+
+	if(ugbReader.num_subset_handlers() > 0)
+		ugbReader.subset_handler(sh, 0);
+
+	for(size_t i_name = 0; i_name < additionalSHNames.size(); ++i_name){
+		for(size_t i_sh = 0; i_sh < ugbReader.num_subset_handlers(); ++i_sh){
+			if(additionalSHNames[i_name] == ugbReader.get_subset_handler_name(i_sh))
+				ugbReader.subset_handler(*ash[i_name], i_sh);
+		}
+	}
+
+	if((num_ph = ugbReader.num_projection_handlers()) != 0){
+		ugbReader.projection_handler(*ph, 0);
+		size_t shIndex = ugbReader.get_projection_handler_subset_handler_index(0);
+
+		if(shIndex > 0){
+			string shName = ugbReader.get_subset_handler_name(shIndex);
+			for(size_t i_name = 0; i_name < additionalSHNames.size(); ++i_name)
+				if(shName == additionalSHNames[i_name])
+				{
+					try {ph->set_subset_handler(ash[i_name]);}
+					UG_CATCH_THROW("Additional subset handler '"<< shName << "' has not been added to the domain.\n"
+									"Do so by using Domain::create_additional_subset_handler(std::string name).");
+				}
+		}
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+//	GridWriterUGB
+GridWriterUGB::GridWriterUGB() :
+	m_pGrid(NULL),
+	m_compressionLevel(0)
+{
+}
+
+void GridWriterUGB::set_compression_level(int level)
+{
+#ifdef UG_ZLIB
+	UG_COND_THROW(level < 0 || level > 9,
+				  "GridWriterUGB: Invalid compression level " << level);
+#else
+	UG_COND_THROW(level != 0,
+				  "GridWriterUGB: Compression requested, but ug was compiled "
+				  "without zlib support (use cmake -DUSE_ZLIB=ON).");
+#endif
+	m_compressionLevel = level;
+}
+
+BinaryBuffer& GridWriterUGB::
+new_section(UGBSectionType type, const char* name, uint64 count,
+			uint32 components, uint32 refIndex)
+{
+	UG_COND_THROW(strlen(name) >= sizeof(UGBSectionEntry().name),
+				  "GridWriterUGB: name too long: " << name);
+
+	UGBSectionEntry e;
+	memset(&e, 0, sizeof(e));
+	e.type = type;
+	e.compression = UGB_RAW;
+	e.components = components;
+	e.refIndex = refIndex;
+	e.count = count;
+	strcpy(e.name, name);
+
+	m_vEntries.push_back(e);
+	m_vData.push_back(BinaryBuffer());
+	return m_vData.back();
+}
+
+template <class TPositionAttachment>
+bool GridWriterUGB::
+add_grid(Grid& grid, TPositionAttachment& aPos)
+{
+	PROFILE_FUNC_GROUP("grid");
+	typedef typename TPositionAttachment::ValueType vector_t;
+	static const size_t dim = vector_t::Size;
+
+	UG_COND_THROW(m_pGrid != NULL, "GridWriterUGB: only one grid per file is supported.");
+
+	if(!grid.has_vertex_attachment(aPos)){
+		UG_LOG("  position attachment missing in grid\n");
+		return false;
+	}
+	m_pGrid = &grid;
+
+	SerializeGridElements(grid, new_section(UGB_GRID, "defGrid"));
+
+//	positions are stored as a plain array in the order of the vertices
+	Grid::VertexAttachmentAccessor<TPositionAttachment> aaPos(grid, aPos);
+	const size_t numVrts = grid.num<Vertex>();
+	BinaryBuffer& buf = new_section(UGB_POSITIONS, "position", numVrts, dim);
+	buf.reserve(numVrts * dim * sizeof(number));
+	for(VertexIterator iter = grid.begin<Vertex>(); iter != grid.end<Vertex>(); ++iter){
+		const vector_t& v = aaPos[*iter];
+		for(size_t d = 0; d < dim; ++d){
+			const number c = v[d];
+			buf.write((const char*)&c, sizeof(number));
+		}
+	}
+	return true;
+}
+
+void GridWriterUGB::
+add_subset_handler(ISubsetHandler& sh, const char* name)
+{
+	UG_COND_THROW(m_pGrid == NULL, "GridWriterUGB: add a grid first.");
+	SerializeSubsetHandler(*m_pGrid, sh, new_section(UGB_SUBSET_HANDLER, name));
+	m_vSH.push_back(&sh);
+}
+
+void GridWriterUGB::
+add_selector(ISelector& sel, const char* name)
+{
+	UG_COND_THROW(m_pGrid == NULL, "GridWriterUGB: add a grid first.");
+	SerializeSelector(*m_pGrid, sel, new_section(UGB_SELECTOR, name));
+}
+
+void GridWriterUGB::
+add_projection_handler(ProjectionHandler& ph, const char* name)
+{
+	size_t shIndex = 0;
+	for(; shIndex < m_vSH.size(); ++shIndex)
+		if(m_vSH[shIndex] == ph.subset_handler())
+			break;
+
+	UG_COND_THROW(shIndex == m_vSH.size(), "ERROR in 'GridWriterUGB::add_projection_handler': "
+				"No matching SubsetHandler could be found.\n"
+				"Please make sure to add the associated SubsetHandler before adding a ProjectionHandler");
+
+	SerializeProjectionHandler(new_section(UGB_PROJECTION_HANDLER, name, 0, 0,
+										   (uint32)shIndex),
+							   ph);
+}
+
+bool GridWriterUGB::
+write_to_file(const char* filename)
+{
+	PROFILE_FUNC_GROUP("grid");
+	UGBFileHeader header;
+	memcpy(header.magic, UGB_MAGIC, sizeof(header.magic));
+	header.version = UGB_VERSION;
+	header.byteOrder = UGB_BYTE_ORDER;
+	header.numberSize = sizeof(number);
+	header.numSections = (uint32)m_vEntries.size();
+
+//	compress the sections and compute their aligned offsets
+	vector<BinaryBuffer> vCompressed(m_vEntries.size());
+	vector<BinaryBuffer*> vOut(m_vEntries.size());
+	uint64 offset = sizeof(UGBFileHeader) + m_vEntries.size() * sizeof(UGBSectionEntry);
+	for(size_t i = 0; i < m_vEntries.size(); ++i){
+		vOut[i] = &m_vData[i];
+		m_vEntries[i].compression = UGB_RAW;
+		m_vEntries[i].rawSize = m_vData[i].write_pos();
+	#ifdef UG_ZLIB
+		if(m_compressionLevel > 0
+		   && UGBCompress(vCompressed[i], m_vData[i].buffer(), m_vEntries[i].rawSize,
+						  m_compressionLevel))
+		{
+			vOut[i] = &vCompressed[i];
+			m_vEntries[i].compression = UGB_ZLIB;
+		}
+	#endif
+		offset = UGBAlign(offset);
+		m_vEntries[i].offset = offset;
+		m_vEntries[i].size = vOut[i]->write_pos();
+		offset += m_vEntries[i].size;
+	}
+
+	ofstream out(filename, ios::binary);
+	if(!out) return false;
+
+	out.write((const char*)&header, sizeof(header));
+	if(!m_vEntries.empty())
+		out.write((const char*)&m_vEntries[0], m_vEntries.size() * sizeof(UGBSectionEntry));
+
+	const char zeros[UGB_ALIGNMENT] = {0};
+	uint64 pos = sizeof(UGBFileHeader) + m_vEntries.size() * sizeof(UGBSectionEntry);
+	for(size_t i = 0; i < m_vEntries.size(); ++i){
+		out.write(zeros, m_vEntries[i].offset - pos);
+		if(m_vEntries[i].size > 0)
+			out.write(vOut[i]->buffer(), m_vEntries[i].size);
+		pos = m_vEntries[i].offset + m_vEntries[i].size;
+	}
+
+	return out.good();
+}
+
+////////////////////////////////////////////////////////////////////////
+//	GridReaderUGB
+GridReaderUGB::GridReaderUGB() :
+	m_pData(NULL),
+	m_size(0),
+	m_bMapped(false),
+	m_pGrid(NULL)
+{
+}
+
+GridReaderUGB::~GridReaderUGB()
+{
+	close();
+}
+
+void GridReaderUGB::close()
+{
+#ifdef UG_POSIX
+	if(m_bMapped)
+		munmap(const_cast<char*>(m_pData), m_size);
+#endif
+	m_bMapped = false;
+	m_pData = NULL;
+	m_size = 0;
+	m_vFileData.clear();
+	m_vEntries.clear();
+	m_pGrid = NULL;
+}
+
+bool GridReaderUGB::parse_file(const char* filename)
+{
+	PROFILE_FUNC_GROUP("grid");
+	close();
+	m_filename = filename;
+
+#ifdef UG_POSIX
+//	map the file into memory. Pages are only loaded when accessed.
+	int fd = open(filename, O_RDONLY);
+	if(fd != -1){
+		struct stat st;
+		if(fstat(fd, &st) == 0 && st.st_size > 0){
+			void* p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if(p != MAP_FAILED){
+				m_pData = (const char*)p;
+				m_size = st.st_size;
+				m_bMapped = true;
+			}
+		}
+		::close(fd);
+	}
+#endif
+
+//	fallback: read the whole file
+	if(!m_bMapped){
+		ifstream in(filename, ios::binary);
+		if(!in)
+			return false;
+		in.seekg(0, ios::end);
+		m_size = in.tellg();
+		in.seekg(0, ios::beg);
+		m_vFileData.resize(m_size);
+		if(m_size > 0)
+			in.read(&m_vFileData[0], m_size);
+		m_pData = m_vFileData.empty() ? NULL : &m_vFileData[0];
+	}
+
+//	check the header
+	if(m_size < sizeof(UGBFileHeader)){
+		UG_LOG("ERROR in GridReaderUGB: file too small: " << filename << endl);
+		return false;
+	}
+	UGBFileHeader header;
+	memcpy(&header, m_pData, sizeof(header));
+
+	if(memcmp(header.magic, UGB_MAGIC, sizeof(header.magic)) != 0){
+		UG_LOG("ERROR in GridReaderUGB: not an ugb file: " << filename << endl);
+		return false;
+	}
+	if(header.byteOrder != UGB_BYTE_ORDER){
+		UG_LOG("ERROR in GridReaderUGB: wrong endianess\n");
+		return false;
+	}
+	if(header.version != UGB_VERSION){
+		UG_LOG("ERROR in GridReaderUGB: bad file-version: " << header.version
+				<< ". Expected " << UGB_VERSION << ".\n");
+		return false;
+	}
+	if(header.numberSize != sizeof(number)){
+		UG_LOG("ERROR in GridReaderUGB: bad number-size\n");
+		return false;
+	}
+
+//	read the section table. The sizes are compared by divisions, so that
+//	corrupt entries can't cause overflows.
+	if(header.numSections > (m_size - sizeof(UGBFileHeader)) / sizeof(UGBSectionEntry)){
+		UG_LOG("ERROR in GridReaderUGB: truncated section table\n");
+		close();
+		return false;
+	}
+	const uint64 tableEnd = sizeof(UGBFileHeader)
+							+ (uint64)header.numSections * sizeof(UGBSectionEntry);
+	m_vEntries.resize(header.numSections);
+	if(header.numSections > 0)
+		memcpy(&m_vEntries[0], m_pData + sizeof(UGBFileHeader),
+			   header.numSections * sizeof(UGBSectionEntry));
+
+	for(size_t i = 0; i < m_vEntries.size(); ++i){
+		const UGBSectionEntry& e = m_vEntries[i];
+		if(e.offset < tableEnd || e.offset > m_size || e.size > m_size - e.offset){
+			UG_LOG("ERROR in GridReaderUGB: section " << i << " exceeds the file\n");
+			close();
+			return false;
+		}
+		bool validCompression = (e.compression == UGB_RAW && e.rawSize == e.size);
+	#ifdef UG_ZLIB
+		validCompression |= (e.compression == UGB_ZLIB);
+	#else
+		if(e.compression == UGB_ZLIB){
+			UG_LOG("ERROR in GridReaderUGB: section " << i << " is compressed, but "
+					"ug was compiled without zlib support (use cmake -DUSE_ZLIB=ON).\n");
+			close();
+			return false;
+		}
+	#endif
+		if(!validCompression){
+			UG_LOG("ERROR in GridReaderUGB: unsupported compression in section " << i << "\n");
+			close();
+			return false;
+		}
+		if(e.type == UGB_POSITIONS && !valid_position_section(e)){
+			UG_LOG("ERROR in GridReaderUGB: bad position section " << i << "\n");
+			close();
+			return false;
+		}
+		m_vEntries[i].name[sizeof(e.name) - 1] = 0;
+	}
+
+	return true;
+}
+
+bool GridReaderUGB::
+valid_position_section(const UGBSectionEntry& e) const
+{
+//	uncompressed positions are read in place, so the data has to be aligned.
+//	Its size has to match count * components numbers exactly
+	if(e.components == 0 || (e.compression == UGB_RAW && e.offset % sizeof(number) != 0))
+		return false;
+	const uint64 entrySize = (uint64)e.components * sizeof(number);
+	return (e.rawSize % entrySize == 0) && (e.rawSize / entrySize == e.count);
+}
+
+const UGBSectionEntry* GridReaderUGB::
+entry(UGBSectionType type, size_t index) const
+{
+	for(size_t i = 0; i < m_vEntries.size(); ++i){
+		if(m_vEntries[i].type == (uint32)type){
+			if(index == 0)
+				return &m_vEntries[i];
+			--index;
+		}
+	}
+	return NULL;
+}
+
+size_t GridReaderUGB::
+num_entries(UGBSectionType type) const
+{
+	size_t num = 0;
+	for(size_t i = 0; i < m_vEntries.size(); ++i)
+		if(m_vEntries[i].type == (uint32)type)
+			++num;
+	return num;
+}
+
+const char* GridReaderUGB::
+section_data(const UGBSectionEntry& e, vector<char>& vTmp) const
+{
+	if(e.compression == UGB_RAW)
+		return m_pData + e.offset;
+
+#ifdef UG_ZLIB
+	if(!UGBDecompress(vTmp, m_pData + e.offset, e.size, e.rawSize))
+		UG_THROW("GridReaderUGB: corrupt compressed section '" << e.name
+				 << "' in " << m_filename);
+#endif
+	return vTmp.empty() ? NULL : &vTmp[0];
+}
+
+void GridReaderUGB::
+read_section(BinaryBuffer& bufOut, const UGBSectionEntry& e) const
+{
+	vector<char> vTmp;
+	const char* data = section_data(e, vTmp);
+	bufOut.clear();
+	bufOut.reserve(e.rawSize);
+	bufOut.write(data, e.rawSize);
+}
+
+template <class TPositionAttachment>
+bool GridReaderUGB::
+grid(Grid& gridOut, TPositionAttachment& aPos)
+{
+	PROFILE_FUNC_GROUP("grid");
+	typedef typename TPositionAttachment::ValueType vector_t;
+	static const size_t dim = vector_t::Size;
+
+	const UGBSectionEntry* pGrid = entry(UGB_GRID, 0);
+	const UGBSectionEntry* pPos = entry(UGB_POSITIONS, 0);
+	if(!pGrid || !pPos){
+		UG_LOG("ERROR in GridReaderUGB: file contains no grid.\n");
+		return false;
+	}
+
+	gridOut.clear_geometry();
+	if(!gridOut.has_vertex_attachment(aPos))
+		gridOut.attach_to_vertices(aPos);
+
+//	to avoid problems with autgenerated elements we'll deactivate
+//	all options and reactivate them later on
+	uint gridOptions = gridOut.get_options();
+	gridOut.set_options(GRIDOPT_NONE);
+
+	{
+		BinaryBuffer buf;
+		read_section(buf, *pGrid);
+		DeserializeGridElements(gridOut, buf);
+	}
+
+	gridOut.set_options(gridOptions);
+
+	if(pPos->count != gridOut.num<Vertex>()){
+		UG_LOG("ERROR in GridReaderUGB: number of positions does not match number of vertices.\n");
+		return false;
+	}
+
+//	copy the positions directly from the mapped file (if not compressed)
+	const size_t fileDim = pPos->components;
+	vector<char> vTmp;
+	const number* pCoord = (const number*)section_data(*pPos, vTmp);
+	const size_t minDim = min(fileDim, dim);
+	Grid::VertexAttachmentAccessor<TPositionAttachment> aaPos(gridOut, aPos);
+	for(VertexIterator iter = gridOut.begin<Vertex>();
+		iter != gridOut.end<Vertex>(); ++iter, pCoord += fileDim)
+	{
+		vector_t& v = aaPos[*iter];
+		size_t d = 0;
+		for(; d < minDim; ++d)
+			v[d] = pCoord[d];
+		for(; d < dim; ++d)
+			v[d] = 0;
+	}
+
+	m_pGrid = &gridOut;
+	return true;
+}
+
+size_t GridReaderUGB::num_subset_handlers() const
+{
+	return num_entries(UGB_SUBSET_HANDLER);
+}
+
+const char* GridReaderUGB::get_subset_handler_name(size_t subsetHandlerIndex) const
+{
+	const UGBSectionEntry* e = entry(UGB_SUBSET_HANDLER, subsetHandlerIndex);
+	UG_COND_THROW(!e, "GridReaderUGB: bad subset handler index " << subsetHandlerIndex);
+	return e->name;
+}
+
+bool GridReaderUGB::subset_handler(ISubsetHandler& shOut, size_t subsetHandlerIndex)
+{
+	const UGBSectionEntry* e = entry(UGB_SUBSET_HANDLER, subsetHandlerIndex);
+	if(!e || !m_pGrid){
+		UG_LOG("ERROR in GridReaderUGB: subset handler " << subsetHandlerIndex
+				<< " not available.\n");
+		return false;
+	}
+	BinaryBuffer buf;
+	read_section(buf, *e);
+	return DeserializeSubsetHandler(*m_pGrid, shOut, buf, true);
+}
+
+size_t GridReaderUGB::num_selectors() const
+{
+	return num_entries(UGB_SELECTOR);
+}
+
+const char* GridReaderUGB::get_selector_name(size_t selectorIndex) const
+{
+	const UGBSectionEntry* e = entry(UGB_SELECTOR, selectorIndex);
+	UG_COND_THROW(!e, "GridReaderUGB: bad selector index " << selectorIndex);
+	return e->name;
+}
+
+bool GridReaderUGB::selector(ISelector& selOut, size_t selectorIndex)
+{
+	const UGBSectionEntry* e = entry(UGB_SELECTOR, selectorIndex);
+	if(!e || !m_pGrid){
+		UG_LOG("ERROR in GridReaderUGB: selector " << selectorIndex
+				<< " not available.\n");
+		return false;
+	}
+	BinaryBuffer buf;
+	read_section(buf, *e);
+	return DeserializeSelector(*m_pGrid, selOut, buf);
+}
+
+size_t GridReaderUGB::num_projection_handlers() const
+{
+	return num_entries(UGB_PROJECTION_HANDLER);
+}
+
+const char* GridReaderUGB::get_projection_handler_name(size_t phIndex) const
+{
+	const UGBSectionEntry* e = entry(UGB_PROJECTION_HANDLER, phIndex);
+	UG_COND_THROW(!e, "GridReaderUGB: bad projection handler index " << phIndex);
+	return e->name;
+}
+
+size_t GridReaderUGB::get_projection_handler_subset_handler_index(size_t phIndex) const
+{
+	const UGBSectionEntry* e = entry(UGB_PROJECTION_HANDLER, phIndex);
+	UG_COND_THROW(!e, "GridReaderUGB: bad projection handler index " << phIndex);
+	return e->refIndex;
+}
+
+bool GridReaderUGB::projection_handler(ProjectionHandler& phOut, size_t phIndex)
+{
+	const UGBSectionEntry* e = entry(UGB_PROJECTION_HANDLER, phIndex);
+	if(!e){
+		UG_LOG("ERROR in GridReaderUGB: projection handler " << phIndex
+				<< " not available.\n");
+		return false;
+	}
+	BinaryBuffer buf;
+	read_section(buf, *e);
+	DeserializeProjectionHandler(buf, phOut);
+	return true;
+}
+
+size_t GridReaderUGB::num_vertex_attachments() const
+{
+	return num_entries(UGB_VERTEX_ATTACHMENT);
+}
+
+const char* GridReaderUGB::get_vertex_attachment_name(size_t attachmentIndex) const
+{
+	const UGBSectionEntry* e = entry(UGB_VERTEX_ATTACHMENT, attachmentIndex);
+	UG_COND_THROW(!e, "GridReaderUGB: bad vertex attachment index " << attachmentIndex);
+	return e->name;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+//	explicit template instantiations
+template bool GridWriterUGB::add_grid<APosition1>(Grid&, APosition1&);
+template bool GridWriterUGB::add_grid<APosition2>(Grid&, APosition2&);
+template bool GridWriterUGB::add_grid<APosition3>(Grid&, APosition3&);
+
+template bool GridReaderUGB::grid<APosition1>(Grid&, APosition1&);
+template bool GridReaderUGB::grid<APosition2>(Grid&, APosition2&);
+template bool GridReaderUGB::grid<APosition3>(Grid&, APosition3&);
+
+template bool SaveGridToUGB<APosition1>(Grid&, ISubsetHandler&, const char*, APosition1&);
+template bool SaveGridToUGB<APosition2>(Grid&, ISubsetHandler&, const char*, APosition2&);
+template bool SaveGridToUGB<APosition3>(Grid&, ISubsetHandler&, const char*, APosition3&);
+
+template bool LoadGridFromUGB<APosition1>(Grid&, ISubsetHandler&, const char*, APosition1&);
+template bool LoadGridFromUGB<APosition2>(Grid&, ISubsetHandler&, const char*, APosition2&);
+template bool LoadGridFromUGB<APosition3>(Grid&, ISubsetHandler&, const char*, APosition3&);
+
+template bool LoadGridFromUGB<APosition1>(Grid&, SPProjectionHandler&, size_t&, ISubsetHandler&,
+		vector<string>, vector<SmartPtr<ISubsetHandler> >, const char*, APosition1&);
+template bool LoadGridFromUGB<APosition2>(Grid&, SPProjectionHandler&, size_t&, ISubsetHandler&,
+		vector<string>, vector<SmartPtr<ISubsetHandler> >, const char*, APosition2&);
+template bool LoadGridFromUGB<APosition3>(Grid&, SPProjectionHandler&, size_t&, ISubsetHandler&,
+		vector<string>, vector<SmartPtr<ISubsetHandler> >, const char*, APosition3&);
+
+}//	end of namespace
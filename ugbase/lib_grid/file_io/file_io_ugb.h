@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_GRID__FILE_IO_UGB__
+#define __H__LIB_GRID__FILE_IO_UGB__
+
+#include <string>
+#include <vector>
+#include "common/util/binary_buffer.h"
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/tools/subset_handler_interface.h"
+#include "lib_grid/tools/selector_interface.h"
+#include "lib_grid/common_attachments.h"
+#include "lib_grid/refinement/projectors/projection_handler.h"
+
+namespace ug
+{
+
+////////////////////////////////////////////////////////////////////////
+///	Writes a grid to an ugb file. internally uses GridWriterUGB.
+/**	The ugb format is the binary counterpart of the ugx format. It stores
+ *	the grid, its positions, subset handlers, selectors, projection handlers
+ *	and vertex attachments in aligned, typed sections, which may be block
+ *	compressed with zlib. MathVector position attachments of dimension 1, 2
+ *	and 3 are supported.
+ */
+template <class TAPosition>
+bool SaveGridToUGB(Grid& grid, ISubsetHandler& sh,
+				   const char* filename, TAPosition& aPos);
+
+////////////////////////////////////////////////////////////////////////
+///	Reads a grid from an ugb file. internally uses GridReaderUGB.
+template <class TAPosition>
+bool LoadGridFromUGB(Grid& grid, ISubsetHandler& sh,
+					 const char* filename, TAPosition& aPos);
+
+///	Reads a grid, its subset handlers and its projection handler from an ugb file.
+/**	Same semantics as the corresponding LoadGridFromUGX: The subset handlers
+ *	named in additionalSHNames are read into ash and the first projection
+ *	handler (if any) is read into ph.*/
+template <class TAPosition>
+bool LoadGridFromUGB(Grid& grid, SPProjectionHandler& ph, size_t& num_ph,
+					 ISubsetHandler& sh, std::vector<std::string> additionalSHNames,
+					 std::vector<SmartPtr<ISubsetHandler> > ash,
+					 const char* filename, TAPosition& aPos);
+
+
+////////////////////////////////////////////////////////////////////////
+///	section types of the ugb format
+enum UGBSectionType
+{
+	UGB_GRID = 1,
+	UGB_POSITIONS = 2,
+	UGB_SUBSET_HANDLER = 3,
+	UGB_SELECTOR = 4,
+	UGB_PROJECTION_HANDLER = 5,
+	UGB_VERTEX_ATTACHMENT = 6
+};
+
+///	compression of a section
+/**	UGB_ZLIB sections start with the number of blocks, the (uncompressed)
+ *	block size and the compressed size of each block (all uint32), followed
+ *	by the blocks. Blocks are compressed independently. Reading them requires
+ *	UG_ZLIB.*/
+enum UGBCompression
+{
+	UGB_RAW = 0,
+	UGB_ZLIB = 1
+};
+
+///	entry of the section table of an ugb file
+/**	All members are naturally aligned, the layout does not contain padding.*/
+struct UGBSectionEntry
+{
+	uint32 type;			///< UGBSectionType
+	uint32 compression;		///< UGBCompression
+	uint32 components;		///< number of components per entry (positions), bytes per entry (attachments)
+	uint32 refIndex;		///< index of a referenced section (projection handler -> subset handler)
+	uint64 offset;			///< offset of the section data in the file (aligned)
+	uint64 size;			///< size of the section data in the file in bytes
+	uint64 rawSize;			///< size of the uncompressed section data in bytes
+	uint64 count;			///< number of entries (e.g. vertices)
+	char name[40];			///< zero-terminated name
+};
+
+////////////////////////////////////////////////////////////////////////
+///	Grants write access to ugb files.
+/**	All data is serialized when added. The grid thus has to be added first
+ *	and must not be changed until the other data has been added.
+ *	Only one grid per file is supported.
+ */
+class GridWriterUGB
+{
+	public:
+		GridWriterUGB();
+
+	/**	TPositionAttachments value type has to be a MathVector.
+	 *	Make sure that aPos is attached to the vertices of the grid.*/
+		template <class TPositionAttachment>
+		bool add_grid(Grid& grid, TPositionAttachment& aPos);
+
+		void add_subset_handler(ISubsetHandler& sh, const char* name);
+
+		void add_selector(ISelector& sel, const char* name);
+
+	///	the subset handler of the projection handler has to be added before
+		void add_projection_handler(ProjectionHandler& ph, const char* name);
+
+	///	stores the values of a vertex attachment
+	/**	The values are copied bytewise, the value type of TAttachment thus
+	 *	has to be a plain type like number, int or MathVector.*/
+		template <class TAttachment>
+		void add_vertex_attachment(TAttachment& attachment, const char* name);
+
+	///	zlib compression level of the sections (0: no compression, default)
+	/**	A section is only stored compressed if this makes it smaller.*/
+		void set_compression_level(int level);
+
+		bool write_to_file(const char* filename);
+
+	protected:
+	///	adds a section entry and returns the buffer for its data
+		BinaryBuffer& new_section(UGBSectionType type, const char* name,
+								  uint64 count = 0, uint32 components = 0,
+								  uint32 refIndex = 0);
+
+	protected:
+		Grid* m_pGrid;
+		std::vector<UGBSectionEntry> m_vEntries;
+		std::vector<BinaryBuffer> m_vData;
+		std::vector<ISubsetHandler*> m_vSH;
+		int m_compressionLevel;
+};
+
+////////////////////////////////////////////////////////////////////////
+///	Grants read access to ugb files.
+/**	The file is mapped into memory (where supported) and only the requested
+ *	sections are read. Uncompressed position and attachment data is copied
+ *	directly from the mapped file to the attachments, compressed sections are
+ *	decompressed block by block.
+ */
+class GridReaderUGB
+{
+	public:
+		GridReaderUGB();
+		~GridReaderUGB();
+
+	///	maps the file and reads its section table
+		bool parse_file(const char* filename);
+
+	///	creates the grid and sets the positions
+	/**	Position attachments of a different dimension than the stored ones
+	 *	are supported. Missing components are set to 0.*/
+		template <class TPositionAttachment>
+		bool grid(Grid& gridOut, TPositionAttachment& aPos);
+
+		size_t num_subset_handlers() const;
+		const char* get_subset_handler_name(size_t subsetHandlerIndex) const;
+	///	grid() has to be called before
+		bool subset_handler(ISubsetHandler& shOut, size_t subsetHandlerIndex);
+
+		size_t num_selectors() const;
+		const char* get_selector_name(size_t selectorIndex) const;
+	///	grid() has to be called before
+		bool selector(ISelector& selOut, size_t selectorIndex);
+
+		size_t num_projection_handlers() const;
+		const char* get_projection_handler_name(size_t phIndex) const;
+	///	index of the subset handler associated with the projection handler
+		size_t get_projection_handler_subset_handler_index(size_t phIndex) const;
+		bool projection_handler(ProjectionHandler& phOut, size_t phIndex);
+
+		size_t num_vertex_attachments() const;
+		const char* get_vertex_attachment_name(size_t attachmentIndex) const;
+	///	reads the values of the vertex attachment with the given name
+	/**	The attachment is attached to the vertices if necessary. Returns false
+	 *	if no such attachment is stored or if its value size does not match.
+	 *	grid() has to be called before.*/
+		template <class TAttachment>
+		bool vertex_attachment(TAttachment& attachmentOut, const char* name);
+
+	protected:
+		void close();
+
+	///	returns the index-th entry of the given type or NULL
+		const UGBSectionEntry* entry(UGBSectionType type, size_t index) const;
+		size_t num_entries(UGBSectionType type) const;
+
+	///	copies the data of a section into a binary buffer
+		void read_section(BinaryBuffer& bufOut, const UGBSectionEntry& e) const;
+
+	///	returns the uncompressed data of a section
+	/**	Uncompressed sections are returned in place, compressed ones are
+	 *	decompressed to vTmp.*/
+		const char* section_data(const UGBSectionEntry& e, std::vector<char>& vTmp) const;
+
+	///	checks size, alignment and number of components of a position section
+		bool valid_position_section(const UGBSectionEntry& e) const;
+
+	protected:
+		std::string m_filename;
+		const char* m_pData;
+		size_t m_size;
+		bool m_bMapped;
+		std::vector<char> m_vFileData;	///< used if the file could not be mapped
+		std::vector<UGBSectionEntry> m_vEntries;
+		Grid* m_pGrid;
+};
+
+}//	end of namespace
+
+
+////////////////////////////////
+//	include implementation
+#include "file_io_ugb_impl.hpp"
+
+#endif
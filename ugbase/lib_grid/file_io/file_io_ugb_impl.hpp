@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_GRID__FILE_IO_UGB_IMPL__
+#define __H__LIB_GRID__FILE_IO_UGB_IMPL__
+
+#include <cstring>
+
+namespace ug
+{
+
+template <class TAttachment>
+void GridWriterUGB::
+add_vertex_attachment(TAttachment& attachment, const char* name)
+{
+	typedef typename TAttachment::ValueType value_t;
+	UG_COND_THROW(m_pGrid == NULL, "GridWriterUGB: add a grid first.");
+
+	Grid& grid = *m_pGrid;
+	if(!grid.has_vertex_attachment(attachment))
+		return;
+
+	Grid::VertexAttachmentAccessor<TAttachment> aaVal(grid, attachment);
+	const size_t numVrts = grid.num<Vertex>();
+	BinaryBuffer& buf = new_section(UGB_VERTEX_ATTACHMENT, name, numVrts,
+									(uint32)sizeof(value_t));
+	buf.reserve(numVrts * sizeof(value_t));
+	for(VertexIterator iter = grid.begin<Vertex>(); iter != grid.end<Vertex>(); ++iter)
+		buf.write((const char*)&aaVal[*iter], sizeof(value_t));
+}
+
+template <class TAttachment>
+bool GridReaderUGB::
+vertex_attachment(TAttachment& attachmentOut, const char* name)
+{
+	typedef typename TAttachment::ValueType value_t;
+
+	const UGBSectionEntry* e = NULL;
+	for(size_t i = 0; i < num_vertex_attachments(); ++i){
+		const UGBSectionEntry* ei = entry(UGB_VERTEX_ATTACHMENT, i);
+		if(strcmp(ei->name, name) == 0){
+			e = ei;
+			break;
+		}
+	}
+
+	if(!e || !m_pGrid){
+		UG_LOG("ERROR in GridReaderUGB: vertex attachment '" << name
+				<< "' not available.\n");
+		return false;
+	}
+
+	Grid& grid = *m_pGrid;
+	if(e->components != sizeof(value_t) || e->count != grid.num<Vertex>()
+		|| e->rawSize != e->count * sizeof(value_t))
+	{
+		UG_LOG("ERROR in GridReaderUGB: vertex attachment '" << name
+				<< "' does not match the grid or the value type.\n");
+		return false;
+	}
+
+	if(!grid.has_vertex_attachment(attachmentOut))
+		grid.attach_to_vertices(attachmentOut);
+
+	std::vector<char> vTmp;
+	const char* pVal = section_data(*e, vTmp);
+	Grid::VertexAttachmentAccessor<TAttachment> aaVal(grid, attachmentOut);
+	for(VertexIterator iter = grid.begin<Vertex>(); iter != grid.end<Vertex>();
+		++iter, pVal += sizeof(value_t))
+	{
+		memcpy(&aaVal[*iter], pVal, sizeof(value_t));
+	}
+	return true;
+}
+
+}//	end of namespace
+
+#endif
@@ -33,6 +33,7 @@
 #ifndef __H__UG__element_storage__
 #define __H__UG__element_storage__
 
+#include <vector>
 #include "grid_base_objects.h"
 #include "common/util/section_container.h"
 
@@ -357,6 +358,42 @@ struct SectionContainerSelector<Volume>{
 		{return vols;}
 };
 
+
+////////////////////////////////////////////////////////////////////////////////
+///	Reorders the grid objects in a section container
+/**	The given elements are grouped by their container section (cf.
+ * GridObject::container_section). Each section which holds at least one of the
+ * given elements has to be covered completely by vNewOrder. Afterwards the
+ * elements of those sections appear in the order in which they are listed in
+ * vNewOrder. Other sections are not affected.*/
+template <class TSectionContainer, class TElem>
+void ReorderSectionContainer(TSectionContainer& sc,
+							 const std::vector<TElem*>& vNewOrder)
+{
+	typedef typename TSectionContainer::value_type	value_type;
+	std::vector<std::vector<value_type> > vSections(sc.num_sections());
+
+	for(size_t i = 0; i < vNewOrder.size(); ++i){
+		TElem* e = vNewOrder[i];
+		const int sec = e->container_section();
+		UG_COND_THROW(sec < 0 || sec >= sc.num_sections(),
+					  "ReorderSectionContainer: element is not contained in the "
+					  "given section container.");
+		vSections[sec].push_back(e);
+	}
+
+	for(int sec = 0; sec < (int)vSections.size(); ++sec){
+		const std::vector<value_type>& vSec = vSections[sec];
+		if(vSec.empty())
+			continue;
+		UG_COND_THROW(vSec.size() != sc.num_elements(sec),
+					  "ReorderSectionContainer: the new order of section " << sec
+					  << " contains " << vSec.size() << " elements, the section holds "
+					  << sc.num_elements(sec) << ".");
+		sc.reorder_section(sec, vSec.begin(), vSec.end());
+	}
+}
+
 }//	end of namespace
 
 #endif
@@ -34,6 +34,7 @@
 #include <algorithm>
 #include "grid.h"
 #include "grid_util.h"
+#include "grid_adjacency_snapshot.h"
 #include "common/common.h"
 #include "lib_grid/attachments/attached_list.h"
 #include "lib_grid/tools/periodic_boundary_manager.h"
@@ -47,6 +48,19 @@ using namespace std;
 
 namespace ug
 {
+
+///	all options whose containers are replaced by the snapshot in Grid::freeze_adjacency
+static const uint STORE_ASSOCIATED_OPTIONS =
+						VRTOPT_STORE_ASSOCIATED_EDGES
+					  | VRTOPT_STORE_ASSOCIATED_FACES
+					  | VRTOPT_STORE_ASSOCIATED_VOLUMES
+					  | EDGEOPT_STORE_ASSOCIATED_FACES
+					  | EDGEOPT_STORE_ASSOCIATED_VOLUMES
+					  | FACEOPT_STORE_ASSOCIATED_EDGES
+					  | FACEOPT_STORE_ASSOCIATED_VOLUMES
+					  | VOLOPT_STORE_ASSOCIATED_EDGES
+					  | VOLOPT_STORE_ASSOCIATED_FACES;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////
 //	implementation of Grid
@@ -61,7 +75,9 @@ Grid::Grid() :
 	m_bMarking(false),
 	m_aMark("Grid_Mark", false),
 	m_distGridMgr(NULL),
-	m_periodicBndMgr(NULL)
+	m_periodicBndMgr(NULL),
+	m_pAdjacencySnapshot(NULL),
+	m_frozenOptions(0)
 {
 	m_hashCounter = 0;
 	m_currentMark = 0;
@@ -79,7 +95,9 @@ Grid::Grid(uint options) :
 	m_bMarking(false),
 	m_aMark("Grid_Mark", false),
 	m_distGridMgr(NULL),
-	m_periodicBndMgr(NULL)
+	m_periodicBndMgr(NULL),
+	m_pAdjacencySnapshot(NULL),
+	m_frozenOptions(0)
 {
 	m_hashCounter = 0;
 	m_currentMark = 0;
@@ -97,7 +115,9 @@ Grid::Grid(const Grid& grid) :
 	m_bMarking(false),
 	m_aMark("Grid_Mark", false),
 	m_distGridMgr(NULL),
-	m_periodicBndMgr(NULL)
+	m_periodicBndMgr(NULL),
+	m_pAdjacencySnapshot(NULL),
+	m_frozenOptions(0)
 {
 	m_hashCounter = 0;
 	m_currentMark = 0;
@@ -225,8 +245,10 @@ void Grid::clear()
 
 void Grid::clear_geometry()
 {
-//	disable all options to speed it up
+//	disable all options to speed it up. A frozen adjacency is simply dropped,
+//	since the frozen options are restored below anyway.
 	uint opts = get_options();
+	discard_adjacency_snapshot();
 	set_options(GRIDOPT_NONE);
 	
 	clear<Volume>();
@@ -281,6 +303,7 @@ Grid& Grid::operator = (const Grid& grid)
 //	we're disabling any options, since new options will
 //	be set during assign_grid anyway. This might speed
 //	things up a little
+	discard_adjacency_snapshot();
 	set_options(GRIDOPT_NONE);
 	clear_geometry();
 	assign_grid(grid);
@@ -539,6 +562,9 @@ void Grid::flip_orientation(Edge* e)
 
 void Grid::flip_orientation(Face* f)
 {
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	inverts the order of vertices.
 	uint numVrts = (int)f->num_vertices();
 	vector<Vertex*> vVrts(numVrts);
@@ -551,7 +577,7 @@ void Grid::flip_orientation(Face* f)
 		f->set_vertex(i, vVrts[numVrts - 1 - i]);
 
 //	update associated edge list
-	if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES)){
+	if(option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES)){
 		m_aaEdgeContainerFACE[f].clear();
 		EdgeDescriptor ed;
 		for(size_t ind = 0; ind < f->num_edges(); ++ind){
@@ -567,6 +593,9 @@ void Grid::flip_orientation(Face* f)
 
 void Grid::flip_orientation(Volume* vol)
 {
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	flips the orientation of volumes
 //	get the descriptor for the flipped volume
 	VolumeDescriptor vd;
@@ -578,7 +607,7 @@ void Grid::flip_orientation(Volume* vol)
 		vol->set_vertex(i, vd.vertex(i));
 
 //	update associated edge list
-	if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES)){
+	if(option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES)){
 		m_aaEdgeContainerVOLUME[vol].clear();
 		EdgeDescriptor ed;
 		for(size_t ind = 0; ind < vol->num_edges(); ++ind){
@@ -592,7 +621,7 @@ void Grid::flip_orientation(Volume* vol)
 	}
 
 //	update associated face list
-	if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES)){
+	if(option_is_active(VOLOPT_STORE_ASSOCIATED_FACES)){
 		m_aaFaceContainerVOLUME[vol].clear();
 		FaceDescriptor fd;
 		for(size_t ind = 0; ind < vol->num_faces(); ++ind){
@@ -700,27 +729,49 @@ void Grid::pass_on_values(Volume* objSrc, Volume* objDest)
 //	options
 void Grid::set_options(uint options)
 {
+	if(options == get_options())
+		return;
+
+	thaw_adjacency();
 	change_options(options);
 }
 
 uint Grid::get_options() const
 {
-	return m_options;
+	return m_options | m_frozenOptions;
 }
 
 void Grid::enable_options(uint options)
 {
+	if(option_is_enabled(options))
+		return;
+
+//	the snapshot holds all associations, independent of the enabled options.
+//	Further STORE_ASSOCIATED options thus don't require a thaw, their
+//	containers are built as soon as the grid thaws.
+	if(adjacency_is_frozen()
+	   && ((options & (~STORE_ASSOCIATED_OPTIONS)) & (~m_options)) == 0)
+	{
+		m_frozenOptions |= (options & STORE_ASSOCIATED_OPTIONS);
+		return;
+	}
+
+	thaw_adjacency();
 	change_options(m_options | options);
 }
 
 void Grid::disable_options(uint options)
 {
+	if((get_options() & options) == 0)
+		return;
+
+	thaw_adjacency();
 	change_options(m_options & (~options));
 }
 
 bool Grid::option_is_enabled(uint option) const
 {
-	return (m_options & option) == option;
+	return (get_options() & option) == option;
 }
 
 void Grid::change_options(uint optsNew)
@@ -731,6 +782,43 @@ void Grid::change_options(uint optsNew)
 	change_volume_options(optsNew &	0xFF000000);
 	assert((m_options == optsNew) && "Grid::change_options failed");
 }
+
+
+void Grid::freeze_adjacency()
+{
+	if(m_pAdjacencySnapshot)
+		return;
+
+	GRID_PROFILE_FUNC();
+
+//	the snapshot has to be in place before the containers are released,
+//	since queries are redirected to it from now on.
+	m_pAdjacencySnapshot = new GridAdjacencySnapshot(*this);
+	m_frozenOptions = m_options & STORE_ASSOCIATED_OPTIONS;
+	change_options(m_options & (~STORE_ASSOCIATED_OPTIONS));
+}
+
+void Grid::thaw_adjacency()
+{
+	if(!m_pAdjacencySnapshot)
+		return;
+
+	GRID_PROFILE_FUNC();
+
+	uint frozenOpts = discard_adjacency_snapshot();
+	change_options(m_options | frozenOpts);
+}
+
+uint Grid::discard_adjacency_snapshot()
+{
+	uint frozenOpts = m_frozenOptions;
+	if(m_pAdjacencySnapshot){
+		delete m_pAdjacencySnapshot;
+		m_pAdjacencySnapshot = NULL;
+	}
+	m_frozenOptions = 0;
+	return frozenOpts;
+}
 /*
 void Grid::register_observer(GridObserver* observer, uint observerType)
 {
@@ -881,7 +969,10 @@ void Grid::unregister_observer(GridObserver* observer)
 //	associated edge access
 Grid::AssociatedEdgeIterator Grid::associated_edges_begin(Vertex* vrt)
 {
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_edges_begin(vrt);
+
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 	{
 		LOG("WARNING in associated_edges_begin(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_EDGES." << endl);
 		vertex_store_associated_edges(true);
@@ -891,7 +982,10 @@ Grid::AssociatedEdgeIterator Grid::associated_edges_begin(Vertex* vrt)
 
 Grid::AssociatedEdgeIterator Grid::associated_edges_end(Vertex* vrt)
 {
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_edges_end(vrt);
+
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 	{
 		LOG("WARNING in associated_edges_end(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_EDGES." << endl);
 		vertex_store_associated_edges(true);
@@ -901,7 +995,10 @@ Grid::AssociatedEdgeIterator Grid::associated_edges_end(Vertex* vrt)
 
 Grid::AssociatedEdgeIterator Grid::associated_edges_begin(Face* face)
 {
-	if(!option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_edges_begin(face);
+
+	if(!option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 	{
 		LOG("WARNING in associated_edges_begin(face): auto-enabling FACEOPT_STORE_ASSOCIATED_EDGES." << endl);
 		face_store_associated_edges(true);
@@ -911,7 +1008,10 @@ Grid::AssociatedEdgeIterator Grid::associated_edges_begin(Face* face)
 
 Grid::AssociatedEdgeIterator Grid::associated_edges_end(Face* face)
 {
-	if(!option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_edges_end(face);
+
+	if(!option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 	{
 		LOG("WARNING in associated_edges_end(face): auto-enabling FACEOPT_STORE_ASSOCIATED_EDGES." << endl);
 		face_store_associated_edges(true);
@@ -921,7 +1021,10 @@ Grid::AssociatedEdgeIterator Grid::associated_edges_end(Face* face)
 
 Grid::AssociatedEdgeIterator Grid::associated_edges_begin(Volume* vol)
 {
-	if(!option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_edges_begin(vol);
+
+	if(!option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 	{
 		LOG("WARNING in associated_edges_begin(vol): auto-enabling VOLOPT_STORE_ASSOCIATED_EDGES." << endl);
 		volume_store_associated_edges(true);
@@ -931,7 +1034,10 @@ Grid::AssociatedEdgeIterator Grid::associated_edges_begin(Volume* vol)
 
 Grid::AssociatedEdgeIterator Grid::associated_edges_end(Volume* vol)
 {
-	if(!option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_edges_end(vol);
+
+	if(!option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 	{
 		LOG("WARNING in associated_edges_end(vol): auto-enabling VOLOPT_STORE_ASSOCIATED_EDGES." << endl);
 		volume_store_associated_edges(true);
@@ -943,7 +1049,10 @@ Grid::AssociatedEdgeIterator Grid::associated_edges_end(Volume* vol)
 //	associated face access
 Grid::AssociatedFaceIterator Grid::associated_faces_begin(Vertex* vrt)
 {
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_faces_begin(vrt);
+
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 	{
 		LOG("WARNING in associated_faces_begin(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_FACES." << endl);
 		vertex_store_associated_faces(true);
@@ -953,7 +1062,10 @@ Grid::AssociatedFaceIterator Grid::associated_faces_begin(Vertex* vrt)
 
 Grid::AssociatedFaceIterator Grid::associated_faces_end(Vertex* vrt)
 {
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_faces_end(vrt);
+
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 	{
 		LOG("WARNING in associated_faces_end(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_FACES." << endl);
 		vertex_store_associated_faces(true);
@@ -963,7 +1075,10 @@ Grid::AssociatedFaceIterator Grid::associated_faces_end(Vertex* vrt)
 
 Grid::AssociatedFaceIterator Grid::associated_faces_begin(Edge* edge)
 {
-	if(!option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_faces_begin(edge);
+
+	if(!option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 	{
 		LOG("WARNING in associated_faces_begin(edge): auto-enabling EDGEOPT_STORE_ASSOCIATED_FACES." << endl);
 		edge_store_associated_faces(true);
@@ -973,7 +1088,10 @@ Grid::AssociatedFaceIterator Grid::associated_faces_begin(Edge* edge)
 
 Grid::AssociatedFaceIterator Grid::associated_faces_end(Edge* edge)
 {
-	if(!option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_faces_end(edge);
+
+	if(!option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 	{
 		LOG("WARNING in associated_faces_end(edge): auto-enabling EDGEOPT_STORE_ASSOCIATED_FACES." << endl);
 		edge_store_associated_faces(true);
@@ -983,7 +1101,10 @@ Grid::AssociatedFaceIterator Grid::associated_faces_end(Edge* edge)
 
 Grid::AssociatedFaceIterator Grid::associated_faces_begin(Volume* vol)
 {
-	if(!option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_faces_begin(vol);
+
+	if(!option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 	{
 		LOG("WARNING in associated_faces_begin(vol): auto-enabling VOLOPT_STORE_ASSOCIATED_FACES." << endl);
 		volume_store_associated_faces(true);
@@ -993,7 +1114,10 @@ Grid::AssociatedFaceIterator Grid::associated_faces_begin(Volume* vol)
 
 Grid::AssociatedFaceIterator Grid::associated_faces_end(Volume* vol)
 {
-	if(!option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_faces_end(vol);
+
+	if(!option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 	{
 		LOG("WARNING in associated_faces_end(vol): auto-enabling VOLOPT_STORE_ASSOCIATED_FACES." << endl);
 		volume_store_associated_faces(true);
@@ -1005,7 +1129,10 @@ Grid::AssociatedFaceIterator Grid::associated_faces_end(Volume* vol)
 //	associated volume access
 Grid::AssociatedVolumeIterator Grid::associated_volumes_begin(Vertex* vrt)
 {
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_volumes_begin(vrt);
+
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		LOG("WARNING in associated_volumes_begin(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_VOLUMES." << endl);
 		vertex_store_associated_volumes(true);
@@ -1015,7 +1142,10 @@ Grid::AssociatedVolumeIterator Grid::associated_volumes_begin(Vertex* vrt)
 
 Grid::AssociatedVolumeIterator Grid::associated_volumes_end(Vertex* vrt)
 {
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_volumes_end(vrt);
+
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		LOG("WARNING in associated_volumes_end(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_VOLUMES." << endl);
 		vertex_store_associated_volumes(true);
@@ -1025,7 +1155,10 @@ Grid::AssociatedVolumeIterator Grid::associated_volumes_end(Vertex* vrt)
 
 Grid::AssociatedVolumeIterator Grid::associated_volumes_begin(Edge* edge)
 {
-	if(!option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_volumes_begin(edge);
+
+	if(!option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		LOG("WARNING in associated_volumes_begin(edge): auto-enabling EDGEOPT_STORE_ASSOCIATED_VOLUMES." << endl);
 		edge_store_associated_volumes(true);
@@ -1035,7 +1168,10 @@ Grid::AssociatedVolumeIterator Grid::associated_volumes_begin(Edge* edge)
 
 Grid::AssociatedVolumeIterator Grid::associated_volumes_end(Edge* edge)
 {
-	if(!option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_volumes_end(edge);
+
+	if(!option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		LOG("WARNING in associated_volumes_end(edge): auto-enabling EDGEOPT_STORE_ASSOCIATED_VOLUMES." << endl);
 		edge_store_associated_volumes(true);
@@ -1045,7 +1181,10 @@ Grid::AssociatedVolumeIterator Grid::associated_volumes_end(Edge* edge)
 
 Grid::AssociatedVolumeIterator Grid::associated_volumes_begin(Face* face)
 {
-	if(!option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_volumes_begin(face);
+
+	if(!option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		LOG("WARNING in associated_volumes_begin(face): auto-enabling FACEOPT_STORE_ASSOCIATED_VOLUMES." << endl);
 		face_store_associated_volumes(true);
@@ -1055,7 +1194,10 @@ Grid::AssociatedVolumeIterator Grid::associated_volumes_begin(Face* face)
 
 Grid::AssociatedVolumeIterator Grid::associated_volumes_end(Face* face)
 {
-	if(!option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+	if(m_pAdjacencySnapshot)
+		return m_pAdjacencySnapshot->associated_volumes_end(face);
+
+	if(!option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		LOG("WARNING in associated_volumes_end(face): auto-enabling FACEOPT_STORE_ASSOCIATED_VOLUMES." << endl);
 		face_store_associated_volumes(true);
@@ -1080,9 +1222,9 @@ Edge* Grid::get_edge(const EdgeVertices& ev)
 Edge* Grid::get_edge(Face* f, int ind)
 {
 //	check whether the face stores associated edges
-	if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 	{
-		if(option_is_enabled(FACEOPT_AUTOGENERATE_EDGES))
+		if(option_is_active(FACEOPT_AUTOGENERATE_EDGES))
 			return m_aaEdgeContainerFACE[f][ind];
 		else{
 			EdgeDescriptor ed;
@@ -1105,11 +1247,11 @@ Edge* Grid::get_edge(Face* f, int ind)
 Edge* Grid::get_edge(Volume* v, int ind)
 {
 //	check whether the face stores associated edges
-	if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 	{
 	//	if autogenerate is enabeld, edges are sorted.
-		if(option_is_enabled(VOLOPT_AUTOGENERATE_EDGES)
-			|| option_is_enabled(VOLOPT_AUTOGENERATE_FACES
+		if(option_is_active(VOLOPT_AUTOGENERATE_EDGES)
+			|| option_is_active(VOLOPT_AUTOGENERATE_FACES
 								| FACEOPT_AUTOGENERATE_EDGES))
 		{
 			return m_aaEdgeContainerVOLUME[v][ind];
@@ -1140,10 +1282,10 @@ Face* Grid::get_face(const FaceVertices& fv)
 Face* Grid::get_face(Volume* v, int ind)
 {
 //	check whether the volume stores associated faces
-	if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+	if(option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 	{
 	//	if autogenerate is enabeld, faces are sorted.
-		if(option_is_enabled(VOLOPT_AUTOGENERATE_FACES))
+		if(option_is_active(VOLOPT_AUTOGENERATE_FACES))
 			return m_aaFaceContainerVOLUME[v][ind];
 		else{
 			FaceDescriptor fd;
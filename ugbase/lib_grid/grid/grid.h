@@ -72,6 +72,10 @@ class DistributedGridManager;
 //	"lib_grid/tools/periodic_boundary_identifier.h"
 class PeriodicBoundaryManager;
 
+//	predeclaration of the adjacency snapshot, which is used while the
+//	adjacency of a grid is frozen. Defined in "grid_adjacency_snapshot.h"
+class GridAdjacencySnapshot;
+
 /**
  * \brief Grid, MultiGrid and GridObjectCollection are contained in this group
  * \defgroup lib_grid_grid grid
@@ -294,6 +298,47 @@ class UG_API Grid
 		void disable_options(uint options);	///< see set_options for a description of valid parameters.
 		bool option_is_enabled(uint option) const;///< see set_options for a description of valid parameters.
 
+	////////////////////////////////////////////////
+	//	frozen adjacency
+	///	replaces the associated element containers by a compact adjacency snapshot
+	/**	During phases in which the topology of the grid does not change, the
+	 * per-element containers of associated elements (cf. VRTOPT_STORE_ASSOCIATED_EDGES
+	 * and related options) may be replaced by a GridAdjacencySnapshot, which
+	 * stores all associations in contiguous arrays. The containers are released,
+	 * all queries for associated elements are answered from the snapshot.
+	 *
+	 * While the adjacency is frozen, option_is_enabled and get_options still
+	 * report the frozen STORE_ASSOCIATED options.
+	 *
+	 * The grid thaws automatically (i.e. rebuilds the containers of the stored
+	 * options) before elements are created or erased and before options are
+	 * changed. Enabling options which are already enabled or further
+	 * STORE_ASSOCIATED options does not thaw the grid.*/
+		void freeze_adjacency();
+
+	///	rebuilds the containers of associated elements which were released by freeze_adjacency
+		void thaw_adjacency();
+
+	///	returns true if the adjacency of the grid is currently frozen.
+		inline bool adjacency_is_frozen() const	{return m_pAdjacencySnapshot != NULL;}
+
+	////////////////////////////////////////////////
+	//	element order
+	///	changes the order in which elements are stored and iterated
+	/**	vNewOrder has to contain each element of the sections it touches
+	 * (cf. GridObject::container_section) exactly once. For TElem = Vertex, Edge,
+	 * Face or Volume this usually means all elements of that type. Elements of
+	 * untouched sections keep their order.
+	 *
+	 * The attached data is rearranged accordingly, so that iterating over the
+	 * elements afterwards also traverses their attachment data consecutively.
+	 * Elements are neither created nor erased, no observers are notified.
+	 *
+	 * Element lists of subset handlers and other observers are not affected.
+	 * \sa ReorderSectionContainer, GridSubsetHandler::reorder_elements*/
+		template <class TElem>
+		void reorder_elements(const std::vector<TElem*>& vNewOrder);
+
 	////////////////////////////////////////////////
 	//	parallelism
 	///	tell the grid whether it will be used in a serial or in a parallel environment.
@@ -1008,6 +1053,11 @@ class UG_API Grid
 
 		void change_options(uint optsNew);
 
+	///	returns true if the given options are enabled and not frozen.
+	/**	Other than option_is_enabled, this reflects whether the containers
+	 * of associated elements currently exist.*/
+		inline bool option_is_active(uint option) const	{return (m_options & option) == option;}
+
 		void change_vertex_options(uint optsNew);
 		void change_edge_options(uint optsNew);
 		void change_face_options(uint optsNew);
@@ -1104,6 +1154,10 @@ class UG_API Grid
 		void copy_user_attachments(const TAttachmentPipe& apSrc, TAttachmentPipe& apDest,
 									std::vector<int>& srcDataIndices);
 
+	///	deletes the adjacency snapshot without restoring the frozen options
+	/**	returns the options which were frozen.*/
+		uint discard_adjacency_snapshot();
+
 	//	marks
 		void init_marks();
 		void reset_marks();
@@ -1198,6 +1252,10 @@ class UG_API Grid
 		SPMessageHub 							m_messageHub;
 		DistributedGridManager*		m_distGridMgr;
 		PeriodicBoundaryManager*	m_periodicBndMgr;
+
+	//	frozen adjacency
+		GridAdjacencySnapshot*		m_pAdjacencySnapshot;
+		uint						m_frozenOptions;
 };
 
 /** \} */
@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "grid_adjacency_snapshot.h"
+#include "grid_util.h"
+#include "common/profiler/profiler.h"
+
+namespace ug
+{
+
+GridAdjacencySnapshot::
+GridAdjacencySnapshot() :
+	m_pGrid(NULL),
+	m_bValid(false),
+	m_aIndex("GridAdjacencySnapshot_Index", false)
+{
+}
+
+GridAdjacencySnapshot::
+GridAdjacencySnapshot(Grid& grid) :
+	m_pGrid(NULL),
+	m_bValid(false),
+	m_aIndex("GridAdjacencySnapshot_Index", false)
+{
+	build(grid);
+}
+
+GridAdjacencySnapshot::
+~GridAdjacencySnapshot()
+{
+	clear();
+}
+
+void GridAdjacencySnapshot::
+clear()
+{
+	if(m_pGrid){
+		m_pGrid->unregister_observer(this);
+		m_pGrid->detach_from_all(m_aIndex);
+		m_pGrid = NULL;
+	}
+
+	m_aaIndVRT.invalidate();
+	m_aaIndEDGE.invalidate();
+	m_aaIndFACE.invalidate();
+	m_aaIndVOL.invalidate();
+
+	m_vrtEdges.clear();
+	m_vrtFaces.clear();
+	m_vrtVols.clear();
+	m_edgeFaces.clear();
+	m_edgeVols.clear();
+	m_faceEdges.clear();
+	m_faceVols.clear();
+	m_volEdges.clear();
+	m_volFaces.clear();
+	m_bValid = false;
+}
+
+void GridAdjacencySnapshot::
+invalidate()
+{
+	m_bValid = false;
+}
+
+size_t GridAdjacencySnapshot::
+memory_consumption() const
+{
+	return	m_vrtEdges.memory_consumption() + m_vrtFaces.memory_consumption()
+		  + m_vrtVols.memory_consumption() + m_edgeFaces.memory_consumption()
+		  + m_edgeVols.memory_consumption() + m_faceEdges.memory_consumption()
+		  + m_faceVols.memory_consumption() + m_volEdges.memory_consumption()
+		  + m_volFaces.memory_consumption();
+}
+
+template <class TElem>
+void GridAdjacencySnapshot::
+collect_vertex_rows(Adjacency<TElem>& adjOut)
+{
+	typedef typename geometry_traits<TElem>::iterator	iter_t;
+	Grid& g = *m_pGrid;
+
+//	count the elements at each vertex
+	std::vector<uint>& offsets = adjOut.m_offsets;
+	offsets.assign(g.num<Vertex>() + 1, 0);
+	for(iter_t iter = g.begin<TElem>(); iter != g.end<TElem>(); ++iter){
+		TElem* e = *iter;
+		for(size_t i = 0; i < e->num_vertices(); ++i)
+			++offsets[m_aaIndVRT[e->vertex(i)] + 1];
+	}
+
+	for(size_t i = 1; i < offsets.size(); ++i)
+		offsets[i] += offsets[i - 1];
+
+//	fill the rows. Elements are added in the order of the element storage.
+	adjOut.m_elems.resize(offsets.back());
+	std::vector<uint> fill(offsets.begin(), offsets.end() - 1);
+	for(iter_t iter = g.begin<TElem>(); iter != g.end<TElem>(); ++iter){
+		TElem* e = *iter;
+		for(size_t i = 0; i < e->num_vertices(); ++i)
+			adjOut.m_elems[fill[m_aaIndVRT[e->vertex(i)]]++] = e;
+	}
+}
+
+template <class TElem>
+void GridAdjacencySnapshot::
+collect_edge_rows(Adjacency<Edge>& adjOut)
+{
+	typedef typename geometry_traits<TElem>::iterator	iter_t;
+	Grid& g = *m_pGrid;
+
+	std::vector<uint>& offsets = adjOut.m_offsets;
+	offsets.clear();
+	offsets.reserve(g.num<TElem>() + 1);
+	adjOut.m_elems.clear();
+
+	EdgeDescriptor ed;
+	for(iter_t iter = g.begin<TElem>(); iter != g.end<TElem>(); ++iter){
+		TElem* elem = *iter;
+		offsets.push_back(adjOut.m_elems.size());
+		for(size_t i = 0; i < elem->num_edges(); ++i){
+			elem->edge_desc(i, ed);
+		//	the edge is contained in the row of its first vertex
+			int vrtRow = m_aaIndVRT[ed.vertex(0)];
+			for(AssociatedEdgeIterator eIter = m_vrtEdges.begin(vrtRow);
+				eIter != m_vrtEdges.end(vrtRow); ++eIter)
+			{
+				if(CompareVertices(*eIter, &ed)){
+					adjOut.m_elems.push_back(*eIter);
+					break;
+				}
+			}
+		}
+	}
+	offsets.push_back(adjOut.m_elems.size());
+}
+
+void GridAdjacencySnapshot::
+collect_volume_face_rows(Adjacency<Face>& adjOut)
+{
+	Grid& g = *m_pGrid;
+
+	std::vector<uint>& offsets = adjOut.m_offsets;
+	offsets.clear();
+	offsets.reserve(g.num<Volume>() + 1);
+	adjOut.m_elems.clear();
+
+	FaceDescriptor fd;
+	for(VolumeIterator iter = g.begin<Volume>(); iter != g.end<Volume>(); ++iter){
+		Volume* vol = *iter;
+		offsets.push_back(adjOut.m_elems.size());
+		for(size_t i = 0; i < vol->num_faces(); ++i){
+			vol->face_desc(i, fd);
+		//	the face is contained in the row of its first vertex
+			int vrtRow = m_aaIndVRT[fd.vertex(0)];
+			for(AssociatedFaceIterator fIter = m_vrtFaces.begin(vrtRow);
+				fIter != m_vrtFaces.end(vrtRow); ++fIter)
+			{
+				if(CompareVertices(*fIter, &fd)){
+					adjOut.m_elems.push_back(*fIter);
+					break;
+				}
+			}
+		}
+	}
+	offsets.push_back(adjOut.m_elems.size());
+}
+
+template <class TSrc, class TDst>
+void GridAdjacencySnapshot::
+collect_transposed(Adjacency<TSrc>& adjOut, const Adjacency<TDst>& adjIn)
+{
+	typedef typename geometry_traits<TSrc>::iterator	iter_t;
+	Grid& g = *m_pGrid;
+
+	std::vector<uint>& offsets = adjOut.m_offsets;
+	offsets.assign(g.num<TDst>() + 1, 0);
+	for(size_t i = 0; i < adjIn.m_elems.size(); ++i)
+		++offsets[row(adjIn.m_elems[i]) + 1];
+
+	for(size_t i = 1; i < offsets.size(); ++i)
+		offsets[i] += offsets[i - 1];
+
+//	rows of adjIn are ordered like the element storage of TSrc
+	adjOut.m_elems.resize(offsets.back());
+	std::vector<uint> fill(offsets.begin(), offsets.end() - 1);
+	int srcRow = 0;
+	for(iter_t iter = g.begin<TSrc>(); iter != g.end<TSrc>(); ++iter, ++srcRow){
+		for(uint i = adjIn.m_offsets[srcRow]; i < adjIn.m_offsets[srcRow + 1]; ++i)
+			adjOut.m_elems[fill[row(adjIn.m_elems[i])]++] = *iter;
+	}
+}
+
+void GridAdjacencySnapshot::
+build(Grid& grid)
+{
+	PROFILE_FUNC_GROUP("grid");
+
+	clear();
+
+	m_pGrid = &grid;
+	grid.attach_to_all(m_aIndex, false);
+	m_aaIndVRT.access(grid, m_aIndex);
+	m_aaIndEDGE.access(grid, m_aIndex);
+	m_aaIndFACE.access(grid, m_aIndex);
+	m_aaIndVOL.access(grid, m_aIndex);
+
+//	rows are numbered in the order of the element storage
+	int ind = 0;
+	for(VertexIterator iter = grid.begin<Vertex>(); iter != grid.end<Vertex>(); ++iter)
+		m_aaIndVRT[*iter] = ind++;
+	ind = 0;
+	for(EdgeIterator iter = grid.begin<Edge>(); iter != grid.end<Edge>(); ++iter)
+		m_aaIndEDGE[*iter] = ind++;
+	ind = 0;
+	for(FaceIterator iter = grid.begin<Face>(); iter != grid.end<Face>(); ++iter)
+		m_aaIndFACE[*iter] = ind++;
+	ind = 0;
+	for(VolumeIterator iter = grid.begin<Volume>(); iter != grid.end<Volume>(); ++iter)
+		m_aaIndVOL[*iter] = ind++;
+
+//	row() asserts validity
+	m_bValid = true;
+
+//	upward associations of vertices
+	collect_vertex_rows(m_vrtEdges);
+	collect_vertex_rows(m_vrtFaces);
+	collect_vertex_rows(m_vrtVols);
+
+//	downward associations. Those are found through the vertex rows.
+	collect_edge_rows<Face>(m_faceEdges);
+	collect_edge_rows<Volume>(m_volEdges);
+	collect_volume_face_rows(m_volFaces);
+
+//	the remaining upward associations are the transposed downward ones
+	collect_transposed(m_edgeFaces, m_faceEdges);
+	collect_transposed(m_edgeVols, m_volEdges);
+	collect_transposed(m_faceVols, m_volFaces);
+
+	grid.register_observer(this, OT_FULL_OBSERVER);
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	grid observer callbacks
+void GridAdjacencySnapshot::
+grid_to_be_destroyed(Grid* grid)
+{
+//	the grid clears its observer lists itself
+	m_pGrid = NULL;
+	clear();
+}
+
+void GridAdjacencySnapshot::
+elements_to_be_cleared(Grid* grid)
+{
+	invalidate();
+}
+
+void GridAdjacencySnapshot::
+vertex_created(Grid* grid, Vertex* vrt, GridObject* pParent, bool replacesParent)
+{
+	invalidate();
+}
+
+void GridAdjacencySnapshot::
+edge_created(Grid* grid, Edge* e, GridObject* pParent, bool replacesParent)
+{
+	invalidate();
+}
+
+void GridAdjacencySnapshot::
+face_created(Grid* grid, Face* f, GridObject* pParent, bool replacesParent)
+{
+	invalidate();
+}
+
+void GridAdjacencySnapshot::
+volume_created(Grid* grid, Volume* vol, GridObject* pParent, bool replacesParent)
+{
+	invalidate();
+}
+
+void GridAdjacencySnapshot::
+vertex_to_be_erased(Grid* grid, Vertex* vrt, Vertex* replacedBy)
+{
+	invalidate();
+}
+
+void GridAdjacencySnapshot::
+edge_to_be_erased(Grid* grid, Edge* e, Edge* replacedBy)
+{
+	invalidate();
+}
+
+void GridAdjacencySnapshot::
+face_to_be_erased(Grid* grid, Face* f, Face* replacedBy)
+{
+	invalidate();
+}
+
+void GridAdjacencySnapshot::
+volume_to_be_erased(Grid* grid, Volume* vol, Volume* replacedBy)
+{
+	invalidate();
+}
+
+}//	end of namespace
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_GRID__GRID_ADJACENCY_SNAPSHOT__
+#define __H__UG__LIB_GRID__GRID_ADJACENCY_SNAPSHOT__
+
+#include <vector>
+#include "grid.h"
+
+namespace ug
+{
+
+///	Compact, read-only copy of the associations between the elements of a grid
+/**	The grid itself stores associated elements in a std::vector per element
+ * (cf. GRIDOPT_VERTEXCENTRIC_INTERCONNECTION and related options). During
+ * phases in which the topology does not change (assembly, smoothing, error
+ * estimation, ...) those associations may instead be collected in one pass
+ * into contiguous arrays in compressed row storage. Queries then touch only
+ * two arrays and neighboring elements are found next to each other in memory.
+ *
+ * All associations between vertices, edges, faces and volumes are stored,
+ * independent of the options enabled at the grid. Associated lower dimensional
+ * elements of an edge, face or volume are stored in the order of their local
+ * indices, i.e. as returned by Grid::associated_elements_sorted.
+ *
+ * The snapshot registers itself as an observer at the grid. As soon as an
+ * element is created or erased, the snapshot becomes invalid and may not be
+ * queried until it was rebuilt through build.
+ *
+ * The query methods mirror those of Grid, i.e. associated_elements and
+ * the associated_..._begin / associated_..._end iterator pairs.
+ *
+ * \sa Grid::freeze_adjacency
+ */
+class UG_API GridAdjacencySnapshot : public GridObserver
+{
+	public:
+		typedef Grid::AssociatedEdgeIterator	AssociatedEdgeIterator;
+		typedef Grid::AssociatedFaceIterator	AssociatedFaceIterator;
+		typedef Grid::AssociatedVolumeIterator	AssociatedVolumeIterator;
+
+	public:
+		GridAdjacencySnapshot();
+		GridAdjacencySnapshot(Grid& grid);
+		virtual ~GridAdjacencySnapshot();
+
+	///	collects all associations of the given grid
+	/**	If the snapshot was built for another grid before, it is released first.*/
+		void build(Grid& grid);
+
+	///	releases all memory and unregisters from the grid
+		void clear();
+
+	///	returns true if the snapshot reflects the current topology of its grid
+		inline bool is_valid() const	{return m_bValid;}
+
+	///	returns the grid for which the snapshot was built (may be NULL)
+		inline Grid* grid() const		{return m_pGrid;}
+
+	///	returns the number of bytes occupied by the association arrays
+		size_t memory_consumption() const;
+
+	///	puts all elements of type TAss which are contained in 'e' or which contain 'e' into elemsOut
+	/**	\sa Grid::associated_elements
+	 * \{ */
+		template <class TElem>
+		void associated_elements(Grid::SecureVertexContainer& elemsOut, TElem* e)	{get_associated(elemsOut, e);}
+		template <class TElem>
+		void associated_elements(Grid::SecureEdgeContainer& elemsOut, TElem* e)		{get_associated(elemsOut, e);}
+		template <class TElem>
+		void associated_elements(Grid::SecureFaceContainer& elemsOut, TElem* e)		{get_associated(elemsOut, e);}
+		template <class TElem>
+		void associated_elements(Grid::SecureVolumeContainer& elemsOut, TElem* e)	{get_associated(elemsOut, e);}
+	/** \} */
+
+	///	iterators over associated elements
+	/** \{ */
+		inline AssociatedEdgeIterator associated_edges_begin(Vertex* vrt)		{return m_vrtEdges.begin(row(vrt));}
+		inline AssociatedEdgeIterator associated_edges_end(Vertex* vrt)			{return m_vrtEdges.end(row(vrt));}
+		inline AssociatedEdgeIterator associated_edges_begin(Face* f)			{return m_faceEdges.begin(row(f));}
+		inline AssociatedEdgeIterator associated_edges_end(Face* f)				{return m_faceEdges.end(row(f));}
+		inline AssociatedEdgeIterator associated_edges_begin(Volume* vol)		{return m_volEdges.begin(row(vol));}
+		inline AssociatedEdgeIterator associated_edges_end(Volume* vol)			{return m_volEdges.end(row(vol));}
+
+		inline AssociatedFaceIterator associated_faces_begin(Vertex* vrt)		{return m_vrtFaces.begin(row(vrt));}
+		inline AssociatedFaceIterator associated_faces_end(Vertex* vrt)			{return m_vrtFaces.end(row(vrt));}
+		inline AssociatedFaceIterator associated_faces_begin(Edge* e)			{return m_edgeFaces.begin(row(e));}
+		inline AssociatedFaceIterator associated_faces_end(Edge* e)				{return m_edgeFaces.end(row(e));}
+		inline AssociatedFaceIterator associated_faces_begin(Volume* vol)		{return m_volFaces.begin(row(vol));}
+		inline AssociatedFaceIterator associated_faces_end(Volume* vol)			{return m_volFaces.end(row(vol));}
+
+		inline AssociatedVolumeIterator associated_volumes_begin(Vertex* vrt)	{return m_vrtVols.begin(row(vrt));}
+		inline AssociatedVolumeIterator associated_volumes_end(Vertex* vrt)		{return m_vrtVols.end(row(vrt));}
+		inline AssociatedVolumeIterator associated_volumes_begin(Edge* e)		{return m_edgeVols.begin(row(e));}
+		inline AssociatedVolumeIterator associated_volumes_end(Edge* e)			{return m_edgeVols.end(row(e));}
+		inline AssociatedVolumeIterator associated_volumes_begin(Face* f)		{return m_faceVols.begin(row(f));}
+		inline AssociatedVolumeIterator associated_volumes_end(Face* f)			{return m_faceVols.end(row(f));}
+	/** \} */
+
+	///	number of associated elements of the given type
+	/** \{ */
+		inline size_t num_associated_edges(Vertex* vrt) const		{return m_vrtEdges.size(row(vrt));}
+		inline size_t num_associated_edges(Face* f) const			{return m_faceEdges.size(row(f));}
+		inline size_t num_associated_edges(Volume* vol) const		{return m_volEdges.size(row(vol));}
+		inline size_t num_associated_faces(Vertex* vrt) const		{return m_vrtFaces.size(row(vrt));}
+		inline size_t num_associated_faces(Edge* e) const			{return m_edgeFaces.size(row(e));}
+		inline size_t num_associated_faces(Volume* vol) const		{return m_volFaces.size(row(vol));}
+		inline size_t num_associated_volumes(Vertex* vrt) const		{return m_vrtVols.size(row(vrt));}
+		inline size_t num_associated_volumes(Edge* e) const			{return m_edgeVols.size(row(e));}
+		inline size_t num_associated_volumes(Face* f) const			{return m_faceVols.size(row(f));}
+	/** \} */
+
+	//	grid observer callbacks. All of them invalidate the snapshot.
+		virtual void grid_to_be_destroyed(Grid* grid);
+		virtual void elements_to_be_cleared(Grid* grid);
+
+		virtual void vertex_created(Grid* grid, Vertex* vrt, GridObject* pParent, bool replacesParent);
+		virtual void edge_created(Grid* grid, Edge* e, GridObject* pParent, bool replacesParent);
+		virtual void face_created(Grid* grid, Face* f, GridObject* pParent, bool replacesParent);
+		virtual void volume_created(Grid* grid, Volume* vol, GridObject* pParent, bool replacesParent);
+
+		virtual void vertex_to_be_erased(Grid* grid, Vertex* vrt, Vertex* replacedBy);
+		virtual void edge_to_be_erased(Grid* grid, Edge* e, Edge* replacedBy);
+		virtual void face_to_be_erased(Grid* grid, Face* f, Face* replacedBy);
+		virtual void volume_to_be_erased(Grid* grid, Volume* vol, Volume* replacedBy);
+
+	protected:
+	///	associations of one element type to elements of type TAss in compressed row storage
+		template <class TAss>
+		struct Adjacency
+		{
+			typedef typename std::vector<TAss*>::iterator	iterator;
+
+			inline iterator begin(int row)		{return m_elems.begin() + m_offsets[row];}
+			inline iterator end(int row)		{return m_elems.begin() + m_offsets[row + 1];}
+			inline TAss* const* ptr(int row) const	{return &m_elems.front() + m_offsets[row];}
+			inline size_t size(int row) const	{return m_offsets[row + 1] - m_offsets[row];}
+
+			void clear()
+			{
+				std::vector<uint>().swap(m_offsets);
+				std::vector<TAss*>().swap(m_elems);
+			}
+
+			size_t memory_consumption() const
+			{
+				return m_offsets.capacity() * sizeof(uint)
+					 + m_elems.capacity() * sizeof(TAss*);
+			}
+
+			std::vector<uint>	m_offsets;
+			std::vector<TAss*>	m_elems;
+		};
+
+		typedef Attachment<int>	AIndex;
+
+	protected:
+		inline int row(Vertex* vrt) const		{UG_ASSERT(m_bValid, "Invalid adjacency snapshot."); return m_aaIndVRT[vrt];}
+		inline int row(Edge* e) const			{UG_ASSERT(m_bValid, "Invalid adjacency snapshot."); return m_aaIndEDGE[e];}
+		inline int row(Face* f) const			{UG_ASSERT(m_bValid, "Invalid adjacency snapshot."); return m_aaIndFACE[f];}
+		inline int row(Volume* vol) const		{UG_ASSERT(m_bValid, "Invalid adjacency snapshot."); return m_aaIndVOL[vol];}
+
+		template <class TAss>
+		static void set_row(typename Grid::traits<TAss>::secure_container& elemsOut,
+							const Adjacency<TAss>& adj, int row)
+		{
+			if(adj.size(row) == 0)
+				elemsOut.clear();
+			else
+				elemsOut.set_external_array(adj.ptr(row), adj.size(row));
+		}
+
+		void get_associated(Grid::SecureVertexContainer& vrts, Edge* e)		{vrts.set_external_array(e->vertices(), e->num_vertices());}
+		void get_associated(Grid::SecureVertexContainer& vrts, Face* f)		{vrts.set_external_array(f->vertices(), f->num_vertices());}
+		void get_associated(Grid::SecureVertexContainer& vrts, Volume* v)	{vrts.set_external_array(v->vertices(), v->num_vertices());}
+
+		void get_associated(Grid::SecureEdgeContainer& edges, Vertex* v)	{set_row(edges, m_vrtEdges, row(v));}
+		void get_associated(Grid::SecureEdgeContainer& edges, Face* f)		{set_row(edges, m_faceEdges, row(f));}
+		void get_associated(Grid::SecureEdgeContainer& edges, Volume* v)	{set_row(edges, m_volEdges, row(v));}
+
+		void get_associated(Grid::SecureFaceContainer& faces, Vertex* v)	{set_row(faces, m_vrtFaces, row(v));}
+		void get_associated(Grid::SecureFaceContainer& faces, Edge* e)		{set_row(faces, m_edgeFaces, row(e));}
+		void get_associated(Grid::SecureFaceContainer& faces, Volume* v)	{set_row(faces, m_volFaces, row(v));}
+
+		void get_associated(Grid::SecureVolumeContainer& vols, Vertex* v)	{set_row(vols, m_vrtVols, row(v));}
+		void get_associated(Grid::SecureVolumeContainer& vols, Edge* e)		{set_row(vols, m_edgeVols, row(e));}
+		void get_associated(Grid::SecureVolumeContainer& vols, Face* f)		{set_row(vols, m_faceVols, row(f));}
+
+	///	elements of the same type are forwarded to the grid
+		template <class TElem>
+		void get_associated(typename Grid::traits<typename TElem::grid_base_object>
+							::secure_container& elems, TElem* e)
+		{m_pGrid->associated_elements(elems, e);}
+
+		void invalidate();
+
+	///	rows of all vertices, listing the elements of type TElem which contain them
+		template <class TElem>
+		void collect_vertex_rows(Adjacency<TElem>& adjOut);
+
+	///	rows of all elements of type TElem, listing their edges in local order
+		template <class TElem>
+		void collect_edge_rows(Adjacency<Edge>& adjOut);
+
+	///	rows of all volumes, listing their faces in local order
+		void collect_volume_face_rows(Adjacency<Face>& adjOut);
+
+	///	rows of all elements of type TDst, listing the elements of type TSrc which contain them.
+	/**	adjIn has to contain the rows of all elements of type TSrc.*/
+		template <class TSrc, class TDst>
+		void collect_transposed(Adjacency<TSrc>& adjOut, const Adjacency<TDst>& adjIn);
+
+	///	Grid::associated_elements_sorted may be served from the snapshot
+		friend class Grid;
+
+	protected:
+		Grid*	m_pGrid;
+		bool	m_bValid;
+
+		AIndex	m_aIndex;
+		Grid::VertexAttachmentAccessor<AIndex>	m_aaIndVRT;
+		Grid::EdgeAttachmentAccessor<AIndex>	m_aaIndEDGE;
+		Grid::FaceAttachmentAccessor<AIndex>	m_aaIndFACE;
+		Grid::VolumeAttachmentAccessor<AIndex>	m_aaIndVOL;
+
+		Adjacency<Edge>		m_vrtEdges;
+		Adjacency<Face>		m_vrtFaces;
+		Adjacency<Volume>	m_vrtVols;
+
+		Adjacency<Face>		m_edgeFaces;
+		Adjacency<Volume>	m_edgeVols;
+
+		Adjacency<Edge>		m_faceEdges;
+		Adjacency<Volume>	m_faceVols;
+
+		Adjacency<Edge>		m_volEdges;
+		Adjacency<Face>		m_volFaces;
+};
+
+}//	end of namespace
+
+#endif
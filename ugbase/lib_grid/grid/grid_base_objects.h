@@ -164,6 +164,16 @@ class UG_API GridObject/* : public SmallObject<>*/
 	public:
 		virtual ~GridObject()	{}
 
+	///	grid objects are allocated from the size-segregated slabs of SlabAllocator
+	/**	This keeps objects which are created one after another (e.g. during
+	 * refinement) close to each other in memory and avoids the overhead of
+	 * individual heap allocations. Since the destructor is virtual, the size
+	 * passed to operator delete is always the size of the dynamic type.
+	 * \{ */
+		static void* operator new(std::size_t size);
+		static void operator delete(void* p, std::size_t size);
+	/** \} */
+
 	///	create an instance of the derived type
 	/**	Make sure to overload this method in derivates of this class!*/
 		virtual GridObject* create_empty_instance() const {return NULL;}
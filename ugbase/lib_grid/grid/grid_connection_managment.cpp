@@ -54,6 +54,7 @@
 #include <algorithm>
 #include "grid.h"
 #include "grid_util.h"
+#include "grid_adjacency_snapshot.h"
 #include "common/common.h"
 #include "common/profiler/profiler.h"
 
@@ -98,6 +99,10 @@ void Grid::register_vertex(Vertex* v, GridObject* pParent)
 {
 	GCM_PROFILE_FUNC();
 
+//	the associated element containers have to exist before the topology changes
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	store the element and register it at the pipe.
 	m_vertexElementStorage.m_attachmentPipe.register_element(v);
 	m_vertexElementStorage.m_sectionContainer.insert(v, v->container_section());
@@ -113,6 +118,9 @@ void Grid::register_vertex(Vertex* v, GridObject* pParent)
 
 void Grid::register_and_replace_element(Vertex* v, Vertex* pReplaceMe)
 {
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 	m_vertexElementStorage.m_attachmentPipe.register_element(v);
 	m_vertexElementStorage.m_sectionContainer.insert(v, v->container_section());
 
@@ -134,7 +142,7 @@ void Grid::register_and_replace_element(Vertex* v, Vertex* pReplaceMe)
 
 //	update edges
 	if(num_edges()){
-		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES)){
+		if(!option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES)){
 			LOG("WARNING in Grid::register_and_replace_element(...) - Vertex: autoenabling grid-option VRTOPT_STORE_ASSOCIATED_EDGES.");
 			enable_options(VRTOPT_STORE_ASSOCIATED_EDGES);
 		}
@@ -156,7 +164,7 @@ void Grid::register_and_replace_element(Vertex* v, Vertex* pReplaceMe)
 
 //	update faces
 	if(num_faces()){
-		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES)){
+		if(!option_is_active(VRTOPT_STORE_ASSOCIATED_FACES)){
 			LOG("WARNING in Grid::register_and_replace_element(...) - Vertex: autoenabling grid-option VRTOPT_STORE_ASSOCIATED_FACES.");
 			enable_options(VRTOPT_STORE_ASSOCIATED_FACES);
 		}
@@ -180,7 +188,7 @@ void Grid::register_and_replace_element(Vertex* v, Vertex* pReplaceMe)
 
 //	update volumes
 	if(num_volumes()){
-		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES)){
+		if(!option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES)){
 			LOG("WARNING in Grid::register_and_replace_element(...) - Vertex: autoenabling grid-option VRTOPT_STORE_ASSOCIATED_VOLUMES.");
 			enable_options(VRTOPT_STORE_ASSOCIATED_VOLUMES);
 		}
@@ -203,11 +211,11 @@ void Grid::register_and_replace_element(Vertex* v, Vertex* pReplaceMe)
 	}
 
 //	clear the containers of pReplaceMe
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 		m_aaEdgeContainerVERTEX[pReplaceMe].clear();
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 		m_aaFaceContainerVERTEX[pReplaceMe].clear();
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 		m_aaVolumeContainerVERTEX[pReplaceMe].clear();
 
 //	remove pReplaceMe
@@ -218,13 +226,16 @@ void Grid::register_and_replace_element(Vertex* v, Vertex* pReplaceMe)
 
 void Grid::unregister_vertex(Vertex* v)
 {
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	notify observers that the vertex is being erased
 	NOTIFY_OBSERVERS_REVERSE(m_vertexObservers, vertex_to_be_erased(this, v));
 
 //	perform some checks in order to assert grid consistency.
 //	all edges, faces and volume referencing this vertex have to be erased.
 
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 	{
 	//	if there are edges this option has to be enabled!
 		if(num_edges() > 0)
@@ -234,15 +245,15 @@ void Grid::unregister_vertex(Vertex* v)
 		}
 	}
 
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 	{
 	//	if there are faces we have to consider the following
 		if(num_faces() > 0)
 		{
 		//	if edges store associated faces and if faces auto-generate edges, then
 		//	nothing has to be performed here.
-			if(!(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES)
-				 &&	option_is_enabled(FACEOPT_AUTOGENERATE_EDGES)))
+			if(!(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES)
+				 &&	option_is_active(FACEOPT_AUTOGENERATE_EDGES)))
 			{
 			//	since adjacent faces have to be removed, we have to enable VRTOPT_STORE_ASSOCIATED_FACES
 				LOG("WARNING in Grid::unregister_vertex(...): auto-enabling VRTOPT_STORE_ASSOCIATED_FACES." << std::endl);
@@ -251,7 +262,7 @@ void Grid::unregister_vertex(Vertex* v)
 		}
 	}
 
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 	//	if there are volumes we have to consider the following
 		if(num_volumes() > 0)
@@ -259,10 +270,10 @@ void Grid::unregister_vertex(Vertex* v)
 		//	if edges store associated volumes and volumes auto-generate edges or
 		//	if faces store associated volumes and volumes auto-generate faces then
 		//	nothing has to be performed here.
-			bool cond1 =	option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES) &&
-							option_is_enabled(VOLOPT_AUTOGENERATE_EDGES);
-			bool cond2 =	option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES) &&
-							option_is_enabled(VOLOPT_AUTOGENERATE_FACES);
+			bool cond1 =	option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES) &&
+							option_is_active(VOLOPT_AUTOGENERATE_EDGES);
+			bool cond2 =	option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES) &&
+							option_is_active(VOLOPT_AUTOGENERATE_FACES);
 
 			if(!(cond1 || cond2))
 			{
@@ -276,7 +287,7 @@ void Grid::unregister_vertex(Vertex* v)
 //	remove associated volumes
 	if(num_volumes() > 0)
 	{
-		if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+		if(option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 		{
 		//	remove associated volumes. Make sure that there are no problems
 		//	when volumes try to unregister from the vertex.
@@ -295,7 +306,7 @@ void Grid::unregister_vertex(Vertex* v)
 //	remove associated faces
 	if(num_faces() > 0)
 	{
-		if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+		if(option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 		{
 		//	remove all associated faces. Make sure that there are no problems
 		//	when faces try to unregister from the vertex.
@@ -313,7 +324,7 @@ void Grid::unregister_vertex(Vertex* v)
 //	remove associated edges
 	if(num_edges() > 0)
 	{
-		assert(option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES) && "unexpected internal error in Grid::unregister_vertex - rae.");
+		assert(option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES) && "unexpected internal error in Grid::unregister_vertex - rae.");
 	//	remove all associated edges. Make sure that there are no problems
 	//	when edges try to unregister from the vertex.
 		EdgeContainer edges;
@@ -336,13 +347,13 @@ void Grid::change_vertex_options(uint optsNew)
 //	check if associated edge information has to be created or removed.
 	if(OPTIONS_CONTAIN_OPTION(optsNew, VRTOPT_STORE_ASSOCIATED_EDGES))
 	{
-		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES)){
+		if(!option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES)){
 			vertex_store_associated_edges(true);
 		}
 	}
 	else
 	{
-		if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES)){
+		if(option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES)){
 			vertex_store_associated_edges(false);
 		}
 	}
@@ -350,24 +361,24 @@ void Grid::change_vertex_options(uint optsNew)
 //	check if associated face information has to be created or removed.
 	if(OPTIONS_CONTAIN_OPTION(optsNew, VRTOPT_STORE_ASSOCIATED_FACES))
 	{
-		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+		if(!option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 			vertex_store_associated_faces(true);
 	}
 	else
 	{
-		if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+		if(option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 			vertex_store_associated_faces(false);
 	}
 
 //	check if associated volume information has to be created or removed.
 	if(OPTIONS_CONTAIN_OPTION(optsNew, VRTOPT_STORE_ASSOCIATED_VOLUMES))
 	{
-		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+		if(!option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 			vertex_store_associated_volumes(true);
 	}
 	else
 	{
-		if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+		if(option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 			vertex_store_associated_volumes(false);
 	}
 }
@@ -376,7 +387,7 @@ void Grid::vertex_store_associated_edges(bool bStoreIt)
 {
 	if(bStoreIt)
 	{
-		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+		if(!option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 		{
 		//	store associated edges
 			attach_to_vertices(m_aEdgeContainer);
@@ -395,7 +406,7 @@ void Grid::vertex_store_associated_edges(bool bStoreIt)
 	}
 	else
 	{
-		if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+		if(option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 		{
 			detach_from_vertices(m_aEdgeContainer);
 			m_options &= (~VRTOPT_STORE_ASSOCIATED_EDGES);
@@ -407,7 +418,7 @@ void Grid::vertex_store_associated_faces(bool bStoreIt)
 {
 	if(bStoreIt)
 	{
-		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+		if(!option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 		{
 		//	store associated faces
 			attach_to_vertices(m_aFaceContainer);
@@ -429,7 +440,7 @@ void Grid::vertex_store_associated_faces(bool bStoreIt)
 	}
 	else
 	{
-		if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+		if(option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 		{
 			detach_from_vertices(m_aFaceContainer);
 			m_options &= (~VRTOPT_STORE_ASSOCIATED_FACES);
@@ -441,7 +452,7 @@ void Grid::vertex_store_associated_volumes(bool bStoreIt)
 {
 	if(bStoreIt)
 	{
-		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+		if(!option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 		{
 		//	store associated volumes
 			attach_to_vertices(m_aVolumeContainer);
@@ -463,7 +474,7 @@ void Grid::vertex_store_associated_volumes(bool bStoreIt)
 	}
 	else
 	{
-		if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+		if(option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 		{
 			detach_from_vertices(m_aVolumeContainer);
 			m_options &= (~VRTOPT_STORE_ASSOCIATED_VOLUMES);
@@ -480,12 +491,15 @@ void Grid::register_edge(Edge* e, GridObject* pParent,
 {
 	GCM_PROFILE_FUNC();
 
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	store the element and register it at the pipe.
 	m_edgeElementStorage.m_attachmentPipe.register_element(e);
 	m_edgeElementStorage.m_sectionContainer.insert(e, e->container_section());
 
 //	register edge at vertices, faces and volumes, if the according options are enabled.
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 	{
 		m_aaEdgeContainerVERTEX[e->vertex(0)].push_back(e);
 		m_aaEdgeContainerVERTEX[e->vertex(1)].push_back(e);
@@ -496,17 +510,17 @@ void Grid::register_edge(Edge* e, GridObject* pParent,
 	if(createdByFace != NULL){
 	//	e has been autogenerated by f. We thus have don't have to check
 	//	for other faces. e is already contained in f's edge-container.
-		if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+		if(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 			m_aaFaceContainerEDGE[e].push_back(createdByFace);
 	}
 	else
 	{
-		if(!option_is_enabled(FACEOPT_AUTOGENERATE_EDGES)){
+		if(!option_is_active(FACEOPT_AUTOGENERATE_EDGES)){
 			GCM_PROFILE(GCM_reg_edge_processing_faces);
 			int switchVar = 0;	// this var will be used to determine what to register where.
-			if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+			if(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 				switchVar = 1;
-			if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+			if(option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 				switchVar += 2;
 
 			if(switchVar > 0)
@@ -548,21 +562,21 @@ void Grid::register_edge(Edge* e, GridObject* pParent,
 	//	e was at least indirectly created by a volume.
 	//	We thus do not have to check for other volumes.
 	//	e is already registered in v's edge-container.
-		if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+		if(option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 			m_aaVolumeContainerEDGE[e].push_back(createdByVol);
 	}
 	else
 	{
-		bool ignoreVolumes = option_is_enabled(VOLOPT_AUTOGENERATE_EDGES)
-						|| (option_is_enabled(VOLOPT_AUTOGENERATE_FACES)
-							&& option_is_enabled(FACEOPT_AUTOGENERATE_EDGES));
+		bool ignoreVolumes = option_is_active(VOLOPT_AUTOGENERATE_EDGES)
+						|| (option_is_active(VOLOPT_AUTOGENERATE_FACES)
+							&& option_is_active(FACEOPT_AUTOGENERATE_EDGES));
 
 		if(!ignoreVolumes){
 			GCM_PROFILE(GCM_reg_edge_processing_volumes);
 			int switchVar = 0;	// this var will be used to determine what to register where.
-			if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+			if(option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 				switchVar = 1;
-			if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+			if(option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 				switchVar += 2;
 
 			if(switchVar > 0)
@@ -607,6 +621,9 @@ void Grid::register_edge(Edge* e, GridObject* pParent,
 
 void Grid::register_and_replace_element(Edge* e, Edge* pReplaceMe)
 {
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	store the element and register it at the pipe.
 	m_edgeElementStorage.m_attachmentPipe.register_element(e);
 	m_edgeElementStorage.m_sectionContainer.insert(e, e->container_section());
@@ -624,7 +641,7 @@ void Grid::register_and_replace_element(Edge* e, Edge* pReplaceMe)
 
 //	check if vertices, faces and volumes reference pReplaceMe.
 //	if so, correct those references.
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 	{
 		for(uint i = 0; i < 2; ++i)
 			replace(associated_edges_begin(e->vertex(i)),
@@ -632,7 +649,7 @@ void Grid::register_and_replace_element(Edge* e, Edge* pReplaceMe)
 					pReplaceMe, e);
 	}
 
-	if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 	{
 	//	collect all faces that are associated with pReplaceMe
 		vector<Face*> vFaces;
@@ -643,7 +660,7 @@ void Grid::register_and_replace_element(Edge* e, Edge* pReplaceMe)
 					pReplaceMe, e);
 	}
 
-	if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 	{
 	//	collect all volumes that are associated with pReplaceMe
 		vector<Volume*> vVolumes;
@@ -655,14 +672,14 @@ void Grid::register_and_replace_element(Edge* e, Edge* pReplaceMe)
 	}
 
 //	now we have to copy all associated elements of pReplaceMe to e
-	if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+	if(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 	{
 		m_aaFaceContainerEDGE[e].assign(associated_faces_begin(pReplaceMe),
 										associated_faces_end(pReplaceMe));
 		m_aaFaceContainerEDGE[pReplaceMe].clear();
 	}
 
-	if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+	if(option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		m_aaVolumeContainerEDGE[e].assign(associated_volumes_begin(pReplaceMe),
 										associated_volumes_end(pReplaceMe));
@@ -677,29 +694,32 @@ void Grid::register_and_replace_element(Edge* e, Edge* pReplaceMe)
 
 void Grid::unregister_edge(Edge* e)
 {
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	notify observers that the edge is being erased
 	NOTIFY_OBSERVERS_REVERSE(m_edgeObservers, edge_to_be_erased(this, e));
 
 //	delete associated faces or unregister from associated faces
 	if(num_volumes() > 0)
 	{
-		if(option_is_enabled(VOLOPT_AUTOGENERATE_EDGES) ||
-			option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+		if(option_is_active(VOLOPT_AUTOGENERATE_EDGES) ||
+			option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 		{
 		//	check if anything has to be performed at all.
-			if(!(option_is_enabled(VOLOPT_AUTOGENERATE_FACES) &&
-				 option_is_enabled(FACEOPT_AUTOGENERATE_EDGES) &&
-				 option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES) &&
-				 option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES)))
+			if(!(option_is_active(VOLOPT_AUTOGENERATE_FACES) &&
+				 option_is_active(FACEOPT_AUTOGENERATE_EDGES) &&
+				 option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES) &&
+				 option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES)))
 			{
 			//	we have to perform something...
 				vector<Volume*> vVolumes;
 				CollectVolumes(vVolumes, *this, e);
 				vector<Volume*>::iterator vIter = vVolumes.begin();
 
-				if(option_is_enabled(VOLOPT_AUTOGENERATE_EDGES))
+				if(option_is_active(VOLOPT_AUTOGENERATE_EDGES))
 				{
-					if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+					if(option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 						m_aaVolumeContainerEDGE[e].clear();
 
 				//	erase the collected volumes
@@ -730,16 +750,16 @@ void Grid::unregister_edge(Edge* e)
 //	delete associated faces or unregister from associated faces
 	if(num_faces() > 0)
 	{
-		if(option_is_enabled(FACEOPT_AUTOGENERATE_EDGES) ||
-			option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+		if(option_is_active(FACEOPT_AUTOGENERATE_EDGES) ||
+			option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 		{
 			vector<Face*> vFaces;
 			CollectFaces(vFaces, *this, e);
 			vector<Face*>::iterator fIter = vFaces.begin();
 
-			if(option_is_enabled(FACEOPT_AUTOGENERATE_EDGES))
+			if(option_is_active(FACEOPT_AUTOGENERATE_EDGES))
 			{
-				if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+				if(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 					m_aaFaceContainerEDGE[e].clear();
 
 			//	erase the collected faces.
@@ -767,7 +787,7 @@ void Grid::unregister_edge(Edge* e)
 	}
 
 //	unregister from vertices
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 	{
 	//	iterate through the associated vertices and remove the edge from their edge-list.
 		for(int i = 0; i < 2; ++i)
@@ -790,24 +810,24 @@ void Grid::change_edge_options(uint optsNew)
 //	check if associated face information has to be created or removed.
 	if(OPTIONS_CONTAIN_OPTION(optsNew, EDGEOPT_STORE_ASSOCIATED_FACES))
 	{
-		if(!option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+		if(!option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 			edge_store_associated_faces(true);
 	}
 	else
 	{
-		if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+		if(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 			edge_store_associated_faces(false);
 	}
 
 //	check if associated volume information has to be created or removed.
 	if(OPTIONS_CONTAIN_OPTION(optsNew, EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
-		if(!option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+		if(!option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 			edge_store_associated_volumes(true);
 	}
 	else
 	{
-		if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+		if(option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 			edge_store_associated_volumes(false);
 	}
 }
@@ -816,7 +836,7 @@ void Grid::edge_store_associated_faces(bool bStoreIt)
 {
 	if(bStoreIt)
 	{
-		if(!option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+		if(!option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 		{
 		//	store associated faces
 			attach_to_edges(m_aFaceContainer);
@@ -827,7 +847,7 @@ void Grid::edge_store_associated_faces(bool bStoreIt)
 		//	the option VRTOPT_STORE_ASSOCIATED_EDGES has to be enabled.
 		//	(This is due to the use of GetEdge(...))
 		//	if it is disabled here, we'll enable it.
-			if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+			if(!option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 			{
 				LOG("WARNING in edge_store_associated_faces(...): auto-enabling VRTOPT_STORE_ASSOCIATED_EDGES." << endl);
 				vertex_store_associated_edges(true);
@@ -852,7 +872,7 @@ void Grid::edge_store_associated_faces(bool bStoreIt)
 	}
 	else
 	{
-		if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+		if(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 		{
 		//	detach edge-face connections
 			detach_from_edges(m_aFaceContainer);
@@ -865,7 +885,7 @@ void Grid::edge_store_associated_volumes(bool bStoreIt)
 {
 	if(bStoreIt)
 	{
-		if(!option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+		if(!option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 		{
 		//	store associated faces
 			attach_to_edges(m_aVolumeContainer);
@@ -876,7 +896,7 @@ void Grid::edge_store_associated_volumes(bool bStoreIt)
 		//	the option VRTOPT_STORE_ASSOCIATED_VOLUMES has to be enabled.
 		//	(This is due to the use of GetEdge(...))
 		//	if it is disabled here, we'll enable it.
-			if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+			if(!option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 			{
 				LOG("WARNING in Grid::edge_store_associated_volumes(...): auto-enabling VRTOPT_STORE_ASSOCIATED_VOLUMES." << endl);
 				vertex_store_associated_volumes(true);
@@ -905,7 +925,7 @@ void Grid::edge_store_associated_volumes(bool bStoreIt)
 	}
 	else
 	{
-		if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+		if(option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 		{
 		//	detach edge-volume connections
 			detach_from_edges(m_aVolumeContainer);
@@ -923,12 +943,15 @@ void Grid::register_face(Face* f, GridObject* pParent, Volume* createdByVol)
 {
 	GCM_PROFILE_FUNC();
 
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	store the element and register it at the pipe.
 	m_faceElementStorage.m_attachmentPipe.register_element(f);
 	m_faceElementStorage.m_sectionContainer.insert(f, f->container_section());
 
 //	register face at vertices
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 	{
 		uint numVrts = f->num_vertices();
 		Face::ConstVertexArray vrts = f->vertices();
@@ -936,9 +959,9 @@ void Grid::register_face(Face* f, GridObject* pParent, Volume* createdByVol)
 			m_aaFaceContainerVERTEX[vrts[i]].push_back(f);
 	}
 
-	bool createEdges = option_is_enabled(FACEOPT_AUTOGENERATE_EDGES);;
-	const bool edgesStoreFaces = option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES);
-	const bool facesStoreEdges = option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES);
+	bool createEdges = option_is_active(FACEOPT_AUTOGENERATE_EDGES);;
+	const bool edgesStoreFaces = option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES);
+	const bool facesStoreEdges = option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES);
 
 //	make sure that the edge container is big enough to hold all edges
 	if(facesStoreEdges)
@@ -991,18 +1014,18 @@ void Grid::register_face(Face* f, GridObject* pParent, Volume* createdByVol)
 	if(createdByVol != NULL){
 	//	This means that the face was autogenerated by a volume.
 	//	In this case the face is already registered in the volumes container.
-		if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+		if(option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 			m_aaVolumeContainerFACE[f].push_back(createdByVol);
 	}
 	else
 	{
-		if(!option_is_enabled(VOLOPT_AUTOGENERATE_FACES)){
+		if(!option_is_active(VOLOPT_AUTOGENERATE_FACES)){
 			GCM_PROFILE(GCM_reg_face_processing_volumes);
 
 			int switchVar = 0;
-			if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+			if(option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 				switchVar = 1;
-			if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+			if(option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 				switchVar += 2;
 
 			if(switchVar > 0)
@@ -1043,6 +1066,9 @@ void Grid::register_face(Face* f, GridObject* pParent, Volume* createdByVol)
 
 void Grid::register_and_replace_element(Face* f, Face* pReplaceMe)
 {
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	check that f and pReplaceMe have the same amount of vertices.
 	if(f->num_vertices() != pReplaceMe->num_vertices())
 	{
@@ -1074,7 +1100,7 @@ void Grid::register_and_replace_element(Face* f, Face* pReplaceMe)
 
 //	check if vertices, edges and volumes reference pReplaceMe.
 //	if so, correct those references.
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 	{
 		for(uint i = 0; i < numVrts; ++i)
 			replace(associated_faces_begin(vrts[i]),
@@ -1082,7 +1108,7 @@ void Grid::register_and_replace_element(Face* f, Face* pReplaceMe)
 					pReplaceMe, f);
 	}
 
-	if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+	if(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 	{
 	//	collect all edges that are associated with pReplaceMe
 		vector<Edge*> vEdges;
@@ -1093,7 +1119,7 @@ void Grid::register_and_replace_element(Face* f, Face* pReplaceMe)
 					pReplaceMe, f);
 	}
 
-	if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+	if(option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 	{
 	//	collect all volumes that are associated with pReplaceMe
 		vector<Volume*> vVolumes;
@@ -1105,14 +1131,14 @@ void Grid::register_and_replace_element(Face* f, Face* pReplaceMe)
 	}
 
 //	now we have to copy all associated elements of pReplaceMe to f
-	if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 	{
 		m_aaEdgeContainerFACE[f].assign(associated_edges_begin(pReplaceMe),
 										associated_edges_end(pReplaceMe));
 		m_aaEdgeContainerFACE[pReplaceMe].clear();
 	}
 
-	if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+	if(option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		m_aaVolumeContainerFACE[f].assign(associated_volumes_begin(pReplaceMe),
 											associated_volumes_end(pReplaceMe));
@@ -1127,22 +1153,25 @@ void Grid::register_and_replace_element(Face* f, Face* pReplaceMe)
 
 void Grid::unregister_face(Face* f)
 {
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	notify observers that the face is being erased
 	NOTIFY_OBSERVERS_REVERSE(m_faceObservers, face_to_be_erased(this, f));
 
 //	remove or disconnect from volumes
 	if(num_volumes() > 0)
 	{
-		if(option_is_enabled(VOLOPT_AUTOGENERATE_FACES) ||
-			option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+		if(option_is_active(VOLOPT_AUTOGENERATE_FACES) ||
+			option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 		{
 			vector<Volume*> vVolumes;
 			CollectVolumes(vVolumes, *this, f, true);
 			vector<Volume*>::iterator vIter= vVolumes.begin();
 
-			if(option_is_enabled(VOLOPT_AUTOGENERATE_FACES))
+			if(option_is_active(VOLOPT_AUTOGENERATE_FACES))
 			{
-				if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+				if(option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 					m_aaVolumeContainerFACE[f].clear();
 
 			//	delete the collected volumes
@@ -1169,7 +1198,7 @@ void Grid::unregister_face(Face* f)
 	}
 
 //	disconnect from edges
-	if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+	if(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 	{
 	//	iterate through all edges of the face
 		uint numEdges = f->num_edges();
@@ -1187,7 +1216,7 @@ void Grid::unregister_face(Face* f)
 	}
 
 //	disconnect from vertices
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 	{
 		size_t numVrts = f->num_vertices();
 		Face::ConstVertexArray vrts = f->vertices();
@@ -1211,36 +1240,36 @@ void Grid::change_face_options(uint optsNew)
 //	check if associated edge information has to be created or removed.
 	if(OPTIONS_CONTAIN_OPTION(optsNew, FACEOPT_STORE_ASSOCIATED_EDGES))
 	{
-		if(!option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+		if(!option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 			face_store_associated_edges(true);
 	}
 	else
 	{
-		if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+		if(option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 			face_store_associated_edges(false);
 	}
 
 //	check if associated volume information has to be created or removed.
 	if(OPTIONS_CONTAIN_OPTION(optsNew, FACEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
-		if(!option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+		if(!option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 			face_store_associated_volumes(true);
 	}
 	else
 	{
-		if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+		if(option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 			face_store_associated_volumes(false);
 	}
 
 //	turn auto-generation of edges on and of
 	if(OPTIONS_CONTAIN_OPTION(optsNew, FACEOPT_AUTOGENERATE_EDGES))
 	{
-		if(!option_is_enabled(FACEOPT_AUTOGENERATE_EDGES))
+		if(!option_is_active(FACEOPT_AUTOGENERATE_EDGES))
 			face_autogenerate_edges(true);
 	}
 	else
 	{
-		if(option_is_enabled(FACEOPT_AUTOGENERATE_EDGES))
+		if(option_is_active(FACEOPT_AUTOGENERATE_EDGES))
 			face_autogenerate_edges(false);
 	}
 }
@@ -1249,13 +1278,13 @@ void Grid::face_store_associated_edges(bool bStoreIt)
 {
 	if(bStoreIt)
 	{
-		if(!option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+		if(!option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 		{
 		//	store associated edges
 			attach_to_faces(m_aEdgeContainer);
 			m_aaEdgeContainerFACE.access(*this, m_aEdgeContainer);
 
-			bool createEdges = option_is_enabled(FACEOPT_AUTOGENERATE_EDGES);
+			bool createEdges = option_is_active(FACEOPT_AUTOGENERATE_EDGES);
 
 		//	if EDGEOPT_STORE_ASSOCIATED_FACES is enabled, this is as simple
 		//	as to iterate through all edges and store them at their
@@ -1265,7 +1294,7 @@ void Grid::face_store_associated_edges(bool bStoreIt)
 		//	If createEdges == true, we want to store the edges sorted.
 		//	The else branch thus has to be executed.
 			if(!createEdges
-				&& option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+				&& option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 			{
 			//	iterate through the edges
 				for(EdgeIterator iter = edges_begin(); iter != edges_end(); iter++)
@@ -1310,7 +1339,7 @@ void Grid::face_store_associated_edges(bool bStoreIt)
 	}
 	else
 	{
-		if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+		if(option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 		{
 		//	remove face-edge connections
 			detach_from_faces(m_aEdgeContainer);
@@ -1323,7 +1352,7 @@ void Grid::face_store_associated_volumes(bool bStoreIt)
 {
 	if(bStoreIt)
 	{
-		if(!option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+		if(!option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 		{
 		//	store associated faces
 			attach_to_faces(m_aVolumeContainer);
@@ -1335,7 +1364,7 @@ void Grid::face_store_associated_volumes(bool bStoreIt)
 				Volume* v = *iter;
 
 			//	if faces are already stored at their associated volumes, we iterate over them.
-				if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+				if(option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 				{
 					AssociatedFaceIterator iterEnd = associated_faces_end(v);
 					for(AssociatedFaceIterator iter = associated_faces_begin(v); iter != iterEnd; iter++)
@@ -1360,7 +1389,7 @@ void Grid::face_store_associated_volumes(bool bStoreIt)
 	}
 	else
 	{
-		if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+		if(option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 		{
 		//	remove face-edge connections
 			detach_from_faces(m_aVolumeContainer);
@@ -1373,9 +1402,9 @@ void Grid::face_autogenerate_edges(bool bAutogen)
 {
 	if(bAutogen)
 	{
-		if(!option_is_enabled(FACEOPT_AUTOGENERATE_EDGES))
+		if(!option_is_active(FACEOPT_AUTOGENERATE_EDGES))
 		{
-			bool storeEdges = option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES);
+			bool storeEdges = option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES);
 			EdgeDescriptor ed;
 
 		//	generate all missing edges now!
@@ -1417,9 +1446,9 @@ void Grid::face_autogenerate_edges(bool bAutogen)
 		//	Now, if VOLOPT_STORE_ASSOCIATED_EDGES is active but
 		//	VOLOPT_AUTOGENERATE_EDGES is inactive, then we'll sort the associated-edges
 		//	of volumes.
-			if(option_is_enabled(VOLOPT_AUTOGENERATE_FACES)
-			   && option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES)
-			   && (!option_is_enabled(VOLOPT_AUTOGENERATE_EDGES)))
+			if(option_is_active(VOLOPT_AUTOGENERATE_FACES)
+			   && option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES)
+			   && (!option_is_active(VOLOPT_AUTOGENERATE_EDGES)))
 			{
 				volume_sort_associated_edge_container();
 			}
@@ -1441,6 +1470,9 @@ void Grid::register_volume(Volume* v, GridObject* pParent)
 {
 	GCM_PROFILE_FUNC();
 
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	store the element and register it at the pipe.
 	m_volumeElementStorage.m_attachmentPipe.register_element(v);
 	m_volumeElementStorage.m_sectionContainer.insert(v, v->container_section());
@@ -1449,7 +1481,7 @@ void Grid::register_volume(Volume* v, GridObject* pParent)
 //	register the volume at the associated vertices, edges and faces, if the according options are enabled.
 
 //	register volume at vertices
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		uint numVrts = v->num_vertices();
 		Volume::ConstVertexArray vrts = v->vertices();
@@ -1457,16 +1489,16 @@ void Grid::register_volume(Volume* v, GridObject* pParent)
 			m_aaVolumeContainerVERTEX[vrts[i]].push_back(v);
 	}
 
-	const bool createEdges = option_is_enabled(VOLOPT_AUTOGENERATE_EDGES);
-	const bool createFaces = option_is_enabled(VOLOPT_AUTOGENERATE_FACES);
-	const bool createEdgesIndirect = option_is_enabled(VOLOPT_AUTOGENERATE_FACES
+	const bool createEdges = option_is_active(VOLOPT_AUTOGENERATE_EDGES);
+	const bool createFaces = option_is_active(VOLOPT_AUTOGENERATE_FACES);
+	const bool createEdgesIndirect = option_is_active(VOLOPT_AUTOGENERATE_FACES
 													   | FACEOPT_AUTOGENERATE_EDGES);
 
-	const bool edgesStoreVols = option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES);
-	const bool volsStoreEdges = option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES);
+	const bool edgesStoreVols = option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES);
+	const bool volsStoreEdges = option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES);
 
-	const bool facesStoreVols = option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES);
-	const bool volsStoreFaces = option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES);
+	const bool facesStoreVols = option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES);
+	const bool volsStoreFaces = option_is_active(VOLOPT_STORE_ASSOCIATED_FACES);
 
 
 //	if elements are automatically created, then we can directly reserve memory
@@ -1575,6 +1607,9 @@ void Grid::register_volume(Volume* v, GridObject* pParent)
 
 void Grid::register_and_replace_element(Volume* v, Volume* pReplaceMe)
 {
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	check that v and pReplaceMe have the same number of vertices.
 	if(v->num_vertices() != pReplaceMe->num_vertices())
 	{
@@ -1603,7 +1638,7 @@ void Grid::register_and_replace_element(Volume* v, Volume* pReplaceMe)
 
 //	check if vertices, edges and faces reference pReplaceMe.
 //	if so, correct those references.
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		for(uint i = 0; i < numVrts; ++i)
 			replace(associated_volumes_begin(vrts[i]),
@@ -1611,7 +1646,7 @@ void Grid::register_and_replace_element(Volume* v, Volume* pReplaceMe)
 					pReplaceMe, v);
 	}
 
-	if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+	if(option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 	//	collect all edges that are associated with pReplaceMe
 		vector<Edge*> vEdges;
@@ -1622,7 +1657,7 @@ void Grid::register_and_replace_element(Volume* v, Volume* pReplaceMe)
 					pReplaceMe, v);
 	}
 
-	if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+	if(option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 	//	collect all faces that are associated with pReplaceMe
 		vector<Face*> vFaces;
@@ -1634,14 +1669,14 @@ void Grid::register_and_replace_element(Volume* v, Volume* pReplaceMe)
 	}
 
 //	now we have to copy all associated elements of pReplaceMe to v
-	if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 	{
 		m_aaEdgeContainerVOLUME[v].assign(associated_edges_begin(pReplaceMe),
 											associated_edges_end(pReplaceMe));
 		m_aaEdgeContainerVOLUME[pReplaceMe].clear();
 	}
 
-	if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+	if(option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 	{
 		m_aaFaceContainerVOLUME[v].assign(associated_faces_begin(pReplaceMe),
 											associated_faces_end(pReplaceMe));
@@ -1656,11 +1691,14 @@ void Grid::register_and_replace_element(Volume* v, Volume* pReplaceMe)
 
 void Grid::unregister_volume(Volume* v)
 {
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	notify observers that the face is being erased
 	NOTIFY_OBSERVERS_REVERSE(m_volumeObservers, volume_to_be_erased(this, v));
 
 //	disconnect from faces
-	if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+	if(option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		uint numFaces = v->num_faces();
 		vector<Face*> vFaces;
@@ -1682,7 +1720,7 @@ void Grid::unregister_volume(Volume* v)
 	}
 
 //	disconnect from edges
-	if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+	if(option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 		uint numEdges = v->num_edges();
 		for(uint i = 0; i < numEdges; ++i)
@@ -1700,7 +1738,7 @@ void Grid::unregister_volume(Volume* v)
 	}
 
 //	disconnect from vertices
-	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+	if(option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 	{
 	//	iterate through all associated vertices and update their connection-info
 		uint numVertices = v->num_vertices();
@@ -1726,48 +1764,48 @@ void Grid::change_volume_options(uint optsNew)
 //	check if associated edge information has to be created or removed.
 	if(OPTIONS_CONTAIN_OPTION(optsNew, VOLOPT_STORE_ASSOCIATED_EDGES))
 	{
-		if(!option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+		if(!option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 			volume_store_associated_edges(true);
 	}
 	else
 	{
-		if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+		if(option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 			volume_store_associated_edges(false);
 	}
 
 //	check if associated face information has to be created or removed.
 	if(OPTIONS_CONTAIN_OPTION(optsNew, VOLOPT_STORE_ASSOCIATED_FACES))
 	{
-		if(!option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+		if(!option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 			volume_store_associated_faces(true);
 	}
 	else
 	{
-		if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+		if(option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 			volume_store_associated_faces(false);
 	}
 
 //	enable or disable edge-auto-generation
 	if(OPTIONS_CONTAIN_OPTION(optsNew, VOLOPT_AUTOGENERATE_EDGES))
 	{
-		if(!option_is_enabled(VOLOPT_AUTOGENERATE_EDGES))
+		if(!option_is_active(VOLOPT_AUTOGENERATE_EDGES))
 			volume_autogenerate_edges(true);
 	}
 	else
 	{
-		if(option_is_enabled(VOLOPT_AUTOGENERATE_EDGES))
+		if(option_is_active(VOLOPT_AUTOGENERATE_EDGES))
 			volume_autogenerate_edges(false);
 	}
 
 //	enable or disable face-auto-generation
 	if(OPTIONS_CONTAIN_OPTION(optsNew, VOLOPT_AUTOGENERATE_FACES))
 	{
-		if(!option_is_enabled(VOLOPT_AUTOGENERATE_FACES))
+		if(!option_is_active(VOLOPT_AUTOGENERATE_FACES))
 			volume_autogenerate_faces(true);
 	}
 	else
 	{
-		if(option_is_enabled(VOLOPT_AUTOGENERATE_FACES))
+		if(option_is_active(VOLOPT_AUTOGENERATE_FACES))
 			volume_autogenerate_faces(false);
 	}
 }
@@ -1776,14 +1814,14 @@ void Grid::volume_store_associated_edges(bool bStoreIt)
 {
 	if(bStoreIt)
 	{
-		if(!option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+		if(!option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 		{
 		//	store associated edges
 			attach_to_volumes(m_aEdgeContainer);
 			m_aaEdgeContainerVOLUME.access(*this, m_aEdgeContainer);
 
-			bool createEdges = option_is_enabled(VOLOPT_AUTOGENERATE_EDGES)
-								|| option_is_enabled(GRIDOPT_AUTOGENERATE_SIDES);
+			bool createEdges = option_is_active(VOLOPT_AUTOGENERATE_EDGES)
+								|| option_is_active(GRIDOPT_AUTOGENERATE_SIDES);
 		//	if EDGEOPT_STORE_ASSOCIATED_VOLUMES is enabled, this is as simple
 		//	as to iterate through all edges and store them at their
 		//	associated volumes.
@@ -1792,7 +1830,7 @@ void Grid::volume_store_associated_edges(bool bStoreIt)
 		//	If createEdges == true, we want to store the edges sorted.
 		//	The else branch thus has to be executed.
 			if(!createEdges
-				&& option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+				&& option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 			{
 			//	iterate through the edges
 				for(EdgeIterator iter = edges_begin(); iter != edges_end(); iter++)
@@ -1839,7 +1877,7 @@ void Grid::volume_store_associated_edges(bool bStoreIt)
 	}
 	else
 	{
-		if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+		if(option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 		{
 			//	remove vol-edge connection
 			detach_from_volumes(m_aEdgeContainer);
@@ -1852,13 +1890,13 @@ void Grid::volume_store_associated_faces(bool bStoreIt)
 {
 	if(bStoreIt)
 	{
-		if(!option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+		if(!option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 		{
 		//	store associated faces
 			attach_to_volumes(m_aFaceContainer);
 			m_aaFaceContainerVOLUME.access(*this, m_aFaceContainer);
 
-			bool createFaces = option_is_enabled(VOLOPT_AUTOGENERATE_FACES);
+			bool createFaces = option_is_active(VOLOPT_AUTOGENERATE_FACES);
 
 		//	if FACEOPT_STORE_ASSOCIATED_VOLUMES is enabled, this is as simple
 		//	as to iterate through all faces and store them at their
@@ -1867,7 +1905,7 @@ void Grid::volume_store_associated_faces(bool bStoreIt)
 		//	each of their faces..
 		//	if createFaces == true then we want to store the faces sorted.
 			if(!createFaces
-				&& option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+				&& option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 			{
 			//	iterate through the edges
 				for(FaceIterator iter = faces_begin(); iter != faces_end(); iter++)
@@ -1917,7 +1955,7 @@ void Grid::volume_store_associated_faces(bool bStoreIt)
 	}
 	else
 	{
-		if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+		if(option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 		{
 			//	remove vol-edge connection
 			detach_from_volumes(m_aFaceContainer);
@@ -1930,9 +1968,9 @@ void Grid::volume_autogenerate_edges(bool bAutogen)
 {
 	if(bAutogen)
 	{
-		if(!option_is_enabled(VOLOPT_AUTOGENERATE_EDGES))
+		if(!option_is_active(VOLOPT_AUTOGENERATE_EDGES))
 		{
-			bool volsStoreEdges = option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES);
+			bool volsStoreEdges = option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES);
 			EdgeDescriptor ed;
 
 		//	generate all missing edges now!
@@ -1983,9 +2021,9 @@ void Grid::volume_autogenerate_faces(bool bAutogen)
 {
 	if(bAutogen)
 	{
-		if(!option_is_enabled(VOLOPT_AUTOGENERATE_FACES))
+		if(!option_is_active(VOLOPT_AUTOGENERATE_FACES))
 		{
-			bool volsStoreFaces = option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES);
+			bool volsStoreFaces = option_is_active(VOLOPT_STORE_ASSOCIATED_FACES);
 			FaceDescriptor fd;
 
 		//	generate all missing faces now!
@@ -2027,9 +2065,9 @@ void Grid::volume_autogenerate_faces(bool bAutogen)
 		//	Now, if VOLOPT_STORE_ASSOCIATED_EDGES is active but
 		//	VOLOPT_AUTOGENERATE_EDGES is inactive, then we'll sort the associated-edges
 		//	of volumes.
-			if(option_is_enabled(FACEOPT_AUTOGENERATE_EDGES)
-			   && option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES)
-			   && (!option_is_enabled(VOLOPT_AUTOGENERATE_EDGES)))
+			if(option_is_active(FACEOPT_AUTOGENERATE_EDGES)
+			   && option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES)
+			   && (!option_is_active(VOLOPT_AUTOGENERATE_EDGES)))
 			{
 				volume_sort_associated_edge_container();
 			}
@@ -2045,7 +2083,7 @@ void Grid::volume_autogenerate_faces(bool bAutogen)
 
 void Grid::volume_sort_associated_edge_container()
 {
-	if(!option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+	if(!option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 		return;
 
 	EdgeContainer tmpCon;
@@ -2085,6 +2123,9 @@ void Grid::volume_sort_associated_edge_container()
 //	replace_vertex
 bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 {
+	if(adjacency_is_frozen())
+		thaw_adjacency();
+
 //	this bool should be a parameter. However one first would have
 //	to add connectivity updates for double-elements in this method,
 //	to handle the case when eraseDoubleElements is set to false.
@@ -2149,7 +2190,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 
 				//	before the removal we will replace its entry in associated-
 				//	element-lists with the pointer to the existing edge.
-					if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+					if(option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 					{
 					//	unregister e from the vertex with which e connects vrtOld.
 						EdgeContainer& ec = m_aaEdgeContainerVERTEX[ed.vertex(0)];
@@ -2158,7 +2199,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 							ec.erase(tmpI);
 					}
 
-					if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES)
+					if(option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES)
 							&& num_faces() > 0)
 					{
 					//	unregister the edge from all adjacent faces
@@ -2171,7 +2212,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 						}
 					}
 
-					if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES)
+					if(option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES)
 							&& num_volumes() > 0)
 					{
 					//	unregister the edge from all adjacent volumes
@@ -2201,7 +2242,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 					e->set_vertex(1, vrtNew);
 
 			//	register e at vrtNew
-				if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+				if(option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES))
 				{
 					m_aaEdgeContainerVERTEX[vrtNew].push_back(e);
 				}
@@ -2258,7 +2299,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 
 				//	before the removal we will replace its entry in associated-
 				//	element-lists with the pointer to the existing face.
-					if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+					if(option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 					{
 					//	unregister f from the vertices with which f connects vrtOld.
 						for(uint i = 0; i < numVrts; ++i)
@@ -2273,7 +2314,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 						}
 					}
 
-					if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES)
+					if(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES)
 						&& num_edges() > 0)
 					{
 					//	unregister f from adjacent edges.
@@ -2287,7 +2328,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 						}
 					}
 
-					if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES)
+					if(option_is_active(VOLOPT_STORE_ASSOCIATED_FACES)
 							&& num_volumes() > 0)
 					{
 					//	unregister the face from all adjacent volumes
@@ -2319,13 +2360,13 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 				}
 
 			//	register f at vrtNew
-				if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+				if(option_is_active(VRTOPT_STORE_ASSOCIATED_FACES))
 				{
 					m_aaFaceContainerVERTEX[vrtNew].push_back(f);
 				}
 
 			//	register f at existing edges
-				if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES))
+				if(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES))
 				{
 				//	only edges which contain vrtNew are relevant.
 					uint numEdges = f->num_edges();
@@ -2397,7 +2438,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 
 				//	before the removal we will replace its entry in associated-
 				//	element-lists with the pointer to the existing volume.
-					if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+					if(option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 					{
 					//	unregister v from the vertices with which v connects vrtOld.
 						for(uint i = 0; i < numVrts; ++i)
@@ -2412,7 +2453,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 						}
 					}
 
-					if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES)
+					if(option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES)
 						&& num_edges() > 0)
 					{
 					//	unregister v from adjacent edges.
@@ -2426,7 +2467,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 						}
 					}
 
-					if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES)
+					if(option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES)
 						&& num_faces() > 0)
 					{
 					//	unregister v from adjacent faces.
@@ -2460,13 +2501,13 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 				}
 
 			//	register v at vrtNew
-				if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+				if(option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES))
 				{
 					m_aaVolumeContainerVERTEX[vrtNew].push_back(v);
 				}
 
 			//	register v at existing edges
-				if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
+				if(option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES))
 				{
 				//	only edges which contain vrtNew are relevant.
 					uint numEdges = v->num_edges();
@@ -2488,7 +2529,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 				}
 
 			//	register v at existing faces
-				if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES))
+				if(option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES))
 				{
 				//	only faces which contain vrtNew are relevant.
 					uint numFaces = v->num_faces();
@@ -2625,10 +2666,15 @@ void Grid::get_associated(SecureVertexContainer& vrts, Volume* v)
 //	ASSOCIATED EDGES
 void Grid::get_associated(SecureEdgeContainer& edges, Vertex* v)
 {
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(edges, v);
+		return;
+	}
+
 //	Without the VRTOPT_STORE_ASSOCIATED_... option, this operation would have
 //	complexity O(n). This has to be avoided! We thus simply enable the option.
 //	This takes some time, however, later queries will greatly benefit.
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES)){
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_EDGES)){
 	//	only enable the option if edges exist at all
 		if(num<Edge>() == 0){
 			edges.clear();
@@ -2648,8 +2694,13 @@ void Grid::get_associated(SecureEdgeContainer& edges, Vertex* v)
 
 void Grid::get_associated(SecureEdgeContainer& edges, Face* f)
 {
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(edges, f);
+		return;
+	}
+
 //	to improve performance, we first check the grid options.
-	if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(FACEOPT_STORE_ASSOCIATED_EDGES))
 	{
 	//	we can output the associated array directly
 		EdgeContainer& assEdges = m_aaEdgeContainerFACE[f];
@@ -2678,8 +2729,13 @@ void Grid::get_associated(SecureEdgeContainer& edges, Face* f)
 
 void Grid::get_associated(SecureEdgeContainer& edges, Volume* v)
 {
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(edges, v);
+		return;
+	}
+
 //	to improve performance, we first check the grid options.
-	if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_EDGES))
+	if(option_is_active(VOLOPT_STORE_ASSOCIATED_EDGES))
 	{
 	//	we can output the associated array directly
 		EdgeContainer& assEdges = m_aaEdgeContainerVOLUME[v];
@@ -2711,10 +2767,15 @@ void Grid::get_associated(SecureEdgeContainer& edges, Volume* v)
 //	ASSOCIATED FACES
 void Grid::get_associated(SecureFaceContainer& faces, Vertex* v)
 {
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(faces, v);
+		return;
+	}
+
 //	Without the VRTOPT_STORE_ASSOCIATED_... option, this operation would have
 //	complexity O(n). This has to be avoided! We thus simply enable the option.
 //	This takes some time, however, later queries will greatly benefit.
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES)){
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_FACES)){
 	//	only enable the option if faces exist at all
 		if(num<Face>() == 0){
 			faces.clear();
@@ -2734,8 +2795,13 @@ void Grid::get_associated(SecureFaceContainer& faces, Vertex* v)
 
 void Grid::get_associated(SecureFaceContainer& faces, Edge* e)
 {
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(faces, e);
+		return;
+	}
+
 //	best option: EDGEOPT_STORE_ASSOCIATED_FACES
-	if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_FACES)){
+	if(option_is_active(EDGEOPT_STORE_ASSOCIATED_FACES)){
 	//	we can output the associated array directly
 		FaceContainer& assFaces = m_aaFaceContainerEDGE[e];
 		if(assFaces.empty())
@@ -2749,7 +2815,7 @@ void Grid::get_associated(SecureFaceContainer& faces, Edge* e)
 	//	VRTOPT_STORE_ASSOCIATED_FACES has to be enabled for this. Only continue,
 	//	if faces exist at all
 		faces.clear();
-		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES)){
+		if(!option_is_active(VRTOPT_STORE_ASSOCIATED_FACES)){
 		//	only enable the option if faces exist at all
 			if(num<Face>() == 0){
 				return;
@@ -2779,8 +2845,13 @@ void Grid::get_associated(SecureFaceContainer& faces, Edge* e)
 
 void Grid::get_associated(SecureFaceContainer& faces, Volume* v)
 {
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(faces, v);
+		return;
+	}
+
 //	to improve performance, we first check the grid options.
-	if(option_is_enabled(VOLOPT_STORE_ASSOCIATED_FACES))
+	if(option_is_active(VOLOPT_STORE_ASSOCIATED_FACES))
 	{
 	//	we can output the associated array directly
 		FaceContainer& assFaces = m_aaFaceContainerVOLUME[v];
@@ -2812,10 +2883,15 @@ void Grid::get_associated(SecureFaceContainer& faces, Volume* v)
 //	ASSOCIATED VOLUMES
 void Grid::get_associated(SecureVolumeContainer& vols, Vertex* v)
 {
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(vols, v);
+		return;
+	}
+
 //	Without the VRTOPT_STORE_ASSOCIATED_... option, this operation would have
 //	complexity O(n). This has to be avoided! We thus simply enable the option.
 //	This takes some time, however, later queries will greatly benefit.
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES)){
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES)){
 	//	only enable the option if volumes exist at all
 		if(num<Volume>() == 0){
 			vols.clear();
@@ -2835,8 +2911,13 @@ void Grid::get_associated(SecureVolumeContainer& vols, Vertex* v)
 
 void Grid::get_associated(SecureVolumeContainer& vols, Edge* e)
 {
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(vols, e);
+		return;
+	}
+
 //	best option: EDGEOPT_STORE_ASSOCIATED_VOLUMES
-	if(option_is_enabled(EDGEOPT_STORE_ASSOCIATED_VOLUMES)){
+	if(option_is_active(EDGEOPT_STORE_ASSOCIATED_VOLUMES)){
 	//	we can output the associated array directly
 		VolumeContainer& assVols = m_aaVolumeContainerEDGE[e];
 		if(assVols.empty())
@@ -2850,7 +2931,7 @@ void Grid::get_associated(SecureVolumeContainer& vols, Edge* e)
 	//	VRTOPT_STORE_ASSOCIATED_VOLUMES has to be enabled for this. Only continue,
 	//	if volumes exist at all
 		vols.clear();
-		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES)){
+		if(!option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES)){
 		//	only enable the option if volumes exist at all
 			if(num<Volume>() == 0){
 				return;
@@ -2880,8 +2961,13 @@ void Grid::get_associated(SecureVolumeContainer& vols, Edge* e)
 
 void Grid::get_associated(SecureVolumeContainer& vols, Face* f)
 {
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(vols, f);
+		return;
+	}
+
 //	best option: FACEOPT_STORE_ASSOCIATED_VOLUMES
-	if(option_is_enabled(FACEOPT_STORE_ASSOCIATED_VOLUMES)){
+	if(option_is_active(FACEOPT_STORE_ASSOCIATED_VOLUMES)){
 	//	we can output the associated array directly
 		VolumeContainer& assVols = m_aaVolumeContainerFACE[f];
 		if(assVols.empty())
@@ -2901,7 +2987,7 @@ void Grid::get_associated_vols_raw(SecureVolumeContainer& vols, Face* f)
 //	VRTOPT_STORE_ASSOCIATED_VOLUMES has to be enabled for this. Only continue,
 //	if volumes exist at all
 	vols.clear();
-	if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES)){
+	if(!option_is_active(VRTOPT_STORE_ASSOCIATED_VOLUMES)){
 	//	only enable the option if volumes exist at all
 		if(num<Volume>() == 0){
 			return;
@@ -2952,8 +3038,16 @@ void Grid::get_associated_sorted(SecureEdgeContainer& edges, Vertex*)
 
 void Grid::get_associated_sorted(SecureEdgeContainer& edges, Face* f)
 {
+//	the snapshot stores the elements in local order. If some are missing,
+//	the gaps can't be detected from the snapshot alone.
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(edges, f);
+		if(edges.size() == f->num_edges())
+			return;
+	}
+
 //	to improve performance, we first check the grid options.
-	if(option_is_enabled(FACEOPT_AUTOGENERATE_EDGES
+	if(option_is_active(FACEOPT_AUTOGENERATE_EDGES
 					   | FACEOPT_STORE_ASSOCIATED_EDGES))
 	{
 	//	we can output the associated array directly
@@ -2980,10 +3074,18 @@ void Grid::get_associated_sorted(SecureEdgeContainer& edges, Face* f)
 
 void Grid::get_associated_sorted(SecureEdgeContainer& edges, Volume* v)
 {
+//	the snapshot stores the elements in local order. If some are missing,
+//	the gaps can't be detected from the snapshot alone.
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(edges, v);
+		if(edges.size() == v->num_edges())
+			return;
+	}
+
 //	to improve performance, we first check the grid options.
-	if(option_is_enabled(VOLOPT_AUTOGENERATE_EDGES
+	if(option_is_active(VOLOPT_AUTOGENERATE_EDGES
 							| VOLOPT_STORE_ASSOCIATED_EDGES)
-		|| option_is_enabled(VOLOPT_AUTOGENERATE_FACES
+		|| option_is_active(VOLOPT_AUTOGENERATE_FACES
 							| FACEOPT_AUTOGENERATE_EDGES
 							| VOLOPT_STORE_ASSOCIATED_EDGES))
 	{
@@ -3021,8 +3123,16 @@ void Grid::get_associated_sorted(SecureFaceContainer& faces, Edge*)
 
 void Grid::get_associated_sorted(SecureFaceContainer& faces, Volume* v)
 {
+//	the snapshot stores the elements in local order. If some are missing,
+//	the gaps can't be detected from the snapshot alone.
+	if(m_pAdjacencySnapshot){
+		m_pAdjacencySnapshot->get_associated(faces, v);
+		if(faces.size() == v->num_faces())
+			return;
+	}
+
 //	to improve performance, we first check the grid options.
-	if(option_is_enabled(VOLOPT_AUTOGENERATE_FACES
+	if(option_is_active(VOLOPT_AUTOGENERATE_FACES
 					   | VOLOPT_STORE_ASSOCIATED_FACES))
 	{
 	//	we can output the associated array directly
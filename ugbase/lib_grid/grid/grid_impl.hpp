@@ -136,6 +136,18 @@ void Grid::reserve(size_t num)
 	element_storage<TGeomObj>().m_attachmentPipe.reserve(num);
 }
 
+////////////////////////////////////////////////////////////////////////
+template <class TGeomObj>
+void Grid::reorder_elements(const std::vector<TGeomObj*>& vNewOrder)
+{
+	STATIC_ASSERT(geometry_traits<TGeomObj>::BASE_OBJECT_ID != -1,
+				invalid_geometry_type);
+
+	typename traits<TGeomObj>::ElementStorage& es = element_storage<TGeomObj>();
+	ReorderSectionContainer(es.m_sectionContainer, vNewOrder);
+	es.m_attachmentPipe.align_data_with_elements();
+}
+
 ////////////////////////////////////////////////////////////////////////
 //	erase
 template <class GeomObjIter>
@@ -31,11 +31,15 @@
  */
 
 #include <algorithm>
+#include <cmath>
+#include <map>
 #include "load_balancer.h"
 #include "load_balancer_util.h"
 #include "distribution.h"
 #include "distributed_grid.h"
 #include "lib_grid/parallelization/parallelization_util.h"
+#include "lib_grid/parallelization/util/compol_subset.h"
+#include "lib_grid/parallelization/util/parallel_dual_graph.h"
 #include "common/util/table.h"
 
 #ifdef UG_PARMETIS
@@ -254,7 +258,12 @@ LoadBalancer() :
 	m_mg(NULL),
 	m_balanceThreshold(0.9),
 	m_elementThreshold(1),
-	m_createVerticalInterfaces(true)
+	m_createVerticalInterfaces(true),
+	m_incrementalRebalancing(false),
+	m_maxDiffusionSteps(100),
+	m_numMigratedElems(0),
+	m_lastNumActiveHLevels(0),
+	m_lastNumProcsInvolved(0)
 {
 	m_processHierarchy = ProcessHierarchy::create();
 	m_balanceWeights = make_sp(new StdBalanceWeights());
@@ -321,6 +330,18 @@ set_element_threshold(size_t threshold)
 	m_elementThreshold = threshold;
 }
 
+void LoadBalancer::
+enable_incremental_rebalancing(bool enable)
+{
+	m_incrementalRebalancing = enable;
+}
+
+void LoadBalancer::
+set_max_diffusion_steps(size_t numSteps)
+{
+	m_maxDiffusionSteps = numSteps;
+}
+
 bool LoadBalancer::
 problems_occurred()
 {
@@ -329,19 +350,23 @@ problems_occurred()
 	return false;
 }
 
+int LoadBalancer::
+highest_element_type()
+{
+	int highestElem = VERTEX;
+	if(m_mg->num<Volume>() > 0)		highestElem = VOLUME;
+	else if(m_mg->num<Face>() > 0)	highestElem = FACE;
+	else if(m_mg->num<Edge>() > 0)	highestElem = EDGE;
+
+	pcl::ProcessCommunicator procCom;
+	return procCom.allreduce(highestElem, PCL_RO_MAX);
+}
+
 number LoadBalancer::
 estimate_distribution_quality(std::vector<number>* pLvlQualitiesOut)
 {
 	if(m_mg){
-		int highestElem = VERTEX;
-		if(m_mg->num<Volume>() > 0)		highestElem = VOLUME;
-		else if(m_mg->num<Face>() > 0)	highestElem = FACE;
-		else if(m_mg->num<Edge>() > 0)	highestElem = EDGE;
-
-		pcl::ProcessCommunicator procCom;
-		highestElem = procCom.allreduce(highestElem, PCL_RO_MAX);
-
-		switch(highestElem){
+		switch(highest_element_type()){
 		case VERTEX:
 			return estimate_distribution_quality_impl<Vertex>(pLvlQualitiesOut);
 		case EDGE:
@@ -456,6 +481,448 @@ estimate_distribution_quality()
 	return estimate_distribution_quality(&v);
 }
 
+size_t LoadBalancer::
+num_migrating_elements(SubsetHandler& shPartition, const std::vector<int>* procMap)
+{
+	switch(highest_element_type()){
+		case VERTEX:
+			return num_migrating_elements_impl<Vertex>(shPartition, procMap);
+		case EDGE:
+			return num_migrating_elements_impl<Edge>(shPartition, procMap);
+		case FACE:
+			return num_migrating_elements_impl<Face>(shPartition, procMap);
+		case VOLUME:
+			return num_migrating_elements_impl<Volume>(shPartition, procMap);
+	}
+	return 0;
+}
+
+template <class TElem>
+size_t LoadBalancer::
+num_migrating_elements_impl(SubsetHandler& shPartition, const std::vector<int>* procMap)
+{
+	typedef typename Grid::traits<TElem>::iterator ElemIter;
+
+	MultiGrid& mg = *m_mg;
+	DistributedGridManager& distGridMgr = *mg.distributed_grid_manager();
+	const int localProc = pcl::ProcRank();
+
+	size_t numMigrating = 0;
+	for(ElemIter iter = mg.begin<TElem>(); iter != mg.end<TElem>(); ++iter){
+		if(distGridMgr.is_ghost(*iter))
+			continue;
+		int si = shPartition.get_subset_index(*iter);
+		if(si < 0)
+			continue;
+		int targetProc = si;
+		if(procMap)
+			targetProc = procMap->at(si);
+		if(targetProc != localProc)
+			++numMigrating;
+	}
+
+	pcl::ProcessCommunicator comGlobal;
+	return comGlobal.allreduce(numMigrating, PCL_RO_SUM);
+}
+
+size_t LoadBalancer::
+num_active_hierarchy_levels()
+{
+	pcl::ProcessCommunicator comGlobal;
+	int topLvl = comGlobal.allreduce((int)m_mg->num_levels() - 1, PCL_RO_MAX);
+
+	size_t numActive = 0;
+	const ProcessHierarchy& procH = *m_processHierarchy;
+	for(size_t i = 0; i < procH.num_hierarchy_levels(); ++i){
+		if((int)procH.grid_base_level(i) <= topLvl)
+			numActive = i + 1;
+	}
+	return numActive;
+}
+
+bool LoadBalancer::
+rebalance_incremental()
+{
+	GDIST_PROFILE_FUNC();
+
+//	incremental rebalancing can only be performed if the last redistribution
+//	was performed with the same setup of the process hierarchy.
+	size_t numActive = num_active_hierarchy_levels();
+	if((numActive == 0)
+		|| (numActive != m_lastNumActiveHLevels)
+		|| (m_processHierarchy->num_global_procs_involved(numActive - 1)
+			!= m_lastNumProcsInvolved))
+	{
+		return false;
+	}
+
+	switch(highest_element_type()){
+		case EDGE:
+			return rebalance_incremental_impl<Edge>();
+		case FACE:
+			return rebalance_incremental_impl<Face>();
+		case VOLUME:
+			return rebalance_incremental_impl<Volume>();
+	}
+	return false;
+}
+
+template <class TElem>
+bool LoadBalancer::
+rebalance_incremental_impl()
+{
+	GDIST_PROFILE_FUNC();
+	UG_DLOG(LIB_GRID, 1, "LoadBalancer-start rebalance_incremental\n");
+
+	typedef TElem elem_t;
+	typedef typename Grid::traits<elem_t>::iterator ElemIter;
+	typedef typename GridLayoutMap::Types<elem_t>::Layout::LevelLayout layout_t;
+	using std::min;
+	using std::max;
+
+//	the diffusion is stopped as soon as the load of each process deviates from
+//	the average load by at most this fraction
+	const number diffusionTolerance = 0.01;
+
+	MultiGrid& mg = *m_mg;
+	DistributedGridManager& distGridMgr = *mg.distributed_grid_manager();
+	GridLayoutMap& glm = distGridMgr.grid_layout_map();
+	IBalanceWeights& wgts = *m_balanceWeights;
+	const int localProc = pcl::ProcRank();
+
+//	only the elements of the highest hierarchy level are rebalanced. Elements
+//	on its base level are migrated together with all their descendants.
+	const ProcessHierarchy& procH = *m_processHierarchy;
+	const size_t hlvl = m_lastNumActiveHLevels - 1;
+	if(procH.num_global_procs_involved(hlvl) <= 1)
+		return false;
+
+	const int baseLvl = (int)procH.grid_base_level(hlvl);
+	pcl::ProcessCommunicator comGlobal;
+	const int topLvl = comGlobal.allreduce((int)mg.num_levels() - 1, PCL_RO_MAX);
+	pcl::ProcessCommunicator procCom = procH.global_proc_com(hlvl);
+
+//	as for the partitioner, no redistribution is performed if the processes
+//	would hold less elements than the element threshold in average
+	size_t numLocalElems = 0;
+	for(int lvl = baseLvl; lvl < (int)mg.num_levels(); ++lvl){
+		for(ElemIter iter = mg.begin<elem_t>(lvl); iter != mg.end<elem_t>(lvl); ++iter){
+			if(!distGridMgr.is_ghost(*iter))
+				++numLocalElems;
+		}
+	}
+	const size_t numElems = comGlobal.allreduce(numLocalElems, PCL_RO_SUM);
+	if(numElems < m_elementThreshold * (size_t)procH.num_global_procs_involved(hlvl)){
+		UG_DLOG(LIB_GRID, 1, "LoadBalancer-stop rebalance_incremental (element threshold)\n");
+		return false;
+	}
+
+	SubsetHandler shPartition(mg);
+	for(int lvl = 0; lvl <= topLvl; ++lvl)
+		shPartition.assign_subset(mg.begin<elem_t>(lvl), mg.end<elem_t>(lvl), localProc);
+
+//	the pre- and post-processors of the partitioner are applied as during
+//	partitioning. The post-processor adjusts the assignment of the base level.
+	SPPartitionPreProcessor preProcessor = m_partitioner->partition_pre_processor();
+	SPPartitionPostProcessor postProcessor = m_partitioner->partition_post_processor();
+	if(preProcessor.valid())
+		preProcessor->partitioning_starts(&mg, m_partitioner.get());
+	if(postProcessor.valid())
+		postProcessor->init_post_processing(&mg, &shPartition);
+
+	bool incrementalPossible = true;
+	{
+	//	accumulate the weights of all descendants in the elements of the base level
+		ANumber aWeight;
+		mg.attach_to<elem_t>(aWeight);
+		Grid::AttachmentAccessor<elem_t, ANumber> aaWeight(mg, aWeight);
+
+		for(int lvl = topLvl; lvl >= baseLvl; --lvl){
+			for(ElemIter iter = mg.begin<elem_t>(lvl); iter != mg.end<elem_t>(lvl); ++iter)
+			{
+				elem_t* e = *iter;
+				number w = 0;
+				if(!distGridMgr.is_ghost(e))
+					w = wgts.get_weight(e);
+				size_t numChildren = mg.num_children<elem_t>(e);
+				for(size_t i = 0; i < numChildren; ++i)
+					w += aaWeight[mg.get_child<elem_t>(e, i)];
+				aaWeight[e] = w;
+			}
+		}
+
+		ParallelDualGraph<elem_t, int> dualGraph(&mg);
+		vector<int> elemTargets;
+
+		if(!procCom.empty()){
+			dualGraph.generate_graph(baseLvl, procCom);
+			pcl::ProcessCommunicator graphCom = dualGraph.process_communicator();
+
+			const int numVrts = dualGraph.num_graph_vertices();
+			const int numGraphEdges = dualGraph.num_graph_edges();
+			int* adjStruct = NULL;
+			int* adjMap = NULL;
+			int* offsets = NULL;
+			int localOffset = 0;
+			if(numVrts > 0){
+				adjStruct = dualGraph.adjacency_map_structure();
+				offsets = dualGraph.parallel_offset_map();
+				localOffset = offsets[graphCom.get_local_proc_id()];
+			}
+			if(numGraphEdges > 0)
+				adjMap = dualGraph.adjacency_map();
+
+		//	group the graph vertices to clusters which are migrated as a whole.
+		//	If clustered siblings are enabled, all children of a parent form a cluster.
+			const bool clusterSiblings = m_partitioner->clustered_siblings_enabled();
+			vector<int> vrtCluster(numVrts);
+			vector<vector<int> > clusterVrts;
+			vector<number> clusterWeights;
+			map<GridObject*, int> parentClusters;
+			number localLoad = 0;
+			for(int i = 0; i < numVrts; ++i){
+				elem_t* e = dualGraph.get_element(i);
+				GridObject* parent = mg.get_parent(e);
+				int ci = -1;
+				if(clusterSiblings && parent){
+					map<GridObject*, int>::iterator iter = parentClusters.find(parent);
+					if(iter != parentClusters.end())
+						ci = iter->second;
+					else
+						parentClusters[parent] = ci = (int)clusterVrts.size();
+				}
+				else
+					ci = (int)clusterVrts.size();
+
+				if(ci == (int)clusterVrts.size()){
+					clusterVrts.push_back(vector<int>());
+					clusterWeights.push_back(0);
+				}
+				vrtCluster[i] = ci;
+				clusterVrts[ci].push_back(i);
+				clusterWeights[ci] += aaWeight[e];
+				localLoad += aaWeight[e];
+			}
+
+		//	find neighbor processes and the clusters at the boundaries to each of them.
+		//	Neighbors are stored by their index in procCom.
+			vector<int> nbrProcs;
+			vector<vector<int> > nbrBoundaryClusters;
+			for(int i = 0; i < numVrts; ++i){
+				for(int j = adjStruct[i]; j < adjStruct[i + 1]; ++j){
+					int gvrt = adjMap[j];
+					if((gvrt >= localOffset) && (gvrt < localOffset + numVrts))
+						continue;
+					int graphProc = (int)(upper_bound(offsets, offsets + graphCom.size() + 1, gvrt)
+										  - offsets) - 1;
+					int nbrProc = procCom.get_local_proc_id(graphCom.get_proc_id(graphProc));
+					size_t ni = find(nbrProcs.begin(), nbrProcs.end(), nbrProc) - nbrProcs.begin();
+					if(ni == nbrProcs.size()){
+						nbrProcs.push_back(nbrProc);
+						nbrBoundaryClusters.push_back(vector<int>());
+					}
+					nbrBoundaryClusters[ni].push_back(vrtCluster[i]);
+				}
+			}
+
+		//	the diffusion requires that each process already holds some load
+			const size_t numProcs = procCom.size();
+			const int localProcInd = procCom.get_local_proc_id();
+			const pcl::DataType numberType = pcl::DataTypeTraits<number>::get_data_type();
+			vector<number> loads(numProcs);
+			procCom.allgather(&localLoad, 1, numberType, &loads.front(), 1, numberType);
+			number totalLoad = 0;
+			for(size_t i = 0; i < numProcs; ++i){
+				totalLoad += loads[i];
+				if(loads[i] <= 0)
+					incrementalPossible = false;
+			}
+			const vector<number> initialLoads = loads;
+
+			if(incrementalPossible){
+				int numNbrs = (int)nbrProcs.size();
+				vector<int> numProcNbrs(numProcs);
+				procCom.allgather(&numNbrs, 1, PCL_DT_INT, &numProcNbrs.front(), 1, PCL_DT_INT);
+
+			//	first order diffusion on the process graph. The flows between
+			//	neighbored processes are accumulated during the diffusion steps.
+			//	Since all processes operate on the same gathered loads, the flow
+			//	from p to q is the negative flow from q to p.
+				const number avgLoad = totalLoad / (number)numProcs;
+				vector<number> flows(nbrProcs.size(), 0);
+				for(size_t step = 0; step < m_maxDiffusionSteps; ++step){
+					number maxDeviation = 0;
+					for(size_t i = 0; i < numProcs; ++i)
+						maxDeviation = max(maxDeviation, fabs(loads[i] - avgLoad));
+					if(maxDeviation <= diffusionTolerance * avgLoad)
+						break;
+
+					number newLoad = loads[localProcInd];
+					for(size_t i = 0; i < nbrProcs.size(); ++i){
+						int q = nbrProcs[i];
+						number alpha = 1. / (number)(max(numNbrs, numProcNbrs[q]) + 1);
+						number flow = alpha * (loads[localProcInd] - loads[q]);
+						flows[i] += flow;
+						newLoad -= flow;
+					}
+					procCom.allgather(&newLoad, 1, numberType, &loads.front(), 1, numberType);
+				}
+
+			//	migrate clusters to neighbors with positive flows. Starting at the
+			//	boundary to a neighbor, clusters are added in a breadth first manner
+			//	until the flow is satisfied.
+				vector<pair<number, int> > nbrOrder(nbrProcs.size());
+				for(size_t i = 0; i < nbrOrder.size(); ++i)
+					nbrOrder[i] = make_pair(flows[i], (int)i);
+				sort(nbrOrder.rbegin(), nbrOrder.rend());
+
+				vector<int> clusterTargets(clusterVrts.size(), -1);
+				vector<int> clusterVisited(clusterVrts.size(), -1);
+				number remainingLoad = localLoad;
+				vector<int> queue;
+				for(size_t i_nbr = 0; i_nbr < nbrOrder.size(); ++i_nbr){
+					const int ni = nbrOrder[i_nbr].second;
+					const number flow = flows[ni];
+					if(flow <= 0)
+						break;
+
+					const int targetProc = procCom.get_proc_id(nbrProcs[ni]);
+					number migrated = 0;
+					queue = nbrBoundaryClusters[ni];
+					for(size_t i_queue = 0; (i_queue < queue.size()) && (migrated < flow); ++i_queue)
+					{
+						const int ci = queue[i_queue];
+						if((clusterTargets[ci] != -1) || (clusterVisited[ci] == ni))
+							continue;
+						clusterVisited[ci] = ni;
+
+					//	don't overshoot the flow and never migrate all elements
+						const number cw = clusterWeights[ci];
+						if((migrated + 0.5 * cw > flow) || (remainingLoad - cw <= 0))
+							continue;
+
+						clusterTargets[ci] = targetProc;
+						migrated += cw;
+						remainingLoad -= cw;
+
+						for(size_t i = 0; i < clusterVrts[ci].size(); ++i){
+							int vrt = clusterVrts[ci][i];
+							for(int j = adjStruct[vrt]; j < adjStruct[vrt + 1]; ++j){
+								int lvrt = adjMap[j] - localOffset;
+								if((lvrt >= 0) && (lvrt < numVrts)
+									&& (clusterTargets[vrtCluster[lvrt]] == -1))
+								{
+									queue.push_back(vrtCluster[lvrt]);
+								}
+							}
+						}
+					}
+				}
+
+				for(int i = 0; i < numVrts; ++i){
+					int targetProc = clusterTargets[vrtCluster[i]];
+					if(targetProc != -1)
+						shPartition.assign_subset(dualGraph.get_element(i), targetProc);
+				}
+
+				if(postProcessor.valid())
+					postProcessor->post_process(baseLvl);
+
+			//	estimate the quality of the new distribution. If it stays below
+			//	the balance threshold (e.g. since the clusters are too heavy
+			//	to satisfy the flows), a complete repartitioning is performed.
+				vector<number> loadChanges(numProcs, 0), newLoads;
+				for(int i = 0; i < numVrts; ++i){
+					elem_t* e = dualGraph.get_element(i);
+					int targetProc = shPartition.get_subset_index(e);
+					if(targetProc == localProc)
+						continue;
+					int targetInd = procCom.get_local_proc_id(targetProc);
+					if(targetInd < 0){
+						incrementalPossible = false;
+						continue;
+					}
+					loadChanges[localProcInd] -= aaWeight[e];
+					loadChanges[targetInd] += aaWeight[e];
+				}
+				procCom.allreduce(loadChanges, newLoads, PCL_RO_SUM);
+
+				number maxLoad = 0;
+				for(size_t i = 0; i < numProcs; ++i){
+					newLoads[i] += initialLoads[i];
+					maxLoad = max(maxLoad, newLoads[i]);
+					if(newLoads[i] <= 0)
+						incrementalPossible = false;
+				}
+				number quality = 1;
+				if(maxLoad > 0)
+					quality = (totalLoad - maxLoad) / (maxLoad * number(numProcs - 1));
+				UG_DLOG(LIB_GRID, 1, "LoadBalancer-rebalance_incremental: estimated quality "
+						<< quality << "\n");
+				if(quality < m_balanceThreshold)
+					incrementalPossible = false;
+			}
+		}
+
+		mg.detach_from<elem_t>(aWeight);
+
+		incrementalPossible = (comGlobal.allreduce((int)incrementalPossible, PCL_RO_MIN) != 0);
+	}
+
+	if(preProcessor.valid())
+		preProcessor->partitioning_done(&mg, m_partitioner.get());
+	if(postProcessor.valid())
+		postProcessor->partitioning_done();
+
+	if(!incrementalPossible){
+		UG_DLOG(LIB_GRID, 1, "LoadBalancer-stop rebalance_incremental (not possible)\n");
+		return false;
+	}
+
+//	descendants of migrated elements are migrated, too
+	for(int lvl = baseLvl; lvl < topLvl; ++lvl){
+		for(ElemIter iter = mg.begin<elem_t>(lvl); iter != mg.end<elem_t>(lvl); ++iter)
+		{
+			int si = shPartition.get_subset_index(*iter);
+			size_t numChildren = mg.num_children<elem_t>(*iter);
+			for(size_t i = 0; i < numChildren; ++i)
+				shPartition.assign_subset(mg.get_child<elem_t>(*iter, i), si);
+		}
+	}
+
+//	vertical masters are sent to the processes to which their slaves are sent
+//	(cf. Partitioner_DynamicBisection)
+	pcl::InterfaceCommunicator<layout_t> intfcCom;
+	ComPol_Subset<layout_t>	compolSHCopy(shPartition, true);
+	for(int lvl = 0; lvl <= topLvl; ++lvl){
+		if(glm.has_layout<elem_t>(INT_V_SLAVE))
+			intfcCom.send_data(glm.get_layout<elem_t>(INT_V_SLAVE).layout_on_level(lvl),
+							   compolSHCopy);
+		if(glm.has_layout<elem_t>(INT_V_MASTER))
+			intfcCom.receive_data(glm.get_layout<elem_t>(INT_V_MASTER).layout_on_level(lvl),
+								  compolSHCopy);
+		intfcCom.communicate();
+	}
+
+	size_t numMigrating = num_migrating_elements(shPartition, NULL);
+	if(numMigrating == 0){
+	//	the imbalance persists, since rebalance is only called for a bad quality
+		UG_DLOG(LIB_GRID, 1, "LoadBalancer-stop rebalance_incremental (no migration)\n");
+		return false;
+	}
+	m_numMigratedElems += numMigrating;
+
+	UG_LOG("Incremental redistribution: migrating " << numMigrating << " elements...\n");
+	if(!DistributeGrid(mg, shPartition, m_serializer, m_createVerticalInterfaces, NULL))
+	{
+		UG_THROW("DistributeGrid failed!");
+	}
+
+	UG_LOG("Redistribution done\n");
+	UG_DLOG(LIB_GRID, 1, "LoadBalancer-stop rebalance_incremental\n");
+	return true;
+}
+
 bool LoadBalancer::
 rebalance()
 {
@@ -482,7 +949,7 @@ rebalance()
 //	distribution quality is only interesting if repartitioning is supported.
 //	If it is not we'll set it to -1, thus calling partition anyways
 	number distQuality = -1;
-	if(m_partitioner->supports_repartitioning()){
+	if(m_partitioner->supports_repartitioning() || m_incrementalRebalancing){
 		distQuality = estimate_distribution_quality();
 		if(!m_partitioner->verbose()){
 			UG_LOG("Current estimated distribution quality: " << distQuality << "\n");
@@ -491,6 +958,11 @@ rebalance()
 
 	if(m_balanceThreshold > distQuality)
 	{
+		if(m_incrementalRebalancing && rebalance_incremental()){
+			UG_DLOG(LIB_GRID, 1, "LoadBalancer-stop rebalance\n");
+			return true;
+		}
+
 		UG_DLOG(LIB_GRID, 1, "LoadBalancer-rebalance: partitioning...\n");
 		if(m_partitioner->partition(0, m_elementThreshold)){
 			UG_LOG("Redistributing...\n");
@@ -501,6 +973,14 @@ rebalance()
 //			}
 
 			const std::vector<int>* procMap = m_partitioner->get_process_map();
+			m_numMigratedElems += num_migrating_elements(sh, procMap);
+
+			m_lastNumActiveHLevels = num_active_hierarchy_levels();
+			m_lastNumProcsInvolved = 0;
+			if(m_lastNumActiveHLevels > 0){
+				m_lastNumProcsInvolved = m_processHierarchy->num_global_procs_involved(
+												m_lastNumActiveHLevels - 1);
+			}
 
 			UG_DLOG(LIB_GRID, 1, "LoadBalancer-rebalance: distributing...\n");
 			if(!DistributeGrid(*m_mg, sh, m_serializer, m_createVerticalInterfaces, procMap))
@@ -533,25 +1013,29 @@ create_quality_record(const char* label)
 //	fill header first
 	if(m_qualityRecords(0, 0).str().empty()){
 		m_qualityRecords(0, 0) << "level:";
+		m_qualityRecords(0, 1) << "migrated:";
 	}
 	for(size_t i = 0; i < lvlQualities.size(); ++i){
-		if(m_qualityRecords(0, 2*i + 1).str().empty())
-			m_qualityRecords(0, 2*i + 1) << i;
+		if(m_qualityRecords(0, 2*i + 2).str().empty())
+			m_qualityRecords(0, 2*i + 2) << i;
 	}
 
 	if(procH.valid()){
 		size_t ri = max<size_t>(1, m_qualityRecords.num_rows());
 		m_qualityRecords(ri, 0) << label;
+	//	number of elements migrated since the last record
+		m_qualityRecords(ri, 1) << m_numMigratedElems;
+		m_numMigratedElems = 0;
 		for(size_t i = 0; i < lvlQualities.size(); ++i){
 			size_t hlvl = procH->hierarchy_level_from_grid_level(i);
 
 			if(i == procH->grid_base_level(hlvl)){
 			//	redistribution takes place on this level
-				m_qualityRecords(ri, 2*i+1) << "(p" << procH->num_global_procs_involved(hlvl) << ")";
+				m_qualityRecords(ri, 2*i+2) << "(p" << procH->num_global_procs_involved(hlvl) << ")";
 			}
 			else
-				m_qualityRecords(ri, 2*i+1) << "-";
-			m_qualityRecords(ri, 2*i+2) << lvlQualities[i];
+				m_qualityRecords(ri, 2*i+2) << "-";
+			m_qualityRecords(ri, 2*i+3) << lvlQualities[i];
 		}
 	}
 }
@@ -93,6 +93,26 @@ class LoadBalancer{
 	 * performed on that level. Default is 1.*/
 		virtual void set_element_threshold(size_t threshold);
 
+	///	enables incremental rebalancing, which only migrates elements at partition boundaries
+	/**	If enabled, rebalance does not repartition the grid from scratch if
+	 * the process hierarchy did not change since the last redistribution.
+	 * Instead the imbalance is diffused between neighbored processes of the
+	 * highest hierarchy level and only clusters of elements at the boundaries
+	 * between those processes are migrated. This is considerably cheaper than
+	 * a complete redistribution, if the imbalance is small (e.g. after a few
+	 * adaptive refinement steps). If the incremental scheme can't be applied
+	 * (e.g. since a process of the hierarchy level doesn't contain elements yet)
+	 * or wouldn't restore the balance threshold, the specified partitioner is
+	 * used instead.
+	 *
+	 * Disabled by default.*/
+		virtual void enable_incremental_rebalancing(bool enable);
+		bool incremental_rebalancing_enabled() const	{return m_incrementalRebalancing;}
+
+	///	maximal number of diffusion steps performed during incremental rebalancing
+	/**	Set to 100 by default.*/
+		virtual void set_max_diffusion_steps(size_t numSteps);
+
 //	///	returns the quality of the current distribution
 //		virtual number distribution_quality();
 
@@ -112,6 +132,9 @@ class LoadBalancer{
 	 * given level. Furthermore it tries to minimize the connection-weights of
 	 * edges which connect elements on different processes.
 	 *
+	 * If incremental rebalancing is enabled, only elements at the boundaries of
+	 * the current partitions are migrated (cf. enable_incremental_rebalancing).
+	 *
 	 * The method returns false if e.g. problems during partitioning occurred.*/
 		virtual bool rebalance();
 
@@ -147,6 +170,9 @@ class LoadBalancer{
 	 *			fullfill all given specifications.*/
 		bool problems_occurred();
 
+	///	records the distribution quality of each level.
+	/**	Besides the qualities, the number of elements which were migrated during
+	 * all rebalancing steps since the last record is stored.*/
 		void create_quality_record(const char* label);
 		void print_quality_records() const;
 		void print_last_quality_record() const;
@@ -155,6 +181,32 @@ class LoadBalancer{
 		template <class TElem>
 		number estimate_distribution_quality_impl(std::vector<number>* pLvlQualitiesOut);
 
+	///	returns the highest dimensional element type (VERTEX, EDGE, ...) of the grid on all processes
+		int highest_element_type();
+
+	///	returns the global number of elements which will be migrated with the given partition map
+		size_t num_migrating_elements(SubsetHandler& shPartition,
+									  const std::vector<int>* procMap);
+
+		template <class TElem>
+		size_t num_migrating_elements_impl(SubsetHandler& shPartition,
+										   const std::vector<int>* procMap);
+
+	///	number of hierarchy levels of the current process hierarchy which contain elements
+		size_t num_active_hierarchy_levels();
+
+	///	performs incremental rebalancing if possible.
+	/**	Returns false, if the incremental scheme can't be applied, if no elements
+	 * would be migrated or if the estimated quality of the new distribution
+	 * would stay below the balance threshold. In this case nothing was changed
+	 * and a complete repartitioning should be performed.
+	 * The pre- and post-processors of the partitioner are applied.
+	 * The returned value is the same on all processes.*/
+		bool rebalance_incremental();
+
+		template <class TElem>
+		bool rebalance_incremental_impl();
+
 		MultiGrid*			m_mg;
 		number				m_balanceThreshold;
 		size_t				m_elementThreshold;
@@ -165,6 +217,13 @@ class LoadBalancer{
 		GridDataSerializationHandler	m_serializer;
 		StringStreamTable	m_qualityRecords;
 		bool m_createVerticalInterfaces;
+
+		bool				m_incrementalRebalancing;
+		size_t				m_maxDiffusionSteps;
+		size_t				m_numMigratedElems;
+	//	setup of the process hierarchy during the last redistribution
+		size_t				m_lastNumActiveHLevels;
+		size_t				m_lastNumProcsInvolved;
 };
 
 ///	\}
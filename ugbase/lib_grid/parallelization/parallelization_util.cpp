@@ -37,6 +37,7 @@
 #include "lib_grid/file_io/file_io.h"
 #include "lib_grid/algorithms/subset_util.h"
 #include "pcl/pcl_layout_tests.h"
+#include "common/serialization.h"
 
 using namespace std;
 
@@ -223,5 +224,107 @@ bool TestGridLayoutMap(MultiGrid& mg, GridLayoutMap& glm, bool verbose)
 	return false;
 }
 
+
+////////////////////////////////////////////////////////////////////////
+template <class TElem>
+static void SerializeLayouts(GridLayoutMap& glm,
+							 MultiElementAttachmentAccessor<AInt>& aaInt,
+							 BinaryBuffer& out)
+{
+	typedef typename GridLayoutMap::Types<TElem>::Map		TMap;
+	typedef typename GridLayoutMap::Types<TElem>::Layout	TLayout;
+	typedef typename TLayout::LevelLayout					TLevelLayout;
+	typedef typename TLayout::Interface						TInterface;
+
+	int numLayouts = 0;
+	for(typename TMap::iterator iter = glm.layouts_begin<TElem>();
+		iter != glm.layouts_end<TElem>(); ++iter)
+		++numLayouts;
+	Serialize(out, numLayouts);
+
+	for(typename TMap::iterator iter = glm.layouts_begin<TElem>();
+		iter != glm.layouts_end<TElem>(); ++iter)
+	{
+		TLayout& layout = iter->second;
+		Serialize(out, iter->first);
+		Serialize(out, (int)layout.num_levels());
+
+		for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl){
+			TLevelLayout& lvlLayout = layout.layout_on_level(lvl);
+			int numIntfcs = 0;
+			for(typename TLevelLayout::iterator iiter = lvlLayout.begin();
+				iiter != lvlLayout.end(); ++iiter)
+				++numIntfcs;
+			Serialize(out, numIntfcs);
+
+			for(typename TLevelLayout::iterator iiter = lvlLayout.begin();
+				iiter != lvlLayout.end(); ++iiter)
+			{
+				TInterface& intfc = lvlLayout.interface(iiter);
+				Serialize(out, lvlLayout.proc_id(iiter));
+				Serialize(out, (int)intfc.size());
+				for(typename TInterface::iterator eiter = intfc.begin();
+					eiter != intfc.end(); ++eiter)
+				{
+					Serialize(out, aaInt[intfc.get_element(eiter)]);
+				}
+			}
+		}
+	}
+}
+
+template <class TElem>
+static void DeserializeLayouts(GridLayoutMap& glm, BinaryBuffer& in,
+							   std::vector<TElem*>& elems)
+{
+	typedef typename GridLayoutMap::Types<TElem>::Layout	TLayout;
+	typedef typename TLayout::Interface						TInterface;
+
+	int numLayouts = Deserialize<int>(in);
+	for(int i_layout = 0; i_layout < numLayouts; ++i_layout){
+		GridLayoutMap::Key key = Deserialize<GridLayoutMap::Key>(in);
+		TLayout& layout = glm.get_layout<TElem>(key);
+		int numLevels = Deserialize<int>(in);
+
+		for(int lvl = 0; lvl < numLevels; ++lvl){
+			int numIntfcs = Deserialize<int>(in);
+			for(int i_intfc = 0; i_intfc < numIntfcs; ++i_intfc){
+				int procID = Deserialize<int>(in);
+				int numEntries = Deserialize<int>(in);
+				TInterface& intfc = layout.interface(procID, lvl);
+				for(int i = 0; i < numEntries; ++i){
+					int ind = Deserialize<int>(in);
+					UG_COND_THROW(ind < 0 || ind >= (int)elems.size(),
+								  "DeserializeGridLayoutMap: Bad element index "
+								  << ind << " in interface to process " << procID);
+					intfc.push_back(elems[ind]);
+				}
+			}
+		}
+	}
+}
+
+void SerializeGridLayoutMap(GridLayoutMap& glm,
+							MultiElementAttachmentAccessor<AInt>& aaInt,
+							BinaryBuffer& out)
+{
+	SerializeLayouts<Vertex>(glm, aaInt, out);
+	SerializeLayouts<Edge>(glm, aaInt, out);
+	SerializeLayouts<Face>(glm, aaInt, out);
+	SerializeLayouts<Volume>(glm, aaInt, out);
+}
+
+void DeserializeGridLayoutMap(GridLayoutMap& glm, BinaryBuffer& in,
+							  std::vector<Vertex*>& vrts,
+							  std::vector<Edge*>& edges,
+							  std::vector<Face*>& faces,
+							  std::vector<Volume*>& vols)
+{
+	DeserializeLayouts<Vertex>(glm, in, vrts);
+	DeserializeLayouts<Edge>(glm, in, edges);
+	DeserializeLayouts<Face>(glm, in, faces);
+	DeserializeLayouts<Volume>(glm, in, vols);
+}
+
 }//	end of namespace
 
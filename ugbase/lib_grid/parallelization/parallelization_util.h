@@ -34,6 +34,7 @@
 #define __H__LIB_GRID__PARALLELIZATION_UTIL__
 
 #include "distributed_grid.h"
+#include "common/util/binary_buffer.h"
 #include <boost/function.hpp>
 
 #define PROFILE_GRID_DISTRIBUTION
@@ -75,6 +76,31 @@ void CreateAndDistributeGlobalIDs(Grid& g, GridLayoutMap& glm,
 ///	Checks whether the grid-layout-map on this proc is consistent with connected ones.
 bool TestGridLayoutMap(MultiGrid& mg, GridLayoutMap& glm, bool verbose = true);
 
+////////////////////////////////////////////////////////////////////////
+///	Writes all interfaces of the given grid-layout-map to a binary stream.
+/**	Interface entries are written as indices, which are read from aaInt.
+ * aaInt thus has to hold valid indices for all interface elements, e.g. the
+ * ones assigned by SerializeMultiGridElements. The order of entries in each
+ * interface is preserved.
+ */
+void SerializeGridLayoutMap(GridLayoutMap& glm,
+							MultiElementAttachmentAccessor<AInt>& aaInt,
+							BinaryBuffer& out);
+
+////////////////////////////////////////////////////////////////////////
+///	Restores interfaces written by SerializeGridLayoutMap.
+/**	The given vectors have to contain the elements in the order of the indices
+ * which were used during serialization, e.g. as returned by
+ * DeserializeMultiGridElements. Entries are appended to the interfaces in glm.
+ * Note that you have to call DistributedGridManager::grid_layouts_changed
+ * afterwards.
+ */
+void DeserializeGridLayoutMap(GridLayoutMap& glm, BinaryBuffer& in,
+							  std::vector<Vertex*>& vrts,
+							  std::vector<Edge*>& edges,
+							  std::vector<Face*>& faces,
+							  std::vector<Volume*>& vols);
+
 ///	@}
 }//	end of namespace
 
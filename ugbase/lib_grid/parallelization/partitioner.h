@@ -188,6 +188,14 @@ class IPartitioner{
 			UG_THROW("Partition-Post-Processing is currently not supported by the chosen partitioner.");
 		}
 
+	///	returns the pre-processor set through set_partition_pre_processor. May be invalid.
+		virtual SPPartitionPreProcessor partition_pre_processor() const
+			{return SPNULL;}
+
+	///	returns the post-processor set through set_partition_post_processor. May be invalid.
+		virtual SPPartitionPostProcessor partition_post_processor() const
+			{return SPNULL;}
+
 		virtual ConstSPProcessHierarchy current_process_hierarchy() const = 0;
 		virtual ConstSPProcessHierarchy next_process_hierarchy() const = 0;
 
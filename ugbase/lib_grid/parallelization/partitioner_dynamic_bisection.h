@@ -99,6 +99,8 @@ class Partitioner_DynamicBisection : public IPartitioner{
 
 		virtual void set_partition_pre_processor(SPPartitionPreProcessor ppp);
 		virtual void set_partition_post_processor(SPPartitionPostProcessor ppp);
+		virtual SPPartitionPreProcessor partition_pre_processor() const		{return m_partitionPreProcessor;}
+		virtual SPPartitionPostProcessor partition_post_processor() const	{return m_partitionPostProcessor;}
 
 		virtual ConstSPProcessHierarchy current_process_hierarchy() const;
 		virtual ConstSPProcessHierarchy next_process_hierarchy() const;
@@ -0,0 +1,593 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "partitioner_sfc.h"
+#include "distributed_grid.h"
+#include "parallelization_util.h"
+#include "space_filling_curve_cuts.h"
+#include "lib_grid/parallelization/util/compol_copy_attachment.h"
+#include "lib_grid/parallelization/util/compol_subset.h"
+#include "lib_grid/algorithms/attachment_util.h"
+#include "lib_grid/algorithms/geom_obj_util/geom_obj_util.h"
+
+using namespace std;
+
+namespace ug{
+
+template <class TElem, int dim>
+Partitioner_SFC<TElem, dim>::
+Partitioner_SFC() :
+	m_mg(NULL),
+	m_curve(SFC_HILBERT),
+	m_tolerance(0.99),
+	m_fixedBoundingBox(false),
+	m_boxValid(false)
+{
+	m_processHierarchy = SPProcessHierarchy(new ProcessHierarchy);
+	m_processHierarchy->add_hierarchy_level(0, 1);
+
+	m_balanceWeights = make_sp(new IBalanceWeights());
+}
+
+template <class TElem, int dim>
+Partitioner_SFC<TElem, dim>::
+~Partitioner_SFC()
+{
+}
+
+////////////////////////////////
+//	SETTERS AND GETTERS
+////////////////////////////////
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+set_grid(MultiGrid* mg, Attachment<MathVector<dim> > aPos)
+{
+	m_mg = mg;
+	if(m_sh.valid())
+		m_sh->assign_grid(m_mg);
+	m_aPos = aPos;
+	m_aaPos.access(*m_mg, m_aPos);
+	m_boxValid = false;
+}
+
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+set_subset_handler(SmartPtr<SubsetHandler> sh)
+{
+	m_sh = sh;
+	if(m_mg)
+		m_sh->assign_grid(m_mg);
+}
+
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+enable_fixed_bounding_box(bool enable)
+{
+	m_fixedBoundingBox = enable;
+	m_boxValid = false;
+}
+
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+set_next_process_hierarchy(SPProcessHierarchy procHierarchy)
+{
+	m_nextProcessHierarchy = procHierarchy;
+}
+
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+set_balance_weights(SPBalanceWeights balanceWeights)
+{
+	m_balanceWeights = balanceWeights;
+}
+
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+set_partition_pre_processor(SPPartitionPreProcessor ppp)
+{
+	m_partitionPreProcessor = ppp;
+}
+
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+set_partition_post_processor(SPPartitionPostProcessor ppp)
+{
+	m_partitionPostProcessor = ppp;
+}
+
+template <class TElem, int dim>
+ConstSPProcessHierarchy Partitioner_SFC<TElem, dim>::
+current_process_hierarchy() const
+{
+	return m_processHierarchy;
+}
+
+template <class TElem, int dim>
+ConstSPProcessHierarchy Partitioner_SFC<TElem, dim>::
+next_process_hierarchy() const
+{
+	return m_nextProcessHierarchy;
+}
+
+template <class TElem, int dim>
+SubsetHandler& Partitioner_SFC<TElem, dim>::
+get_partitions()
+{
+	if(m_sh.invalid()){
+		if(m_mg)
+			m_sh = make_sp(new SubsetHandler(*m_mg));
+		else
+			m_sh = make_sp(new SubsetHandler());
+	}
+	return *m_sh;
+}
+
+template <class TElem, int dim>
+const std::vector<int>* Partitioner_SFC<TElem, dim>::
+get_process_map() const
+{
+	return NULL;
+}
+
+
+////////////////////////////////
+//	PARTITIONING
+////////////////////////////////
+template <class TElem, int dim>
+bool Partitioner_SFC<TElem, dim>::
+partition(size_t baseLvl, size_t elementThreshold)
+{
+	GDIST_PROFILE_FUNC();
+
+	UG_COND_THROW(m_mg == NULL,
+			"No grid was specified for Partitioner_SFC. "
+			"partitioning can't be executed without a specified grid.");
+
+	if(m_balanceWeights.invalid())
+		m_balanceWeights = make_sp(new IBalanceWeights());
+
+	MultiGrid& mg = *m_mg;
+	if(m_sh.invalid())
+		m_sh = make_sp(new SubsetHandler(mg));
+	SubsetHandler& sh = *m_sh;
+	sh.clear();
+
+	ANumber aWeight;
+	mg.attach_to<elem_t>(aWeight);
+
+	if(m_partitionPreProcessor.valid())
+		m_partitionPreProcessor->partitioning_starts(m_mg, this);
+
+	if(m_partitionPostProcessor.valid())
+		m_partitionPostProcessor->init_post_processing(m_mg, m_sh.get());
+
+//	the bounding box has to be computed after the pre-processor was executed,
+//	since it may alter the positions of vertices
+	update_bounding_box();
+
+//	assign all elements below baseLvl to the local process
+	for(int i = 0; i < (int)baseLvl; ++i)
+		sh.assign_subset(mg.begin<elem_t>(i), mg.end<elem_t>(i), 0);
+
+	const ProcessHierarchy* procH;
+	if(m_nextProcessHierarchy.valid())
+		procH = m_nextProcessHierarchy.get();
+	else
+		procH = m_processHierarchy.get();
+
+	m_problemsOccurred = false;
+
+//	iterate over procHierarchy levels and perform rebalancing for all
+//	hierarchy-sections which contain levels higher than baseLvl
+	for(size_t hlevel = 0; hlevel < procH->num_hierarchy_levels(); ++ hlevel)
+	{
+		int numProcs = procH->num_global_procs_involved(hlevel);
+
+		int minLvl = procH->grid_base_level(hlevel);
+		int maxLvl = (int)mg.top_level();
+
+		if(m_balanceWeights->has_level_offsets()){
+			if(mg.top_level() < procH->grid_base_level(hlevel)){
+			//	cf. Partitioner_DynamicBisection::partition
+				if((hlevel == 0) ||
+					((int)procH->num_global_procs_involved(hlevel - 1) != numProcs))
+				{
+					UG_LOG("Partitioner_SFC: Ignoring hierarchy level "
+						<< hlevel << " since it doesn't contain any elements yet\n");
+					m_problemsOccurred = true;
+				}
+				continue;
+			}
+		}
+
+		if(hlevel + 1 < procH->num_hierarchy_levels()){
+			maxLvl = min<int>(maxLvl,
+						(int)procH->grid_base_level(hlevel + 1) - 1);
+		}
+
+		if(minLvl < (int)baseLvl)
+			minLvl = (int)baseLvl;
+
+		if(maxLvl < minLvl)
+			continue;
+
+		if(numProcs <= 1){
+			for(int i = minLvl; i <= maxLvl; ++i)
+				sh.assign_subset(mg.begin<elem_t>(i), mg.end<elem_t>(i), 0);
+			continue;
+		}
+
+	//	if clustered siblings are enabled, we'll perform partitioning on the level
+	//	below minLvl (if such a level exists). However, only the partition-map
+	//	of minLvl and levels above will be adjusted.
+		int partitionLvl = minLvl;
+		pcl::ProcessCommunicator com;
+
+		if((minLvl > 0) && base_class::clustered_siblings_enabled()){
+			partitionLvl = minLvl - 1;
+			size_t partitionHLvl = m_processHierarchy->hierarchy_level_from_grid_level(partitionLvl);
+			com = m_processHierarchy->global_proc_com(partitionHLvl);
+		}
+		else
+			com = procH->global_proc_com(hlevel);
+
+		perform_partitioning(numProcs, minLvl, maxLvl, partitionLvl, aWeight, com);
+
+		for(int i = minLvl; i < maxLvl; ++i){
+			copy_partitions_to_children(sh, i);
+		}
+	}
+
+	if(m_nextProcessHierarchy.valid()){
+		*m_processHierarchy = *m_nextProcessHierarchy;
+		m_nextProcessHierarchy = SPProcessHierarchy(NULL);
+	}
+
+	mg.detach_from<elem_t>(aWeight);
+
+	if(m_partitionPreProcessor.valid())
+		m_partitionPreProcessor->partitioning_done(m_mg, this);
+
+	if(m_partitionPostProcessor.valid())
+		m_partitionPostProcessor->partitioning_done();
+
+	PCL_DEBUG_BARRIER_ALL();
+	return true;
+}
+
+
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+update_bounding_box()
+{
+	GDIST_PROFILE_FUNC();
+	typedef MultiGrid::traits<Vertex>::iterator VrtIter;
+
+	MultiGrid& mg = *m_mg;
+
+	number minMax[2 * dim];
+	for(int i = 0; i < dim; ++i){
+		minMax[i] = numeric_limits<number>::max();
+		minMax[dim + i] = numeric_limits<number>::max();
+	}
+
+//	we store the negative maximum, so that a single MIN-reduction suffices
+	for(VrtIter iter = mg.begin<Vertex>(); iter != mg.end<Vertex>(); ++iter){
+		const vector_t& p = m_aaPos[*iter];
+		for(int i = 0; i < dim; ++i){
+			minMax[i] = min(minMax[i], p[i]);
+			minMax[dim + i] = min(minMax[dim + i], -p[i]);
+		}
+	}
+
+	pcl::ProcessCommunicator globCom;
+	number gMinMax[2 * dim];
+	globCom.allreduce(minMax, gMinMax, 2 * dim, PCL_RO_MIN);
+
+	vector_t boxMin, boxMax;
+	for(int i = 0; i < dim; ++i){
+		boxMin[i] = gMinMax[i];
+		boxMax[i] = -gMinMax[dim + i];
+	}
+
+	if(m_fixedBoundingBox && m_boxValid){
+	//	keep the old box as long as it contains the whole grid
+		bool contained = true;
+		for(int i = 0; i < dim; ++i){
+			if((boxMin[i] < m_boxMin[i]) || (boxMax[i] > m_boxMax[i]))
+				contained = false;
+		}
+		if(contained)
+			return;
+	}
+
+	m_boxMin = boxMin;
+	m_boxMax = boxMax;
+	m_boxValid = true;
+}
+
+
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+perform_partitioning(int numTargetProcs, int minLvl, int maxLvl, int partitionLvl,
+					 ANumber aWeight, pcl::ProcessCommunicator com)
+{
+	GDIST_PROFILE_FUNC();
+
+	typedef typename MultiGrid::traits<elem_t>::iterator iter_t;
+
+	MultiGrid&		mg	= *m_mg;
+	SubsetHandler&	sh	= *m_sh;
+	DistributedGridManager* pdgm = mg.distributed_grid_manager();
+
+	Grid::AttachmentAccessor<elem_t, ANumber> aaWeight(mg, aWeight);
+	SetAttachmentValues(aaWeight, mg.begin<elem_t>(partitionLvl),
+						mg.end<elem_t>(partitionLvl), 0);
+
+	vector<int> origSubsetIndices;
+	if(partitionLvl < minLvl){
+		origSubsetIndices.reserve(mg.num<elem_t>(partitionLvl));
+		for(iter_t eiter = mg.begin<elem_t>(partitionLvl);
+			eiter != mg.end<elem_t>(partitionLvl); ++eiter)
+		{
+			origSubsetIndices.push_back(sh.get_subset_index(*eiter));
+		}
+	}
+
+//	invalidate target partitions of all elements in partitionLvl
+	sh.assign_subset(mg.begin<elem_t>(partitionLvl),
+					 mg.end<elem_t>(partitionLvl), -1);
+
+	bool markedElemsOnly = m_balanceWeights->has_level_offsets();
+
+	vector<uint64> cuts;
+	m_entries.reserve(mg.num<elem_t>(partitionLvl));
+
+//	iterate over all levels and gather child-weights in the partitionLvl.
+//	As in Partitioner_DynamicBisection, elements with children in higher
+//	levels are partitioned first.
+	for(int i_lvl = maxLvl; i_lvl >= minLvl;){
+		gather_weights_from_level(partitionLvl, i_lvl, aWeight, markedElemsOnly);
+
+	//	collect elements on partitionLvl which have children in i_lvl but
+	//	have not yet been partitioned.
+		m_entries.clear();
+		for(iter_t eiter = mg.begin<elem_t>(partitionLvl);
+			eiter != mg.end<elem_t>(partitionLvl); ++eiter)
+		{
+			elem_t* elem = *eiter;
+			if((aaWeight[elem] > 0) && (sh.get_subset_index(elem) == -1)
+				&& ((!pdgm) || (!pdgm->is_ghost(elem))))
+			{
+				CurveEntry e;
+				e.key = SpaceFillingCurveIndex<dim>(m_curve,
+									CalculateCenter(elem, m_aaPos),
+									m_boxMin, m_boxMax);
+				e.weight = aaWeight[elem];
+				e.elem = elem;
+				m_entries.push_back(e);
+			}
+		}
+
+		if(!com.empty()){
+			sort(m_entries.begin(), m_entries.end());
+			find_cuts(cuts, m_entries, numTargetProcs, com);
+
+			for(size_t i = 0; i < m_entries.size(); ++i){
+				const CurveEntry& e = m_entries[i];
+				int p = (int)(upper_bound(cuts.begin(), cuts.end(), e.key)
+							  - cuts.begin());
+				sh.assign_subset(e.elem, p);
+			}
+		}
+
+		if(markedElemsOnly)
+			markedElemsOnly = false;
+		else
+			--i_lvl;
+	}
+
+	m_entries.clear();
+
+	if(m_partitionPostProcessor.valid())
+		m_partitionPostProcessor->post_process(partitionLvl);
+
+
+	if(partitionLvl < minLvl){
+		UG_ASSERT(partitionLvl == minLvl - 1,
+				  "partitionLvl and minLvl should be neighbors");
+
+	//	copy subset indices from partition-level to minLvl
+		for(int i = partitionLvl; i < minLvl; ++i){
+			copy_partitions_to_children(sh, i);
+		}
+
+	//	reset partitions in the specified partition-level
+		size_t counter = 0;
+		for(iter_t eiter = mg.begin<elem_t>(partitionLvl);
+			eiter != mg.end<elem_t>(partitionLvl); ++eiter, ++counter)
+		{
+			sh.assign_subset(*eiter, origSubsetIndices[counter]);
+		}
+	}
+	else if(pdgm){
+	//	copy subset indices from vertical slaves to vertical masters,
+	//	since partitioning was only performed on vslaves
+		GridLayoutMap& glm = pdgm->grid_layout_map();
+		ComPol_Subset<layout_t>	compolSHCopy(sh, true);
+
+		if(glm.has_layout<elem_t>(INT_V_SLAVE))
+			m_intfcCom.send_data(glm.get_layout<elem_t>(INT_V_SLAVE).layout_on_level(partitionLvl),
+								 compolSHCopy);
+		if(glm.has_layout<elem_t>(INT_V_MASTER))
+			m_intfcCom.receive_data(glm.get_layout<elem_t>(INT_V_MASTER).layout_on_level(partitionLvl),
+									compolSHCopy);
+		m_intfcCom.communicate();
+	}
+}
+
+
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+find_cuts(std::vector<uint64>& cutsOut, const std::vector<CurveEntry>& entries,
+		  int numTargetProcs, pcl::ProcessCommunicator& com)
+{
+	GDIST_PROFILE_FUNC();
+
+	vector<uint64> keys(entries.size());
+	vector<number> weights(entries.size());
+	for(size_t i = 0; i < entries.size(); ++i){
+		keys[i] = entries[i].key;
+		weights[i] = entries[i].weight;
+	}
+
+	const uint64 keyEnd = (uint64)1 << (dim * SpaceFillingCurveBits<dim>::value);
+	FindSpaceFillingCurveCuts(cutsOut, keys, weights, numTargetProcs,
+							  m_tolerance, keyEnd, com);
+}
+
+
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+copy_partitions_to_children(ISubsetHandler& partitionSH, int lvl)
+{
+	GDIST_PROFILE_FUNC();
+	typedef typename Grid::traits<elem_t>::iterator ElemIter;
+	MultiGrid& mg = *m_mg;
+
+//	assign partitions to all children in this hierarchy level
+	for(ElemIter iter = mg.begin<elem_t>(lvl); iter != mg.end<elem_t>(lvl); ++iter)
+	{
+		size_t numChildren = mg.num_children<elem_t>(*iter);
+		int si = partitionSH.get_subset_index(*iter);
+		for(size_t i = 0; i < numChildren; ++i)
+			partitionSH.assign_subset(mg.get_child<elem_t>(*iter, i), si);
+	}
+
+	if(mg.is_parallel()){
+		GridLayoutMap& glm = mg.distributed_grid_manager()->grid_layout_map();
+	//	communicate partitions from v-masters to v-slaves, since v-slaves
+	//	havn't got no parents on their procs.
+		ComPol_Subset<layout_t>	compolSHCopy(partitionSH, true);
+		if(glm.has_layout<elem_t>(INT_V_MASTER)){
+			m_intfcCom.send_data(glm.get_layout<elem_t>(INT_V_MASTER).layout_on_level(lvl+1),
+								 compolSHCopy);
+		}
+		if(glm.has_layout<elem_t>(INT_V_SLAVE)){
+			m_intfcCom.receive_data(glm.get_layout<elem_t>(INT_V_SLAVE).layout_on_level(lvl+1),
+									compolSHCopy);
+		}
+		m_intfcCom.communicate();
+	}
+}
+
+
+template <class TElem, int dim>
+void Partitioner_SFC<TElem, dim>::
+gather_weights_from_level(int baseLvl, int childLvl, ANumber aWeight,
+						  bool markedElemsOnly)
+{
+	GDIST_PROFILE_FUNC();
+	typedef typename Grid::traits<elem_t>::iterator ElemIter;
+
+	IBalanceWeights& bw = *m_balanceWeights;
+	MultiGrid& mg = *m_mg;
+	Grid::AttachmentAccessor<elem_t, ANumber> aaWeight(mg, aWeight);
+
+	if(childLvl < baseLvl || childLvl >= (int)mg.num_levels()){
+		SetAttachmentValues(aaWeight, mg.begin<elem_t>(baseLvl), mg.end<elem_t>(baseLvl), 0);
+		return;
+	}
+
+	DistributedGridManager* pdgm = mg.distributed_grid_manager();
+
+//	weights of the elements in childLvl. Only unrefined elements which shall be
+//	considered in the level above are relevant if markedElemsOnly is set.
+	for(ElemIter iter = mg.begin<elem_t>(childLvl);
+		iter != mg.end<elem_t>(childLvl); ++iter)
+	{
+		elem_t* e = *iter;
+		if(!markedElemsOnly)
+			aaWeight[e] = bw.get_weight(e);
+		else if((mg.num_children<elem_t>(e) == 0) && !(pdgm && pdgm->is_ghost(e))
+				&& bw.consider_in_level_above(e))
+			aaWeight[e] = bw.get_refined_weight(e);
+		else
+			aaWeight[e] = 0;
+	}
+
+	ComPol_CopyAttachment<layout_t, ANumber> compolCopy(mg, aWeight);
+
+	for(int lvl = childLvl - 1; lvl >= baseLvl; --lvl){
+	//	copy from v-slaves to v-masters
+		if(pdgm){
+			GridLayoutMap& glm = pdgm->grid_layout_map();
+			if(glm.has_layout<elem_t>(INT_V_SLAVE))
+				m_intfcCom.send_data(glm.get_layout<elem_t>(INT_V_SLAVE).layout_on_level(lvl + 1),
+									 compolCopy);
+			if(glm.has_layout<elem_t>(INT_V_MASTER))
+				m_intfcCom.receive_data(glm.get_layout<elem_t>(INT_V_MASTER).layout_on_level(lvl + 1),
+										compolCopy);
+			m_intfcCom.communicate();
+		}
+
+	//	accumulate child weights in parent elements on lvl
+		for(ElemIter iter = mg.begin<elem_t>(lvl); iter != mg.end<elem_t>(lvl); ++iter)
+		{
+			elem_t* e = *iter;
+			size_t numChildren = mg.num_children<elem_t>(e);
+			if(bw.has_level_offsets() && (lvl == childLvl - 1) && (numChildren == 0)
+				&& !(pdgm && pdgm->is_ghost(e)) && bw.consider_in_level_above(e))
+			{
+				aaWeight[e] = bw.get_refined_weight(e);
+			}
+			else{
+				aaWeight[e] = 0;
+				for(size_t i = 0; i < numChildren; ++i)
+					aaWeight[e] += aaWeight[mg.get_child<elem_t>(e, i)];
+			}
+		}
+	}
+}
+
+
+template class Partitioner_SFC<Edge, 1>;
+template class Partitioner_SFC<Edge, 2>;
+template class Partitioner_SFC<Face, 2>;
+template class Partitioner_SFC<Edge, 3>;
+template class Partitioner_SFC<Face, 3>;
+template class Partitioner_SFC<Volume, 3>;
+
+}// end of namespace
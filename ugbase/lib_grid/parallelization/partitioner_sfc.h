@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__partitioner_sfc__
+#define __H__UG__partitioner_sfc__
+
+#include <vector>
+#include "parallel_grid_layout.h"
+#include "partitioner.h"
+#include "lib_grid/algorithms/space_filling_curve_util.h"
+#include "pcl/pcl_interface_communicator.h"
+
+namespace ug{
+
+/// \addtogroup lib_grid_parallelization_distribution
+///	\{
+
+///	Parallel partitioner which cuts a space filling curve into segments of equal weight
+/**	The partitioner can be used inside a LoadBalancer or separately. It can
+ * operate on serial and parallel multigrids.
+ *
+ * The centers of all elements which are to be partitioned are mapped to their
+ * index along a space filling curve (Hilbert by default) through the bounding
+ * box of the grid. The curve is then cut into as many segments as there are
+ * target processes, so that the sum of the balance weights in each segment is
+ * (nearly) the same. Partition i receives the i-th segment of the curve.
+ *
+ * The cut positions are found by a parallel bisection on the curve indices,
+ * which only requires one reduction of numProcs-1 values per iteration. No
+ * element data has to be exchanged between processes.
+ *
+ * Since the order of the elements along the curve does not change between
+ * two runs (at least if the bounding box is fixed, cf. enable_fixed_bounding_box),
+ * repartitioning a slightly imbalanced grid only moves the cut positions.
+ * Only elements close to a cut thus change their partition, which keeps
+ * migration during rebalancing at a minimum. The partitioner therefore
+ * supports repartitioning.
+ *
+ * Process hierarchies are supported in the same way as in
+ * Partitioner_DynamicBisection.
+ */
+template <class TElem, int dim>
+class Partitioner_SFC : public IPartitioner{
+	public:
+		typedef IPartitioner	 						base_class;
+		typedef TElem									elem_t;
+		typedef MathVector<dim>							vector_t;
+		typedef Attachment<vector_t>					apos_t;
+		typedef Grid::VertexAttachmentAccessor<apos_t>	aapos_t;
+		typedef typename GridLayoutMap::Types<elem_t>::Layout::LevelLayout	layout_t;
+
+		Partitioner_SFC();
+		virtual ~Partitioner_SFC();
+
+		void set_grid(MultiGrid* mg, Attachment<MathVector<dim> > aPos);
+
+	///	allows to optionally specify a subset-handler on which the balancer shall operate
+		void set_subset_handler(SmartPtr<SubsetHandler> sh);
+
+	///	sets the space filling curve along which elements are partitioned
+	/**	SFC_HILBERT by default.*/
+		void set_space_filling_curve(SpaceFillingCurve sfc)	{m_curve = sfc;}
+		SpaceFillingCurve space_filling_curve() const		{return m_curve;}
+
+	///	sets the space filling curve by its name ("hilbert" or "morton")
+		void set_curve(const char* name)	{m_curve = SpaceFillingCurveFromString(name);}
+
+	///	sets the tolerance threshold. 1: no tolerance, 0: full tolerance.
+	/**	The search for a cut position stops, as soon as the weight of the
+	 * segment in front of the cut deviates from its optimal value by at most
+	 * (1 - tol) times the average weight per partition. Values below 0.5
+	 * are treated as 0.5, see FindSpaceFillingCurveCuts.
+	 * The tolerance is defaulted to 0.99*/
+		void set_tolerance(number tol)	{m_tolerance = tol;}
+
+	///	if enabled, the bounding box of the first partitioning is reused in later runs
+	/**	A fixed box guarantees that the curve indices of elements do not change
+	 * between subsequent runs, which minimizes migration during rebalancing.
+	 * If the grid grows beyond the stored box, a new box is computed.
+	 * Disabled by default.*/
+		void enable_fixed_bounding_box(bool enable);
+		bool fixed_bounding_box_enabled() const	{return m_fixedBoundingBox;}
+
+		virtual void set_next_process_hierarchy(SPProcessHierarchy procHierarchy);
+		virtual void set_balance_weights(SPBalanceWeights balanceWeights);
+
+		virtual void set_partition_pre_processor(SPPartitionPreProcessor ppp);
+		virtual void set_partition_post_processor(SPPartitionPostProcessor ppp);
+		virtual SPPartitionPreProcessor partition_pre_processor() const		{return m_partitionPreProcessor;}
+		virtual SPPartitionPostProcessor partition_post_processor() const	{return m_partitionPostProcessor;}
+
+		virtual ConstSPProcessHierarchy current_process_hierarchy() const;
+		virtual ConstSPProcessHierarchy next_process_hierarchy() const;
+
+		virtual bool supports_balance_weights() const			{return true;}
+		virtual bool supports_connection_weights() const		{return false;}
+		virtual bool supports_repartitioning() const			{return true;}
+
+		virtual bool partition(size_t baseLvl, size_t elementThreshold);
+
+		virtual SubsetHandler& get_partitions();
+		virtual const std::vector<int>* get_process_map() const;
+
+	private:
+		struct CurveEntry{
+			uint64	key;
+			number	weight;
+			elem_t*	elem;
+
+			bool operator<(const CurveEntry& e) const	{return key < e.key;}
+		};
+
+	///	computes the global bounding box of all vertices of the grid (collective)
+		void update_bounding_box();
+
+		void perform_partitioning(int numTargetProcs, int minLvl, int maxLvl,
+								  int partitionLvl, ANumber aWeight,
+								  pcl::ProcessCommunicator com);
+
+	///	cuts the sorted entries into numTargetProcs segments of similar weight
+	/**	Returns the numTargetProcs - 1 curve indices at which the curve is cut.
+	 * Partition i contains all entries with keys in [cuts[i-1], cuts[i]).*/
+		void find_cuts(std::vector<uint64>& cutsOut,
+					   const std::vector<CurveEntry>& entries,
+					   int numTargetProcs, pcl::ProcessCommunicator& com);
+
+		void copy_partitions_to_children(ISubsetHandler& partitionSH, int lvl);
+
+		void gather_weights_from_level(int baseLvl, int childLvl, ANumber aWeight,
+									   bool markedElemsOnly);
+
+		MultiGrid*								m_mg;
+		apos_t									m_aPos;
+		aapos_t									m_aaPos;
+		SmartPtr<SubsetHandler>					m_sh;
+		SPProcessHierarchy						m_processHierarchy;
+		SPProcessHierarchy						m_nextProcessHierarchy;
+		pcl::InterfaceCommunicator<layout_t>	m_intfcCom;
+		std::vector<CurveEntry>					m_entries;
+
+		SPBalanceWeights						m_balanceWeights;
+		SPPartitionPreProcessor					m_partitionPreProcessor;
+		SPPartitionPostProcessor				m_partitionPostProcessor;
+
+		SpaceFillingCurve	m_curve;
+		number				m_tolerance;
+
+		bool				m_fixedBoundingBox;
+		bool				m_boxValid;
+		vector_t			m_boxMin;
+		vector_t			m_boxMax;
+};
+
+///	\}
+
+}// end of namespace
+
+#endif
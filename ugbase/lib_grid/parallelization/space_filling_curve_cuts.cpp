@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "space_filling_curve_cuts.h"
+#include "common/error.h"
+
+using namespace std;
+
+namespace ug{
+
+void FindSpaceFillingCurveCuts(std::vector<uint64>& cutsOut,
+							   const std::vector<uint64>& keys,
+							   const std::vector<number>& weights,
+							   int numSegments, number tolerance, uint64 keyEnd,
+							   pcl::ProcessCommunicator& com)
+{
+	UG_COND_THROW(keys.size() != weights.size(),
+				  "FindSpaceFillingCurveCuts: number of keys and weights differ.");
+
+	const size_t numCuts = (size_t)max(numSegments - 1, 0);
+	cutsOut.assign(numCuts, 0);
+	if(numCuts == 0)
+		return;
+
+//	prefix sums of the local weights along the curve
+	vector<number> prefix(keys.size() + 1, 0);
+	for(size_t i = 0; i < keys.size(); ++i)
+		prefix[i + 1] = prefix[i] + weights[i];
+
+	const number totalWeight = com.allreduce(prefix.back(), PCL_RO_SUM);
+	if(totalWeight <= 0)
+		return;
+
+//	with a deviation of more than half a segment, the windows of neighbored
+//	cuts would overlap and the cuts could end up in the wrong order.
+	const number avgWeight = totalWeight / (number)numSegments;
+	const number maxDeviation = min<number>(max<number>(0, 1 - tolerance), 0.5)
+								* avgWeight;
+
+//	we search for each cut the smallest curve index, so that the global weight
+//	of all entries in front of it is at least the targeted weight. Since all
+//	processes work on the same reduced values, all take the same decisions.
+	vector<uint64> lo(numCuts, 0);
+	vector<uint64> hi(numCuts, keyEnd);
+	vector<uint64> mid(numCuts, 0);
+	vector<number> localWeights(numCuts);
+	vector<number> globalWeights(numCuts);
+
+	bool searching = true;
+	while(searching){
+		for(size_t i = 0; i < numCuts; ++i){
+			localWeights[i] = 0;
+			if(lo[i] < hi[i]){
+				mid[i] = lo[i] + (hi[i] - lo[i]) / 2;
+				localWeights[i] = prefix[lower_bound(keys.begin(), keys.end(), mid[i])
+										 - keys.begin()];
+			}
+		}
+
+		com.allreduce(&localWeights.front(), &globalWeights.front(), numCuts, PCL_RO_SUM);
+
+		searching = false;
+		for(size_t i = 0; i < numCuts; ++i){
+			if(lo[i] >= hi[i])
+				continue;
+
+			const number targetWeight = avgWeight * (number)(i + 1);
+			if(fabs(globalWeights[i] - targetWeight) <= maxDeviation)
+				lo[i] = hi[i] = mid[i];
+			else if(globalWeights[i] >= targetWeight)
+				hi[i] = mid[i];
+			else
+				lo[i] = mid[i] + 1;
+
+			if(lo[i] < hi[i])
+				searching = true;
+		}
+	}
+
+//	cuts with equal weights in front of them may still be found in any order
+	cutsOut[0] = lo[0];
+	for(size_t i = 1; i < numCuts; ++i)
+		cutsOut[i] = max(lo[i], cutsOut[i - 1]);
+}
+
+}// end of namespace
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__space_filling_curve_cuts__
+#define __H__UG__space_filling_curve_cuts__
+
+#include <vector>
+#include "common/types.h"
+#include "pcl/pcl_process_communicator.h"
+
+namespace ug{
+
+/// \addtogroup lib_grid_parallelization_distribution
+///	\{
+
+///	Finds the positions at which a space filling curve is cut into equally weighted segments.
+/**	The given keys have to be sorted ascending. Each process passes its local
+ * keys and weights, all processes in com receive the same cuts.
+ * Segment i holds all keys in [cutsOut[i-1], cutsOut[i]), i.e. the segment of
+ * a key is given by std::upper_bound(cutsOut.begin(), cutsOut.end(), key).
+ *
+ * The search for a cut stops as soon as the weight in front of it deviates
+ * from its optimal value by at most (1 - tolerance) times the average weight
+ * per segment. Tolerances below 0.5 are treated as 0.5, since the search windows
+ * of neighbored cuts would overlap otherwise. The returned cuts are ascending.
+ *
+ * \param cutsOut		numSegments - 1 cut positions in [0, keyEnd].
+ * \param keyEnd		upper bound for all keys on the curve.*/
+void FindSpaceFillingCurveCuts(std::vector<uint64>& cutsOut,
+							   const std::vector<uint64>& keys,
+							   const std::vector<number>& weights,
+							   int numSegments, number tolerance, uint64 keyEnd,
+							   pcl::ProcessCommunicator& com);
+
+/// \}
+
+}// end of namespace
+
+#endif
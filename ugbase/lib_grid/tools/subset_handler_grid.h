@@ -141,6 +141,13 @@ class UG_API GridSubsetHandler : public ISubsetHandler
 		template <class TElem>
 		void clear_subset_elements(int subsetIndex);
 
+	///	changes the order in which the elements of the given subset are iterated.
+	/**	vNewOrder has to contain each element of the touched sections of the
+	 * subset exactly once (cf. ReorderSectionContainer).
+	 * \sa Grid::reorder_elements*/
+		template <class TElem>
+		void reorder_elements(int subsetIndex, const std::vector<TElem*>& vNewOrder);
+
 	//	geometric-object-collection
 		virtual GridObjectCollection
 		get_grid_objects_in_subset(int subsetIndex) const;
@@ -141,6 +141,23 @@ clear_subset_elements(int subsetIndex)
 	}
 }
 
+template <class TElem>
+void
+GridSubsetHandler::
+reorder_elements(int subsetIndex, const std::vector<TElem*>& vNewOrder)
+{
+	UG_COND_THROW(subsetIndex < 0 || subsetIndex >= (int)num_subsets_in_list(),
+				  "GridSubsetHandler::reorder_elements: bad subset index: " << subsetIndex);
+
+	for(size_t i = 0; i < vNewOrder.size(); ++i){
+		UG_COND_THROW(get_subset_index(vNewOrder[i]) != subsetIndex,
+					  "GridSubsetHandler::reorder_elements: element is not "
+					  "contained in subset " << subsetIndex << ".");
+	}
+
+	ReorderSectionContainer(section_container<TElem>(subsetIndex), vNewOrder);
+}
+
 template <class TElem>
 uint
 GridSubsetHandler::
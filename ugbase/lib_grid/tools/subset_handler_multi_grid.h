@@ -149,6 +149,14 @@ class UG_API MultiGridSubsetHandler : public ISubsetHandler
 		template <class TElem>
 		void clear_subset_elements(int subsetIndex, int level);
 
+	///	changes the order in which the elements of the given subset and level are iterated.
+	/**	vNewOrder has to contain each element of the touched sections of the
+	 * subset on the given level exactly once (cf. ReorderSectionContainer).
+	 * \sa Grid::reorder_elements*/
+		template <class TElem>
+		void reorder_elements(int subsetIndex, int level,
+							  const std::vector<TElem*>& vNewOrder);
+
 	///	returns a GridObjectCollection
 	/**	the returned GridObjectCollection hold the elements of the
 	 *	specified subset on the given level.*/
@@ -151,6 +151,25 @@ clear_subset_elements(int subsetIndex, int level)
 	}
 }
 
+template <class TElem>
+void MultiGridSubsetHandler::
+reorder_elements(int subsetIndex, int level, const std::vector<TElem*>& vNewOrder)
+{
+	UG_COND_THROW(subsetIndex < 0 || subsetIndex >= (int)num_subsets_in_list(),
+				  "MultiGridSubsetHandler::reorder_elements: bad subset index: " << subsetIndex);
+	UG_COND_THROW(level < 0 || level >= (int)num_levels(),
+				  "MultiGridSubsetHandler::reorder_elements: bad level: " << level);
+
+	for(size_t i = 0; i < vNewOrder.size(); ++i){
+		UG_COND_THROW(get_subset_index(vNewOrder[i]) != subsetIndex
+					  || (int)get_level(vNewOrder[i]) != level,
+					  "MultiGridSubsetHandler::reorder_elements: element is not "
+					  "contained in subset " << subsetIndex << " on level " << level << ".");
+	}
+
+	ReorderSectionContainer(section_container<TElem>(subsetIndex, level), vNewOrder);
+}
+
 template <class TElem>
 uint
 MultiGridSubsetHandler::
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__PCL__PCL_INTERFACE_COMMUNICATION_PLAN__
+#define __H__PCL__PCL_INTERFACE_COMMUNICATION_PLAN__
+
+#include <map>
+#include <vector>
+#include "mpi.h"
+#include "common/util/binary_buffer.h"
+#include "pcl_communication_structs.h"
+#include "pcl_interface_communicator.h"
+
+namespace pcl
+{
+
+/// \addtogroup pcl
+/// \{
+
+////////////////////////////////////////////////////////////////////////
+//	InterfaceCommunicationPlan
+///	Reusable exchange of fixed-size interface data between two layouts.
+/**	An InterfaceCommunicator determines the involved processes and the
+ * buffer sizes anew in each communication step. For exchanges that are
+ * repeated many times with the same layouts (e.g. the additive to consistent
+ * conversion of vectors in each iteration of a linear solver) this setup
+ * dominates the cost for small messages.
+ *
+ * The plan caches the neighbor processes and buffer sizes of an exchange
+ * from a send-layout to a receive-layout, allocates the send and receive
+ * buffers once and registers them with persistent MPI requests
+ * (MPI_Send_init / MPI_Recv_init). A communication step then only consists
+ * of collecting the data directly into the registered send buffers,
+ * MPI_Startall, MPI_Waitall and the extraction from the registered receive
+ * buffers.
+ *
+ * This requires that the communication-policy can compute the buffer size
+ * of each interface on both sides, i.e. that
+ * ICommunicationPolicy::get_required_buffer_size returns a value >= 0
+ * (which is the case e.g. for vector entries of fixed size). If this is not
+ * the case, the plan falls back to an internal InterfaceCommunicator.
+ *
+ * The plan is checked against the passed layouts and policy in each step and
+ * is rebuilt automatically if neighbor processes or buffer sizes have
+ * changed. This check does only involve local operations, so that no
+ * additional communication is required. Note however, that all processes
+ * involved in an exchange have to either use a plan or an
+ * InterfaceCommunicator for that exchange, since the plan uses its own tag.
+ *
+ * Copying a plan yields an empty plan with the same tag, since persistent
+ * requests can't be shared. A plan destroyed during a communication (e.g.
+ * while unwinding from an exception between start() and wait()) completes
+ * the pending requests and drops the received data.
+ */
+template <class TLayout>
+class InterfaceCommunicationPlan
+{
+	public:
+	//	typedefs
+		typedef TLayout 					Layout;
+		typedef typename Layout::Interface	Interface;
+
+	protected:
+		typedef ICommunicationPolicy<Layout>	CommPol;
+
+	public:
+		InterfaceCommunicationPlan(int tag = 749346);
+
+		InterfaceCommunicationPlan(const InterfaceCommunicationPlan& plan);
+
+		InterfaceCommunicationPlan& operator=(const InterfaceCommunicationPlan& plan);
+
+		~InterfaceCommunicationPlan();
+
+	///	sends data through sendLayout and receives it through recvLayout
+	/**	Same as calling start() directly followed by wait().*/
+		void communicate(const Layout& sendLayout, const Layout& recvLayout,
+						 CommPol& commPol);
+
+	///	collects the data and starts the communication without waiting for it.
+	/**	The plan is (re-)built if required. A call to start() has to be
+	 * followed by a call to wait(). commPol and recvLayout have to exist
+	 * until wait() returns.*/
+		void start(const Layout& sendLayout, const Layout& recvLayout,
+				   CommPol& commPol);
+
+	///	waits for the communication started by start() and extracts the data
+		void wait();
+
+	///	returns true, if the plan currently holds persistent requests
+		bool is_set_up() const		{return m_bSetUp;}
+
+	///	frees the persistent requests and the buffers of the plan
+	/**	Throws if a communication is pending.*/
+		void clear();
+
+	protected:
+	///	completes a pending communication without extracting the data
+		void discard_pending();
+
+	///	collects the buffer sizes of all non-empty interfaces per process
+	/**	returns false if the size of an interface can't be determined.*/
+		bool collect_buffer_sizes(const Layout& layout, CommPol& commPol,
+								  std::map<int, int>& mapSizesOut,
+								  const layout_tags::single_level_layout_tag&);
+
+		bool collect_buffer_sizes(const Layout& layout, CommPol& commPol,
+								  std::map<int, int>& mapSizesOut,
+								  const layout_tags::multi_level_layout_tag&);
+
+	///	returns true if the plan matches the given sizes
+		bool matches(const std::map<int, int>& mapSendSizes,
+					 const std::map<int, int>& mapRecvSizes) const;
+
+	///	creates buffers and persistent requests for the given sizes
+		void setup(const std::map<int, int>& mapSendSizes,
+				   const std::map<int, int>& mapRecvSizes);
+
+	///	writes the interface data into the registered send buffers
+		void collect(const Layout& layout, CommPol& commPol,
+					 const layout_tags::single_level_layout_tag&);
+
+		void collect(const Layout& layout, CommPol& commPol,
+					 const layout_tags::multi_level_layout_tag&);
+
+	///	reads the interface data from the registered receive buffers
+		void extract(const Layout& layout, CommPol& commPol,
+					 const layout_tags::single_level_layout_tag&);
+
+		void extract(const Layout& layout, CommPol& commPol,
+					 const layout_tags::multi_level_layout_tag&);
+
+	///	returns the buffer associated with the given process
+		ug::BinaryBuffer& buffer(std::vector<int>& vProcs,
+								 std::vector<ug::BinaryBuffer>& vBufs, int proc);
+
+	protected:
+	///	tag used for the persistent requests
+		int	m_tag;
+
+	///	true if persistent requests have been created
+		bool m_bSetUp;
+
+	///	target processes, their buffer sizes and the registered send buffers
+	/**	all three vectors are sorted by process id. The buffers are never
+	 * resized after setup, since their memory is registered with MPI.*/
+		std::vector<int>				m_vSendProcs;
+		std::vector<int>				m_vSendSizes;
+		std::vector<ug::BinaryBuffer>	m_vSendBufs;
+
+	///	source processes, their buffer sizes and the registered receive buffers
+		std::vector<int>				m_vRecvProcs;
+		std::vector<int>				m_vRecvSizes;
+		std::vector<ug::BinaryBuffer>	m_vRecvBufs;
+
+	///	persistent requests. Receives are stored first, then sends.
+		std::vector<MPI_Request>		m_vRequests;
+
+	///	layout and policy of a started communication, used in wait()
+		const Layout*	m_pCurRecvLayout;
+		CommPol*		m_pCurCommPol;
+
+	///	true if the current communication runs through m_fallbackCom
+		bool m_bCurFallback;
+
+	///	used if buffer sizes can't be determined in advance
+		InterfaceCommunicator<Layout>	m_fallbackCom;
+};
+
+// end group pcl
+/// \}
+
+}//	end of namespace pcl
+
+////////////////////////////////////////
+//	include implementation
+#include "pcl_interface_communication_plan_impl.hpp"
+
+#endif
@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__PCL__PCL_INTERFACE_COMMUNICATION_PLAN_IMPL__
+#define __H__PCL__PCL_INTERFACE_COMMUNICATION_PLAN_IMPL__
+
+#include <algorithm>
+#include "pcl_comm_world.h"
+#include "pcl_methods.h"
+#include "pcl_profiling.h"
+#include "common/error.h"
+#include "common/log.h"
+
+namespace pcl
+{
+
+template <class TLayout>
+InterfaceCommunicationPlan<TLayout>::
+InterfaceCommunicationPlan(int tag) :
+	m_tag(tag),
+	m_bSetUp(false),
+	m_pCurRecvLayout(NULL),
+	m_pCurCommPol(NULL),
+	m_bCurFallback(false)
+{
+}
+
+template <class TLayout>
+InterfaceCommunicationPlan<TLayout>::
+InterfaceCommunicationPlan(const InterfaceCommunicationPlan& plan) :
+	m_tag(plan.m_tag),
+	m_bSetUp(false),
+	m_pCurRecvLayout(NULL),
+	m_pCurCommPol(NULL),
+	m_bCurFallback(false)
+{
+}
+
+template <class TLayout>
+InterfaceCommunicationPlan<TLayout>& InterfaceCommunicationPlan<TLayout>::
+operator=(const InterfaceCommunicationPlan& plan)
+{
+	if(this != &plan){
+		clear();
+		m_tag = plan.m_tag;
+	}
+	return *this;
+}
+
+template <class TLayout>
+InterfaceCommunicationPlan<TLayout>::
+~InterfaceCommunicationPlan()
+{
+//	a destructor must not throw, thus a pending communication is finished
+//	here. The policy may already be gone, so nothing is extracted.
+	discard_pending();
+	clear();
+}
+
+template <class TLayout>
+void InterfaceCommunicationPlan<TLayout>::
+discard_pending()
+{
+	if(!m_pCurCommPol)
+		return;
+
+	m_pCurCommPol = NULL;
+	m_pCurRecvLayout = NULL;
+
+	int finalized = 0;
+	MPI_Finalized(&finalized);
+	if(finalized)
+		return;
+
+	if(m_bCurFallback)
+		m_fallbackCom.wait_and_discard();
+	else if(!m_vRequests.empty())
+		pcl::MPI_Waitall((int)m_vRequests.size(), &m_vRequests.front(),
+					MPI_STATUSES_IGNORE);
+}
+
+////////////////////////////////////////////////////////////////////////
+template <class TLayout>
+void InterfaceCommunicationPlan<TLayout>::
+clear()
+{
+	if(m_pCurCommPol){
+		UG_THROW("InterfaceCommunicationPlan: Can't clear the plan while a "
+				 "communication is pending. Call wait() first.");
+	}
+
+	if(m_bSetUp){
+	//	plans may be destroyed with the objects holding them after mpi
+	//	has been finalized. The requests are released by mpi in this case.
+		int finalized = 0;
+		MPI_Finalized(&finalized);
+		if(!finalized){
+			for(size_t i = 0; i < m_vRequests.size(); ++i){
+				if(m_vRequests[i] != MPI_REQUEST_NULL)
+					MPI_Request_free(&m_vRequests[i]);
+			}
+		}
+	}
+
+	m_vRequests.clear();
+	m_vSendProcs.clear();	m_vSendSizes.clear();	m_vSendBufs.clear();
+	m_vRecvProcs.clear();	m_vRecvSizes.clear();	m_vRecvBufs.clear();
+	m_bSetUp = false;
+}
+
+////////////////////////////////////////////////////////////////////////
+template <class TLayout>
+bool InterfaceCommunicationPlan<TLayout>::
+collect_buffer_sizes(const Layout& layout, CommPol& commPol,
+					 std::map<int, int>& mapSizesOut,
+					 const layout_tags::single_level_layout_tag&)
+{
+	for(typename Layout::const_iterator iter = layout.begin();
+		iter != layout.end(); ++iter)
+	{
+		const Interface& interface = layout.interface(iter);
+		if(interface.empty())
+			continue;
+
+		int size = commPol.get_required_buffer_size(interface);
+		if(size < 0)
+			return false;
+		mapSizesOut[layout.proc_id(iter)] += size;
+	}
+	return true;
+}
+
+template <class TLayout>
+bool InterfaceCommunicationPlan<TLayout>::
+collect_buffer_sizes(const Layout& layout, CommPol& commPol,
+					 std::map<int, int>& mapSizesOut,
+					 const layout_tags::multi_level_layout_tag&)
+{
+	for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl)
+	{
+		for(typename Layout::const_iterator iter = layout.begin(lvl);
+			iter != layout.end(lvl); ++iter)
+		{
+			const Interface& interface = layout.interface(iter);
+			if(interface.empty())
+				continue;
+
+			int size = commPol.get_required_buffer_size(interface);
+			if(size < 0)
+				return false;
+			mapSizesOut[layout.proc_id(iter)] += size;
+		}
+	}
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+template <class TLayout>
+bool InterfaceCommunicationPlan<TLayout>::
+matches(const std::map<int, int>& mapSendSizes,
+		const std::map<int, int>& mapRecvSizes) const
+{
+	if(!m_bSetUp
+	   || mapSendSizes.size() != m_vSendProcs.size()
+	   || mapRecvSizes.size() != m_vRecvProcs.size())
+		return false;
+
+	size_t i = 0;
+	for(std::map<int, int>::const_iterator iter = mapSendSizes.begin();
+		iter != mapSendSizes.end(); ++iter, ++i)
+	{
+		if(iter->first != m_vSendProcs[i] || iter->second != m_vSendSizes[i])
+			return false;
+	}
+
+	i = 0;
+	for(std::map<int, int>::const_iterator iter = mapRecvSizes.begin();
+		iter != mapRecvSizes.end(); ++iter, ++i)
+	{
+		if(iter->first != m_vRecvProcs[i] || iter->second != m_vRecvSizes[i])
+			return false;
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+template <class TLayout>
+void InterfaceCommunicationPlan<TLayout>::
+setup(const std::map<int, int>& mapSendSizes,
+	  const std::map<int, int>& mapRecvSizes)
+{
+	PCL_PROFILE(pcl_IntComPlan_setup);
+	clear();
+
+	for(std::map<int, int>::const_iterator iter = mapSendSizes.begin();
+		iter != mapSendSizes.end(); ++iter)
+	{
+		m_vSendProcs.push_back(iter->first);
+		m_vSendSizes.push_back(iter->second);
+	}
+
+	for(std::map<int, int>::const_iterator iter = mapRecvSizes.begin();
+		iter != mapRecvSizes.end(); ++iter)
+	{
+		m_vRecvProcs.push_back(iter->first);
+		m_vRecvSizes.push_back(iter->second);
+	}
+
+//	the buffers are sized once here and never touched again structurally,
+//	since mpi keeps pointers to their memory.
+	m_vSendBufs.resize(m_vSendProcs.size());
+	m_vRecvBufs.resize(m_vRecvProcs.size());
+	m_vRequests.resize(m_vRecvProcs.size() + m_vSendProcs.size(),
+					   MPI_REQUEST_NULL);
+
+	for(size_t i = 0; i < m_vRecvProcs.size(); ++i){
+		m_vRecvBufs[i].reserve(std::max(m_vRecvSizes[i], 1));
+		MPI_Recv_init(m_vRecvBufs[i].buffer(), m_vRecvSizes[i],
+					  MPI_UNSIGNED_CHAR, m_vRecvProcs[i], m_tag,
+					  PCL_COMM_WORLD, &m_vRequests[i]);
+	}
+
+	const size_t sendOffset = m_vRecvProcs.size();
+	for(size_t i = 0; i < m_vSendProcs.size(); ++i){
+		m_vSendBufs[i].reserve(std::max(m_vSendSizes[i], 1));
+		MPI_Send_init(m_vSendBufs[i].buffer(), m_vSendSizes[i],
+					  MPI_UNSIGNED_CHAR, m_vSendProcs[i], m_tag,
+					  PCL_COMM_WORLD, &m_vRequests[sendOffset + i]);
+	}
+
+	m_bSetUp = true;
+	UG_DLOG(ug::LIB_PCL, 1, "InterfaceCommunicationPlan: set up plan with "
+			<< m_vSendProcs.size() << " send- and " << m_vRecvProcs.size()
+			<< " receive-processes.\n");
+}
+
+////////////////////////////////////////////////////////////////////////
+template <class TLayout>
+ug::BinaryBuffer& InterfaceCommunicationPlan<TLayout>::
+buffer(std::vector<int>& vProcs, std::vector<ug::BinaryBuffer>& vBufs, int proc)
+{
+	std::vector<int>::iterator iter =
+			std::lower_bound(vProcs.begin(), vProcs.end(), proc);
+	UG_ASSERT(iter != vProcs.end() && *iter == proc,
+			  "InterfaceCommunicationPlan: process " << proc << " not in plan.");
+	return vBufs[iter - vProcs.begin()];
+}
+
+template <class TLayout>
+void InterfaceCommunicationPlan<TLayout>::
+collect(const Layout& layout, CommPol& commPol,
+		const layout_tags::single_level_layout_tag&)
+{
+	commPol.begin_layout_collection(&layout);
+	for(typename Layout::const_iterator iter = layout.begin();
+		iter != layout.end(); ++iter)
+	{
+		if(!layout.interface(iter).empty())
+			commPol.collect(buffer(m_vSendProcs, m_vSendBufs, layout.proc_id(iter)),
+							layout.interface(iter));
+	}
+	commPol.end_layout_collection(&layout);
+}
+
+template <class TLayout>
+void InterfaceCommunicationPlan<TLayout>::
+collect(const Layout& layout, CommPol& commPol,
+		const layout_tags::multi_level_layout_tag&)
+{
+	commPol.begin_layout_collection(&layout);
+	for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl)
+	{
+		for(typename Layout::const_iterator iter = layout.begin(lvl);
+			iter != layout.end(lvl); ++iter)
+		{
+			if(!layout.interface(iter).empty())
+				commPol.collect(buffer(m_vSendProcs, m_vSendBufs, layout.proc_id(iter)),
+								layout.interface(iter));
+		}
+	}
+	commPol.end_layout_collection(&layout);
+}
+
+template <class TLayout>
+void InterfaceCommunicationPlan<TLayout>::
+extract(const Layout& layout, CommPol& commPol,
+		const layout_tags::single_level_layout_tag&)
+{
+	commPol.begin_layout_extraction(&layout);
+	commPol.begin_level_extraction(0);
+	for(typename Layout::const_iterator iter = layout.begin();
+		iter != layout.end(); ++iter)
+	{
+		if(!layout.interface(iter).empty())
+			commPol.extract(buffer(m_vRecvProcs, m_vRecvBufs, layout.proc_id(iter)),
+							layout.interface(iter));
+	}
+	commPol.end_layout_extraction(&layout);
+}
+
+template <class TLayout>
+void InterfaceCommunicationPlan<TLayout>::
+extract(const Layout& layout, CommPol& commPol,
+		const layout_tags::multi_level_layout_tag&)
+{
+	commPol.begin_layout_extraction(&layout);
+	for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl)
+	{
+		commPol.begin_level_extraction(lvl);
+		for(typename Layout::const_iterator iter = layout.begin(lvl);
+			iter != layout.end(lvl); ++iter)
+		{
+			if(!layout.interface(iter).empty())
+				commPol.extract(buffer(m_vRecvProcs, m_vRecvBufs, layout.proc_id(iter)),
+								layout.interface(iter));
+		}
+	}
+	commPol.end_layout_extraction(&layout);
+}
+
+////////////////////////////////////////////////////////////////////////
+template <class TLayout>
+void InterfaceCommunicationPlan<TLayout>::
+communicate(const Layout& sendLayout, const Layout& recvLayout,
+			CommPol& commPol)
+{
+	start(sendLayout, recvLayout, commPol);
+	wait();
+}
+
+template <class TLayout>
+void InterfaceCommunicationPlan<TLayout>::
+start(const Layout& sendLayout, const Layout& recvLayout, CommPol& commPol)
+{
+	PCL_PROFILE(pcl_IntComPlan_start);
+
+	if(m_pCurCommPol){
+		UG_THROW("InterfaceCommunicationPlan: Can't start a communication since "
+				 "a previous one is still pending. Call wait() after each start().");
+	}
+
+//	determine the current sizes. This is local and cheap compared to the
+//	size exchange an InterfaceCommunicator would have to perform otherwise.
+	std::map<int, int> mapSendSizes, mapRecvSizes;
+	bool bFixed = collect_buffer_sizes(sendLayout, commPol, mapSendSizes,
+									   typename TLayout::category_tag())
+				&& collect_buffer_sizes(recvLayout, commPol, mapRecvSizes,
+									   typename TLayout::category_tag());
+
+	if(!bFixed){
+		m_pCurRecvLayout = &recvLayout;
+		m_pCurCommPol = &commPol;
+		m_bCurFallback = true;
+		m_fallbackCom.send_data(sendLayout, commPol);
+		m_fallbackCom.receive_data(recvLayout, commPol);
+		m_fallbackCom.communicate_and_resume(m_tag);
+		return;
+	}
+
+//	setup clears the old plan, so the communication is marked as pending
+//	only afterwards
+	if(!matches(mapSendSizes, mapRecvSizes))
+		setup(mapSendSizes, mapRecvSizes);
+
+	m_pCurRecvLayout = &recvLayout;
+	m_pCurCommPol = &commPol;
+	m_bCurFallback = false;
+
+//	pack directly into the registered send buffers
+	for(size_t i = 0; i < m_vSendBufs.size(); ++i)
+		m_vSendBufs[i].clear();
+
+	collect(sendLayout, commPol, typename TLayout::category_tag());
+
+	for(size_t i = 0; i < m_vSendBufs.size(); ++i){
+		if((int)m_vSendBufs[i].write_pos() != m_vSendSizes[i]){
+			m_pCurCommPol = NULL;
+			UG_THROW("InterfaceCommunicationPlan: collected " << m_vSendBufs[i].write_pos()
+					 << " bytes for process " << m_vSendProcs[i] << ", but "
+					 "the policy announced " << m_vSendSizes[i] << " bytes.");
+		}
+	}
+
+	if(!m_vRequests.empty())
+		MPI_Startall((int)m_vRequests.size(), &m_vRequests.front());
+}
+
+template <class TLayout>
+void InterfaceCommunicationPlan<TLayout>::
+wait()
+{
+	PCL_PROFILE(pcl_IntComPlan_wait);
+
+	if(!m_pCurCommPol)
+		return;
+
+	CommPol& commPol = *m_pCurCommPol;
+	const Layout& recvLayout = *m_pCurRecvLayout;
+	m_pCurCommPol = NULL;
+	m_pCurRecvLayout = NULL;
+
+	if(m_bCurFallback){
+		m_fallbackCom.wait();
+		return;
+	}
+
+	if(!m_vRequests.empty())
+		pcl::MPI_Waitall((int)m_vRequests.size(), &m_vRequests.front(),
+					MPI_STATUSES_IGNORE);
+
+	for(size_t i = 0; i < m_vRecvBufs.size(); ++i){
+		m_vRecvBufs[i].clear();
+		m_vRecvBufs[i].set_write_pos(m_vRecvSizes[i]);
+	}
+
+	extract(recvLayout, commPol, typename TLayout::category_tag());
+}
+
+}//	end of namespace pcl
+
+#endif
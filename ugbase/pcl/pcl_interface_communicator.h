@@ -241,6 +241,12 @@ class InterfaceCommunicator
 	 *	released. Make sure that you will keep your communication-policies
 	 *	in memory until this point.*/
 		void wait();
+
+	///	waits for the data communicated by communicate_and_resume() and drops it
+	/**	In contrast to wait(), the communication-policies are not called, so
+	 * that they need not exist anymore. This allows an owner to finish a
+	 * pending communication e.g. in its destructor.*/
+		void wait_and_discard();
 	
 
 	///	enables debugging of communication. This has a severe effect on performance!
@@ -738,6 +738,25 @@ wait()
 	m_vReceiveRequests.clear();
 }
 
+template <class TLayout>
+void InterfaceCommunicator<TLayout>::
+wait_and_discard()
+{
+	{
+		PCL_PROFILE(pcl_IntCom_MPIWait);
+		Waitall(m_vReceiveRequests, m_vSendRequests);
+	}
+
+	for(BufferMap::iterator iter = m_bufMapOut.begin();
+		iter != m_bufMapOut.end(); ++iter)
+		iter->second.clear();
+
+	m_curOutProcs.clear();
+	m_extractorInfos.clear();
+	m_vSendRequests.clear();
+	m_vReceiveRequests.clear();
+}
+
 
 
 template <class TLayout>
@@ -314,6 +314,20 @@ class ProcessCommunicator
 		void allreduce(const std::vector<T> &send, std::vector<T> &receive,
 					   pcl::ReduceOperation op) const;
 
+	///	performs a non-blocking MPI_Iallreduce on the processes of the communicator.
+	/**	The reduced values are only available in recBuf after the request
+	 * has been completed, e.g. by pcl::MPI_Wait. sendBuf and recBuf must not
+	 * be accessed until then. If the MPI library does not provide MPI-3,
+	 * a blocking allreduce is performed and req is set to MPI_REQUEST_NULL.*/
+		void iallreduce(const void* sendBuf, void* recBuf, int count,
+						DataType type, ReduceOperation op, MPI_Request& req) const;
+
+	/** simplified non-blocking allreduce for buffers.
+	 * \sa iallreduce*/
+		template<typename T>
+		void iallreduce(const T *pSendBuff, T *pReceiveBuff, size_t count,
+						pcl::ReduceOperation op, MPI_Request& req) const;
+
 
 	/** performs a MPI_Bcast
 	 * @param v		pointer to data
@@ -228,6 +228,15 @@ allreduce(const std::vector<T> &send, std::vector<T> &receive,
 	}
 }
 
+template<typename T>
+void ProcessCommunicator::
+iallreduce(const T *pSendBuff, T *pReceiveBuff, size_t count,
+		   pcl::ReduceOperation op, MPI_Request& req) const
+{
+	iallreduce(pSendBuff, pReceiveBuff, count, DataTypeTraits<T>::get_data_type(),
+			   op, req);
+}
+
 
 
 template<typename T>